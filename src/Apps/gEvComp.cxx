@@ -15,6 +15,8 @@
            [] Denotes an optional argument
            -f Specifies the GENIE/ROOT file with the generated event sample
 	   -r Specifies another GENIE/ROOT event sample file for comparison 
+              Both -f and -r accept a comma-separated list of files
+              (wildcards accepted), which are chained together
            -n Specifies how many events to analyze [default: all]
 
          Notes:
@@ -35,7 +37,6 @@
 */
 //____________________________________________________________________________
 
-#include <cassert>
 #include <sstream>
 #include <string>
 
@@ -43,6 +44,8 @@
 #include <TFile.h>
 #include <TDirectory.h>
 #include <TTree.h>
+#include <TChain.h>
+#include <TObjString.h>
 #include <TVector3.h>
 #include <TLorentzVector.h>
 #include <TPostScript.h>
@@ -57,6 +60,7 @@
 #include <TLegend.h>
 
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCEventScanner.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/Utils/CmdLnArgParser.h"
@@ -70,7 +74,7 @@ using namespace genie;
 // function prototypes
 void   GetCommandLineArgs   (int argc, char ** argv);
 void   PrintSyntax          (void);
-bool   CheckRootFilename    (string filename);
+TChain * OpenSummaryChain  (string filenames);
 string OutputFileName       (string input_file_name);
 void   CreatePlots          (string filename, string filename_ref);
 
@@ -91,24 +95,13 @@ int main(int argc, char ** argv)
 //_________________________________________________________________________________
 void CreatePlots(string inp_filename, string inp_filename_ref)
 {
-  TFile * fin_0 = 0;
-  TFile * fin_1 = 0;
-  TTree * gst_0 = 0;
-  TTree * gst_1 = 0;
+  TChain * gst_0 = OpenSummaryChain(inp_filename);
+  TChain * gst_1 = OpenSummaryChain(inp_filename_ref);
 
-  if(!CheckRootFilename(inp_filename)) {
-    LOG("gevcomp", pERROR) << "Input file: " << inp_filename << " doesn't exist";
+  if(!gst_0) {
+    LOG("gevcomp", pERROR) << "No gst events found in: " << inp_filename;
     return;
   }
-  fin_0 = new TFile(inp_filename.c_str(),"READ");
-  gst_0 = (TTree *) fin_0->Get("gst");
-  assert(gst_0);
-  
-  if(CheckRootFilename(inp_filename_ref)) {
-     fin_1 = new TFile(inp_filename_ref.c_str(),"READ");
-     gst_1 = (TTree *) fin_1->Get("gst");
-     assert(gst_1);
-  }
   
   gst_0->SetLineColor(kBlack);
   gst_0->SetLineWidth(3);
@@ -148,7 +141,8 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   ls->SetFillColor(0);
   ls->SetBorderSize(0);
 
-  string ps_filename = OutputFileName(inp_filename);
+  string ps_filename = OutputFileName(
+     gst_0->GetListOfFiles()->At(0)->GetTitle());
   TPostScript * ps = new TPostScript(ps_filename.c_str(), 111);
   
   //
@@ -1971,12 +1965,8 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
        
   ps->Close();
 
-  fin_0->Close();
-  delete fin_0;
-  if(fin_1) {
-     fin_1->Close();
-     delete fin_1;
-  }
+  delete gst_0;
+  delete gst_1;
 }
 //_________________________________________________________________________________
 string OutputFileName(string inpname)
@@ -2030,17 +2020,33 @@ void PrintSyntax(void)
     << " gevcomp -f sample.root [-n nev] [-r reference_sample.root]\n";
 }
 //_________________________________________________________________________________
-bool CheckRootFilename(string filename)
+TChain * OpenSummaryChain(string filenames)
 {
-  if(filename.size() == 0) return false;
+// Chains the gst trees of all input files (comma-separated list, wildcards
+// accepted). Each plot below is a TTree::Draw pass over the full sample, so
+// the summary branches are read through a TTreeCache.
+
+  if(filenames.size() == 0) return 0;
+
+  TChain * chain = new TChain("gst");
+  TObjArray * tokens = TString(filenames.c_str()).Tokenize(",");
+  for(int i = 0; i < tokens->GetEntriesFast(); i++) {
+    TString filename = ((TObjString *) tokens->At(i))->GetString();
+    if(chain->Add(filename.Data()) == 0) {
+      LOG("gevcomp", pERROR)
+         << "The input ROOT file [" << filename << "] is not accessible";
+    }
+  }
+  delete tokens;
 
-  bool is_accessible = ! (gSystem->AccessPathName(filename.c_str()));
-  if (!is_accessible) {
-   LOG("gevcomp", pERROR)
-       << "The input ROOT file [" << filename << "] is not accessible";
-   return false;
+  if(chain->GetEntries() <= 0) {
+    delete chain;
+    return 0;
   }
-  return true;
+  chain->LoadTree(0);
+  NtpMCEventScanner::EnableReadCache(chain, 30000000);
+
+  return chain;
 }
 //_________________________________________________________________________________
 
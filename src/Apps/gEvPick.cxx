@@ -38,6 +38,7 @@
            gevpick -i list_of_input_files 
                    -t type
                   [-o output_file]
+                  [--workers n]
                   [--message-thresholds xmfile]
                   [--event-record-print-level level]
 
@@ -112,6 +113,11 @@
            -o 
               Specify output filename.
               (optional, default: gntp.<topology>.ghep.root)
+          --workers
+              Number of worker processes scanning the input files in parallel.
+              Each worker writes the events it picked in a temporary file and
+              the temporary files are merged, in input order, at the end.
+              (optional, default: 1)
           --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -146,17 +152,22 @@
 #include <TSystem.h>
 #include <TFile.h>
 #include <TTree.h>
-#include <TChain.h>
-#include <TChainElement.h>
+#include <TObjString.h>
+#include <TMath.h>
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Interaction/InteractionType.h"
+#include "Framework/Interaction/ScatteringType.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCEventScanner.h"
+#include "Framework/Ntuple/NtpMCEventSummary.h"
+#include "Framework/Ntuple/NtpMCEventVisitorI.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -175,7 +186,7 @@ using namespace genie;
 // func prototypes
 void   GetCommandLineArgs (int argc, char ** argv);
 void   RunCherryPicker    (void);
-bool   AcceptEvent        (const EventRecord & event);
+bool   AcceptEvent        (const NtpMCEventSummary & summary);
 void   PrintSyntax        (void);
 string DefaultOutputFile  (void);
 
@@ -214,6 +225,31 @@ typedef enum EGPickType {
 // input options (from command line arguments):
 string      gOptInpFileNames;  ///< input file name
 string      gOptOutFileName;   ///< output file name
+int         gOptNWorkers = 1;  ///< number of worker processes
+
+// event visitor writing out the cherry-picked events
+class CherryPicker : public NtpMCEventVisitorI {
+public:
+  CherryPicker();
+ ~CherryPicker();
+
+  bool     NeedsEventRecord (void) const { return false; }
+  void     BeginWorker      (int iworker, int nworkers);
+  bool     Visit            (NtpMCEventScanner & scanner);
+  void     EndWorker        (int iworker);
+  void     Merge            (int nworkers);
+  Long64_t NPicked          (void) const { return fNPicked; }
+
+private:
+  void   OpenWriter  (string filename);
+  void   CloseWriter (void);
+  string WorkerFile  (int iworker) const;
+
+  NtpWriter *  fWriter;          ///< output event tree writer
+  TObjString * fOrigFilename;    ///< original filename of picked event
+  Long64_t     fOrigEvtNum;      ///< event number in the original file
+  Long64_t     fNPicked;         ///< number of picked events
+};
 string      gPickedTypeStr;    ///< output file name
 GPickType_t gPickedType;       ///< output file format id
 
@@ -231,179 +267,186 @@ int main(int argc, char ** argv)
 }
 //____________________________________________________________________________________
 void RunCherryPicker(void)
+{
+  // Scan the input events. More than one files can be given here if a
+  // wildcard was specified with -i (eg -i "/data/myfiles/genie/*.ghep.root")
+
+  NtpMCEventScanner scanner;
+  scanner.AddFiles(gOptInpFileNames);
+  scanner.SetNWorkers(gOptNWorkers);
+
+  int nfiles = scanner.NFiles();
+  LOG("gevpick", pNOTICE) 
+      << "Processing " << nfiles
+      << (nfiles==1 ? " file " : " files ");
+
+  CherryPicker picker;
+  if(!scanner.Run(picker)) {
+    LOG("gevpick", pFATAL) << "Failed to cherry-pick events";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  
+  LOG("gevpick", pNOTICE) 
+    << "Picked " << picker.NPicked() << " / " << scanner.NEntries() 
+    << " events of type " << gPickedTypeStr;
+  LOG("gevpick", pNOTICE) << "Done!";
+}
+//____________________________________________________________________________________
+CherryPicker::CherryPicker() :
+NtpMCEventVisitorI(),
+fWriter(0),
+fOrigFilename(new TObjString),
+fOrigEvtNum(0),
+fNPicked(0)
+{
+
+}
+//____________________________________________________________________________________
+CherryPicker::~CherryPicker()
+{
+  this->CloseWriter();
+  delete fOrigFilename;
+}
+//____________________________________________________________________________________
+void CherryPicker::OpenWriter(string filename)
 {
   // Create an NtpWriter for writing out a tree with the cherry-picked events
   // Add 2 additional branches to the output event tree to save the original filename
   // and the event number in the original file (so that all info can be traced back 
   // to its source).
 
-  NtpWriter ntpw(kNFGHEP, 0);
-  ntpw.CustomizeFilename(gOptOutFileName);
-  ntpw.Initialize();
-  TObjString* brOrigFilename = new TObjString;
-  Long64_t    brOrigEvtNum;
-  ntpw.EventTree()->Branch("orig_filename", "TObjString", &brOrigFilename, 5000,0);
-  ntpw.EventTree()->Branch("orig_evtnum", &brOrigEvtNum, "brOrigEvtNum/L");
-  Long64_t iev_glob = 0;
+  fWriter = new NtpWriter(kNFGHEP, 0);
+  fWriter->CustomizeFilename(filename);
+  fWriter->Initialize();
+  fWriter->EventTree()->Branch("orig_filename", "TObjString", &fOrigFilename, 5000,0);
+  fWriter->EventTree()->Branch("orig_evtnum", &fOrigEvtNum, "brOrigEvtNum/L");
+  fNPicked = 0;
+}
+//____________________________________________________________________________________
+void CherryPicker::CloseWriter(void)
+{
+  if(!fWriter) return;
+
+  // save the cherry-picked MC events
+  fWriter->Save();
+  delete fWriter;
+  fWriter = 0;
+}
+//____________________________________________________________________________________
+string CherryPicker::WorkerFile(int iworker) const
+{
+  ostringstream fnm;
+  fnm << gOptOutFileName << ".worker" << iworker;
+  return fnm.str();
+}
+//____________________________________________________________________________________
+void CherryPicker::BeginWorker(int iworker, int nworkers)
+{
+  // with a single worker the picked events are written out directly
+  this->OpenWriter( (nworkers == 1) ? gOptOutFileName : this->WorkerFile(iworker) );
+}
+//____________________________________________________________________________________
+bool CherryPicker::Visit(NtpMCEventScanner & scanner)
+{
+  LOG("gevpick", pDEBUG) << scanner.Summary();
 
-  // Load input trees. More than one trees can be loaded here if a wildcard was
-  // specified with -f (eg -f /data/myfiles/genie/*.ghep.root)
+  if(!AcceptEvent(scanner.Summary())) return true;
 
-  TChain gchain;
-  gchain.Add(gOptInpFileNames.c_str());
+  EventRecord * event = scanner.Event();
+  if(!event) {
+    LOG("gevpick", pERROR) << "Null MC record";
+    return false;
+  }
+  LOG("gevpick", pDEBUG) << *event;
 
-  TObjArray * file_array = gchain.GetListOfFiles();
-  int nfiles = file_array->GetEntries();
-  LOG("gevpick", pNOTICE) 
-      << "Processing " << nfiles
-      << (nfiles==1 ? " file " : " files ");
+  fOrigFilename->SetString(scanner.CurrentFile().c_str());
+  fOrigEvtNum = scanner.CurrentEntry();
+  fWriter->AddEventRecord(fNPicked, event);
+  fNPicked++;
 
-  //
-  // Loop over input event files
-  //
+  return true;
+}
+//____________________________________________________________________________________
+void CherryPicker::EndWorker(int /*iworker*/)
+{
+  this->CloseWriter();
+}
+//____________________________________________________________________________________
+void CherryPicker::Merge(int nworkers)
+{
+  if(nworkers == 1) return;
+
+  // Copy the events picked by each worker, in worker order, so that the
+  // output is identical to the one of a serial scan
+
+  this->OpenWriter(gOptOutFileName);
+
+  for(int iw = 0; iw < nworkers; iw++) {
+    string filename = this->WorkerFile(iw);
+    TFile fin(filename.c_str(),"READ");
+    TTree * ghep_tree = (fin.IsZombie()) ? 0 :
+                        dynamic_cast <TTree *> ( fin.Get("gtree") );
+    if(!ghep_tree) {
+      // the merged output would silently miss the events of this worker
+      LOG("gevpick", pFATAL)
+        << "No GHEP tree found in worker output " << filename;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    NtpMCEventRecord * mcrec         = 0;
+    TObjString *       orig_filename = 0;
+    Long64_t           orig_evtnum   = 0;
+    ghep_tree->SetBranchAddress("gmcrec",        &mcrec);
+    ghep_tree->SetBranchAddress("orig_filename", &orig_filename);
+    ghep_tree->SetBranchAddress("orig_evtnum",   &orig_evtnum);
+    NtpMCEventScanner::EnableReadCache(ghep_tree, 30000000);
+
+    Long64_t nev = ghep_tree->GetEntries();
+    for(Long64_t iev = 0; iev < nev; iev++) {
+      ghep_tree->GetEntry(iev);
+      fOrigFilename->SetString(orig_filename->GetString());
+      fOrigEvtNum = orig_evtnum;
+      fWriter->AddEventRecord(fNPicked, mcrec->event);
+      fNPicked++;
+      mcrec->Clear(); // clear out explicitly to prevent memory leak w/Root6
+    }
+    fin.Close();
+    delete mcrec;
+    delete orig_filename;
 
-  TIter next_file(file_array);
-  TChainElement *chEl=0;
-
-  unsigned int total_events  = 0;
-  unsigned int picked_events = 0;
-
-  while (( chEl=(TChainElement*)next_file() )) {
-
-     TFile fin(chEl->GetTitle(),"read");
-     TTree * ghep_tree = 
-        dynamic_cast <TTree *> ( fin.Get("gtree")  );
-
-     if(!ghep_tree) {
-        LOG("gevpick", pWARN) 
-           << "No GHEP tree found in " << chEl->GetTitle();
-        LOG("gevpick", pWARN) 
-           << "Skipping to next file...";
-        continue;
-     }
-
-     NtpMCEventRecord * mcrec = 0;
-     ghep_tree->SetBranchAddress("gmcrec", &mcrec);
-     if (!mcrec) {
-       LOG("gevpick", pERROR) << "Null MC record";
-       return;
-     }
-     Long64_t nmax = ghep_tree->GetEntries();
-     LOG("gevpick", pNOTICE) 
-        << "* Analyzing: " << nmax 
-        << " events from GHEP tree in file: " << chEl->GetTitle();
-
-     NtpMCTreeHeader * thdr = 
-        dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-     LOG("gevpick", pNOTICE) 
-          << "Input tree header: " << *thdr;
-
-     //
-     // Loop over events in current file
-     //
-
-     for(Long64_t iev = 0; iev < nmax; iev++) {
-       total_events++;
-       ghep_tree->GetEntry(iev);
-       NtpMCRecHeader rec_header = mcrec->hdr;
-       EventRecord &  event      = *(mcrec->event);
-       LOG("gevpick", pDEBUG) << rec_header;
-       LOG("gevpick", pDEBUG) << event;
-       if(AcceptEvent(event)) {
-         picked_events++;
-          brOrigFilename->SetString(chEl->GetTitle());
-          brOrigEvtNum = iev;
-          ntpw.AddEventRecord( iev_glob, &event );
-          iev_glob++;
-       }
-       mcrec->Clear();
-
-    } // event loop (current file)
-  }// file loop
+    gSystem->Unlink(filename.c_str());
+  }
 
-  // save the cherry-picked MC events
-  ntpw.Save();
-  
-  LOG("gevpick", pNOTICE) << "Picked " << picked_events << " / " << total_events << " events of type " << gPickedTypeStr;
-  LOG("gevpick", pNOTICE) << "Done!";
+  this->CloseWriter();
 }
 //____________________________________________________________________________________
-bool AcceptEvent(const EventRecord & event)
+bool AcceptEvent(const NtpMCEventSummary & summary)
 {
+// The selection only uses the flat event summary (see NtpMCEventSummary),
+// so the full event record is only read for the events that get picked.
+
   if ( gPickedType == kPtAll       ) return true;
   if ( gPickedType == kPtUndefined ) return false;
 
-  const Interaction * interaction = event.Summary();
-
-  int  nupdg     = event.Probe()->Pdg();
+  int  nupdg     = summary.probe;
   bool isnumu    = (nupdg == kPdgNuMu);
   bool isnumubar = (nupdg == kPdgAntiNuMu);
-  bool iscc      = interaction->ProcInfo().IsWeakCC();
-  bool isnc      = interaction->ProcInfo().IsWeakNC();
-  bool isqe      = interaction->ProcInfo().IsQuasiElastic();
-  bool ismec     = interaction->ProcInfo().IsMEC();
-  bool isstr     = interaction->ExclTag().IsStrangeEvent();
-  bool ischm     = interaction->ExclTag().IsCharmEvent();
-
-  int NfP        = 0; // number of protons         in final state
-  int NfPbar     = 0; // number of anti-protons    in final state
-  int NfN        = 0; // number of neutrons        in final state
-  int NfNbar     = 0; // number of anti-neutrons   in final state
-  int NfPip      = 0; // number of \pi^+'s         in final state
-  int NfPim      = 0; // number of \pi^-'s         in final state
-  int NfPi0      = 0; // number of \pi^0's         in final state
-  int NfKp       = 0; // number of \K^+'s          in final state
-  int NfKm       = 0; // number of \K^-'s          in final state
-  int NfK0       = 0; // number of \K^0's          in final state
-  int NfK0bar    = 0; // number of \bar{\K^0}'s    in final state
-  int NfSigmap   = 0; // number of \Sigma^+'s      in final state
-  int NfSigma0   = 0; // number of \Sigma^0's      in final state
-  int NfSigmam   = 0; // number of \Sigma^-'s      in final state
-  int NfLambda0  = 0; // number of \Lambda^0's     in final state
-  int NfXi0      = 0; // number of \Xi^0's         in final state
-  int NfXim      = 0; // number of \Xi^-'s         in final state
-  int NfOmegam   = 0; // number of \Omega^-'s      in final state
-  int NfOther    = 0; // number of other particles in final state
-
-  TObjArrayIter piter(&event);
-  GHepParticle * p = 0;
-  int ip=-1;
-  while( (p = (GHepParticle *) piter.Next())) {
-    ip++;
-    int pdgc = p->Pdg();
-    int ist  = p->Status();
-    // only final state particles
-    if(ist!=kIStStableFinalState) continue;
-    // don't count final state lepton as part of the hadronic system
-    if(event.Particle(ip)->FirstMother()==0) continue;
-    // skip pseudo-particles
-    if(pdg::IsPseudoParticle(pdgc)) continue;
-    // count ...
-    if      (pdgc == kPdgProton     ) NfP++;
-    else if (pdgc == kPdgAntiProton ) NfPbar++;
-    else if (pdgc == kPdgNeutron    ) NfN++;
-    else if (pdgc == kPdgAntiNeutron) NfNbar++;
-    else if (pdgc == kPdgPiP        ) NfPip++;
-    else if (pdgc == kPdgPiM        ) NfPim++;
-    else if (pdgc == kPdgPi0        ) NfPi0++;
-    else if (pdgc == kPdgKP         ) NfKp++;
-    else if (pdgc == kPdgKM         ) NfKm++;
-    else if (pdgc == kPdgK0         ) NfK0++;
-    else if (pdgc == kPdgAntiK0     ) NfK0bar++;
-    else if (pdgc == kPdgSigmaP     ) NfSigmap++;
-    else if (pdgc == kPdgSigma0     ) NfSigma0++;
-    else if (pdgc == kPdgSigmaM     ) NfSigmam++;
-    else if (pdgc == kPdgLambda     ) NfLambda0++;
-    else if (pdgc == kPdgXi0        ) NfXi0++;
-    else if (pdgc == kPdgXiM        ) NfXim++;
-    else if (pdgc == kPdgOmegaM     ) NfOmegam++;
-    else                              NfOther++;
-  }
+  bool iscc      = (summary.inttype  == kIntWeakCC);
+  bool isnc      = (summary.inttype  == kIntWeakNC);
+  bool isqe      = (summary.scattype == kScQuasiElastic);
+  bool ismec     = (summary.scattype == kScMEC);
+  bool isstr     = (summary.strange  != 0);
+  bool ischm     = (summary.charm    != 0);
+
+  int NfPip      = summary.nfpip; // number of \pi^+'s in final state
+  int NfPim      = summary.nfpim; // number of \pi^-'s in final state
+  int NfPi0      = summary.nfpi0; // number of \pi^0's in final state
 
   bool is1pipX  = (NfPip==1 && NfPi0==0 && NfPim==0);
   bool is1pi0X  = (NfPip==0 && NfPi0==1 && NfPim==0);
   bool is1pimX  = (NfPip==0 && NfPi0==0 && NfPim==1);
-  bool has_hype = (NfSigmap+NfSigma0+NfSigmam+NfLambda0+NfXi0+NfXim+NfOmegam > 0);
+  bool has_hype = (summary.nfhyp > 0);
 
   if ( gPickedType == kPtTopoNumuCC1pip ) {
     if(isnumu && iscc && is1pipX) return true;
@@ -565,12 +608,18 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptOutFileName = DefaultOutputFile();
   }
 
+  // get number of worker processes
+  if( parser.OptionExists("workers") ) {
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  }
+
   // Summarize
   LOG("gevpick", pNOTICE) 
     << "\n\n gevpick job info: "
     << "\n - input file(s)          : " << gOptInpFileNames
     << "\n - output file            : " << gOptOutFileName
     << "\n - cherry-picked topology : " << evtype
+    << "\n - worker processes       : " << gOptNWorkers
     << "\n";
 }
 //____________________________________________________________________________________
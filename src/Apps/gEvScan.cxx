@@ -3,13 +3,19 @@
 
 \program gevscan
 
-\brief   A utility that reads-in a GHEP event tree and performs basic sanity 
+\brief   A utility that reads-in a GHEP event tree and performs basic sanity
          checks / test whether the generated events obey basic conservation laws
 
+         All requested checks are performed in a single pass over the events,
+         which can be split among several worker processes. The results of
+         the workers are merged in input order, so the error log does not
+         depend on the number of workers.
+
 \syntax  gevscan
-             -f ghep_event_file 
+             -f ghep_event_file
             [-o output_error_log_file]
             [-n nev1[,nev2]]
+            [--workers n]
             [--add-event-printout-in-error-log]
             [--max-num-of-errors-shown n]
             [--event-record-print-level level]
@@ -22,6 +28,10 @@
             [--check-decayer-consistency]
             [--all]
 
+         The input can be a comma-separated list of files (wildcards
+         accepted), in which case events are numbered consecutively across
+         the input files.
+
 \author  Costas Andreopoulos <c.andreopoulos \at cern.ch>
  University of Liverpool
 
@@ -29,7 +39,7 @@
 
 \cpright Copyright (c) 2003-2025, The GENIE Collaboration
          For the full text of the license visit http://copyright.genie-mc.org
-         
+
 */
 //____________________________________________________________________________
 
@@ -37,6 +47,7 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include <iomanip>
 #include <sstream>
 #include <fstream>
@@ -45,14 +56,17 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TH1D.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TParameter.h>
 #include <TLorentzVector.h>
+#include <TMath.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
-#include "Framework/Ntuple/NtpMCFormat.h"
-#include "Framework/Ntuple/NtpMCTreeHeader.h"
-#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCEventScanner.h"
+#include "Framework/Ntuple/NtpMCEventVisitorI.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -63,9 +77,11 @@
 #include "Framework/Utils/RunOpt.h"
 
 using std::ostringstream;
+using std::istringstream;
 using std::ofstream;
 using std::string;
 using std::vector;
+using std::map;
 using std::setw;
 using std::setprecision;
 using std::setfill;
@@ -75,40 +91,106 @@ using std::endl;
 using namespace genie;
 using namespace genie::constants;
 
+// checks performed event by event
+typedef enum EEvScanCheck {
+  kChkEnergyMomentumConservation = 0,
+  kChkChargeConservation,
+  kChkPseudoParticlesInFinState,
+  kChkOffMassShellParticlesInFinState,
+  kChkNumFinStateNucleonsInconsistentWithTarget,
+  kNEventChecks
+} EvScanCheck_t;
+
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
 bool CheckRootFilename  (string filename);
 
 // checks
-void CheckEnergyMomentumConservation (void);
-void CheckChargeConservation (void);
-void CheckForPseudoParticlesInFinState (void);
-void CheckForOffMassShellParticlesInFinState (void);
-void CheckForNumFinStateNucleonsInconsistentWithTarget (void);
-void CheckVertexDistribution (void);
-void CheckDecayerConsistency (void);
+bool EventPassesCheck                        (int check, EventRecord & event);
+bool EnergyMomentumConserved                 (EventRecord & event);
+bool ChargeConserved                         (EventRecord & event);
+bool NoPseudoParticlesInFinState             (EventRecord & event);
+bool NoOffMassShellParticlesInFinState       (EventRecord & event);
+bool NumFinStateNucleonsConsistentWithTarget (EventRecord & event);
 
 // options
 string   gOptInpFilename = "";
 string   gOptOutFilename = "";
 Long64_t gOptNEvtL = -1;
 Long64_t gOptNEvtH = -1;
-int      gOptMaxNumErrs = -1; 
+int      gOptNWorkers = 1;
+int      gOptMaxNumErrs = -1;
 bool     gOptAddEventPrintoutInErrLog = false;
-bool     gOptCheckEnergyMomentumConservation = false;
-bool     gOptCheckChargeConservation = false;
-bool     gOptCheckForPseudoParticlesInFinState = false;
-bool     gOptCheckForOffMassShellParticlesInFinState = false;
-bool     gOptCheckForNumFinStateNucleonsInconsistentWithTarget = false;
+bool     gOptCheck[kNEventChecks] = { false, false, false, false, false };
 bool     gOptCheckVertexDistribution = false;
 bool     gOptCheckDecayerConsistency = false;
 
-Long64_t gFirstEventNum = -1;
-Long64_t gLastEventNum  = -1;
-
-TTree *            gEventTree = 0;
-NtpMCEventRecord * gMCRec = 0;
-ofstream           gErrLog;
+ofstream gErrLog;
+int      gParentPid = 0;
+
+const char * kCheckStartMesg[kNEventChecks] = {
+  "Checking energy/momentum conservation...",
+  "Checking charge conservation...",
+  "Checking for pseudo-particles appearing in final state...",
+  "Checking for off-mass-shell particles appearing in the final state...",
+  "Checking for number of final state nucleons inconsistent with target..."
+};
+const char * kCheckErrLogHeader[kNEventChecks] = {
+  "# Events failing the energy-momentum conservation test:",
+  "# Events failing the charge conservation test:",
+  "# Events with pseudo-particles in final state:",
+  "# Events with off-mass-shell particles in final state:",
+  "# Events with number of final state nucleons inconsistent with target:"
+};
+const char * kCheckErrMesg[kNEventChecks] = {
+  " ** Energy-momentum non-conservation in event: ",
+  " ** Charge non-conservation in event: ",
+  " ** Pseudo-particle final state particle in event: ",
+  " ** Off-mass-shell final state particle in event: ",
+  " ** Number of final state nucleons inconsistent with target in event: "
+};
+const char * kCheckSummaryMesg[kNEventChecks] = {
+  " events failing the energy/momentum conservation test",
+  " events failing the charge conservation test",
+  " events with pseudo-particles in  final state",
+  " events with off-mass-shell particles in final state",
+  " events with a number of final state nucleons inconsistent with target"
+};
+
+// event visitor performing all the requested checks
+class EventChecker : public NtpMCEventVisitorI {
+public:
+  EventChecker();
+ ~EventChecker();
+
+  void BeginWorker (int iworker, int nworkers);
+  bool Visit       (NtpMCEventScanner & scanner);
+  void EndWorker   (int iworker);
+  void Merge       (int nworkers);
+
+  //! Write the results in the error log
+  void Report (NtpMCEventScanner & scanner);
+
+private:
+  string WorkerFile               (int iworker) const;
+  void   AddError                 (int check, Long64_t i, EventRecord & event);
+  void   FillVertexDistribution   (EventRecord & event);
+  void   FillDecayerLists         (Long64_t i, EventRecord & event);
+  void   AddFinStateParticle      (int pdgc, Long64_t i);
+  void   AddDecayedParticle       (int pdgc, Long64_t i);
+  void   ReportVertexDistribution (void);
+  void   ReportDecayerConsistency (NtpMCEventScanner & scanner);
+
+  int                 fNWorkers;                 ///< number of worker processes
+  vector<string>      fErrors[kNEventChecks];    ///< error log entries for each check
+  TH1D *              fRDistrMC;                 ///< vertex radial distribution
+  int                 fZ;                        ///< target Z for vertex distribution check
+  int                 fA;                        ///< target A for vertex distribution check
+  PDGCodeList         fFinStateParticles;        ///< particles seen in the final state
+  PDGCodeList         fDecayedParticles;         ///< particles seen to have decayed
+  map<int, Long64_t>  fFirstFinState;            ///< first event with particle in final state
+  map<int, Long64_t>  fFirstDecayed;             ///< first event with particle decayed
+};
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -118,44 +200,27 @@ int main(int argc, char ** argv)
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
-  TFile file(gOptInpFilename.c_str(),"READ");
+  NtpMCEventScanner scanner;
+  scanner.AddFiles(gOptInpFilename);
+  scanner.SetEntryRange(gOptNEvtL, gOptNEvtH);
+  scanner.SetNWorkers(gOptNWorkers);
 
-  NtpMCTreeHeader * thdr = dynamic_cast <NtpMCTreeHeader *> ( file.Get("header") );
-  LOG("gevscan", pINFO) << "Input tree header: " << *thdr;
-  NtpMCFormat_t format = thdr->format;
-  if(format != kNFGHEP) {
-      LOG("gevscan", pERROR) 
-        << "*** Unsupported event-tree format : "
-        << NtpMCFormat::AsString(format);
-      file.Close();
+  if(scanner.NEntries() == 0) {
+    if(gOptNEvtL == -1 && gOptNEvtH == -1) {
+      LOG("gevscan", pERROR)
+        << "*** No GHEP events found in: " << gOptInpFilename;
       return 3;
-  }
-
-  gEventTree = dynamic_cast <TTree *> (file.Get("gtree"));
-  gEventTree->SetBranchAddress("gmcrec", &gMCRec);
-
-  Long64_t nev = gEventTree->GetEntries();
-  if(gOptNEvtL == -1 && gOptNEvtH == -1) {
-    // read all events
-    gFirstEventNum = 0;
-    gLastEventNum  = nev-1;
-  }
-  else {
-    // read a range of events
-    gFirstEventNum = TMath::Max((Long64_t)0,  gOptNEvtL);
-    gLastEventNum = TMath::Min(nev-1,        gOptNEvtH);
-    if(gLastEventNum - gFirstEventNum < 0) {
-      LOG("gevdump", pFATAL) << "Invalid event range";
-      PrintSyntax();
-      gAbortingInErr = true;
-      exit(1);
     }
+    LOG("gevscan", pFATAL) << "Invalid event range";
+    PrintSyntax();
+    gAbortingInErr = true;
+    exit(1);
   }
 
-  
   if(gOptOutFilename.size() == 0) {
      ostringstream logfile;
-     logfile << gOptInpFilename << ".errlog";
+     if(scanner.NFiles() == 1) logfile << scanner.File(0) << ".errlog";
+     else                      logfile << "gevscan.errlog";
      gOptOutFilename = logfile.str();
   }
   if(gOptOutFilename != "none") {
@@ -166,28 +231,27 @@ int main(int argc, char ** argv)
      gErrLog << "# " << endl;
   }
 
-  if (gOptCheckEnergyMomentumConservation) {
-	  CheckEnergyMomentumConservation();
-  }
-  if (gOptCheckChargeConservation) {
-          CheckChargeConservation();
-  }
-  if (gOptCheckForPseudoParticlesInFinState) {
-          CheckForPseudoParticlesInFinState();
-  }
-  if (gOptCheckForOffMassShellParticlesInFinState) {
-          CheckForOffMassShellParticlesInFinState();
-  }
-  if (gOptCheckForNumFinStateNucleonsInconsistentWithTarget) {
-          CheckForNumFinStateNucleonsInconsistentWithTarget();
+  for(int c = 0; c < kNEventChecks; c++) {
+    if(gOptCheck[c]) {
+      LOG("gevscan", pNOTICE) << kCheckStartMesg[c];
+    }
   }
   if (gOptCheckVertexDistribution) {
-          CheckVertexDistribution();
+    LOG("gevscan", pNOTICE) << "Checking intra-nuclear vertex distribution...";
   }
   if (gOptCheckDecayerConsistency) {
-          CheckDecayerConsistency();
+    LOG("gevscan", pNOTICE) << "Checking decayer consistency...";
   }
 
+  gParentPid = gSystem->GetPid();
+
+  EventChecker checker;
+  if(!scanner.Run(checker)) {
+    LOG("gevscan", pFATAL) << "Failed to scan the input events";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  checker.Report(scanner);
 
   if(gOptOutFilename != "none") {
      gErrLog.close();
@@ -196,567 +260,333 @@ int main(int argc, char ** argv)
   return 0;
 }
 //____________________________________________________________________________
-void CheckEnergyMomentumConservation (void)
+EventChecker::EventChecker() :
+NtpMCEventVisitorI(),
+fNWorkers(1),
+fZ(-1),
+fA(-1),
+fFinStateParticles(false),
+fDecayedParticles(false)
 {
-  LOG("gevscan", pNOTICE) << "Checking energy/momentum conservation...";
-
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events failing the energy-momentum conservation test:" << endl;
-    gErrLog << "# " << endl;
+  fRDistrMC = new TH1D("r_distr_mc","",150,0,30); //fm
+  fRDistrMC->SetDirectory(0);
+}
+//____________________________________________________________________________
+EventChecker::~EventChecker()
+{
+  delete fRDistrMC;
+}
+//____________________________________________________________________________
+string EventChecker::WorkerFile(int iworker) const
+{
+  ostringstream filename;
+  filename << gSystem->TempDirectory() << "/gevscan."
+           << gParentPid << ".worker" << iworker << ".root";
+  return filename.str();
+}
+//____________________________________________________________________________
+void EventChecker::BeginWorker(int /*iworker*/, int nworkers)
+{
+  fNWorkers = nworkers;
+}
+//____________________________________________________________________________
+bool EventChecker::Visit(NtpMCEventScanner & scanner)
+{
+  EventRecord * record = scanner.Event();
+  if(!record) {
+    LOG("gevscan", pERROR) << "Null MC record";
+    return false;
   }
+  EventRecord & event = *record;
+  Long64_t i = scanner.GlobalEntry();
 
-  int nerr = 0;
+  LOG("gevscan", pINFO) << "Checking event.... " << i;
 
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    double E_init  = 0, E_fin  = 0; // E
-    double px_init = 0, px_fin = 0; // px
-    double py_init = 0, py_fin = 0; // py
-    double pz_init = 0, pz_fin = 0; // pz
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-      GHepStatus_t ist  = p->Status();
-
-      if(ist == kIStInitialState) 
-      {
-         E_init  += p->E();
-         px_init += p->Px();
-         py_init += p->Py();
-         pz_init += p->Pz();
-       }
-       if(ist == kIStStableFinalState || 
-          ist == kIStFinalStateNuclearRemnant) 
-       {
-         E_fin   += p->E();
-         px_fin  += p->Px();
-         py_fin  += p->Py();
-         pz_fin  += p->Pz();
-       }
-    }//p
-
-    double epsilon = 1E-3; 
-
-    bool E_conserved  = TMath::Abs(E_init  - E_fin)  < epsilon;
-    bool px_conserved = TMath::Abs(px_init - px_fin) < epsilon;
-    bool py_conserved = TMath::Abs(py_init - py_fin) < epsilon;
-    bool pz_conserved = TMath::Abs(pz_init - pz_fin) < epsilon;
-
-    bool ok = E_conserved  && 
-              px_conserved &&
-              py_conserved &&
-              pz_conserved;
-
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Energy-momentum non-conservation in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-           gErrLog << i;
-           if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-           }
-       }
-       nerr++;
+  for(int c = 0; c < kNEventChecks; c++) {
+    if(!gOptCheck[c]) continue;
+    if(gOptMaxNumErrs != -1 && (int)fErrors[c].size() >= gOptMaxNumErrs) continue;
+    if(!EventPassesCheck(c, event)) {
+      this->AddError(c, i, event);
     }
-    
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
   }
-
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events failing the energy/momentum conservation test";
+  if (gOptCheckVertexDistribution) {
+    this->FillVertexDistribution(event);
+  }
+  if (gOptCheckDecayerConsistency) {
+    this->FillDecayerLists(i, event);
+  }
+  return true;
 }
 //____________________________________________________________________________
-void CheckChargeConservation(void)
+void EventChecker::AddError(int check, Long64_t i, EventRecord & event)
 {
-  LOG("gevscan", pNOTICE) << "Checking charge conservation...";
+  LOG("gevscan", pERROR)
+    << kCheckErrMesg[check] << i
+    << "\n"
+    << event;
 
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events failing the charge conservation test:" << endl;
-     gErrLog << "# " << endl;
+  ostringstream err;
+  err << i << endl;
+  if(gOptAddEventPrintoutInErrLog) {
+    err << event;
   }
-
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    // Can't run the test for neutrinos scattered off nuclear targets
-    // because of intranuclear rescattering effects and the presence, in the event
-    // record, of a charged nuclear remnant pseudo-particle whose charge is not stored.
-    // To check charge conservation in the primary interaction, use a sample generated
-    // for a free nucleon targets.
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event in nuclear target - Skipping test...";
-    }
-    else {
-      double Q_init  = 0;
-      double Q_fin   = 0; 
-
-      GHepParticle * p = 0;
-      TIter event_iter(&event);
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-        GHepStatus_t ist  = p->Status();
-
-        if(ist == kIStInitialState) 
-        {
-           Q_init  += p->Charge();
-         }
-         if(ist == kIStStableFinalState)
-         {
-           Q_fin  += p->Charge();
-         }
-      }//p
-
-      double epsilon = 1E-3; 
-      bool ok = TMath::Abs(Q_init - Q_fin)  < epsilon;
-      if(!ok) {
-         LOG("gevscan", pERROR) 
-           << " ** Charge non-conservation in event: " << i 
-           << "\n"
-           << event;
-         if(gErrLog.is_open()) {
-            gErrLog << i << endl;    
-            if(gOptAddEventPrintoutInErrLog) {
-                 gErrLog << event;
-            }
-         }
-         nerr++;
-      }
-      
-    }
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
-  }
-
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events failing the charge conservation test";
+  fErrors[check].push_back(err.str());
 }
 //____________________________________________________________________________
-void CheckForPseudoParticlesInFinState(void)
+void EventChecker::FillVertexDistribution(EventRecord & event)
 {
-  LOG("gevscan", pNOTICE) 
-      << "Checking for pseudo-particles appearing in final state...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events with pseudo-particles in final state:" << endl;
-     gErrLog << "# " << endl;
+  // get target nucleus
+  GHepParticle * nucltgt = event.TargetNucleus();
+  if (!nucltgt) {
+    LOG("gevscan", pINFO)
+         << "Event not in nuclear target - Skipping...";
+    return;
+  }
+  if(fZ == -1 && fA == -1) {
+     fZ = nucltgt->Z();
+     fA = nucltgt->A();
   }
 
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    bool ok = true;
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-      GHepStatus_t ist = p->Status();
-      if(ist != kIStStableFinalState) continue;
-      int pdgc = p->Pdg();      
-      if(pdg::IsPseudoParticle(pdgc))
-      {
-        ok = false;
-        break;
-      }      
-    }//p
-
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Pseudo-particle final state particle in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-          gErrLog << i << endl;    
-          if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-          }
-       }
-       nerr++;
-    }
-
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
+  // this test is run on a MC sample for a given target
+  if(fZ != nucltgt->Z() || fA != nucltgt->A()) {
+    LOG("gevscan", pINFO)
+         << "Event not in nuclear target seen first - Skipping...";
+    return;
   }
+  GHepParticle * probe = event.Particle(0);
+  double r = probe->X4()->Vect().Mag();
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with pseudo-particles in  final state";
+  fRDistrMC->Fill(r);
 }
 //____________________________________________________________________________
-void CheckForOffMassShellParticlesInFinState(void)
+void EventChecker::FillDecayerLists(Long64_t i, EventRecord & event)
 {
-  LOG("gevscan", pNOTICE) 
-      << "Checking for off-mass-shell particles appearing in the final state...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events with off-mass-shell particles in final state:" << endl;
-     gErrLog << "# " << endl;
-  }
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    GHepStatus_t ist = p->Status();
+    int pdgc = p->Pdg();
+    if(ist == kIStStableFinalState) { this->AddFinStateParticle(pdgc, i); }
+    if(ist == kIStDecayedState    ) { this->AddDecayedParticle (pdgc, i); }
+  }//p
+}
+//____________________________________________________________________________
+void EventChecker::AddFinStateParticle(int pdgc, Long64_t i)
+{
+  fFinStateParticles.push_back(pdgc);
+  if(fFirstFinState.find(pdgc) == fFirstFinState.end()) fFirstFinState[pdgc] = i;
+}
+//____________________________________________________________________________
+void EventChecker::AddDecayedParticle(int pdgc, Long64_t i)
+{
+  fDecayedParticles.push_back(pdgc);
+  if(fFirstDecayed.find(pdgc) == fFirstDecayed.end()) fFirstDecayed[pdgc] = i;
+}
+//____________________________________________________________________________
+void EventChecker::EndWorker(int iworker)
+{
+  if(fNWorkers == 1) return;
 
-  int nerr = 0;
+  // Save the results of this worker, to be merged by the parent process
+  TFile fout(this->WorkerFile(iworker).c_str(), "RECREATE");
 
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    bool ok = true;
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-      GHepStatus_t ist = p->Status();
-      if(ist != kIStStableFinalState) continue;
-      if(p->IsOffMassShell())
-      {
-        ok = false;
-        break;
-      }      
-    }//p
-
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Off-mass-shell final state particle in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-          gErrLog << i << endl;    
-          if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-          }
-       }
-       nerr++;
+  for(int c = 0; c < kNEventChecks; c++) {
+    TObjArray errors;
+    errors.SetOwner(true);
+    vector<string>::const_iterator it = fErrors[c].begin();
+    for( ; it != fErrors[c].end(); ++it) {
+      errors.Add(new TObjString(it->c_str()));
     }
+    ostringstream name;
+    name << "errors_" << c;
+    errors.Write(name.str().c_str(), TObject::kSingleKey);
+  }
 
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
+  fRDistrMC->Write("r_distr_mc");
+  TParameter<int> Z("Z", fZ);
+  TParameter<int> A("A", fA);
+  Z.Write();
+  A.Write();
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
+  // the particle lists, in the order the particles were first seen
+  ostringstream decayer;
+  PDGCodeList::const_iterator ip;
+  for(ip = fFinStateParticles.begin(); ip != fFinStateParticles.end(); ++ip) {
+    decayer << "F " << *ip << " " << fFirstFinState[*ip] << endl;
+  }
+  for(ip = fDecayedParticles.begin(); ip != fDecayedParticles.end(); ++ip) {
+    decayer << "D " << *ip << " " << fFirstDecayed[*ip] << endl;
   }
+  TObjString decayer_lists(decayer.str().c_str());
+  decayer_lists.Write("decayer_lists");
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with off-mass-shell particles in final state";
+  fout.Close();
 }
 //____________________________________________________________________________
-void CheckForNumFinStateNucleonsInconsistentWithTarget(void)
+void EventChecker::Merge(int nworkers)
 {
-  LOG("gevscan", pNOTICE) 
-     << "Checking for number of final state nucleons inconsistent with target...";
-
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events with number of final state nucleons inconsistent with target:" << endl;
-    gErrLog << "# " << endl;
-  }
-
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
+  if(nworkers == 1) return;
+
+  for(int iw = 0; iw < nworkers; iw++) {
+    string filename = this->WorkerFile(iw);
+    TFile fin(filename.c_str(), "READ");
+    if(fin.IsZombie()) {
+      LOG("gevscan", pERROR) << "Could not read the output of worker " << iw;
+      continue;
+    }
 
-    // get target nucleus
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (!nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event not in nuclear target - Skipping test...";
+    for(int c = 0; c < kNEventChecks; c++) {
+      ostringstream name;
+      name << "errors_" << c;
+      TObjArray * errors = dynamic_cast<TObjArray *> (fin.Get(name.str().c_str()));
+      if(!errors) continue;
+      errors->SetOwner(true);
+      for(int ie = 0; ie < errors->GetEntriesFast(); ie++) {
+        if(gOptMaxNumErrs != -1 && (int)fErrors[c].size() >= gOptMaxNumErrs) break;
+        TObjString * err = dynamic_cast<TObjString *> (errors->At(ie));
+        if(err) fErrors[c].push_back(err->GetString().Data());
+      }
+      delete errors;
     }
-    else {
-      GHepParticle * p = 0;
-
-      int Z = 0;
-      int N = 0;
-
-      // get number of spectator nucleons 
-      int fd = nucltgt->FirstDaughter();
-      int ld = nucltgt->LastDaughter();
-      for(int d = fd; d <= ld; d++) {
-        p = event.Particle(d);
-        if(!p) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsIon(pdgc)) {
-          Z = p->Z();
-          N = p->A() - p->Z();
-        }
+
+    // the vertex distribution check is meant for a single-target sample:
+    // only add the events in the target seen first
+    TH1D *            r_distr_mc = dynamic_cast<TH1D *>            (fin.Get("r_distr_mc"));
+    TParameter<int> * Z          = dynamic_cast<TParameter<int> *> (fin.Get("Z"));
+    TParameter<int> * A          = dynamic_cast<TParameter<int> *> (fin.Get("A"));
+    if(r_distr_mc && Z && A && Z->GetVal() != -1) {
+      if(fZ == -1 && fA == -1) {
+        fZ = Z->GetVal();
+        fA = A->GetVal();
       }
-      // add nucleons from the primary interaction
-      TIter event_iter(&event);
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-        GHepStatus_t ist = p->Status();
-        if(ist != kIStHadronInTheNucleus) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsProton (pdgc)) { Z++; }
-        if(pdg::IsNeutron(pdgc)) { N++; }
-      }//p
-
-      LOG("gevscan", pINFO)
-         << "Before intranuclear hadron transport: Z = " << Z << ", N = " << N;
-
-      // count final state nucleons
-      int Zf = 0;
-      int Nf = 0;
-      event_iter.Reset();
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-        GHepStatus_t ist = p->Status();
-        if(ist != kIStStableFinalState) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsProton (pdgc)) { Zf++; }
-        if(pdg::IsNeutron(pdgc)) { Nf++; }
+      if(fZ == Z->GetVal() && fA == A->GetVal()) {
+        fRDistrMC->Add(r_distr_mc);
       }
-      LOG("gevscan", pINFO)
-         << "In the final state: Z = " << Zf << ", N = " << Nf;
-
-      bool ok = (Zf <= Z && Nf <= N);
-      if(!ok) {
-         LOG("gevscan", pERROR) 
-           << " ** Number of final state nucleons inconsistent with target in event: " << i 
-           << "\n"
-           << event;
-         if(gErrLog.is_open()) {
-             gErrLog << i << endl;    
-             if(gOptAddEventPrintoutInErrLog) {
-                 gErrLog << event;
-             }
-         }
-         nerr++;
+    }
+    delete Z;
+    delete A;
+
+    TObjString * decayer_lists = dynamic_cast<TObjString *> (fin.Get("decayer_lists"));
+    if(decayer_lists) {
+      istringstream decayer(decayer_lists->GetString().Data());
+      string   list;
+      int      pdgc = 0;
+      Long64_t i    = 0;
+      while(decayer >> list >> pdgc >> i) {
+        if(list == "F") this->AddFinStateParticle(pdgc, i);
+        if(list == "D") this->AddDecayedParticle (pdgc, i);
       }
-    } //nucltgt
-
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
+      delete decayer_lists;
+    }
 
+    fin.Close();
+    gSystem->Unlink(filename.c_str());
+  }
+}
+//____________________________________________________________________________
+void EventChecker::Report(NtpMCEventScanner & scanner)
+{
+  for(int c = 0; c < kNEventChecks; c++) {
+    if(!gOptCheck[c]) continue;
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
+    int nerr = fErrors[c].size();
+    if(gErrLog.is_open()) {
+      gErrLog << kCheckErrLogHeader[c] << endl;
+      gErrLog << "# " << endl;
+      vector<string>::const_iterator it = fErrors[c].begin();
+      for( ; it != fErrors[c].end(); ++it) {
+        gErrLog << *it;
+      }
+      if(nerr == 0) {
+        gErrLog << "none" << endl;
+      }
+    }
+    LOG("gevscan", pNOTICE)
+       << "Found " << nerr << kCheckSummaryMesg[c];
   }
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with a number of final state nucleons inconsistent with target";
+  if (gOptCheckVertexDistribution) {
+    this->ReportVertexDistribution();
+  }
+  if (gOptCheckDecayerConsistency) {
+    this->ReportDecayerConsistency(scanner);
+  }
 }
 //____________________________________________________________________________
-void CheckVertexDistribution(void)
+void EventChecker::ReportVertexDistribution(void)
 {
-  LOG("gevscan", pNOTICE) 
-     << "Checking intra-nuclear vertex distribution...";
-
   if(gErrLog.is_open()) {
     gErrLog << "# Intranuclear vertex distribution check:" << endl;
     gErrLog << "# " << endl;
   }
 
-  TH1D * r_distr_mc       = new TH1D("r_distr_mc","",      150,0,30); //fm
-  TH1D * r_distr_expected = new TH1D("r_distr_expected","",150,0,30); //fm
-
-  int Z = -1;
-  int A = -1;
-
-  // get vertex position distribution
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    // get target nucleus
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (!nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event not in nuclear target - Skipping...";
+  if(fA <= 1) {
+    if(gErrLog.is_open()) {
+      gErrLog << "Can not run test with current sample" << endl;
     }
-    else {
-      if(Z == -1 && A == -1) {
-         Z = nucltgt->Z();
-         A = nucltgt->A();
-      }
-
-      // this test is run on a MC sample for a given target
-      if(Z != nucltgt->Z() || A != nucltgt->A()) {
-        LOG("gevscan", pINFO)
-             << "Event not in nuclear target seen first - Skipping...";
-      }
-      else {
-        GHepParticle * probe = event.Particle(0);
-        double r = probe->X4()->Vect().Mag();
-
-        r_distr_mc->Fill(r);
-      }
-    } //nucltgt
-
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
+    return;
+  }
 
-  }//i
+  TH1D * r_distr_expected = new TH1D("r_distr_expected","",150,0,30); //fm
 
-  if(A > 1) {
-    // get expected vertex position distribution
-    for(int ir = 1; ir <= r_distr_expected->GetNbinsX(); ir++) {
-      double r = r_distr_expected->GetBinCenter(ir);
-      double rho  = utils::nuclear::Density(r,A);
-      double nexp = 4*kPi*r*r*rho;
-      r_distr_expected->SetBinContent(ir,nexp);
-    }
+  // get expected vertex position distribution
+  for(int ir = 1; ir <= r_distr_expected->GetNbinsX(); ir++) {
+    double r = r_distr_expected->GetBinCenter(ir);
+    double rho  = utils::nuclear::Density(r,fA);
+    double nexp = 4*kPi*r*r*rho;
+    r_distr_expected->SetBinContent(ir,nexp);
+  }
 
-    // normalize 
-    double N = r_distr_mc->GetEntries();
-    r_distr_expected -> Scale (N / r_distr_expected -> Integral());
+  // normalize
+  double N = fRDistrMC->GetEntries();
+  r_distr_expected -> Scale (N / r_distr_expected -> Integral());
 
-    // check consistency
-    double pvalue = r_distr_mc->Chi2Test(r_distr_expected,"WWP");
-    LOG("gevscan", pNOTICE) << "p-value {\\chi^2 test} = " << pvalue;
+  // check consistency
+  double pvalue = fRDistrMC->Chi2Test(r_distr_expected,"WWP");
+  LOG("gevscan", pNOTICE) << "p-value {\\chi^2 test} = " << pvalue;
 
-    if(gErrLog.is_open()) {
-       if(pvalue < 0.99) {
-         gErrLog << "Problem! p-value = " << pvalue << endl;    
-       } else {
-         gErrLog << "OK! p-value = " << pvalue << endl;    
-       }
-    }
+  if(gErrLog.is_open()) {
+     if(pvalue < 0.99) {
+       gErrLog << "Problem! p-value = " << pvalue << endl;
+     } else {
+       gErrLog << "OK! p-value = " << pvalue << endl;
+     }
+  }
 
 #ifdef __debug__
-    TFile f("./check_vtx.root","recreate");
-    r_distr_mc -> Write();
-    r_distr_expected -> Write();
-    f.Close();
+  TFile f("./check_vtx.root","recreate");
+  fRDistrMC -> Write();
+  r_distr_expected -> Write();
+  f.Close();
 #endif
 
-  }//A
-  else {
-
-    if(gErrLog.is_open()) {
-      gErrLog << "Can not run test with current sample" << endl;   
-    }
-
-  }
-
+  delete r_distr_expected;
 }
 //____________________________________________________________________________
-void CheckDecayerConsistency(void)
+void EventChecker::ReportDecayerConsistency(NtpMCEventScanner & scanner)
 {
-// Check that particles seen in the final state in some events do not appear to 
+// Check that particles seen in the final state in some events do not appear to
 // have decayed in other events.
 // This might happen if, for example, particle decay flags which are applied to
 // GENIE events do not get applied to intermediate particles appearing in the
 // PYTHIA hadronization. It might also happen if the decayed particle status is
 // used incorrectly in some modules (eg intranuke).
 //
-  LOG("gevscan", pNOTICE) 
-     << "Checking decayer consistency...";
-
   if(gErrLog.is_open()) {
     gErrLog << "# Decayer consistency check:" << endl;
     gErrLog << "# " << endl;
   }
 
-  bool allowdup = false;
-  PDGCodeList final_state_particles(allowdup);
-  PDGCodeList decayed_particles(allowdup);
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-      GHepStatus_t ist = p->Status();
-      int pdgc = p->Pdg();
-      if(ist == kIStStableFinalState) { final_state_particles.push_back(pdgc); }
-      if(ist == kIStDecayedState    ) { decayed_particles.push_back(pdgc);     }
-    }//p
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-  }//i
-
   // find particles which appear in both lists
+  bool allowdup = false;
   PDGCodeList particles_in_both_lists(allowdup);
 
   PDGCodeList::const_iterator iter;
-  for(iter = final_state_particles.begin(); 
-      iter != final_state_particles.end(); ++iter) 
+  for(iter = fFinStateParticles.begin();
+      iter != fFinStateParticles.end(); ++iter)
   {
      int pdgc = *iter;
-     if(decayed_particles.ExistsInPDGCodeList(pdgc)) 
+     if(fDecayedParticles.ExistsInPDGCodeList(pdgc))
      {
         particles_in_both_lists.push_back(pdgc);
      }
@@ -770,71 +600,235 @@ void CheckDecayerConsistency(void)
     ok = false;
     mesg << "Problem!\n" << particles_in_both_lists.size() << " particles seen both final state and to have decayed.";
   }
- 
-  LOG("gevscan", pNOTICE) 
+
+  LOG("gevscan", pNOTICE)
     << mesg.str();
-  LOG("gevscan", pNOTICE) 
-    << "Particles seen in final state: " << final_state_particles;
-  LOG("gevscan", pNOTICE) 
-    << "Particles seen to have decayed: " << decayed_particles;
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
+    << "Particles seen in final state: " << fFinStateParticles;
+  LOG("gevscan", pNOTICE)
+    << "Particles seen to have decayed: " << fDecayedParticles;
+  LOG("gevscan", pNOTICE)
     << "Particles seen in both lists: " << particles_in_both_lists;
 
   if(gErrLog.is_open()) {
      gErrLog << mesg.str() << endl;
-     gErrLog << "\nParticles seen in final state:" << final_state_particles << endl;
-     gErrLog << "\nParticles seen to have decayed:" << decayed_particles << endl;
+     gErrLog << "\nParticles seen in final state:" << fFinStateParticles << endl;
+     gErrLog << "\nParticles seen to have decayed:" << fDecayedParticles << endl;
      gErrLog << "\nParticles seen in both lists:" << particles_in_both_lists << endl;
-   }
+  }
 
-   // find example events
-   if(!ok) {
-      if(gErrLog.is_open()) {
-         gErrLog << "\nExample events: " << endl;          
-      }
-      for(iter  = particles_in_both_lists.begin(); 
-          iter != particles_in_both_lists.end(); ++iter) 
-      {
-         int pdgc_bothlists = *iter;
-         int iev_decay = -1;
-         int iev_fs    = -1;
-         bool have_example = false;
-         for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-         {
-           have_example = (iev_decay != -1 && iev_fs != -1);
-           if(have_example) break;
-
-           gEventTree->GetEntry(i);
-           EventRecord &  event = *(gMCRec->event);
-           GHepParticle * p = 0;
-           TIter event_iter(&event);
-           while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-              int pdgc = p->Pdg();
-              if(pdgc != pdgc_bothlists) continue;
-              GHepStatus_t ist = p->Status();
-              if(ist == kIStStableFinalState && iev_fs    == -1) { iev_fs    = i; }
-              if(ist == kIStDecayedState     && iev_decay == -1) { iev_decay = i; }
-           }//p
-           gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-         }//i
-         if(gErrLog.is_open()) {
-            gErrLog << ">> " << PDGLibrary::Instance()->Find(pdgc_bothlists)->GetName()
-                    << ": Decayed in event " << iev_decay 
-                    << ". Seen in final state in event " << iev_fs << "." << endl;
-            if(gOptAddEventPrintoutInErrLog) {
-               gEventTree->GetEntry(iev_decay);
-               EventRecord & event_dec = *(gMCRec->event);
-               gErrLog << "Event " << iev_decay << ":";
-               gErrLog << event_dec;
-               gEventTree->GetEntry(iev_fs);
-               EventRecord & event_fs = *(gMCRec->event);
-               gErrLog << "Event: " << iev_fs << ":";
-               gErrLog << event_fs;
-            }
-         }
-      }//pdgc
-   }//!ok
+  // example events (the first events where the particle was seen in the
+  // final state / to have decayed, recorded during the scan)
+  if(ok || !gErrLog.is_open()) return;
+
+  gErrLog << "\nExample events: " << endl;
+  for(iter  = particles_in_both_lists.begin();
+      iter != particles_in_both_lists.end(); ++iter)
+  {
+     int pdgc_bothlists = *iter;
+     Long64_t iev_decay = fFirstDecayed [pdgc_bothlists];
+     Long64_t iev_fs    = fFirstFinState[pdgc_bothlists];
+     gErrLog << ">> " << PDGLibrary::Instance()->Find(pdgc_bothlists)->GetName()
+             << ": Decayed in event " << iev_decay
+             << ". Seen in final state in event " << iev_fs << "." << endl;
+     if(gOptAddEventPrintoutInErrLog) {
+        EventRecord * event_dec = scanner.ReadEvent(iev_decay);
+        if(event_dec) {
+          gErrLog << "Event " << iev_decay << ":";
+          gErrLog << *event_dec;
+        }
+        EventRecord * event_fs = scanner.ReadEvent(iev_fs);
+        if(event_fs) {
+          gErrLog << "Event: " << iev_fs << ":";
+          gErrLog << *event_fs;
+        }
+     }
+  }//pdgc
+}
+//____________________________________________________________________________
+bool EventPassesCheck(int check, EventRecord & event)
+{
+  switch(check) {
+    case kChkEnergyMomentumConservation:
+       return EnergyMomentumConserved(event);
+    case kChkChargeConservation:
+       return ChargeConserved(event);
+    case kChkPseudoParticlesInFinState:
+       return NoPseudoParticlesInFinState(event);
+    case kChkOffMassShellParticlesInFinState:
+       return NoOffMassShellParticlesInFinState(event);
+    case kChkNumFinStateNucleonsInconsistentWithTarget:
+       return NumFinStateNucleonsConsistentWithTarget(event);
+    default:
+       break;
+  }
+  return true;
+}
+//____________________________________________________________________________
+bool EnergyMomentumConserved(EventRecord & event)
+{
+  double E_init  = 0, E_fin  = 0; // E
+  double px_init = 0, px_fin = 0; // px
+  double py_init = 0, py_fin = 0; // py
+  double pz_init = 0, pz_fin = 0; // pz
+
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+
+    GHepStatus_t ist  = p->Status();
+
+    if(ist == kIStInitialState)
+    {
+       E_init  += p->E();
+       px_init += p->Px();
+       py_init += p->Py();
+       pz_init += p->Pz();
+     }
+     if(ist == kIStStableFinalState ||
+        ist == kIStFinalStateNuclearRemnant)
+     {
+       E_fin   += p->E();
+       px_fin  += p->Px();
+       py_fin  += p->Py();
+       pz_fin  += p->Pz();
+     }
+  }//p
+
+  double epsilon = 1E-3;
+
+  bool E_conserved  = TMath::Abs(E_init  - E_fin)  < epsilon;
+  bool px_conserved = TMath::Abs(px_init - px_fin) < epsilon;
+  bool py_conserved = TMath::Abs(py_init - py_fin) < epsilon;
+  bool pz_conserved = TMath::Abs(pz_init - pz_fin) < epsilon;
+
+  return E_conserved  &&
+         px_conserved &&
+         py_conserved &&
+         pz_conserved;
+}
+//____________________________________________________________________________
+bool ChargeConserved(EventRecord & event)
+{
+  // Can't run the test for neutrinos scattered off nuclear targets
+  // because of intranuclear rescattering effects and the presence, in the event
+  // record, of a charged nuclear remnant pseudo-particle whose charge is not stored.
+  // To check charge conservation in the primary interaction, use a sample generated
+  // for a free nucleon targets.
+  GHepParticle * nucltgt = event.TargetNucleus();
+  if (nucltgt) {
+    LOG("gevscan", pINFO)
+         << "Event in nuclear target - Skipping test...";
+    return true;
+  }
+
+  double Q_init  = 0;
+  double Q_fin   = 0;
+
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+
+    GHepStatus_t ist  = p->Status();
+
+    if(ist == kIStInitialState)
+    {
+       Q_init  += p->Charge();
+     }
+     if(ist == kIStStableFinalState)
+     {
+       Q_fin  += p->Charge();
+     }
+  }//p
+
+  double epsilon = 1E-3;
+  return TMath::Abs(Q_init - Q_fin)  < epsilon;
+}
+//____________________________________________________________________________
+bool NoPseudoParticlesInFinState(EventRecord & event)
+{
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
 
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStStableFinalState) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsPseudoParticle(pdgc)) return false;
+  }//p
+
+  return true;
+}
+//____________________________________________________________________________
+bool NoOffMassShellParticlesInFinState(EventRecord & event)
+{
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStStableFinalState) continue;
+    if(p->IsOffMassShell()) return false;
+  }//p
+
+  return true;
+}
+//____________________________________________________________________________
+bool NumFinStateNucleonsConsistentWithTarget(EventRecord & event)
+{
+  // get target nucleus
+  GHepParticle * nucltgt = event.TargetNucleus();
+  if (!nucltgt) {
+    LOG("gevscan", pINFO)
+         << "Event not in nuclear target - Skipping test...";
+    return true;
+  }
+
+  GHepParticle * p = 0;
+
+  int Z = 0;
+  int N = 0;
+
+  // get number of spectator nucleons
+  int fd = nucltgt->FirstDaughter();
+  int ld = nucltgt->LastDaughter();
+  for(int d = fd; d <= ld; d++) {
+    p = event.Particle(d);
+    if(!p) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsIon(pdgc)) {
+      Z = p->Z();
+      N = p->A() - p->Z();
+    }
+  }
+  // add nucleons from the primary interaction
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStHadronInTheNucleus) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsProton (pdgc)) { Z++; }
+    if(pdg::IsNeutron(pdgc)) { N++; }
+  }//p
+
+  LOG("gevscan", pINFO)
+     << "Before intranuclear hadron transport: Z = " << Z << ", N = " << N;
+
+  // count final state nucleons
+  int Zf = 0;
+  int Nf = 0;
+  event_iter.Reset();
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStStableFinalState) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsProton (pdgc)) { Zf++; }
+    if(pdg::IsNeutron(pdgc)) { Nf++; }
+  }
+  LOG("gevscan", pINFO)
+     << "In the final state: Z = " << Zf << ", N = " << Nf;
+
+  return (Zf <= Z && Nf <= N);
 }
 //____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
@@ -844,13 +838,13 @@ void GetCommandLineArgs(int argc, char ** argv)
   RunOpt::Instance()->ReadFromCommandLine(argc,argv);
 
   CmdLnArgParser parser(argc,argv);
-  
+
   // get input GENIE event sample
   if( parser.OptionExists('f') ) {
     LOG("gevscan", pINFO) << "Reading event sample filename";
     gOptInpFilename = parser.ArgAsString('f');
   } else {
-    LOG("gevscan", pFATAL) 
+    LOG("gevscan", pFATAL)
         << "Unspecified input filename - Exiting";
     PrintSyntax();
     exit(1);
@@ -860,7 +854,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   if( parser.OptionExists('o') ) {
     LOG("gevscan", pINFO) << "Reading err log file name";
     gOptOutFilename = parser.ArgAsString('o');
-  } 
+  }
 
   // number of events
   if ( parser.OptionExists('n') ) {
@@ -889,6 +883,11 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptNEvtH = -1;
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  }
+
   gOptAddEventPrintoutInErrLog =
      parser.OptionExists("add-event-printout-in-error-log");
 
@@ -896,19 +895,19 @@ void GetCommandLineArgs(int argc, char ** argv)
      gOptMaxNumErrs = parser.ArgAsInt("max-num-of-errors-shown");
      gOptMaxNumErrs = TMath::Max(1,gOptMaxNumErrs);
   }
-  
+
   bool all = parser.OptionExists("all");
 
   // checks
-  gOptCheckEnergyMomentumConservation = all ||
+  gOptCheck[kChkEnergyMomentumConservation] = all ||
      parser.OptionExists("check-energy-momentum-conservation");
-  gOptCheckChargeConservation = all || 
+  gOptCheck[kChkChargeConservation] = all ||
      parser.OptionExists("check-charge-conservation");
-  gOptCheckForNumFinStateNucleonsInconsistentWithTarget = all ||
+  gOptCheck[kChkNumFinStateNucleonsInconsistentWithTarget] = all ||
      parser.OptionExists("check-for-num-of-final-state-nucleons-inconsistent-with-target");
-  gOptCheckForPseudoParticlesInFinState = all ||
+  gOptCheck[kChkPseudoParticlesInFinState] = all ||
      parser.OptionExists("check-for-pseudoparticles-in-final-state");
-  gOptCheckForOffMassShellParticlesInFinState = all ||
+  gOptCheck[kChkOffMassShellParticlesInFinState] = all ||
      parser.OptionExists("check-for-off-mass-shell-particles-in-final-state");
   gOptCheckVertexDistribution = all ||
      parser.OptionExists("check-vertex-distribution");
@@ -920,20 +919,19 @@ void PrintSyntax(void)
 {
   LOG("gevscan", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevscan -f sample.root [-n n1[,n2]] [-o errlog] [check names]\n";
+    << " gevscan -f sample.root [-n n1[,n2]] [-o errlog] [--workers n] [check names]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
 {
   if(filename.size() == 0) return false;
-    
+
   bool is_accessible = ! (gSystem->AccessPathName(filename.c_str()));
   if (!is_accessible) {
-   LOG("gevscan", pERROR)  
+   LOG("gevscan", pERROR)
        << "The input ROOT file [" << filename << "] is not accessible";
    return false;
   }
   return true;
 }
 //_________________________________________________________________________________
-
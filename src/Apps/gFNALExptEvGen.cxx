@@ -309,6 +309,7 @@
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
 #include "Framework/EventGen/GMCJMonitor.h"
@@ -778,7 +779,7 @@ int main(int argc, char ** argv)
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
-     delete event;
+     EventRecordPool::Instance()->Release(event);
      ievent++;
 
   } //1
@@ -0,0 +1,117 @@
+//____________________________________________________________________________
+/*!
+
+\program ght2bin
+
+\brief   Utility converting hadron tensor tables (as used by the Nieves and
+         SuSAv2 MEC / QE hadron tensor models) from the text format to the
+         binary format that can be memory-mapped at start-up.
+
+         Syntax :
+           ght2bin -f input_file[,input_file,...] [-o output_file]
+
+         Options :
+           []  denotes an optional argument
+
+           -f
+              comma-separated list of hadron tensor tables in the text format
+           -o
+              output file name (only valid for a single input file)
+              [default: input file name + ".bin"]
+
+         The hadron tensor models look for a converted table named after the
+         original one with a ".bin" suffix and, if present, load it instead
+         of the text table. A converted table remembers the size and
+         modification time of its text table and is ignored, with a warning,
+         once the text table changes. So the simplest way to use this
+         utility is:
+
+           shell$ for f in $GENIE/data/evgen/hadron_tensors/nieves/*.dat; do
+                    ght2bin -f $f; done
+
+\author  The GENIE Collaboration
+
+\created October 18, 2026
+
+\cpright Copyright (c) 2003-2025, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/HadronTensors/TabulatedLabFrameHadronTensor.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+vector<string> gOptInpFiles;
+string         gOptOutFile;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  int nfailed = 0;
+
+  for(unsigned int i = 0; i < gOptInpFiles.size(); i++) {
+    string inp = gOptInpFiles[i];
+    string out = (gOptOutFile.size() > 0) ? gOptOutFile : inp + ".bin";
+
+    if( TabulatedLabFrameHadronTensor::IsBinaryTable(inp) ) {
+      LOG("ght2bin", pWARN) << inp << " is already in the binary format";
+      continue;
+    }
+
+    TabulatedLabFrameHadronTensor tensor(inp);
+    if( tensor.WriteBinaryTable(out) ) {
+      LOG("ght2bin", pNOTICE) << "Converted " << inp << " -> " << out;
+    } else {
+      LOG("ght2bin", pERROR) << "Failed to write " << out;
+      nfailed++;
+    }
+  }
+
+  return (nfailed == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('f') ) {
+    gOptInpFiles = parser.ArgAsStringTokens('f', ",");
+  } else {
+    LOG("ght2bin", pFATAL) << "No input hadron tensor table was specified";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+    if( gOptInpFiles.size() > 1 ) {
+      LOG("ght2bin", pFATAL)
+        << "An output file name can only be given for a single input file";
+      PrintSyntax();
+      exit(1);
+    }
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("ght2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   ght2bin -f input_file[,input_file,...] [-o output_file]\n";
+}
+//____________________________________________________________________________
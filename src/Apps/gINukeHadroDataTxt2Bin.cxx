@@ -0,0 +1,98 @@
+//____________________________________________________________________________
+/*!
+
+\program ginuke2bin
+
+\brief   Utility converting the hadron x-section data used by INTRANUKE
+         (hA2018 / hN2018) from the text / ntuple files to a single binary
+         dataset, which is read channel by channel, on demand, at run time.
+
+         Syntax :
+           ginuke2bin [-o output_file]
+
+         Options :
+           []  denotes an optional argument
+
+           -o
+              output file name
+              [default: intranuke-hadro-data-2018.bin in the INTRANUKE data
+               directory, ie $GINUKEHADRONDATA or $GENIE/data/evgen/intranuke]
+
+         INukeHadroData2018 looks for the binary dataset, with its default
+         name, in the INTRANUKE data directory and, if present and valid,
+         uses it instead of the text files. Each channel record carries an
+         MD5 checksum and the size and modification time of the text files
+         it was made from, which are verified when the channel is first
+         loaded; a channel whose text files changed since is read from the
+         text files. Re-run this utility whenever the text files are updated.
+
+\author  The GENIE Collaboration
+
+\created October 18, 2026
+
+\cpright Copyright (c) 2003-2025, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include <TSystem.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/HadronTransport/INukeHadroData2018.h"
+
+using std::string;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+string gOptOutFile;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  string out = gOptOutFile;
+  if(out.size() == 0) {
+    string data_dir = (gSystem->Getenv("GINUKEHADRONDATA")) ?
+             string(gSystem->Getenv("GINUKEHADRONDATA")) :
+             string(gSystem->Getenv("GENIE")) + string("/data/evgen/intranuke");
+    out = data_dir + "/" + INukeHadroData2018::BinaryDatasetName();
+  }
+
+  if( INukeHadroData2018::Instance()->WriteBinaryDataset(out) ) {
+    LOG("ginuke2bin", pNOTICE) << "Wrote the INTRANUKE hadron dataset: " << out;
+    return 0;
+  }
+
+  LOG("ginuke2bin", pERROR) << "Failed to write " << out;
+  return 1;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("ginuke2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   ginuke2bin [-o output_file]\n";
+}
+//____________________________________________________________________________
@@ -9,6 +9,7 @@
          Syntax:
            gntpc -i input_file [-o output_file] -f format [-n nev] [-v vrs] [-c] 
                  [--seed random_number_seed]
+                 [--workers n]
                  [--message-thresholds xml_file]
                  [--event-record-print-level level]
 
@@ -91,6 +92,14 @@
                `ginuke'               -> *.ginuke.root
            --seed
               Random number seed.
+           --workers
+              Number of worker processes converting events in parallel
+              (optional, default: 1). Each worker converts a contiguous range
+              of input events into its own output file and the worker outputs
+              are merged, in worker order, into the requested output file.
+              The output is identical to the one of a single process, except
+              for the random K0 -> K0_{long}, K0_{short} conversion of the
+              `t2k_tracker' format, where each worker uses its own seed.
          --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -124,6 +133,7 @@
 #include <iomanip>
 #include <vector>
 #include <algorithm>
+#include <functional>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -131,6 +141,7 @@
 #include <TSystem.h>
 #include <TFile.h>
 #include <TTree.h>
+#include <TChain.h>
 #include <TFolder.h>
 #include <TBits.h>
 #include <TObjString.h>
@@ -147,6 +158,8 @@
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCEventScanner.h"
+#include "Framework/Ntuple/NtpMCEventVisitorI.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Messenger/Messenger.h"
@@ -172,6 +185,7 @@
 
 using std::string;
 using std::ostringstream;
+using std::ifstream;
 using std::ofstream;
 using std::endl;
 using std::setw;
@@ -192,6 +206,12 @@ void   ConvertToGTracker         (void);
 void   ConvertToGRooTracker      (void);
 void   ConvertToGHad             (void);
 void   ConvertToGINuke           (void);
+class  FormatConverter;
+void   RunConverter              (FormatConverter & converter);
+void   MergeTextFiles            (int nworkers);
+void   MergeTreeFiles            (int nworkers, string treename);
+void   CopyJobMeta               (TFile & fin);
+void   ReadPassThroughBranches   (NtpMCEventScanner & scanner);
 void   GetCommandLineArgs        (int argc, char ** argv);
 void   PrintSyntax               (void);
 string DefaultOutputFile         (void);
@@ -199,8 +219,8 @@ int    LatestFormatVersionNumber (void);
 bool   CheckRootFilename         (string filename);
 int    HAProbeFSI                (int, int, int, double [], int [], int, int, int); //Test code
 #ifdef __GENIE_HEAVY_NEUTRAL_LEPTON_ENABLED__
-void   DeclareHNLBranches        (TTree * tree, TTree * intree, 
-				  double * dVars, int * iVars);
+void   DeclareHNLBranches        (TTree * tree, double * dVars, int * iVars);
+void   SetHNLBranchAddresses     (TTree * intree, double * dVars, int * iVars);
 #endif // #ifdef __GENIE_HEAVY_NEUTRAL_LEPTON_ENABLED__
 //format enum
 typedef enum EGNtpcFmt {
@@ -226,6 +246,7 @@ int        gOptVersion;             ///< output file format version
 Long64_t   gOptN;                   ///< number of events to process
 bool       gOptCopyJobMeta = false; ///< copy MC job metadata (gconfig, genv TFolders)
 long int   gOptRanSeed;             ///< random number seed
+int        gOptNWorkers = 1;        ///< number of worker processes
 
 //genie version used to generate the input event file 
 int gFileMajorVrs = -1;
@@ -234,6 +255,37 @@ int gFileRevisVrs = -1;
 
 //consts
 const int kNPmax = 250;
+
+//event visitor running the conversion code of the selected format.
+//The converters set up the output of each worker in Open(), convert the
+//current event in Convert() and finish the worker output in Close().
+//When the conversion is split among several workers, Join() merges the
+//worker outputs, in worker order, into the requested output file.
+class FormatConverter : public NtpMCEventVisitorI {
+public:
+  FormatConverter() : fIWorker(0), fNWorkers(1) { }
+
+  std::function<void (string)>              Open;    ///< argument: output file
+  std::function<bool (NtpMCEventScanner &)> Convert;
+  std::function<void (void)>                Close;
+  std::function<void (int)>                 Join;    ///< argument: number of workers
+
+  void BeginWorker (int iworker, int nworkers);
+  bool Visit       (NtpMCEventScanner & scanner) { return Convert(scanner); }
+  void EndWorker   (int /*iworker*/) { Close(); }
+  void Merge       (int nworkers) { if(nworkers > 1) Join(nworkers); }
+
+  int  IWorker     (void) const { return fIWorker;  }
+  int  NWorkers    (void) const { return fNWorkers; }
+  bool FirstWorker (void) const { return fIWorker == 0; }
+  bool LastWorker  (void) const { return fIWorker == fNWorkers-1; }
+
+  static string WorkerFile (int iworker);
+
+private:
+  int fIWorker;   ///< current worker
+  int fNWorkers;  ///< number of workers
+};
 //____________________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -416,9 +468,11 @@ void ConvertToGST(void)
   //
   LOG("gntpc", pNOTICE) 
        << "*** Saving summary tree to: " << gOptOutFileName;
-  TFile fout(gOptOutFileName.c_str(),"recreate");
+  TFile * fout = 0;
 
+  // The tree is moved to the output file of each worker once opened
   TTree * s_tree = new TTree("gst","GENIE Summary Event Tree");
+  s_tree->SetDirectory(0);
 
   // Create tree branches
   //
@@ -522,41 +576,29 @@ void ConvertToGST(void)
   s_tree->Branch("DXSec",         &brDXSec,	    "DXSec/D"    );
   s_tree->Branch("KPS",          &brKPS,	    "KPS/i"    );
 
-  // Open the ROOT file and get the TTree & its header
+  // Open the ROOT file and get the TTree header
   TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           er_tree = 0;
-  NtpMCTreeHeader * thdr    = 0;
-  er_tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr    = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-  if (!er_tree) {
-    LOG("gntpc", pERROR) << "Null input GHEP event tree";
+  NtpMCTreeHeader * thdr = 
+     dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  if (!thdr) {
+    LOG("gntpc", pERROR) << "Null input GHEP tree header";
     return;
   }
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
-  // Get the mc record
-  NtpMCEventRecord * mcrec = 0;
-  er_tree->SetBranchAddress("gmcrec", &mcrec);
-  if (!mcrec) {
-    LOG("gntpc", pERROR) << "Null MC record";
-    return;
-  }
-  
-  // Figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
+  TLorentzVector pdummy(0,0,0,0);
 
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  FormatConverter converter;
 
-  TLorentzVector pdummy(0,0,0,0);
+  converter.Open = [&](string filename) {
+    fout = new TFile(filename.c_str(),"recreate");
+    s_tree->SetDirectory(fout);
+  };
     
   // Event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    er_tree->GetEntry(iev);
+  converter.Convert = [&](NtpMCEventScanner & scanner) -> bool {
+    Long64_t           iev   = scanner.GlobalEntry();
+    NtpMCEventRecord * mcrec = scanner.Record();
 
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -568,8 +610,7 @@ void ConvertToGST(void)
     bool is_unphysical = event.IsUnphysical();
     if(is_unphysical) {
       LOG("gntpc", pINFO) << "Skipping unphysical event";
-      mcrec->Clear();
-      continue;
+      return true;
     }
 
     // Clean-up arrays
@@ -814,8 +855,7 @@ void ConvertToGST(void)
     }//particle-loop
 
     if( count(final_had_syst.begin(), final_had_syst.end(), -1) > 0) {
-        mcrec->Clear();
- 	continue;
+        return true;
     }
 
     //
@@ -934,8 +974,7 @@ void ConvertToGST(void)
     }//study_hadsystem?
     
     if( count(prim_had_syst.begin(), prim_had_syst.end(), -1) > 0) {
-        mcrec->Clear();
- 	continue;
+        return true;
     }
 
     //
@@ -1126,65 +1165,63 @@ void ConvertToGST(void)
 
     s_tree->Fill();
 
-    mcrec->Clear();
+    return true;
 
-  } // event loop
+  }; // event loop
 
+  converter.Close = [&](void) {
+    fout->Write();
+    fout->Close();
+    delete fout;
+    fout = 0;
+  };
+  converter.Join = [&](int nworkers) {
+    MergeTreeFiles(nworkers, "gst");
+  };
+
+  RunConverter(converter);
 
   // Copy MC job metadata (gconfig and genv TFolders)
   if(gOptCopyJobMeta) {
-    TFolder * genv    = (TFolder*) fin.Get("genv");
-    TFolder * gconfig = (TFolder*) fin.Get("gconfig");
-    fout.cd();       
-    genv    -> Write("genv");
-    gconfig -> Write("gconfig");
+    CopyJobMeta(fin);
   }
 
   fin.Close();
-
-  fout.Write();
-  fout.Close();
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> GENIE XML EVENT FILE FORMAT 
 //____________________________________________________________________________________
 void ConvertToGXML(void)
 {
-  //-- open the ROOT file and get the TTree & its header
+  //-- open the ROOT file and get the TTree header
   TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           tree = 0;
-  NtpMCTreeHeader * thdr = 0;
-  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-
-  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
-
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  tree->SetBranchAddress("gmcrec", &mcrec);
-
-  //-- open the output stream
-  ofstream output(gOptOutFileName.c_str(), ios::out);
-
-  //-- add required header
-  output << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
-  output << endl << endl;
-  output << "<!-- generated by GENIE gntpc utility -->";   
-  output << endl << endl;
-  output << "<genie_event_list version=\"1.00\">" << endl;
-
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
+  NtpMCTreeHeader * thdr = 
+     dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  if (!thdr) {
+    LOG("gntpc", pERROR) << "Null input GHEP tree header";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
+
+  FormatConverter converter;
+  ofstream output;
+
+  converter.Open = [&](string filename) {
+    //-- open the output stream
+    output.open(filename.c_str(), ios::out);
+
+    //-- add required header (the worker outputs are concatenated)
+    if(!converter.FirstWorker()) return;
+    output << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
+    output << endl << endl;
+    output << "<!-- generated by GENIE gntpc utility -->";   
+    output << endl << endl;
+    output << "<genie_event_list version=\"1.00\">" << endl;
+  };
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    tree->GetEntry(iev);
+  converter.Convert = [&](NtpMCEventScanner & scanner) -> bool {
+    NtpMCEventRecord * mcrec = scanner.Record();
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
 
@@ -1279,14 +1316,23 @@ void ConvertToGXML(void)
     }
     output << "  </ghep>" << endl;
 
-    mcrec->Clear();
-  } // event loop
+    return true;
+  }; // event loop
 
-  //-- add required footer
-  output << endl << endl;
-  output << "<genie_event_list version=\"1.00\">";
+  converter.Close = [&](void) {
+    //-- add required footer
+    if(converter.LastWorker()) {
+      output << endl << endl;
+      output << "<genie_event_list version=\"1.00\">";
+    }
+    output.close();
+  };
+  converter.Join = [&](int nworkers) {
+    MergeTextFiles(nworkers);
+  };
+
+  RunConverter(converter);
 
-  output.close();
   fin.Close();
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
@@ -1296,36 +1342,30 @@ void ConvertToGXML(void)
 //____________________________________________________________________________________
 void ConvertToGHepMock(void)
 {
-  //-- open the ROOT file and get the TTree & its header
+  //-- open the ROOT file and get the TTree header
   TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           tree = 0;
-  NtpMCTreeHeader * thdr = 0;
-  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-        
-  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
-   
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  tree->SetBranchAddress("gmcrec", &mcrec);
-        
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ?
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
+  NtpMCTreeHeader * thdr = 
+     dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  if (!thdr) {
+    LOG("gntpc", pERROR) << "Null input GHEP tree header";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
+
+  FormatConverter converter;
+  NtpWriter * ntpw = 0;
 
-  //-- initialize an Ntuple Writer
-  NtpWriter ntpw(kNFGHEP, thdr->runnu);
-  ntpw.CustomizeFilename(gOptOutFileName);
-  ntpw.Initialize();
+  converter.Open = [&](string filename) {
+    //-- initialize an Ntuple Writer
+    ntpw = new NtpWriter(kNFGHEP, thdr->runnu);
+    ntpw->CustomizeFilename(filename);
+    ntpw->Initialize();
+  };
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    tree->GetEntry(iev);
+  converter.Convert = [&](NtpMCEventScanner & scanner) -> bool {
+    Long64_t           iev   = scanner.GlobalEntry();
+    NtpMCEventRecord * mcrec = scanner.Record();
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
 
@@ -1349,15 +1389,48 @@ void ConvertToGHepMock(void)
           p->Pdg(), ist, -1,-1,-1,-1, *p->P4(), *p->X4());
     }//p
 
-    ntpw.AddEventRecord(iev,stripped_event);
-
-    mcrec->Clear();
-  } // event loop
-
-  //-- save the generated MC events
-  ntpw.Save();
+    ntpw->AddEventRecord(iev,stripped_event);
+    delete stripped_event;
+
+    return true;
+  }; // event loop
+
+  converter.Close = [&](void) {
+    //-- save the generated MC events
+    ntpw->Save();
+    delete ntpw;
+    ntpw = 0;
+  };
+  converter.Join = [&](int nworkers) {
+    //-- copy the events of each worker, keeping their event numbers
+    converter.Open(gOptOutFileName);
+    for(int iw = 0; iw < nworkers; iw++) {
+      string filename = FormatConverter::WorkerFile(iw);
+      TFile fw(filename.c_str(),"READ");
+      TTree * tree = (fw.IsZombie()) ? 0 : 
+                     dynamic_cast <TTree *> ( fw.Get("gtree") );
+      if(!tree) {
+        LOG("gntpc", pFATAL) 
+          << "No GHEP tree found in worker output " << filename;
+        gAbortingInErr = true;
+        exit(1);
+      }
+      NtpMCEventRecord * mcrec = 0;
+      tree->SetBranchAddress("gmcrec", &mcrec);
+      NtpMCEventScanner::EnableReadCache(tree, 30000000, "gmcrec");
+      for(Long64_t i = 0; i < tree->GetEntries(); i++) {
+        tree->GetEntry(i);
+        ntpw->AddEventRecord(mcrec->hdr.ievent, mcrec->event);
+        mcrec->Clear(); // clear out explicitly to prevent memory leak w/Root6
+      }
+      fw.Close();
+      delete mcrec;
+      gSystem->Unlink(filename.c_str());
+    }
+    converter.Close();
+  };
 
-  //-- rename the output file
+  RunConverter(converter);
       
   fin.Close();
       
@@ -1368,26 +1441,22 @@ void ConvertToGHepMock(void)
 //____________________________________________________________________________________
 void ConvertToGTracker(void)
 {
-  //-- open the ROOT file and get the TTree & its header
+  //-- open the ROOT file and get the TTree header
   TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           tree = 0;
-  NtpMCTreeHeader * thdr = 0;
-  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-
+  NtpMCTreeHeader * thdr = 
+     dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  if (!thdr) {
+    LOG("gntpc", pERROR) << "Null input GHEP tree header";
+    return;
+  }
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
   gFileMajorVrs = utils::system::GenieMajorVrsNum(thdr->cvstag.GetString().Data());
   gFileMinorVrs = utils::system::GenieMinorVrsNum(thdr->cvstag.GetString().Data());
   gFileRevisVrs = utils::system::GenieRevisVrsNum(thdr->cvstag.GetString().Data());
 
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  tree->SetBranchAddress("gmcrec", &mcrec);
-
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
   flux::GJPARCNuFluxPassThroughInfo * flux_info = 0;
-  tree->SetBranchAddress("flux", &flux_info);
 #else
   LOG("gntpc", pWARN) 
     << "\n Flux drivers are not enabled." 
@@ -1396,21 +1465,29 @@ void ConvertToGTracker(void)
     << "--with-flux-drivers in the configuration step.";
 #endif
 
-  //-- open the output stream
-  ofstream output(gOptOutFileName.c_str(), ios::out);
+  FormatConverter converter;
+  ofstream output;
+  int ifile = -1;
 
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  converter.Open = [&](string filename) {
+    //-- open the output stream
+    output.open(filename.c_str(), ios::out);
+  };
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    tree->GetEntry(iev);
+  converter.Convert = [&](NtpMCEventScanner & scanner) -> bool {
+    Long64_t           iev   = scanner.GlobalEntry();
+    NtpMCEventRecord * mcrec = scanner.Record();
+
+    //-- get the flux pass-through info
+    if(scanner.CurrentFileIdx() != ifile) {
+      ifile = scanner.CurrentFileIdx();
+#ifdef __GENIE_FLUX_DRIVERS_ENABLED__
+      scanner.Tree()->SetBranchAddress("flux", &flux_info);
+#endif
+    }
+    ReadPassThroughBranches(scanner);
+
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
     Interaction * interaction = event.Summary();
@@ -1805,13 +1882,22 @@ be agreed with the SKDETSIM maintainers.
     //
     output << "$ end" << endl;
 
-    mcrec->Clear();
-  } // event loop
+    return true;
+  }; // event loop
 
-  // add tracker end-of-file tag
-  output << "$ stop" << endl;
+  converter.Close = [&](void) {
+    // add tracker end-of-file tag (the worker outputs are concatenated)
+    if(converter.LastWorker()) {
+      output << "$ stop" << endl;
+    }
+    output.close();
+  };
+  converter.Join = [&](int nworkers) {
+    MergeTextFiles(nworkers);
+  };
+
+  RunConverter(converter);
 
-  output.close();
   fin.Close();
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
@@ -1993,11 +2079,12 @@ void ConvertToGRooTracker(void)
   double     brNumiFluxBeampy;            // Primary proton momentum, Y - component
   double     brNumiFluxBeampz;            // Primary proton momentum, Z - component
 
-  //-- open the output ROOT file
-  TFile fout(gOptOutFileName.c_str(), "RECREATE");
+  //-- the output ROOT file (of each worker)
+  TFile * fout = 0;
 
-  //-- create the output ROOT tree
+  //-- create the output ROOT tree, moved to the output file once opened
   TTree * rootracker_tree = new TTree("gRooTracker","GENIE event tree rootracker format");
+  rootracker_tree->SetDirectory(0);
 
   //-- is it a `mock data' variance?
   bool hide_truth = (gOptOutFileFormat == kConvFmt_rootracker_mock_data);
@@ -2167,13 +2254,12 @@ void ConvertToGRooTracker(void)
   NtpMCTreeHeader * thdr  = 0;
   gtree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
   thdr  = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-
+  if (!gtree || !thdr) {
+    LOG("gntpc", pERROR) << "Null input GHEP event tree";
+    return;
+  }
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  gtree->SetBranchAddress("gmcrec", &mcrec);
-
   //-- print-out metadata associated with the input event file in case the
   //   event file was generated using the gT2Kevgen driver
   //   (assuming this is the case if the requested output format is the t2k_rootracker format)
@@ -2194,23 +2280,14 @@ void ConvertToGRooTracker(void)
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
   flux::GJPARCNuFluxPassThroughInfo * jnubeam_flux_info = 0;
-  if(gOptOutFileFormat == kConvFmt_t2k_rootracker) {
-     gtree->SetBranchAddress("flux", &jnubeam_flux_info);
-  }
   flux::GNuMIFluxPassThroughInfo * gnumi_flux_info = 0;
-  if(gOptOutFileFormat == kConvFmt_numi_rootracker) {
-     gtree->SetBranchAddress("flux", &gnumi_flux_info);
-  }
 #ifdef __GENIE_HEAVY_NEUTRAL_LEPTON_ENABLED__
   // gnumi_flux_ster ==> the "new flux" for HNL neutrino
   hnl::FluxContainer * gnumi_flux_ster = 0;
-  if(gOptOutFileFormat == kConvFmt_numi_rootracker) {
-    gtree->SetBranchAddress("flux", &gnumi_flux_ster);
-  }
   // extra branches for HNL declared here
   double dVars[9] = { -9.9, -9.9, -9.9, -9.9, -9.9, -9.9, -9.9, -9.9, -9.9 };
   int    iVars[4] = { -9, -9, -9, -9 };
-  DeclareHNLBranches( rootracker_tree, gtree, dVars, iVars );
+  DeclareHNLBranches( rootracker_tree, dVars, iVars );
 #endif // #ifdef __GENIE_HEAVY_NEUTRAL_LEPTON_ENABLED__
 #else
   LOG("gntpc", pWARN) 
@@ -2220,18 +2297,42 @@ void ConvertToGRooTracker(void)
     << "--with-flux-drivers in the configuration step.";
 #endif
 
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-      gtree->GetEntries() : TMath::Min(gtree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  //-- POT normalization for the generated sample
+  double pot = gtree->GetWeight();
+
+  FormatConverter converter;
+  int ifile = -1;
+
+  converter.Open = [&](string filename) {
+    fout = new TFile(filename.c_str(), "RECREATE");
+    rootracker_tree->SetDirectory(fout);
+  };
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    gtree->GetEntry(iev);
+  converter.Convert = [&](NtpMCEventScanner & scanner) -> bool {
+    Long64_t           iev   = scanner.GlobalEntry();
+    NtpMCEventRecord * mcrec = scanner.Record();
+
+    //-- get the flux pass-through info
+    if(scanner.CurrentFileIdx() != ifile) {
+      ifile = scanner.CurrentFileIdx();
+#ifdef __GENIE_FLUX_DRIVERS_ENABLED__
+      TTree * intree = scanner.Tree();
+      if(gOptOutFileFormat == kConvFmt_t2k_rootracker) {
+         intree->SetBranchAddress("flux", &jnubeam_flux_info);
+      }
+      if(gOptOutFileFormat == kConvFmt_numi_rootracker) {
+         intree->SetBranchAddress("flux", &gnumi_flux_info);
+      }
+#ifdef __GENIE_HEAVY_NEUTRAL_LEPTON_ENABLED__
+      if(gOptOutFileFormat == kConvFmt_numi_rootracker) {
+        intree->SetBranchAddress("flux", &gnumi_flux_ster);
+      }
+      SetHNLBranchAddresses( intree, dVars, iVars );
+#endif // #ifdef __GENIE_HEAVY_NEUTRAL_LEPTON_ENABLED__
+#endif
+    }
+    ReadPassThroughBranches(scanner);
 
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -2579,28 +2680,32 @@ void ConvertToGRooTracker(void)
 
     // fill tree
     rootracker_tree->Fill();
-    mcrec->Clear();
 
-  } // event loop
+    return true;
+  }; // event loop
 
-  // Copy POT normalization for the generated sample
-  double pot = gtree->GetWeight();
-  rootracker_tree->SetWeight(pot);
+  converter.Close = [&](void) {
+    // Copy POT normalization for the generated sample
+    // (the merged tree is cloned from the tree of the first worker)
+    rootracker_tree->SetWeight(pot);
+    fout->Write();
+    fout->Close();
+    delete fout;
+    fout = 0;
+  };
+  converter.Join = [&](int nworkers) {
+    MergeTreeFiles(nworkers, "gRooTracker");
+  };
+
+  RunConverter(converter);
 
   // Copy MC job metadata (gconfig and genv TFolders)
   if(gOptCopyJobMeta) {
-    TFolder * genv    = (TFolder*) fin.Get("genv");
-    TFolder * gconfig = (TFolder*) fin.Get("gconfig");    
-    fout.cd();
-    genv    -> Write("genv");
-    gconfig -> Write("gconfig");
+    CopyJobMeta(fin);
   }
 
   fin.Close();
 
-  fout.Write();
-  fout.Close();
-
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
 }
 //____________________________________________________________________________________
@@ -2620,26 +2725,24 @@ void ConvertToGHad(void)
 // ... then for each stable daughter
 // particle id, 5 vec 
 
-  //-- open the ROOT file and get the TTree & its header
+  //-- open the ROOT file and get the TTree header
   TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           tree = 0;
-  NtpMCTreeHeader * thdr = 0;
-  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-
+  NtpMCTreeHeader * thdr = 
+     dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  if (!thdr) {
+    LOG("gntpc", pERROR) << "Null input GHEP tree header";
+    return;
+  }
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  tree->SetBranchAddress("gmcrec", &mcrec);
+  FormatConverter converter;
+  ofstream output;
 
-  //-- open the output stream
-  ofstream output(gOptOutFileName.c_str(), ios::out);
-
-  //-- open output root file and create ntuple -- if required
+  //-- create ntuple -- if required
 #ifdef __GHAD_NTP__
-  TFile fout("ghad.root","recreate");  
+  TFile * fout = 0;
   TTree * ghad = new TTree("ghad","");   
+  ghad->SetDirectory(0);
   ghad->Branch("i",       &brIev,          "i/I" );
   ghad->Branch("W",       &brW,            "W/D" );
   ghad->Branch("n",       &brN,            "n/I" );
@@ -2650,18 +2753,22 @@ void ConvertToGHad(void)
   ghad->Branch("pz",       brPz,           "pz[n]/D"   );
 #endif
 
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-      tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  converter.Open = [&](string filename) {
+    //-- open the output stream
+    output.open(filename.c_str(), ios::out);
+
+    //-- open output root file -- if required (not merged across workers)
+#ifdef __GHAD_NTP__
+    fout = new TFile( (converter.NWorkers() == 1) ? "ghad.root" :
+               Form("ghad.root.worker%d", converter.IWorker()), "recreate");
+    ghad->SetDirectory(fout);
+#endif
+  };
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    tree->GetEntry(iev);
+  converter.Convert = [&](NtpMCEventScanner & scanner) -> bool {
+    Long64_t           iev   = scanner.GlobalEntry();
+    NtpMCEventRecord * mcrec = scanner.Record();
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
 
@@ -2692,8 +2799,7 @@ void ConvertToGHad(void)
 
     bool pass   = is_cc && (is_dis || is_res);
     if(!pass) {
-      mcrec->Clear();
-      continue;
+      return true;
     }
 
     int ccnc   = is_cc ? 1 : 0;
@@ -2704,7 +2810,7 @@ void ConvertToGHad(void)
     else if (init_state.IsNuN    ()) im = 2; 
     else if (init_state.IsNuBarP ()) im = 3; 
     else if (init_state.IsNuBarN ()) im = 4; 
-    else return;
+    else return false;
 
     GHepParticle * neutrino = event.Probe();
     assert(neutrino);
@@ -2833,18 +2939,28 @@ void ConvertToGHad(void)
     ghad->Fill();
 #endif
 
-    mcrec->Clear();
+    return true;
 
-  } // event loop
+  }; // event loop
 
-  output.close();
-  fin.Close();
+  converter.Close = [&](void) {
+    output.close();
 
 #ifdef __GHAD_NTP__
-  ghad->Write("ghad");
-  fout.Write();
-  fout.Close();
+    ghad->Write("ghad");
+    fout->Write();
+    fout->Close();
+    delete fout;
+    fout = 0;
 #endif
+  };
+  converter.Join = [&](int nworkers) {
+    MergeTextFiles(nworkers);
+  };
+
+  RunConverter(converter);
+
+  fin.Close();
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
 }
@@ -2887,10 +3003,12 @@ void ConvertToGINuke(void)
   //
   LOG("gntpc", pNOTICE)
        << "*** Saving summary tree to: " << gOptOutFileName;
-  TFile fout(gOptOutFileName.c_str(),"recreate");
+  TFile * fout = 0;
    
-TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
+  //-- the tree is moved to the output file of each worker once opened
+  TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   assert(tEvtTree);
+  tEvtTree->SetDirectory(0);
 
   //-- create tree branches
   //
@@ -2922,38 +3040,26 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   tEvtTree->Branch("npim",      &brNpim,         "npim/I"      );
   tEvtTree->Branch("npi0",      &brNpi0,         "npi0/I"      );
 
-  //-- open the ROOT file and get the TTree & its header
+  //-- open the ROOT file and get the TTree header
   TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           er_tree = 0;
-  NtpMCTreeHeader * thdr    = 0;
-  er_tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr    = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-  if (!er_tree) {
-    LOG("gntpc", pERROR) << "Null input tree";
+  NtpMCTreeHeader * thdr = 
+     dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  if (!thdr) {
+    LOG("gntpc", pERROR) << "Null input tree header";
     return;
   }
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
-  //-- get the mc record
-  NtpMCEventRecord * mcrec = 0;
-  er_tree->SetBranchAddress("gmcrec", &mcrec);
-  if (!mcrec) {
-    LOG("gntpc", pERROR) << "Null MC record";
-    return;
-  }
+  FormatConverter converter;
 
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ?
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  converter.Open = [&](string filename) {
+    fout = new TFile(filename.c_str(),"recreate");
+    tEvtTree->SetDirectory(fout);
+  };
 
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    brIEv = iev; 
-    er_tree->GetEntry(iev);
+  converter.Convert = [&](NtpMCEventScanner & scanner) -> bool {
+    brIEv = scanner.GlobalEntry(); 
+    NtpMCEventRecord * mcrec = scanner.Record();
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
 
@@ -3050,16 +3156,146 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
     // fill the summary tree
     tEvtTree->Fill();
 
-    mcrec->Clear();
+    return true;
+
+  }; // event loop
+
+  converter.Close = [&](void) {
+    fout->Write();
+    fout->Close();
+    delete fout;
+    fout = 0;
+  };
+  converter.Join = [&](int nworkers) {
+    MergeTreeFiles(nworkers, "ginuke");
+  };
 
-  } // event loop
+  RunConverter(converter);
 
   fin.Close();
 
-  fout.Write();
+  LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+}
+//____________________________________________________________________________________
+// FUNCTIONS FOR RUNNING THE CONVERTERS OVER THE INPUT EVENTS
+//____________________________________________________________________________________
+void RunConverter(FormatConverter & converter)
+{
+  NtpMCEventScanner scanner;
+  scanner.AddFiles(gOptInpFileName);
+  scanner.SetNWorkers(gOptNWorkers);
+
+  // figure out how many events to analyze (-n 0: an empty entry range)
+  if      (gOptN >  0) scanner.SetEntryRange(0, gOptN-1);
+  else if (gOptN == 0) scanner.SetEntryRange(1, 0);
+
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << scanner.NEntries() << " events";
+
+  if(!scanner.Run(converter)) {
+    LOG("gntpc", pFATAL) << "Failed to convert the GHEP events";
+    gAbortingInErr = true;
+    exit(1);
+  }
+}
+//____________________________________________________________________________________
+void FormatConverter::BeginWorker(int iworker, int nworkers)
+{
+  fIWorker  = iworker;
+  fNWorkers = nworkers;
+
+  // the forked workers inherit the state of the random number generator:
+  // the first worker continues the sequence of a single-process run and
+  // the others are reseeded
+  if(iworker > 0) {
+    RandomGen * rnd = RandomGen::Instance();
+    rnd->SetSeed(rnd->GetSeed() + iworker);
+  }
+
+  Open( (nworkers == 1) ? gOptOutFileName : WorkerFile(iworker) );
+}
+//____________________________________________________________________________________
+string FormatConverter::WorkerFile(int iworker)
+{
+  ostringstream fnm;
+  fnm << gOptOutFileName << ".worker" << iworker;
+  return fnm.str();
+}
+//____________________________________________________________________________________
+void MergeTextFiles(int nworkers)
+{
+  // Concatenate the text outputs of the workers, in worker order
+
+  ofstream output(gOptOutFileName.c_str(), ios::out | ios::binary);
+
+  for(int iw = 0; iw < nworkers; iw++) {
+    string filename = FormatConverter::WorkerFile(iw);
+    ifstream input(filename.c_str(), ios::in | ios::binary);
+    if(!input.good()) {
+      LOG("gntpc", pFATAL) << "Could not read worker output " << filename;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if(input.peek() != ifstream::traits_type::eof()) output << input.rdbuf();
+    input.close();
+    gSystem->Unlink(filename.c_str());
+  }
+  output.close();
+}
+//____________________________________________________________________________________
+void MergeTreeFiles(int nworkers, string treename)
+{
+  // Merge the output trees of the workers, in worker order. The merged tree
+  // is cloned from the tree of the first worker, keeping its weight.
+
+  TChain chain(treename.c_str());
+  for(int iw = 0; iw < nworkers; iw++) {
+    string filename = FormatConverter::WorkerFile(iw);
+    if(chain.Add(filename.c_str(), 0) == 0) {
+      LOG("gntpc", pFATAL) 
+        << "No " << treename << " tree found in worker output " << filename;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+
+  TFile fout(gOptOutFileName.c_str(),"recreate");
+  chain.Merge(&fout, 0, "fast keep");
   fout.Close();
 
-  LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+  for(int iw = 0; iw < nworkers; iw++) {
+    gSystem->Unlink(FormatConverter::WorkerFile(iw).c_str());
+  }
+}
+//____________________________________________________________________________________
+void CopyJobMeta(TFile & fin)
+{
+  // Copy MC job metadata (gconfig and genv TFolders) to the output file
+
+  TFolder * genv    = (TFolder*) fin.Get("genv");
+  TFolder * gconfig = (TFolder*) fin.Get("gconfig");
+
+  TFile fout(gOptOutFileName.c_str(),"update");
+  fout.cd();
+  genv    -> Write("genv");
+  gconfig -> Write("gconfig");
+  fout.Close();
+}
+//____________________________________________________________________________________
+void ReadPassThroughBranches(NtpMCEventScanner & scanner)
+{
+  // Read the current entry of the input event tree branches other than the
+  // ones read by the scanner (eg. flux pass-through info)
+
+  TTree *  tree  = scanner.Tree();
+  Long64_t entry = scanner.CurrentEntry();
+
+  TIter next(tree->GetListOfBranches());
+  TBranch * branch = 0;
+  while( (branch = (TBranch *) next()) ) {
+    string name = branch->GetName();
+    if(name == "gmcrec" || name == "gsum") continue;
+    branch->GetEntry(entry);
+  }
 }
 //____________________________________________________________________________________
 // FUNCTIONS FOR PARSING CMD-LINE ARGUMENTS 
@@ -3170,6 +3406,11 @@ void GetCommandLineArgs(int argc, char ** argv)
     LOG("gntpc", pINFO) << "Unspecified random number seed - Using default";
     gOptRanSeed = -1;
   }
+
+  // get number of worker processes
+  if( parser.OptionExists("workers") ) {
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  }
  
   LOG("gntpc", pNOTICE) << "Input filename  = " << gOptInpFileName;
   LOG("gntpc", pNOTICE) << "Output filename = " << gOptOutFileName;
@@ -3178,6 +3419,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gntpc", pNOTICE) << "Number of events to be converted = " << gOptN;
   LOG("gntpc", pNOTICE) << "Copy metadata? = " << ((gOptCopyJobMeta) ? "Yes" : "No");
   LOG("gntpc", pNOTICE) << "Random number seed = " << gOptRanSeed;
+  LOG("gntpc", pNOTICE) << "Number of worker processes = " << gOptNWorkers;
 
   LOG("gntpc", pNOTICE) << *RunOpt::Instance();
 }
@@ -3298,8 +3540,7 @@ int HAProbeFSI(int probe_fsi, int probe_pdg, int numh, double E_had[], int pdg_h
 // Functions to add in branches from BeamHNL module
 //____________________________________________________________________________________
 #ifdef __GENIE_HEAVY_NEUTRAL_LEPTON_ENABLED__
-void DeclareHNLBranches( TTree * tree, TTree * intree, 
-			 double * dVars, int * iVars )
+void DeclareHNLBranches( TTree * tree, double * dVars, int * iVars )
 {
   tree->Branch( "HNL_mass",     &dVars[0],    "HNL_mass/D"     );
   tree->Branch( "HNL_coup_e",   &dVars[1],    "HNL_coup_e/D"   );
@@ -3315,8 +3556,11 @@ void DeclareHNLBranches( TTree * tree, TTree * intree,
   tree->Branch( "NumiHNLFluxLepPdg",  &iVars[3],   "NumiHNLFluxLepPdg/I"  );
   tree->Branch( "NumiHNLFluxNecm",    &dVars[7],   "NumiHNLFluxNecm/D"    );
   tree->Branch( "NumiHNLFluxAccCorr", &dVars[8],   "NumiHNLFluxAccCorr/D" );
-
-  // set up the branch addresses now.
+}
+//____________________________________________________________________________________
+void SetHNLBranchAddresses( TTree * intree, double * dVars, int * iVars )
+{
+  // set up the branch addresses of the input tree (of each input file)
   intree->SetBranchAddress( "hnl_mass",   &dVars[0] );
   intree->SetBranchAddress( "hnl_coup_e", &dVars[1] );
   intree->SetBranchAddress( "hnl_coup_m", &dVars[2] );
@@ -364,22 +364,28 @@ void MakePlots (void)
     h2_xds [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xstr[im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xglu[im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
-    PDF pdf;
-    pdf.SetModel(gPDFAlgList[im]);
+    // evaluate the PDFs for all Q2 bins at a given x in a single batch
+    int nbinsq2 = h2_xuv[im]->GetYaxis()->GetNbins();
+    vector<double> x_batch  (nbinsq2);
+    vector<double> Q2_batch (nbinsq2);
+    vector<PDF_t>  pdf_batch(nbinsq2);
     for(int ibinx = 1; 
             ibinx <= h2_xuv[im]->GetXaxis()->GetNbins(); ibinx++) {
       double x = h2_xuv[im]->GetXaxis()->GetBinCenter(ibinx);
-      for(int ibinq2 = 1; 
-              ibinq2 <= h2_xuv[im]->GetYaxis()->GetNbins(); ibinq2++) {
-         double Q2 = h2_xuv[im]->GetYaxis()->GetBinCenter(ibinq2);
-         pdf.Calculate(x, Q2);
-       //LOG("gpdfcomp", pINFO) << "PDFs:\n" << pdf;
-         double xuv  = x * pdf.UpValence();
-         double xdv  = x * pdf.DownValence();
-         double xus  = x * pdf.UpSea();
-         double xds  = x * pdf.DownSea();
-         double xstr = x * pdf.Strange();
-         double xglu = x * pdf.Gluon();
+      for(int ibinq2 = 1; ibinq2 <= nbinsq2; ibinq2++) {
+         x_batch [ibinq2-1] = x;
+         Q2_batch[ibinq2-1] = h2_xuv[im]->GetYaxis()->GetBinCenter(ibinq2);
+      }
+      gPDFAlgList[im]->AllPDFs(
+         nbinsq2, &x_batch[0], &Q2_batch[0], &pdf_batch[0]);
+      for(int ibinq2 = 1; ibinq2 <= nbinsq2; ibinq2++) {
+         const PDF_t & pdf = pdf_batch[ibinq2-1];
+         double xuv  = x * pdf.uval;
+         double xdv  = x * pdf.dval;
+         double xus  = x * pdf.usea;
+         double xds  = x * pdf.dsea;
+         double xstr = x * pdf.str;
+         double xglu = x * pdf.gl;
          h2_xuv [im] -> SetBinContent(ibinx, ibinq2, xuv );
          h2_xdv [im] -> SetBinContent(ibinx, ibinq2, xdv ); 
          h2_xus [im] -> SetBinContent(ibinx, ibinq2, xus ); 
@@ -40,6 +40,7 @@
                       [--event-record-print-level level]
                       [--mc-job-status-refresh-rate  rate]
                       [--cache-file root_file]
+                      [--init-cache directory]
 
          *** Options :
 
@@ -331,6 +332,12 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --init-cache
+              Directory where the event generation driver looks for / saves
+              its init products (cross section sum splines, max path lengths,
+              interaction probability scales). Jobs with identical splines,
+              flux energy range, geometry and settings share the same cache
+              file and skip the corresponding init steps.
 
          *** Examples:
 
@@ -431,6 +438,7 @@
 #include <map>
 
 #include <TSystem.h>
+#include <TMD5.h>
 #include <TTree.h>
 #include <TFile.h>
 #include <TH1D.h>
@@ -442,6 +450,7 @@
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
 #include "Framework/EventGen/GMCJMonitor.h"
@@ -519,6 +528,7 @@ string          gOptSaveFluxProbsFileName;     // output filename for pre-genera
 bool            gOptRandomFluxOffset = false;  // start looping over flux file from random start entry
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+string          gOptInitCacheDir;              // directory of the GMCJDriver init cache
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -664,6 +674,20 @@ int main(int argc, char ** argv)
   mcj_driver->UseFluxDriver(flux_driver);
   mcj_driver->UseGeomAnalyzer(geom_driver);
   mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
+  if(gOptInitCacheDir.size() > 0) {
+    // identify the geometry by the contents of the geometry file, the top
+    // volume and the units
+    ostringstream geom_id;
+    if(gOptUsingRootGeom) {
+      TMD5 * md5 = TMD5::FileChecksum(gOptRootGeom.c_str());
+      if(md5) {
+        geom_id << md5->AsString() << ";" << gOptRootGeomTopVol << ";"
+                << gOptGeomLUnits << ";" << gOptGeomDUnits;
+        delete md5;
+      }
+    }
+    mcj_driver->UseInitCache(gOptInitCacheDir, geom_id.str());
+  }
   // do not calculate probability scales if using pre-generated flux probs
   bool calc_prob_scales = (gOptSaveFluxProbsFile || gOptUseFluxProbs) ? false : true;
   mcj_driver->Configure(calc_prob_scales);
@@ -863,7 +887,7 @@ int main(int argc, char ** argv)
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
-     delete event;
+     EventRecordPool::Instance()->Release(event);
      if(flux_info) delete flux_info;
      ievent++;
   } //1
@@ -1367,6 +1391,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // GMCJDriver init cache
+  if( parser.OptionExists("init-cache") ) {
+    LOG("gevgen_t2k", pINFO) << "Reading init cache directory";
+    gOptInitCacheDir = parser.ArgAsString("init-cache");
+  } else {
+    gOptInitCacheDir = "";
+  }
+
   //
   // >>> perform 'sanity' checks on command line arguments
   //
@@ -1527,6 +1559,7 @@ void PrintSyntax(void)
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
    << "\n           [--cache-file root_file]"
+   << "\n           [--init-cache directory]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << " or look at the source code: $GENIE/src/Apps/gT2KEvGen.cxx"
@@ -14,6 +14,8 @@
 #include <sstream>
 #include <cstdlib>
 #include <fstream>
+#include <cstdio>
+#include <stdint.h>
 
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
@@ -23,6 +25,7 @@
 #include <TTree.h>
 #include <TH1F.h>
 #include <TH2F.h>
+#include <TMD5.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Messenger/Messenger.h"
@@ -30,6 +33,7 @@
 #include "Framework/Utils/XmlParserUtils.h"
 
 #include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/RunOpt.h"
 
 using std::setw;
 using std::setfill;
@@ -38,6 +42,45 @@ using std::ostringstream;
 
 using namespace genie;
 
+namespace {
+  // binary snapshot format
+  const char *   kSnapshotMagic   = "GENIE-ALGCONF";
+  const uint32_t kSnapshotVersion = 1;
+
+  void WriteUInt(ostream & out, uint32_t n)
+  {
+    out.write((const char *) &n, sizeof(n));
+  }
+  void WriteStr(ostream & out, const string & str)
+  {
+    WriteUInt(out, str.size());
+    out.write(str.data(), str.size());
+  }
+  bool ReadUInt(std::istream & in, uint32_t & n)
+  {
+    in.read((char *) &n, sizeof(n));
+    return in.good();
+  }
+  bool ReadStr(std::istream & in, string & str)
+  {
+    uint32_t n = 0;
+    if(!ReadUInt(in, n) || n > (1u<<24)) return false;
+    str.resize(n);
+    if(n > 0) in.read(&str[0], n);
+    return in.good();
+  }
+  // MD5 checksum of a file, or an empty string if it can not be read
+  string FileChecksum(const string & filename)
+  {
+    if(gSystem->AccessPathName(filename.c_str())) return "";
+    TMD5 * md5 = TMD5::FileChecksum(filename.c_str());
+    if(!md5) return "";
+    string checksum = md5->AsString();
+    delete md5;
+    return checksum;
+  }
+}
+
 //____________________________________________________________________________
 namespace genie {
   ostream & operator<<(ostream & stream, const AlgConfigPool & config_pool)
@@ -49,7 +92,8 @@ namespace genie {
 //____________________________________________________________________________
 AlgConfigPool * AlgConfigPool::fInstance = 0;
 //____________________________________________________________________________
-AlgConfigPool::AlgConfigPool()
+AlgConfigPool::AlgConfigPool() :
+fRecording(false)
 {
   if( ! this->LoadAlgConfig() )
   LOG("AlgConfigPool", pERROR) << "Could not load XML config file";
@@ -97,6 +141,14 @@ bool AlgConfigPool::LoadAlgConfig(void)
 // Loads all algorithm XML configurations and creates a map with all loaded
 // configuration registries
 
+  //-- use the binary configuration snapshot, if one is enabled and valid,
+  //   otherwise record the parsed XML files to save a new snapshot
+  string snapshot = this->SnapshotFilename();
+  if(snapshot.size() > 0) {
+    if(this->LoadSnapshot(snapshot)) return true;
+    fRecording = true;
+  }
+
   SLOG("AlgConfigPool", pINFO)
         << "AlgConfigPool late initialization: Loading all XML config. files";
 
@@ -137,12 +189,20 @@ bool AlgConfigPool::LoadAlgConfig(void)
     string full_path = utils::xml::GetXMLFilePath(file_name);
     SLOG("AlgConfigPool", pNOTICE)
       << "*** GENIE XML config file " << full_path;
+    this->RecordSource(file_name, full_path);
     bool ok = this->LoadSingleAlgConfig(alg_name, full_path);
     if(!ok) {
       SLOG("AlgConfigPool", pERROR)
            << "Error in loading config sets for algorithm = " << alg_name;
     }
   }
+
+  if(fRecording) {
+    fRecording = false;
+    this->WriteSnapshot(snapshot);
+    fRecords.clear();
+    fSources.clear();
+  }
   return true;
 };
 //____________________________________________________________________________
@@ -154,6 +214,7 @@ bool AlgConfigPool::LoadMasterConfig(std::string configname)
   //-- get the master config XML file using GXMLPATH + default locations
   // fMasterConfig = utils::xml::GetXMLFilePath("master_config.xml");
   fMasterConfig = utils::xml::GetXMLFilePath(configname);
+  this->RecordSource(configname, fMasterConfig);
 
   bool is_accessible = ! (gSystem->AccessPathName( fMasterConfig.c_str() ));
   if (!is_accessible) {
@@ -224,6 +285,7 @@ bool AlgConfigPool::LoadGlobalParamLists(void)
 
   // -- get the user config XML file using GXMLPATH + default locations
   string glob_params = utils::xml::GetXMLFilePath("ModelConfiguration.xml");
+  this->RecordSource("ModelConfiguration.xml", glob_params);
 
   // fixed key prefix
   string key_prefix = "GlobalParameterList";
@@ -263,6 +325,7 @@ bool AlgConfigPool::LoadTuneGeneratorList(void)
 
   // -- get the user config XML file using GXMLPATH + default locations
   string generator_list_file = utils::xml::GetXMLFilePath("TuneGeneratorList.xml");
+  this->RecordSource("TuneGeneratorList.xml", generator_list_file);
 
   // fixed key prefix
   string key_prefix = "TuneGeneratorList";
@@ -340,6 +403,13 @@ bool AlgConfigPool::LoadRegistries(
       // create a new Registry and fill it with the configuration params
       Registry * config = new Registry(param_set,false);
 
+      if(fRecording) {
+        RegistryRecord record;
+        record.key       = key.str();
+        record.param_set = param_set;
+        fRecords.push_back(record);
+      }
+
       xmlNodePtr xml_param = xml_cur->xmlChildrenNode;
       while (xml_param != NULL) {
         if( (!xmlStrcmp(xml_param->name, (const xmlChar *) "param")) ) {
@@ -515,6 +585,7 @@ int  AlgConfigPool::AddParameterMatrix  (Registry * r, string pt, string pn, str
   if (!file.is_open()) {
     throw std::runtime_error("Could not open file");
   }
+  this->RecordSource(filepath, filepath);
 
   std::string line;
   int n_row = 0, n_col = 0;
@@ -568,6 +639,14 @@ void AlgConfigPool::AddConfigParameter( Registry * r,
     << "Adding Parameter [" << ptype << "]: Key = "
     << pname << " -> Value = " << pvalue;
 
+  if(fRecording && !fRecords.empty()) {
+    ParamRecord record;
+    record.type  = ptype;
+    record.name  = pname;
+    record.value = pvalue;
+    fRecords.back().params.push_back(record);
+  }
+
   bool isRootObjParam = (strcmp(ptype.c_str(), "h1f")    == 0) ||
                         (strcmp(ptype.c_str(), "Th2f")   == 0) ||
                         (strcmp(ptype.c_str(), "tree")   == 0);
@@ -697,6 +776,201 @@ void AlgConfigPool::AddRootObjParameter(
   else {}
 }
 //____________________________________________________________________________
+string AlgConfigPool::SnapshotFilename(void) const
+{
+// Build the snapshot file name from a hash of everything that determines
+// which XML files are loaded: the tune, the XML search path and whether the
+// reweighting configuration is loaded. The contents of the XML files are
+// checked when the snapshot is loaded.
+
+  const char * dir = gSystem->Getenv("GALGCONFSNAPSHOT");
+  if(!dir) return "";
+
+  std::ostringstream key;
+  key << "AlgConfigPool snapshot v" << kSnapshotVersion << "\n";
+  TuneId * tune = RunOpt::Instance()->Tune();
+  key << "tune: " << (tune ? tune->Name() : "") << "\n";
+  key << "path: " << utils::xml::GetXMLPathList() << "\n";
+  key << "reweight: " << (std::getenv("GENIE_REWEIGHT") ? 1 : 0) << "\n";
+
+  TMD5 md5;
+  string skey = key.str();
+  md5.Update((const UChar_t *) skey.data(), skey.size());
+  md5.Final();
+
+  std::ostringstream filename;
+  filename << dir << "/algconf." << md5.AsString() << ".bin";
+  return filename.str();
+}
+//____________________________________________________________________________
+void AlgConfigPool::RecordSource(string name, string full_path)
+{
+  if(!fRecording) return;
+
+  SourceRecord source;
+  source.name      = name;
+  source.full_path = full_path;
+  source.checksum  = FileChecksum(full_path);
+  fSources.push_back(source);
+}
+//____________________________________________________________________________
+bool AlgConfigPool::LoadSnapshot(string filename)
+{
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  if(!in) {
+    SLOG("AlgConfigPool", pNOTICE)
+      << "No configuration snapshot " << filename << " - Will parse XML & save";
+    return false;
+  }
+
+  string   magic;
+  uint32_t version = 0;
+  if(!ReadStr(in, magic) || magic != kSnapshotMagic ||
+     !ReadUInt(in, version) || version != kSnapshotVersion) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Not a valid configuration snapshot: " << filename;
+    return false;
+  }
+
+  // check that all source files are unchanged and still resolve to the
+  // same location
+  uint32_t nsources = 0;
+  if(!ReadUInt(in, nsources)) return false;
+  for(uint32_t i = 0; i < nsources; i++) {
+    SourceRecord source;
+    if(!ReadStr(in, source.name) || !ReadStr(in, source.full_path) ||
+       !ReadStr(in, source.checksum)) return false;
+
+    string full_path = (source.name == source.full_path) ?
+          source.full_path : utils::xml::GetXMLFilePath(source.name);
+    if(full_path != source.full_path ||
+       FileChecksum(full_path) != source.checksum) {
+      SLOG("AlgConfigPool", pNOTICE)
+        << "Configuration snapshot is out of date (" << source.name
+        << " has changed) - Will parse XML & save";
+      return false;
+    }
+  }
+
+  // read everything first and only use it if the file is complete
+  map<string, string>    config_files;
+  vector<RegistryRecord> records;
+
+  uint32_t nfiles = 0;
+  if(!ReadUInt(in, nfiles)) return false;
+  for(uint32_t i = 0; i < nfiles; i++) {
+    string alg_name, file_name;
+    if(!ReadStr(in, alg_name) || !ReadStr(in, file_name)) return false;
+    config_files.insert(pair<string, string>(alg_name, file_name));
+  }
+
+  uint32_t nrecords = 0;
+  if(!ReadUInt(in, nrecords)) return false;
+  records.resize(nrecords);
+  for(uint32_t i = 0; i < nrecords; i++) {
+    RegistryRecord & record = records[i];
+    uint32_t nparams = 0;
+    if(!ReadStr(in, record.key) || !ReadStr(in, record.param_set) ||
+       !ReadUInt(in, nparams)) return false;
+    record.params.resize(nparams);
+    for(uint32_t j = 0; j < nparams; j++) {
+      ParamRecord & param = record.params[j];
+      if(!ReadStr(in, param.type) || !ReadStr(in, param.name) ||
+         !ReadStr(in, param.value)) return false;
+    }
+  }
+
+  uint32_t end = 0;
+  if(!ReadUInt(in, end) || end != nrecords) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Incomplete configuration snapshot: " << filename;
+    return false;
+  }
+
+  SLOG("AlgConfigPool", pNOTICE)
+    << "Loading algorithm configurations from snapshot: " << filename;
+
+  fConfigFiles = config_files;
+  vector<RegistryRecord>::const_iterator riter = records.begin();
+  for( ; riter != records.end(); ++riter) {
+    fConfigKeyList.push_back(riter->key);
+
+    Registry * config = new Registry(riter->param_set,false);
+    vector<ParamRecord>::const_iterator piter = riter->params.begin();
+    for( ; piter != riter->params.end(); ++piter) {
+      this->AddConfigParameter(config, piter->type, piter->name, piter->value);
+    }
+    config->SetName(riter->param_set);
+    config->Lock();
+
+    pair<string, Registry *> single_reg(riter->key, config);
+    fRegistryPool.insert(single_reg);
+  }
+  return true;
+}
+//____________________________________________________________________________
+bool AlgConfigPool::WriteSnapshot(string filename) const
+{
+// Write in a temporary file and rename it, so that concurrent jobs never
+// read a partially written snapshot
+
+  std::ostringstream tmpfilename;
+  tmpfilename << filename << ".tmp" << gSystem->GetPid();
+
+  std::ofstream out(tmpfilename.str().c_str(), std::ios::binary);
+  if(!out) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Could not create configuration snapshot: " << tmpfilename.str();
+    return false;
+  }
+
+  WriteStr (out, kSnapshotMagic);
+  WriteUInt(out, kSnapshotVersion);
+
+  WriteUInt(out, fSources.size());
+  vector<SourceRecord>::const_iterator siter = fSources.begin();
+  for( ; siter != fSources.end(); ++siter) {
+    WriteStr(out, siter->name);
+    WriteStr(out, siter->full_path);
+    WriteStr(out, siter->checksum);
+  }
+
+  WriteUInt(out, fConfigFiles.size());
+  map<string, string>::const_iterator fiter = fConfigFiles.begin();
+  for( ; fiter != fConfigFiles.end(); ++fiter) {
+    WriteStr(out, fiter->first);
+    WriteStr(out, fiter->second);
+  }
+
+  WriteUInt(out, fRecords.size());
+  vector<RegistryRecord>::const_iterator riter = fRecords.begin();
+  for( ; riter != fRecords.end(); ++riter) {
+    WriteStr (out, riter->key);
+    WriteStr (out, riter->param_set);
+    WriteUInt(out, riter->params.size());
+    vector<ParamRecord>::const_iterator piter = riter->params.begin();
+    for( ; piter != riter->params.end(); ++piter) {
+      WriteStr(out, piter->type);
+      WriteStr(out, piter->name);
+      WriteStr(out, piter->value);
+    }
+  }
+  // trailer, to detect truncated files
+  WriteUInt(out, fRecords.size());
+  out.close();
+
+  if(!out || std::rename(tmpfilename.str().c_str(), filename.c_str()) != 0) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Could not write configuration snapshot: " << filename;
+    gSystem->Unlink(tmpfilename.str().c_str());
+    return false;
+  }
+
+  SLOG("AlgConfigPool", pNOTICE)
+    << "Saved algorithm configurations in snapshot: " << filename;
+  return true;
+}
+//____________________________________________________________________________
 Registry * AlgConfigPool::FindRegistry(const Algorithm * algorithm) const
 {
   string key = algorithm->Id().Key();
@@ -6,6 +6,13 @@
 \brief    A singleton class holding all configuration registries built while
           parsing all loaded XML configuration files.
 
+          If the GALGCONFSNAPSHOT environmental variable points to a directory,
+          the parsed configuration is saved there in a binary snapshot, keyed
+          by the tune and the XML search path. Later jobs load the snapshot
+          instead of parsing the XML files. The snapshot stores the checksums
+          of all source files and is ignored (and re-written) if any of them
+          has changed or resolves to a different location.
+
 \author   Costas Andreopoulos <c.andreopoulos \at cern.ch>
           University of Liverpool
 
@@ -80,6 +87,12 @@ private:
   void   AddBasicParameter   (Registry * r, string pt, string pn, string pv);
   void   AddRootObjParameter (Registry * r, string pt, string pn, string pv);
 
+  // methods for the binary configuration snapshot
+  string SnapshotFilename    (void) const;
+  bool   LoadSnapshot        (string filename);
+  bool   WriteSnapshot       (string filename) const;
+  void   RecordSource        (string name, string full_path);
+
 
   static AlgConfigPool * fInstance;
 
@@ -88,6 +101,15 @@ private:
   vector<string>          fConfigKeyList; ///< list of all available configuration keys
   string                  fMasterConfig;  ///< lists config files for all algorithms
 
+  // parameters as read from the XML files, kept for writing the snapshot
+  struct ParamRecord    { string type, name, value; };
+  struct RegistryRecord { string key, param_set; vector<ParamRecord> params; };
+  struct SourceRecord   { string name, full_path, checksum; };
+
+  bool                    fRecording;     ///< record parsed parameters for the snapshot?
+  vector<RegistryRecord>  fRecords;       ///< parsed registries
+  vector<SourceRecord>    fSources;       ///< files the parsed registries came from
+
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
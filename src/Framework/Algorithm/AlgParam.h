@@ -0,0 +1,114 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AlgParam
+          genie::AlgSubAlgParam
+
+\brief    Typed handles to an algorithm configuration parameter / sub-algorithm.
+
+          A handle is declared once, with the parameter key, and is used in
+          place of Algorithm::GetParam() / Algorithm::SubAlg() in code which
+          runs after configuration. The value is looked up in the string
+          keyed configuration registries on first access only, and then
+          kept in the handle. The handle is refreshed automatically once the
+          configuration of the algorithm changes (eg when it is reconfigured
+          during event reweighting or in a fit), as every change of the
+          algorithm registries gives it a new configuration generation.
+
+          Example:
+            AlgParam<double> fMaParam("QEL-Ma");   // data member
+            ...
+            double Ma = fMaParam.Value(this);      // at run time
+
+          Note that a handle refers to the algorithm it was accessed with.
+          A parameter found in a sub-algorithm that is not owned by the
+          algorithm is not refreshed when only the sub-algorithm is
+          reconfigured.
+
+\author   The GENIE Collaboration
+
+\created  October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ALG_PARAM_H_
+#define _ALG_PARAM_H_
+
+#include <cassert>
+
+#include "Framework/Algorithm/Algorithm.h"
+
+namespace genie {
+
+template<class T> class AlgParam {
+
+public:
+  //! A parameter which must exist in the configuration
+  AlgParam(const RgKey & name) :
+    fName(name), fDefault(), fHasDefault(false),
+    fAlg(0), fGeneration(0), fValue() { }
+
+  //! A parameter with a default value, used if it is not configured
+  AlgParam(const RgKey & name, const T & def) :
+    fName(name), fDefault(def), fHasDefault(true),
+    fAlg(0), fGeneration(0), fValue() { }
+
+  const RgKey & Name (void) const { return fName; }
+
+  //! Value of the parameter in the configuration of the input algorithm
+  const T & Value (const Algorithm * alg) const
+  {
+    if(alg != fAlg || alg->ConfigGeneration() != fGeneration) {
+      if(fHasDefault) alg->GetParamDef(fName, fValue, fDefault);
+      else            alg->GetParam   (fName, fValue);
+      fAlg        = alg;
+      fGeneration = alg->ConfigGeneration();
+    }
+    return fValue;
+  }
+
+private:
+  RgKey   fName;                        ///< parameter key
+  T       fDefault;                     ///< default value
+  bool    fHasDefault;                  ///< is there a default value?
+
+  mutable const Algorithm * fAlg;       ///< algorithm the value was looked up from
+  mutable unsigned long     fGeneration;///< its configuration generation at the time
+  mutable T                 fValue;     ///< cached value
+};
+
+template<class T> class AlgSubAlgParam {
+
+public:
+  AlgSubAlgParam(const RgKey & name) :
+    fName(name), fAlg(0), fGeneration(0), fSubAlg(0) { }
+
+  const RgKey & Name (void) const { return fName; }
+
+  //! The sub-algorithm pointed to by the key, in the configuration of the
+  //! input algorithm
+  const T * Value (const Algorithm * alg) const
+  {
+    if(alg != fAlg || alg->ConfigGeneration() != fGeneration) {
+      fSubAlg = dynamic_cast<const T *>(alg->SubAlg(fName));
+      assert(fSubAlg);
+      fAlg        = alg;
+      fGeneration = alg->ConfigGeneration();
+    }
+    return fSubAlg;
+  }
+
+private:
+  RgKey fName;                          ///< sub-algorithm key
+
+  mutable const Algorithm * fAlg;       ///< algorithm the sub-algorithm was looked up from
+  mutable unsigned long     fGeneration;///< its configuration generation at the time
+  mutable const T *         fSubAlg;    ///< cached sub-algorithm
+};
+
+}      // genie namespace
+
+#endif // _ALG_PARAM_H_
@@ -35,6 +35,8 @@ namespace genie
   }
 }
 //____________________________________________________________________________
+unsigned long Algorithm::fLastConfigGeneration = 0;
+//____________________________________________________________________________
 Algorithm::Algorithm()
 {
   this->Initialize();
@@ -238,6 +240,7 @@ void Algorithm::FindConfig(void)
     delete fConfig ;
     fConfig = 0 ;
   }
+  NewConfigGeneration() ;
 
 }
 
@@ -340,6 +343,16 @@ void Algorithm::Initialize(void)
   fOwnsSubstruc   = false;
   fConfig         = 0;
   fOwnedSubAlgMp  = 0;
+
+  this->NewConfigGeneration();
+}
+//____________________________________________________________________________
+void Algorithm::NewConfigGeneration(void)
+{
+// Generations are unique across all algorithms, so that a parameter handle
+// never mistakes the configuration of one algorithm for that of another
+
+  fConfigGeneration = ++fLastConfigGeneration;
 }
 //____________________________________________________________________________
 const Algorithm * Algorithm::SubAlg(const RgKey & registry_key) const
@@ -457,6 +470,7 @@ void Algorithm::AdoptSubstructure(void)
     delete fConfig ;
     fConfig = 0 ;
   }
+  NewConfigGeneration() ;
 
 }
 //____________________________________________________________________________
@@ -482,6 +496,8 @@ void Algorithm::DeleteConfig(void)
     fConfig=0;
   }
 
+  NewConfigGeneration() ;
+
 }
 
 //____________________________________________________________________________
@@ -692,6 +708,7 @@ int Algorithm::AddTopRegistry( Registry * rp, bool own ) {
     delete fConfig ;
     fConfig = 0 ;
   }
+  NewConfigGeneration() ;
 
   return fConfVect.size() ;
 
@@ -708,6 +725,7 @@ int Algorithm::AddLowRegistry( Registry * rp, bool own ) {
     delete fConfig ;
     fConfig = 0 ;
   }
+  NewConfigGeneration() ;
 
   return fConfVect.size() ;
 
@@ -744,6 +762,7 @@ int  Algorithm::MergeTopRegistry( const Registry & r )  {
      delete fConfig ;
      fConfig = 0 ;
   }
+  NewConfigGeneration() ;
 
   return fConfVect.size() ;
 }
@@ -761,6 +780,7 @@ int Algorithm::AddTopRegisties( const vector<Registry*> & rs, bool own ) {
     delete fConfig ;
     fConfig = 0 ;
   }
+  NewConfigGeneration() ;
 
   return fConfVect.size() ;
 
@@ -100,6 +100,12 @@ public:
   //! Get algorithm status
   virtual AlgStatus_t GetStatus(void) const { return fStatus; }
 
+  //! Get configuration generation
+  //!  A number which changes every time the configuration registries of the
+  //!  algorithm change. Used by AlgParam / AlgSubAlgParam to find out when
+  //!  cached parameter values must be looked up again.
+  unsigned long ConfigGeneration(void) const { return fConfigGeneration; }
+
   //! Allow reconfigration after initializaton?
   //! Algorithms may opt-out, if reconfiguration is not necessary,
   //! to improve event reweighting speed.
@@ -212,10 +218,18 @@ protected:
                                                             ///< Otherwise an owned copy is added as a top registry
   int   AddTopRegisties( const vector<Registry*> & rs, bool owns = false ) ; ///< Add registries with top priority, also udated Ownerships
 
+  //! Parameter handles use GetParam()
+  template<class T> friend class AlgParam;
+
 private:
 
+  void NewConfigGeneration(void);
+
   Registry *   fConfig;        ///< Summary configuration derived from fConvVect, not necessarily allocated
 
+  unsigned long        fConfigGeneration;     ///< configuration generation, see ConfigGeneration()
+  static unsigned long fLastConfigGeneration; ///< last configuration generation given to any algorithm
+
 };
 
 }       // genie namespace
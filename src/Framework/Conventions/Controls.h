@@ -52,6 +52,11 @@ static const double kMaxY           = 1.-kASmallNum;
 // by the KNO hadronization model.
 static const int kMaxMultiplicity = 35;
 
+// Maximum hadronic multiplicity generated by the low-W KNO hadronizer. It is
+// set by the max number of particles accepted by the ROOT phase space decayer
+// and it sizes the multiplicity probability tables of AGKYLowW2019.
+static const int kMaxKNOMultiplicity = 18;
+
 // Maximum number of attempts by the KNO hadronizer for finding a valid f/s
 // hadronic system before going in error and quiting
 static const unsigned int kMaxKNOHadSystIterations = 400;
@@ -0,0 +1,178 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2025, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <chrono>
+#include <ctime>
+#include <fstream>
+
+#include <TSystem.h>
+
+#include "Framework/EventGen/EventGenProfiler.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+namespace {
+  // Escape a string for inclusion in a JSON document
+  string JSONString(const string & s)
+  {
+    string out = "\"";
+    for(string::const_iterator c = s.begin(); c != s.end(); ++c) {
+      if      (*c == '"' ) out += "\\\"";
+      else if (*c == '\\') out += "\\\\";
+      else if (*c == '\n') out += "\\n";
+      else                 out += *c;
+    }
+    out += "\"";
+    return out;
+  }
+}
+
+//____________________________________________________________________________
+EventGenProfiler * EventGenProfiler::fInstance = 0;
+//____________________________________________________________________________
+EventGenProfiler::EventGenProfiler() :
+fEnabled(false)
+{
+  fInstance = 0;
+
+  const char * filename = gSystem->Getenv("GEVGPROFILE");
+  if(filename) {
+    fEnabled  = true;
+    fFilename = filename;
+    LOG("EventGenProfiler", pNOTICE)
+      << "Event generation profiling is on. Report will be written in: "
+      << fFilename;
+  }
+}
+//____________________________________________________________________________
+EventGenProfiler::~EventGenProfiler()
+{
+  if(fEnabled) this->Write();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EventGenProfiler * EventGenProfiler::Instance()
+{
+  if(fInstance == 0) {
+    static EventGenProfiler::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EventGenProfiler;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+double EventGenProfiler::WallTime(void)
+{
+  return std::chrono::duration<double>(
+     std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+//____________________________________________________________________________
+double EventGenProfiler::CpuTime(void)
+{
+  return (double) std::clock() / CLOCKS_PER_SEC;
+}
+//____________________________________________________________________________
+string EventGenProfiler::ChannelKey(const Interaction * in)
+{
+  return (in) ? in->AsString() : "";
+}
+//____________________________________________________________________________
+bool EventGenProfiler::Key::operator < (const Key & other) const
+{
+  if(thread != other.thread) return thread < other.thread;
+  if(module != other.module) return module < other.module;
+  return channel < other.channel;
+}
+//____________________________________________________________________________
+EventGenProfiler::Entry & EventGenProfiler::GetEntry(
+  const string & thread, const string & module, const string & channel)
+{
+  Key key;
+  key.thread  = thread;
+  key.module  = module;
+  key.channel = channel;
+  return fEntries[key];
+}
+//____________________________________________________________________________
+void EventGenProfiler::AddCall(const string & thread, const string & module,
+  const string & channel, double wall, double cpu)
+{
+  if(!fEnabled) return;
+
+  Entry & entry = this->GetEntry(thread, module, channel);
+  entry.NCalls++;
+  entry.WallTime += wall;
+  entry.CpuTime  += cpu;
+}
+//____________________________________________________________________________
+void EventGenProfiler::AddException(const string & thread,
+  const string & module, const string & channel, bool step_back)
+{
+  if(!fEnabled) return;
+
+  Entry & entry = this->GetEntry(thread, module, channel);
+  entry.NExceptions++;
+  if(step_back) entry.NStepBacks++;
+}
+//____________________________________________________________________________
+void EventGenProfiler::AddRejectionTrials(const string & thread,
+  const string & module, const string & channel, long nevaluated,
+  long naccepted)
+{
+  if(!fEnabled) return;
+
+  Entry & entry = this->GetEntry(thread, module, channel);
+  entry.NEvaluated += nevaluated;
+  entry.NAccepted  += naccepted;
+}
+//____________________________________________________________________________
+void EventGenProfiler::Write(string filename) const
+{
+  if(filename.size() == 0) filename = fFilename;
+  if(filename.size() == 0) return;
+
+  std::ofstream out(filename.c_str());
+  if(!out) {
+    LOG("EventGenProfiler", pERROR)
+      << "Could not open profiling report file: " << filename;
+    return;
+  }
+  this->PrintJSON(out);
+}
+//____________________________________________________________________________
+void EventGenProfiler::PrintJSON(ostream & stream) const
+{
+  stream << "{\n  \"entries\": [";
+
+  map<Key, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    const Key   & key   = it->first;
+    const Entry & entry = it->second;
+    double eff = (entry.NEvaluated > 0) ?
+                 (double) entry.NAccepted / entry.NEvaluated : 0.;
+
+    stream << ((it == fEntries.begin()) ? "\n" : ",\n")
+           << "    { \"thread\": "      << JSONString(key.thread)
+           << ", \"module\": "          << JSONString(key.module)
+           << ", \"channel\": "         << JSONString(key.channel)
+           << ", \"calls\": "           << entry.NCalls
+           << ", \"wall_time\": "       << entry.WallTime
+           << ", \"cpu_time\": "        << entry.CpuTime
+           << ", \"exceptions\": "      << entry.NExceptions
+           << ", \"step_backs\": "      << entry.NStepBacks
+           << ", \"rej_evaluated\": "   << entry.NEvaluated
+           << ", \"rej_accepted\": "    << entry.NAccepted
+           << ", \"rej_efficiency\": "  << eff
+           << " }";
+  }
+  stream << "\n  ]\n}\n";
+}
+//____________________________________________________________________________
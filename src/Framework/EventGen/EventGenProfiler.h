@@ -0,0 +1,126 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EventGenProfiler
+
+\brief    Singleton accumulating event generation profiling information.
+
+          For every (event generation thread, module, interaction channel)
+          combination it records the number of calls, the wall and CPU time
+          spent in the module, the number of EVGThreadExceptions thrown and
+          of step-backs (retries) requested, and the number of kinematical
+          points evaluated / accepted by the module's rejection method (if
+          the module reports them).
+
+          Profiling is switched on by setting the GEVGPROFILE environmental
+          variable to the name of the output file. A JSON report is written
+          to that file at the end of the job (or whenever Write() is called).
+          When profiling is off, the only overhead is a flag check per
+          module call.
+
+\author   The GENIE Collaboration
+
+\created  October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_GEN_PROFILER_H_
+#define _EVENT_GEN_PROFILER_H_
+
+#include <map>
+#include <string>
+#include <ostream>
+
+using std::map;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class Interaction;
+
+class EventGenProfiler
+{
+public:
+  static EventGenProfiler * Instance(void);
+
+  //! Is profiling switched on?
+  bool IsEnabled (void) const { return fEnabled; }
+
+  //! High-resolution wall and CPU clocks (in sec)
+  static double WallTime (void);
+  static double CpuTime  (void);
+
+  //! Interaction channel key under which all profiling information for an
+  //! interaction is recorded (Interaction::AsString()). Module timing and
+  //! rejection method reporting both use it, so that the key format is
+  //! defined in one place.
+  static string ChannelKey (const Interaction * in);
+
+  //! Record a module call
+  void AddCall (const string & thread, const string & module,
+                const string & channel, double wall, double cpu);
+
+  //! Record an EVGThreadException thrown by a module, and whether it
+  //! requested a step-back to re-generate part of the event
+  void AddException (const string & thread, const string & module,
+                     const string & channel, bool step_back);
+
+  //! Record rejection method trials of a module
+  void AddRejectionTrials (const string & thread, const string & module,
+                           const string & channel, long nevaluated, long naccepted);
+
+  //! Write the JSON report (to the file given via GEVGPROFILE if no
+  //! filename is specified)
+  void Write (string filename = "") const;
+  void PrintJSON (ostream & stream) const;
+
+  struct Key {
+    string thread;
+    string module;
+    string channel;
+    bool operator < (const Key & other) const;
+  };
+  struct Entry {
+    Entry() : NCalls(0), WallTime(0), CpuTime(0), NExceptions(0),
+              NStepBacks(0), NEvaluated(0), NAccepted(0) { }
+    long   NCalls;
+    double WallTime;
+    double CpuTime;
+    long   NExceptions;
+    long   NStepBacks;
+    long   NEvaluated;
+    long   NAccepted;
+  };
+
+private:
+  EventGenProfiler();
+  EventGenProfiler(const EventGenProfiler & profiler);
+  virtual ~EventGenProfiler();
+
+  Entry & GetEntry (const string & thread, const string & module, const string & channel);
+
+  static EventGenProfiler * fInstance;
+
+  bool              fEnabled;  ///< is profiling switched on?
+  string            fFilename; ///< output file name
+  map<Key, Entry>   fEntries;  ///< accumulated profiling information
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EventGenProfiler::fInstance !=0) {
+            delete EventGenProfiler::fInstance;
+            EventGenProfiler::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVENT_GEN_PROFILER_H_
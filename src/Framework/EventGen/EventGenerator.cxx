@@ -22,6 +22,7 @@
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Conventions/Controls.h"
 #include "Framework/EventGen/EventGenerator.h"
+#include "Framework/EventGen/EventGenProfiler.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/GVldContext.h"
@@ -84,6 +85,16 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
   string mesgh = "Event generation thread: " + this->Id().Key() + 
                  " -> Running module: ";
 
+  //-- Profiling (if enabled): the event is attributed to the channel
+  //   selected before entering this thread
+  EventGenProfiler * profiler = EventGenProfiler::Instance();
+  bool profile = profiler->IsEnabled();
+  string channel = "";
+  if(profile) {
+    channel = EventGenProfiler::ChannelKey(event_rec->Summary());
+  }
+  double wall0 = 0, cpu0 = 0;
+
   //-- Loop over the event record processing modules
   int istep=0;
   vector<const EventRecordVisitorI *>::const_iterator miter;
@@ -103,9 +114,18 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
     }
     try
     {
+      if(profile) {
+        wall0 = EventGenProfiler::WallTime();
+        cpu0  = EventGenProfiler::CpuTime();
+      }
       fWatch->Start();
       visitor->ProcessEventRecord(event_rec);
       fWatch->Stop();
+      if(profile) {
+        profiler->AddCall(this->Id().Key(), visitor->Id().Key(), channel,
+                          EventGenProfiler::WallTime() - wall0,
+                          EventGenProfiler::CpuTime()  - cpu0);
+      }
       fRecHistory.AddSnapshot(istep, event_rec);
       (*fEVGTime)[istep] = fWatch->CpuTime(); // sec
     }
@@ -115,6 +135,14 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
            << "An exception was thrown and caught by EventGenerator!";
       LOG("EventGenerator", pNOTICE) << exception;
 
+      if(profile) {
+        profiler->AddCall(this->Id().Key(), visitor->Id().Key(), channel,
+                          EventGenProfiler::WallTime() - wall0,
+                          EventGenProfiler::CpuTime()  - cpu0);
+        profiler->AddException(this->Id().Key(), visitor->Id().Key(),
+                               channel, exception.StepBack());
+      }
+
       nexceptions++;
       if ( nexceptions > kMaxEVGThreadExceptions ) {
          LOG("EventGenerator", pFATAL)
@@ -164,11 +192,14 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
            // step we are about to return to
            LOG("EventGenerator", pNOTICE)
                   << "Restoring GHEP as it was just before the return step";
-           event_rec->ResetRecord();
            istep--;
-           GHepRecord * snapshot = fRecHistory[istep];
-           fRecHistory.PurgeRecentHistory(istep+1);
-           event_rec->Copy(*snapshot);
+           bool restored = fRecHistory.RestoreSnapshot(istep, event_rec);
+           if(!restored) {
+             LOG("EventGenerator", pFATAL)
+               << "No GHEP record history available for processing step "
+               << istep << " (check the GHEPHISTENABLE setting). Aborting";
+             exit(1);
+           }
          } // valid-return-step
       } // step-back
     } // catch exception
@@ -0,0 +1,87 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2025, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::fInstance = 0;
+//____________________________________________________________________________
+EventRecordPool::EventRecordPool() :
+fMaxSize(16),
+fNAllocated(0),
+fNRecycled(0)
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EventRecordPool::~EventRecordPool()
+{
+  LOG("EventRecordPool", pINFO)
+    << "Event records allocated: " << fNAllocated
+    << ", recycled: " << fNRecycled;
+
+  for(unsigned int i = 0; i < fFree.size(); i++) {
+    delete fFree[i];
+  }
+  fFree.clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::Instance()
+{
+  if(fInstance == 0) {
+    static EventRecordPool::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EventRecordPool;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+EventRecord * EventRecordPool::Get(const Interaction & summary)
+{
+  EventRecord * record = 0;
+  if(fFree.empty()) {
+    record = new EventRecord;
+    fNAllocated++;
+  } else {
+    record = fFree.back();
+    fFree.pop_back();
+    fNRecycled++;
+  }
+  record->CopySummary(summary);
+
+  return record;
+}
+//____________________________________________________________________________
+void EventRecordPool::Release(EventRecord * record)
+{
+  if(!record) return;
+
+  if(fFree.size() >= fMaxSize) {
+    delete record;
+    return;
+  }
+  record->Recycle();
+  fFree.push_back(record);
+}
+//____________________________________________________________________________
+void EventRecordPool::SetMaxSize(unsigned int n)
+{
+  fMaxSize = n;
+  while(fFree.size() > fMaxSize) {
+    delete fFree.back();
+    fFree.pop_back();
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,86 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EventRecordPool
+
+\brief    A pool of reusable EventRecord objects.
+
+          The interaction selectors bootstrap new events with records taken
+          from the pool. Event generation applications (and the drivers, for
+          rejected events) can hand records back to the pool, instead of
+          deleting them, once they are done with them. The pool recycles the
+          GHEP entry slots (and their 4-vectors), the interaction summary and
+          the vertex / flag objects of released records (see
+          GHepRecord::Recycle()), so that the event loop runs with almost no
+          memory allocation.
+          Records that are deleted rather than released are simply not
+          recycled.
+
+\author   The GENIE Collaboration
+
+\created  October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_RECORD_POOL_H_
+#define _EVENT_RECORD_POOL_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+class Interaction;
+
+class EventRecordPool
+{
+public:
+  static EventRecordPool * Instance(void);
+
+  //! Get an (empty) event record with a copy of the input interaction
+  //! summary attached. The caller adopts the record.
+  EventRecord * Get (const Interaction & summary);
+
+  //! Hand an event record back to the pool. The pool adopts the record.
+  void Release (EventRecord * record);
+
+  //! Maximum number of released records kept for reuse
+  void         SetMaxSize (unsigned int n);
+  unsigned int MaxSize    (void) const { return fMaxSize; }
+
+  unsigned int NFree      (void) const { return fFree.size(); }
+  long         NAllocated (void) const { return fNAllocated; }
+  long         NRecycled  (void) const { return fNRecycled;  }
+
+private:
+  EventRecordPool();
+  EventRecordPool(const EventRecordPool & pool);
+  virtual ~EventRecordPool();
+
+  static EventRecordPool * fInstance;
+
+  vector<EventRecord *> fFree;       ///< released records, ready for reuse
+  unsigned int          fMaxSize;    ///< maximum number of released records kept
+  long                  fNAllocated; ///< number of records allocated by the pool
+  long                  fNRecycled;  ///< number of records reused by the pool
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EventRecordPool::fInstance !=0) {
+            delete EventRecordPool::fInstance;
+            EventRecordPool::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVENT_RECORD_POOL_H_
@@ -21,6 +21,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/EventGeneratorList.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/ToyInteractionSelector.h"
@@ -227,11 +228,6 @@ void GEVGDriver::SetUnphysEventMask(const TBits & mask)
 //___________________________________________________________________________
 EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
 {
-  //-- Build initial state information from inputs
-  LOG("GEVGDriver", pINFO) << "Creating the initial state";
-  InitialState init_state(*fInitState);
-  init_state.SetProbeP4(nu4p);
-
   //-- Select the interaction to be generated (amongst the entries of the
   //   InteractionList assembled by the EventGenerators) and bootstrap the
   //   event record
@@ -242,7 +238,7 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
   if(!fCurrentRecord) {
      LOG("GEVGDriver", pWARN)
          << "No interaction could be selected for: "
-         << init_state.AsString() << " at E = " << nu4p.E() << " GeV";
+         << fInitState->AsString() << " at E = " << nu4p.E() << " GeV";
      return 0;
   }
 
@@ -309,7 +305,7 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
      } else {
        LOG("GEVGDriver", pWARN)
           << "The generated unphysical event is rejected";
-       delete fCurrentRecord;
+       EventRecordPool::Instance()->Release(fCurrentRecord);
        fCurrentRecord = 0;
        fNRecLevel++; // increase the nested level counter
 
@@ -485,6 +481,15 @@ void GEVGDriver::CreateXSecSumSpline(
   delete [] xsec;
 }
 //___________________________________________________________________________
+void GEVGDriver::SetXSecSumSpline(const Spline & spline)
+{
+// Use a previously computed total cross section spline (eg loaded from the
+// GMCJDriver init cache) instead of creating it with CreateXSecSumSpline()
+
+  if (fXSecSumSpl) delete fXSecSumSpl;
+  fXSecSumSpl = new Spline(spline);
+}
+//___________________________________________________________________________
 const Spline * GEVGDriver::XSecSpline(const Interaction * interaction) const
 {
 // Returns the cross section spline for the input interaction as was
@@ -93,6 +93,7 @@ public :
   // Methods used for building the 'total' cross section spline
   double XSecSum             (const TLorentzVector & nup4);
   void   CreateXSecSumSpline (int nk, double Emin, double Emax, bool inlogE=true);
+  void   SetXSecSumSpline    (const Spline & spline);
 
   // Get validity range (combined validity range of loaded evg threads)
   Range1D_t ValidEnergyRange (void) const;
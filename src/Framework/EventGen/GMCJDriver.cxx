@@ -9,10 +9,16 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
+#include <sstream>
 
 #include <TVector3.h>
+#include <TVectorD.h>
 #include <TSystem.h>
 #include <TStopwatch.h>
+#include <TMD5.h>
+#include <TParameter.h>
+#include <TRandom3.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/GBuild.h"
@@ -21,6 +27,7 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/EventGen/GMCJMetrics.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/GEVGPool.h"
 #include "Framework/EventGen/GFluxI.h"
@@ -396,6 +403,28 @@ void GMCJDriver::SaveFluxProbabilities(string outfilename)
   fFluxIntFileName = outfilename;
 }
 //___________________________________________________________________________
+void GMCJDriver::UseInitCache(string cache_dir, string geom_id)
+{
+// Products of the driver initialization that depend only on the job inputs
+// (the cross section sum splines for each initial state, the max path
+// lengths and the interaction probability scales) are read from / written
+// to a file in the specified directory. The file name is built from a hash
+// of everything these products depend on: the loaded cross section splines,
+// the tune, the event generator list, the flux neutrino and target lists,
+// the max flux energy, the spline and Pmax binning settings, and the
+// geometry.
+// The geometry is identified by the input geom_id string (eg a checksum of
+// the geometry file and the top volume name). If it is empty, the max path
+// lengths are computed (or loaded from the external file) in every job and
+// their values are used in the cache key instead.
+// With an init cache, Configure() leaves the random number generator state
+// unchanged by the max path length computation, so a job generates the same
+// events whether or not the cache file already existed.
+//
+  fInitCacheDir    = cache_dir;
+  fInitCacheGeomId = geom_id;
+}
+//___________________________________________________________________________
 void GMCJDriver::Configure(bool calc_prob_scales)
 {
   LOG("GMCJDriver", pNOTICE)
@@ -427,20 +456,51 @@ void GMCJDriver::Configure(bool calc_prob_scales)
   // them into the XSecSplineList
   this->BootstrapXSecSplines();
 
-  // Create cross section splines describing the total interaction xsec
-  // for a given initial state (Create them by summing all xsec splines
-  // for each possible initial state)
-  this->BootstrapXSecSplineSummation();
+  bool calc_pmax = calc_prob_scales && !fForceInteraction;
+
+  // Forget the max path lengths of any earlier configuration
+  fMaxPathLengths.clear();
 
-  if(calc_prob_scales && !fForceInteraction){
-    // Ask the input geometry driver to compute the max. path length for each
-    // material in the list of target materials (or load a precomputed list)
-    this->GetMaxPathLengthList();
+  // Computing the max path lengths draws random numbers (geometry
+  // navigation), which is skipped when they are loaded from the init cache.
+  // If an init cache is used, the random number generator state is restored
+  // once the init products are available, so that jobs with the same seed
+  // generate the same events whether the cache was found or not
+  bool use_cache = (fInitCacheDir.size() > 0);
+  TRandom3 rnd_state;
+  if(use_cache) rnd_state = RandomGen::Instance()->RndGeom();
+
+  // Look for the remaining init products in the init cache, if one is used
+  string cache_file = "";
+  if(use_cache) {
+    // without a geometry identifier, the max path lengths enter the key
+    if(calc_pmax && fInitCacheGeomId.size() == 0) {
+      this->GetMaxPathLengthList();
+    }
+    cache_file = this->InitCacheFilename(calc_pmax);
+  }
+  bool cached = (cache_file.size() > 0) &&
+                this->LoadInitCache(cache_file, calc_pmax);
+
+  if(!cached) {
+    // Create cross section splines describing the total interaction xsec
+    // for a given initial state (Create them by summing all xsec splines
+    // for each possible initial state)
+    this->BootstrapXSecSplineSummation();
+
+    if(calc_pmax){
+      // Ask the input geometry driver to compute the max. path length for each
+      // material in the list of target materials (or load a precomputed list)
+      if(fMaxPathLengths.size() == 0) this->GetMaxPathLengthList();
+
+      // Compute the max. interaction probability to scale all interaction
+      // probabilities to be computed by this driver
+      this->ComputeProbScales();
+    }
 
-    // Compute the max. interaction probability to scale all interaction
-    // probabilities to be computed by this driver
-    this->ComputeProbScales();
+    if(cache_file.size() > 0) this->SaveInitCache(cache_file, calc_pmax);
   }
+  if(use_cache) RandomGen::Instance()->RndGeom() = rnd_state;
   if (fForceInteraction) fGlobPmax = 1.;
   LOG("GMCJDriver", pNOTICE) << "Finished configuring GMCJDriver\n\n";
 }
@@ -490,6 +550,9 @@ void GMCJDriver::InitJob(void)
   fBrFluxPDG          = 0;
   fSumFluxIntProbs.clear();
 
+  fInitCacheDir       = "";
+  fInitCacheGeomId    = "";
+
   // Throw as many flux neutrinos as necessary till one has interacted
   // so that GenerateEvent() never  returns NULL (except when in error)
   this->KeepOnThrowingFluxNeutrinos(true);
@@ -846,6 +909,8 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
 // attempt generating a neutrino interaction by firing a single flux neutrino
 //
   RandomGen * rnd = RandomGen::Instance();
+  GMCJMetrics * metrics = GMCJMetrics::Instance();
+  metrics->Increment(kMJCGenerateTries);
 
   double Pno=0, Psum=0;
   double R = rnd->RndEvg().Rndm();
@@ -856,6 +921,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   if(!flux_ok) {
      LOG("GMCJDriver", pERROR)
         << "** Rejecting current flux neutrino (flux driver err)";
+     metrics->Increment(kMJCRejError);
      return 0;
   }
 
@@ -868,6 +934,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
     if(fCurPathLengths.AreAllZero()) {
        LOG("GMCJDriver", pNOTICE)
           << "** Rejecting current flux neutrino (misses generation volume)";
+       metrics->Increment(kMJCRejMissedGeometry);
        return 0;
     }
     Psum = this->ComputeInteractionProbabilities(false);
@@ -901,6 +968,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
          if(R>=1-Pno) {
     	   LOG("GMCJDriver", pNOTICE)  
                 << "** Rejecting current flux neutrino";
+           metrics->Increment(kMJCRejPreSelection);
   	   return 0;
          }
     } // preselect 
@@ -920,11 +988,13 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
       if(!pl_ok) {
          LOG("GMCJDriver", pERROR) 
             << "** Rejecting current flux neutrino (err computing path-lengths)";
+         metrics->Increment(kMJCRejError);
          return 0;
       }
       if(fCurPathLengths.AreAllZero()) {
          LOG("GMCJDriver", pNOTICE) 
             << "** Rejecting current flux neutrino (misses generation volume)";
+         metrics->Increment(kMJCRejMissedGeometry);
          return 0;
       }
       Psum = this->ComputeInteractionProbabilities(false /* <- actual PL */);
@@ -934,6 +1004,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
     if(TMath::Abs(Psum) < controls::kASmallNum){
       LOG("GMCJDriver", pNOTICE)
          << "** Rejecting current flux neutrino (has null interaction probability)";
+      metrics->Increment(kMJCRejNoInteraction);
       return 0;
     } 
 
@@ -968,6 +1039,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
     if(R>=1-Pno) {
        LOG("GMCJDriver", pNOTICE) 
           << "** Rejecting current flux neutrino";
+       metrics->Increment(kMJCRejNoInteraction);
        return 0;
     }
 
@@ -999,6 +1071,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   if(fSelTgtPdg==0) {
      LOG("GMCJDriver", pERROR)
         << "** Rejecting current flux neutrino (failed to select tgt!)";
+     metrics->Increment(kMJCRejError);
      return 0;
   }
 
@@ -1008,6 +1081,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   if(!fCurEvt) {
      LOG("GMCJDriver", pWARN)
         << "** Couldn't generate kinematics for selected interaction";
+     metrics->Increment(kMJCRejError);
      return 0;
   }
 
@@ -1031,6 +1105,8 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
     this->ComputeEventProbability();
   }
 
+  metrics->Increment(kMJCAccepted);
+
   return fCurEvt;
 }
 //___________________________________________________________________________
@@ -1041,7 +1117,14 @@ bool GMCJDriver::GenerateFluxNeutrino(void)
 //
   LOG("GMCJDriver", pNOTICE) << "Generating a flux neutrino";
 
+  GMCJMetrics * metrics = GMCJMetrics::Instance();
+  double t0 = metrics->IsEnabled() ? GMCJMetrics::WallTime() : 0;
+
   bool ok = fFluxDriver->GenerateNext();
+
+  if(metrics->IsEnabled()) {
+     metrics->AddTime(kMJTFlux, GMCJMetrics::WallTime() - t0);
+  }
   if(!ok) {
      LOG("GMCJDriver", pERROR)
          << "*** The flux driver couldn't generate a flux neutrino!!";
@@ -1049,6 +1132,7 @@ bool GMCJDriver::GenerateFluxNeutrino(void)
   }
 
   fNFluxNeutrinos++;
+  metrics->Increment(kMJCFluxNeutrinos);
   int                    nupdg = fFluxDriver -> PdgCode  ();
   const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
   const TLorentzVector & nux4  = fFluxDriver -> Position ();
@@ -1089,8 +1173,15 @@ bool GMCJDriver::ComputePathLengths(void)
   const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
   const TLorentzVector & nux4  = fFluxDriver -> Position ();
 
+  GMCJMetrics * metrics = GMCJMetrics::Instance();
+  double t0 = metrics->IsEnabled() ? GMCJMetrics::WallTime() : 0;
+
   fCurPathLengths = fGeomAnalyzer->ComputePathLengths(nux4, nup4);
 
+  if(metrics->IsEnabled()) {
+     metrics->AddTime(kMJTGeomPathLengths, GMCJMetrics::WallTime() - t0);
+  }
+
   LOG("GMCJDriver", pNOTICE) << fCurPathLengths;
 
   if(fCurPathLengths.size() == 0) {
@@ -1234,7 +1325,14 @@ void GMCJDriver::GenerateEventKinematics(void)
   // the selected initial state & neutrino 4-momentum
   LOG("GMCJDriver", pNOTICE)
           << "Asking the selected GEVGDriver object to generate an event";
+  GMCJMetrics * metrics = GMCJMetrics::Instance();
+  double t0 = metrics->IsEnabled() ? GMCJMetrics::WallTime() : 0;
+
   fCurEvt = evgdriver->GenerateEvent(nup4);
+
+  if(metrics->IsEnabled()) {
+     metrics->AddTime(kMJTKinematics, GMCJMetrics::WallTime() - t0);
+  }
 }
 //___________________________________________________________________________
 void GMCJDriver::GenerateVertexPosition(void)
@@ -1247,8 +1345,15 @@ void GMCJDriver::GenerateVertexPosition(void)
   const TLorentzVector & p4 = fFluxDriver->Momentum ();
   const TLorentzVector & x4 = fFluxDriver->Position ();
 
+  GMCJMetrics * metrics = GMCJMetrics::Instance();
+  double t0 = metrics->IsEnabled() ? GMCJMetrics::WallTime() : 0;
+
   const TVector3 & vtx = fGeomAnalyzer->GenerateVertex(x4, p4, fSelTgtPdg);
 
+  if(metrics->IsEnabled()) {
+     metrics->AddTime(kMJTGeomVertex, GMCJMetrics::WallTime() - t0);
+  }
+
   TVector3 origin(x4.X(), x4.Y(), x4.Z());
   origin-=vtx; // computes vector dr = origin - vtx
 
@@ -1364,3 +1469,231 @@ double GMCJDriver::PreGenFluxInteractionProbability()
   return fBrFluxIntProb/fGlobPmax;
 }
 //___________________________________________________________________________
+string GMCJDriver::InitCacheFilename(bool with_prob_scales)
+{
+// Build the init cache file name from a hash of all inputs of the
+// cached init products
+
+  std::ostringstream key;
+  key.precision(17);
+
+  key << "GMCJDriver init cache v1\n";
+  key << "tune: "   << XSecSplineList::Instance()->CurrentTune() << "\n";
+  key << "evgl: "   << fEventGenList << "\n";
+  key << "nu:";
+  PDGCodeList::const_iterator iter;
+  for(iter = fNuList.begin();  iter != fNuList.end();  ++iter) key << " " << *iter;
+  key << "\ntgt:";
+  for(iter = fTgtList.begin(); iter != fTgtList.end(); ++iter) key << " " << *iter;
+  key << "\nemax: "  << fEmax;
+  key << "\nxsnb: "  << fXSecSplineNbins;
+
+  if(with_prob_scales) {
+    key << "\npmax: " << fPmaxLogBinning << " " << fPmaxNbins
+        << " " << fPmaxSafetyFactor;
+    if(fInitCacheGeomId.size() > 0) {
+      key << "\ngeom: " << fInitCacheGeomId;
+      if(fUseExtMaxPl) {
+        TMD5 * md5 = TMD5::FileChecksum(fMaxPlXmlFilename.c_str());
+        if(md5) {
+          key << "\nmaxpl: " << md5->AsString();
+          delete md5;
+        }
+      }
+    } else {
+      key << "\nmaxpl:";
+      PathLengthList::const_iterator pliter = fMaxPathLengths.begin();
+      for( ; pliter != fMaxPathLengths.end(); ++pliter) {
+        key << " " << pliter->first << "=" << pliter->second;
+      }
+    }
+  }
+  key << "\n";
+
+  TMD5 md5;
+  string skey = key.str();
+  md5.Update((const UChar_t *) skey.data(), skey.size());
+
+  // the cross section splines are hashed by content, so that the key does
+  // not depend on where they were loaded from
+  XSecSplineList * xsl = XSecSplineList::Instance();
+  const vector<string> * spline_keys = xsl->GetSplineKeys();
+  if(spline_keys) {
+    vector<string>::const_iterator kiter = spline_keys->begin();
+    for( ; kiter != spline_keys->end(); ++kiter) {
+      const Spline * spl = xsl->GetSpline(*kiter);
+      if(!spl) continue;
+      md5.Update((const UChar_t *) kiter->data(), kiter->size());
+      for(int i = 0; i < spl->NKnots(); i++) {
+        double xy[2];
+        spl->GetKnot(i, xy[0], xy[1]);
+        md5.Update((const UChar_t *) xy, sizeof(xy));
+      }
+    }
+    delete spline_keys;
+  }
+  md5.Final();
+
+  std::ostringstream filename;
+  filename << fInitCacheDir << "/gmcjinit." << md5.AsString() << ".root";
+  return filename.str();
+}
+//___________________________________________________________________________
+bool GMCJDriver::LoadInitCache(string filename, bool with_prob_scales)
+{
+  if(gSystem->AccessPathName(filename.c_str())) {
+    LOG("GMCJDriver", pNOTICE)
+      << "No init cache file " << filename << " - Will compute & save";
+    return false;
+  }
+
+  TFile cache(filename.c_str(), "READ");
+  if(cache.IsZombie()) {
+    LOG("GMCJDriver", pWARN) << "Could not read init cache file: " << filename;
+    return false;
+  }
+
+  LOG("GMCJDriver", pNOTICE) << "Loading init products from: " << filename;
+
+  // read everything first and only use it if the file is complete
+  map<GEVGDriver *, Spline *> sum_splines;
+  map<int, TH1D *>            pmax;
+  PathLengthList              maxpl;
+  double                      glob_pmax = 0;
+  bool                        ok = true;
+
+  PDGCodeList::const_iterator nuiter;
+  PDGCodeList::const_iterator tgtiter;
+  for(nuiter = fNuList.begin(); ok && nuiter != fNuList.end(); ++nuiter) {
+    for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
+      std::ostringstream name;
+      name << "xsec_sum_" << *nuiter << "_" << *tgtiter;
+      TVectorD * E    = dynamic_cast<TVectorD *>(cache.Get((name.str()+"_E"   ).c_str()));
+      TVectorD * xsec = dynamic_cast<TVectorD *>(cache.Get((name.str()+"_xsec").c_str()));
+      InitialState init_state(*tgtiter, *nuiter);
+      GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+      if(E && xsec && evgdriver && E->GetNrows() == xsec->GetNrows()) {
+        sum_splines[evgdriver] = new Spline(
+           E->GetNrows(), E->GetMatrixArray(), xsec->GetMatrixArray());
+      } else {
+        ok = false;
+      }
+      delete E;
+      delete xsec;
+      if(!ok) break;
+    }
+  }
+
+  if(ok && with_prob_scales) {
+    for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+      std::ostringstream name;
+      name << "pmax_" << *nuiter;
+      TH1D * h = dynamic_cast<TH1D *>(cache.Get(name.str().c_str()));
+      if(!h) { ok = false; break; }
+      h->SetDirectory(0);
+      pmax[*nuiter] = h;
+    }
+    for(tgtiter = fTgtList.begin(); ok && tgtiter != fTgtList.end(); ++tgtiter) {
+      std::ostringstream name;
+      name << "maxpl_" << *tgtiter;
+      TParameter<double> * pl =
+         dynamic_cast<TParameter<double> *>(cache.Get(name.str().c_str()));
+      if(!pl) { ok = false; break; }
+      maxpl.SetPathLength(*tgtiter, pl->GetVal());
+      delete pl;
+    }
+    TParameter<double> * gp =
+       dynamic_cast<TParameter<double> *>(cache.Get("glob_pmax"));
+    if(gp) { glob_pmax = gp->GetVal(); delete gp; }
+    else   { ok = false; }
+  }
+  cache.Close();
+
+  if(!ok) {
+    LOG("GMCJDriver", pWARN)
+      << "Incomplete init cache file: " << filename << " - Will recompute";
+    map<GEVGDriver *, Spline *>::iterator siter = sum_splines.begin();
+    for( ; siter != sum_splines.end(); ++siter) delete siter->second;
+    map<int, TH1D *>::iterator piter = pmax.begin();
+    for( ; piter != pmax.end(); ++piter) delete piter->second;
+    return false;
+  }
+
+  map<GEVGDriver *, Spline *>::iterator siter = sum_splines.begin();
+  for( ; siter != sum_splines.end(); ++siter) {
+    siter->first->SetXSecSumSpline(*(siter->second));
+    delete siter->second;
+  }
+
+  if(with_prob_scales) {
+    map<int,TH1D*>::iterator pmax_iter = fPmax.begin();
+    for( ; pmax_iter != fPmax.end(); ++pmax_iter) delete pmax_iter->second;
+    fPmax           = pmax;
+    fMaxPathLengths = maxpl;
+    fGlobPmax       = glob_pmax;
+    LOG("GMCJDriver", pNOTICE)
+       << "Maximum path length list: " << fMaxPathLengths;
+    LOG("GMCJDriver", pNOTICE) << "*** Probability scale = " << fGlobPmax;
+  }
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::SaveInitCache(string filename, bool with_prob_scales)
+{
+// Write in a temporary file and rename it, so that concurrent jobs never
+// read a partially written cache file
+
+  std::ostringstream tmpfilename;
+  tmpfilename << filename << ".tmp" << gSystem->GetPid();
+
+  TFile cache(tmpfilename.str().c_str(), "RECREATE");
+  if(cache.IsZombie()) {
+    LOG("GMCJDriver", pWARN)
+      << "Could not create init cache file: " << tmpfilename.str();
+    return;
+  }
+
+  PDGCodeList::const_iterator nuiter;
+  PDGCodeList::const_iterator tgtiter;
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+    for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
+      InitialState init_state(*tgtiter, *nuiter);
+      GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+      const Spline * spl = evgdriver ? evgdriver->XSecSumSpline() : 0;
+      if(!spl) continue;
+      int nk = spl->NKnots();
+      TVectorD E(nk), xsec(nk);
+      for(int i = 0; i < nk; i++) spl->GetKnot(i, E[i], xsec[i]);
+      std::ostringstream name;
+      name << "xsec_sum_" << *nuiter << "_" << *tgtiter;
+      E.Write    ((name.str()+"_E"   ).c_str());
+      xsec.Write ((name.str()+"_xsec").c_str());
+    }
+  }
+
+  if(with_prob_scales) {
+    map<int,TH1D*>::const_iterator pmax_iter = fPmax.begin();
+    for( ; pmax_iter != fPmax.end(); ++pmax_iter) {
+      std::ostringstream name;
+      name << "pmax_" << pmax_iter->first;
+      pmax_iter->second->Write(name.str().c_str());
+    }
+    for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
+      std::ostringstream name;
+      name << "maxpl_" << *tgtiter;
+      TParameter<double> pl(name.str().c_str(), fMaxPathLengths.PathLength(*tgtiter));
+      pl.Write();
+    }
+    TParameter<double> gp("glob_pmax", fGlobPmax);
+    gp.Write();
+  }
+  cache.Close();
+
+  if(std::rename(tmpfilename.str().c_str(), filename.c_str()) != 0) {
+    LOG("GMCJDriver", pWARN) << "Could not write init cache file: " << filename;
+    gSystem->Unlink(tmpfilename.str().c_str());
+    return;
+  }
+  LOG("GMCJDriver", pNOTICE) << "Saved init products in: " << filename;
+}
+//___________________________________________________________________________
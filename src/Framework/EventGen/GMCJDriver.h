@@ -67,6 +67,7 @@ public :
   bool PreCalcFluxProbabilities    (void);
   bool LoadFluxProbabilities       (string filename);
   void SaveFluxProbabilities       (string outfilename);
+  void UseInitCache                (string cache_dir, string geom_id = "");
   void Configure                   (bool calc_prob_scales = true);
 
   // generate single neutrino event for input flux & geometry
@@ -105,6 +106,9 @@ private:
   void          ComputeEventProbability         (void);
   double        InteractionProbability          (double xsec, double pl, int A);
   double        PreGenFluxInteractionProbability(void);
+  string        InitCacheFilename               (bool with_prob_scales);
+  bool          LoadInitCache                   (string filename, bool with_prob_scales);
+  void          SaveInitCache                   (string filename, bool with_prob_scales);
 
   // private data members:
   GEVGPool *      fGPool;              ///< A pool of GEVGDrivers properly configured event generation drivers / one per init state
@@ -146,6 +150,8 @@ private:
   string          fFluxIntFileName;    ///< whether to save pre-generated flux tree for use in later jobs
   string          fFluxIntTreeName;    ///< name for tree holding flux probabilities
   map<int, double> fSumFluxIntProbs;   ///< map where the key is flux pdg code and the value is sum of fBrFluxWeight * fBrFluxIntProb for all these flux neutrinos
+  string          fInitCacheDir;       ///< [config] directory of the init cache (xsec sum splines, max path lengths, prob scales); none if empty
+  string          fInitCacheGeomId;    ///< [config] geometry identifier used in the init cache key
 };
 
 }      // genie namespace
@@ -0,0 +1,278 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2025, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <chrono>
+#include <ctime>
+#include <cstdio>
+#include <fstream>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <TSystem.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GMCJMetrics.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+namespace {
+  // Upper bucket bounds (in sec) of the timer histograms
+  const double kTimeBucketBounds[GMCJMetrics::kNTimeBuckets] = {
+    1E-6, 3E-6, 1E-5, 3E-5, 1E-4, 3E-4, 1E-3, 3E-3, 1E-2, 3E-2, 1E-1, 3E-1
+  };
+
+  const char * kCounterName[kNMJCounters] = {
+    "genie_mcjob_flux_neutrinos_total",
+    "genie_mcjob_generate_tries_total",
+    "genie_mcjob_flux_neutrinos_interacted_total",
+    "genie_mcjob_flux_neutrinos_rejected_total",
+    "genie_mcjob_flux_neutrinos_rejected_total",
+    "genie_mcjob_flux_neutrinos_rejected_total",
+    "genie_mcjob_flux_neutrinos_rejected_total",
+    "genie_mcjob_events_total"
+  };
+  const char * kCounterLabel[kNMJCounters] = {
+    "", "", "",
+    "reason=\"preselection\"",
+    "reason=\"missed_geometry\"",
+    "reason=\"no_interaction\"",
+    "reason=\"error\"",
+    ""
+  };
+  const char * kCounterHelp[kNMJCounters] = {
+    "Flux neutrinos thrown by the flux driver",
+    "Attempts to generate an event by firing a single flux neutrino",
+    "Flux neutrinos which were selected to interact",
+    "Flux neutrinos rejected, by reason",
+    0, 0, 0,
+    "Events processed by the job"
+  };
+  const char * kTimerLabel[kNMJTimers] = {
+    "flux", "geom_path_lengths", "geom_vertex", "kinematics"
+  };
+
+  // Escape a string for inclusion in a Prometheus label value
+  string LabelValue(const string & s)
+  {
+    string out = "\"";
+    for(string::const_iterator c = s.begin(); c != s.end(); ++c) {
+      if      (*c == '"' ) out += "\\\"";
+      else if (*c == '\\') out += "\\\\";
+      else if (*c == '\n') out += "\\n";
+      else                 out += *c;
+    }
+    out += "\"";
+    return out;
+  }
+}
+
+//____________________________________________________________________________
+GMCJMetrics * GMCJMetrics::fInstance = 0;
+//____________________________________________________________________________
+GMCJMetrics::GMCJMetrics() :
+fEnabled(false)
+{
+  fInstance = 0;
+
+  fStartWallTime = WallTime();
+  for(int i = 0; i < kNMJCounters; i++) {
+    fCounters[i] = 0;
+  }
+  for(int i = 0; i < kNMJTimers; i++) {
+    fTimeSum  [i] = 0;
+    fTimeCount[i] = 0;
+    for(int j = 0; j < kNTimeBuckets; j++) fTimeBuckets[i][j] = 0;
+  }
+
+  const char * filename = gSystem->Getenv("GMCJMONMETRICS");
+  if(filename) {
+    fEnabled  = true;
+    fFilename = filename;
+    LOG("GMCJMetrics", pNOTICE)
+      << "MC job metrics are on. Metrics will be written in: " << fFilename;
+  }
+}
+//____________________________________________________________________________
+GMCJMetrics::~GMCJMetrics()
+{
+  if(fEnabled) this->Write();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+GMCJMetrics * GMCJMetrics::Instance()
+{
+  if(fInstance == 0) {
+    static GMCJMetrics::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new GMCJMetrics;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+double GMCJMetrics::WallTime(void)
+{
+  return std::chrono::duration<double>(
+     std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+//____________________________________________________________________________
+double GMCJMetrics::MemoryHighWaterMark(void)
+{
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+  return (double) usage.ru_maxrss;          // ru_maxrss in bytes
+#else
+  return (double) usage.ru_maxrss * 1024.;  // ru_maxrss in kB -> bytes
+#endif
+}
+//____________________________________________________________________________
+double GMCJMetrics::MemoryResident(void)
+{
+// Read directly from /proc rather than through gSystem, as the final
+// metrics are written during static destruction
+#ifdef __linux__
+  std::ifstream statm("/proc/self/statm");
+  long size = 0, resident = 0;
+  if(!(statm >> size >> resident)) return 0;
+  return (double) resident * sysconf(_SC_PAGESIZE);
+#else
+  return 0;
+#endif
+}
+//____________________________________________________________________________
+void GMCJMetrics::AddTime(GMCJTimer_t timer, double seconds)
+{
+  if(!fEnabled) return;
+
+  fTimeSum  [timer] += seconds;
+  fTimeCount[timer] ++;
+  for(int j = 0; j < kNTimeBuckets; j++) {
+    if(seconds <= kTimeBucketBounds[j]) {
+      fTimeBuckets[timer][j]++;
+      break;
+    }
+  }
+}
+//____________________________________________________________________________
+void GMCJMetrics::AddEvent(const EventRecord * event)
+{
+  if(!fEnabled) return;
+
+  fCounters[kMJCEvents]++;
+
+  if(!event) return;
+  const Interaction * interaction = event->Summary();
+  if(!interaction) return;
+
+  const ProcessInfo & proc = interaction->ProcInfo();
+  pair<int,int> channel(proc.ScatteringTypeId(), proc.InteractionTypeId());
+  fChannelCounts[channel]++;
+}
+//____________________________________________________________________________
+void GMCJMetrics::Write(string filename) const
+{
+  if(filename.size() == 0) filename = fFilename;
+  if(filename.size() == 0) return;
+
+  // write a temporary file and rename it, so that readers never see a
+  // partially written file
+  string tmpfilename = filename + ".tmp";
+  std::ofstream out(tmpfilename.c_str());
+  if(!out) {
+    LOG("GMCJMetrics", pERROR)
+      << "Could not open metrics file: " << tmpfilename;
+    return;
+  }
+  this->PrintPrometheus(out);
+  out.close();
+
+  if(std::rename(tmpfilename.c_str(), filename.c_str()) != 0) {
+    LOG("GMCJMetrics", pERROR)
+      << "Could not write metrics file: " << filename;
+  }
+}
+//____________________________________________________________________________
+void GMCJMetrics::PrintPrometheus(ostream & stream) const
+{
+  double elapsed = WallTime() - fStartWallTime;
+
+  // counters
+  for(int i = 0; i < kNMJCounters; i++) {
+    if(kCounterHelp[i]) {
+      stream << "# HELP " << kCounterName[i] << " " << kCounterHelp[i] << "\n";
+      stream << "# TYPE " << kCounterName[i] << " counter\n";
+    }
+    stream << kCounterName[i];
+    if(kCounterLabel[i][0] != 0) stream << "{" << kCounterLabel[i] << "}";
+    stream << " " << fCounters[i] << "\n";
+  }
+
+  // average rates since the start of the job
+  stream << "# HELP genie_mcjob_event_rate Events per second (job average)\n"
+         << "# TYPE genie_mcjob_event_rate gauge\n"
+         << "genie_mcjob_event_rate "
+         << ((elapsed > 0) ? fCounters[kMJCEvents] / elapsed : 0.) << "\n";
+  stream << "# HELP genie_mcjob_flux_neutrino_rate Flux neutrinos thrown per second (job average)\n"
+         << "# TYPE genie_mcjob_flux_neutrino_rate gauge\n"
+         << "genie_mcjob_flux_neutrino_rate "
+         << ((elapsed > 0) ? fCounters[kMJCFluxNeutrinos] / elapsed : 0.) << "\n";
+  long ntries = fCounters[kMJCGenerateTries];
+  stream << "# HELP genie_mcjob_acceptance_fraction Fraction of GenerateEvent1Try attempts producing an interaction\n"
+         << "# TYPE genie_mcjob_acceptance_fraction gauge\n"
+         << "genie_mcjob_acceptance_fraction "
+         << ((ntries > 0) ? (double) fCounters[kMJCAccepted] / ntries : 0.) << "\n";
+
+  // timers
+  stream << "# HELP genie_mcjob_step_seconds Time spent in event generation steps\n"
+         << "# TYPE genie_mcjob_step_seconds histogram\n";
+  for(int i = 0; i < kNMJTimers; i++) {
+    long cumulative = 0;
+    for(int j = 0; j < kNTimeBuckets; j++) {
+      cumulative += fTimeBuckets[i][j];
+      stream << "genie_mcjob_step_seconds_bucket{step=\"" << kTimerLabel[i]
+             << "\",le=\"" << kTimeBucketBounds[j] << "\"} " << cumulative << "\n";
+    }
+    stream << "genie_mcjob_step_seconds_bucket{step=\"" << kTimerLabel[i]
+           << "\",le=\"+Inf\"} " << fTimeCount[i] << "\n";
+    stream << "genie_mcjob_step_seconds_sum{step=\""   << kTimerLabel[i]
+           << "\"} " << fTimeSum[i]   << "\n";
+    stream << "genie_mcjob_step_seconds_count{step=\"" << kTimerLabel[i]
+           << "\"} " << fTimeCount[i] << "\n";
+  }
+
+  // events per channel
+  stream << "# HELP genie_mcjob_channel_events_total Events per interaction channel\n"
+         << "# TYPE genie_mcjob_channel_events_total counter\n";
+  map<pair<int,int>, long>::const_iterator it = fChannelCounts.begin();
+  for( ; it != fChannelCounts.end(); ++it) {
+    ScatteringType_t  st = (ScatteringType_t)  it->first.first;
+    InteractionType_t it_type = (InteractionType_t) it->first.second;
+    stream << "genie_mcjob_channel_events_total{scattering="
+           << LabelValue(ScatteringType::AsString(st))
+           << ",interaction=" << LabelValue(InteractionType::AsString(it_type))
+           << "} " << it->second << "\n";
+  }
+
+  // process
+  stream << "# HELP genie_mcjob_elapsed_seconds Wall time since the start of the job\n"
+         << "# TYPE genie_mcjob_elapsed_seconds gauge\n"
+         << "genie_mcjob_elapsed_seconds " << elapsed << "\n";
+  stream << "# HELP genie_mcjob_cpu_seconds CPU time used by the job\n"
+         << "# TYPE genie_mcjob_cpu_seconds gauge\n"
+         << "genie_mcjob_cpu_seconds " << (double) std::clock() / CLOCKS_PER_SEC << "\n";
+  stream << "# HELP genie_mcjob_memory_resident_bytes Resident memory\n"
+         << "# TYPE genie_mcjob_memory_resident_bytes gauge\n"
+         << "genie_mcjob_memory_resident_bytes " << MemoryResident() << "\n";
+  stream << "# HELP genie_mcjob_memory_high_water_mark_bytes Peak resident memory\n"
+         << "# TYPE genie_mcjob_memory_high_water_mark_bytes gauge\n"
+         << "genie_mcjob_memory_high_water_mark_bytes " << MemoryHighWaterMark() << "\n";
+}
+//____________________________________________________________________________
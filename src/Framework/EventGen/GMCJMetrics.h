@@ -0,0 +1,125 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GMCJMetrics
+
+\brief    Singleton collecting run-time metrics of an MC job (counters and
+          timing histograms fed by the event generation drivers) and
+          exporting them in the Prometheus text exposition format.
+
+          Metrics are switched on by setting the GMCJMONMETRICS environmental
+          variable to the name of the output file. The file is re-written by
+          GMCJMonitor::Update() every GMCJMONREFRESH events (and at the end of
+          the job), atomically, so that it can be picked up while the job is
+          running (eg by a node-exporter text-file collector).
+          When metrics are off, the only overhead is a flag check in each
+          instrumented driver method.
+
+\author   The GENIE Collaboration
+
+\created  October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _G_MC_JOB_METRICS_H_
+#define _G_MC_JOB_METRICS_H_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <ostream>
+
+using std::map;
+using std::pair;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class EventRecord;
+
+// counters fed by the MC job drivers
+typedef enum EGMCJCounter {
+  kMJCFluxNeutrinos = 0,   ///< flux neutrinos thrown
+  kMJCGenerateTries,       ///< GMCJDriver::GenerateEvent1Try() calls
+  kMJCAccepted,            ///< flux neutrinos which interacted
+  kMJCRejPreSelection,     ///< rejected using the max path lengths
+  kMJCRejMissedGeometry,   ///< rejected: missed the generation volume
+  kMJCRejNoInteraction,    ///< rejected using the actual path lengths
+  kMJCRejError,            ///< rejected because of a driver error
+  kMJCEvents,              ///< events seen by the job monitor
+  kNMJCounters
+} GMCJCounter_t;
+
+// timers fed by the MC job drivers
+typedef enum EGMCJTimer {
+  kMJTFlux = 0,            ///< flux driver: GenerateNext()
+  kMJTGeomPathLengths,     ///< geometry swim: ComputePathLengths()
+  kMJTGeomVertex,          ///< geometry swim: GenerateVertex()
+  kMJTKinematics,          ///< event generation at the selected init state
+  kNMJTimers
+} GMCJTimer_t;
+
+class GMCJMetrics
+{
+public:
+  static GMCJMetrics * Instance(void);
+
+  //! Are metrics switched on?
+  bool IsEnabled (void) const { return fEnabled; }
+
+  //! Update counters / timers
+  void Increment (GMCJCounter_t counter, long n=1) { if(fEnabled) fCounters[counter] += n; }
+  void AddTime   (GMCJTimer_t timer, double seconds);
+
+  //! Record an event (counted per interaction channel)
+  void AddEvent  (const EventRecord * event);
+
+  //! Write the metrics (to the file given via GMCJMONMETRICS if no
+  //! filename is specified)
+  void Write (string filename = "") const;
+  void PrintPrometheus (ostream & stream) const;
+
+  //! Wall clock (in sec)
+  static double WallTime (void);
+
+  //! Peak / current resident memory of the process (in bytes)
+  static double MemoryHighWaterMark (void);
+  static double MemoryResident      (void);
+
+  static const int kNTimeBuckets = 12;
+
+private:
+  GMCJMetrics();
+  GMCJMetrics(const GMCJMetrics & metrics);
+  virtual ~GMCJMetrics();
+
+  static GMCJMetrics * fInstance;
+
+  bool   fEnabled;                               ///< are metrics switched on?
+  string fFilename;                              ///< output file name
+  double fStartWallTime;                         ///< wall time at job start
+  long   fCounters   [kNMJCounters];             ///< counter values
+  double fTimeSum    [kNMJTimers];               ///< sum of timer measurements
+  long   fTimeCount  [kNMJTimers];               ///< number of timer measurements
+  long   fTimeBuckets[kNMJTimers][kNTimeBuckets];///< timer histograms (non-cumulative)
+  map<pair<int,int>, long> fChannelCounts;       ///< events per (scattering, interaction) type
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (GMCJMetrics::fInstance !=0) {
+            delete GMCJMetrics::fInstance;
+            GMCJMetrics::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _G_MC_JOB_METRICS_H_
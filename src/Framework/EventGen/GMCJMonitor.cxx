@@ -17,6 +17,7 @@
 
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/GMCJMetrics.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/PrintUtils.h"
@@ -47,8 +48,13 @@ void GMCJMonitor::SetRefreshRate(int rate)
 //____________________________________________________________________________
 void GMCJMonitor::Update(int iev, const EventRecord * event)
 {
+  GMCJMetrics * metrics = GMCJMetrics::Instance();
+  metrics->AddEvent(event);
+
   if(iev%fRefreshRate) return; // continue only every fRefreshRate events
 
+  if(metrics->IsEnabled()) metrics->Write();
+
   fWatch.Stop();
   fCpuTime += (fWatch.CpuTime());
 
@@ -63,6 +69,8 @@ void GMCJMonitor::Update(int iev, const EventRecord * event)
                              << fCpuTime << " s" << endl;
   status << "Approximate processing time/event: "
                      << fCpuTime/(iev+1) << " s" << endl;
+  status << "Peak resident memory: "
+         << GMCJMetrics::MemoryHighWaterMark()/(1024.*1024.) << " MB" << endl;
 
   if(!event) status << "NULL" << endl;
   else       status << *event << endl;
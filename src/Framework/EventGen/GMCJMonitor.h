@@ -6,6 +6,8 @@
 \brief   Simple class to create & update MC job status files and env. vars.
          This is used to be able to keep track of an MC job status even when
          all output is suppressed or redirected to /dev/null.
+         If GMCJMONMETRICS is set, the machine-readable job metrics (see
+         GMCJMetrics) are exported at the same refresh rate.
 
 \author  Costas Andreopoulos <c.andreopoulos \at cern.ch>
  University of Liverpool
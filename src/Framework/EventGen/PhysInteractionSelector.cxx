@@ -20,6 +20,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/PhysInteractionSelector.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
@@ -178,7 +179,10 @@ EventRecord * PhysInteractionSelector::SelectInteraction
                << "Sum{xsec}(0->" << iint <<") = " << xseclist[iint];
 
      if( R < xseclist[iint] ) {
-       Interaction * selected_interaction = new Interaction (*ilst[iint]);
+       // bootstrap the event record (recycling a previously released one,
+       // if available) with a copy of the selected interaction
+       EventRecord * evrec = EventRecordPool::Instance()->Get(*ilst[iint]);
+       Interaction * selected_interaction = evrec->Summary();
        selected_interaction->InitStatePtr()->SetProbeP4(p4);
 
        // set the cross section for the selected interaction (just extract it
@@ -190,9 +194,6 @@ EventRecord * PhysInteractionSelector::SelectInteraction
        LOG("IntSel", pNOTICE)
          << "Selected interaction: " << selected_interaction->AsString();
 
-       // bootstrap the event record
-       EventRecord * evrec = new EventRecord;
-       evrec->AttachSummary(selected_interaction);
        evrec->SetXSec(xsec);
 
        return evrec;
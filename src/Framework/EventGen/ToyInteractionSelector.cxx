@@ -12,6 +12,7 @@
 
 #include "Framework/EventGen/ToyInteractionSelector.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
 #include "Framework/Interaction/Interaction.h"
@@ -64,16 +65,13 @@ EventRecord * ToyInteractionSelector::SelectInteraction
 
   Interaction * interaction = ilst[iint];
 
-  // clone interaction
-  Interaction * selected_interaction = new Interaction( *interaction );
+  // bootstrap the event record with a clone of the interaction
+  EventRecord * evrec = EventRecordPool::Instance()->Get(*interaction);
+  Interaction * selected_interaction = evrec->Summary();
   selected_interaction->InitStatePtr()->SetProbeP4(p4);
   LOG("IntSel", pINFO)
              << "Interaction to generate: \n" << *selected_interaction;
 
-  // bootstrap the event record
-  EventRecord * evrec = new EventRecord;
-  evrec->AttachSummary(selected_interaction);
-
   return evrec;
 }
 //___________________________________________________________________________
@@ -57,3 +57,17 @@ bool XSecAlgorithmI::ValidKinematics(const Interaction* interaction) const
   return true;
 }
 //___________________________________________________________________________
+void XSecAlgorithmI::XSecBatch(
+      Interaction* interaction, KinePhaseSpace_t kps, int npoints, int nkv,
+      const KineVar_t * kv, const double * values, double * xsec) const
+{
+  Kinematics * kine = interaction->KinePtr();
+  for(int ip = 0; ip < npoints; ip++) {
+    const double * point = values + ip*nkv;
+    for(int j = 0; j < nkv; j++) {
+      kine->SetKV(kv[j], point[j]);
+    }
+    xsec[ip] = this->XSec(interaction, kps);
+  }
+}
+//___________________________________________________________________________
@@ -20,6 +20,7 @@
 
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/Conventions/KineVar.h"
 #include "Framework/Interaction/Interaction.h"
 
 namespace genie {
@@ -42,6 +43,15 @@ public:
   //! Is the input kinematical point a physically allowed one?
   virtual bool ValidKinematics (const Interaction* i) const;
 
+  //! Compute the cross section for the input interaction at a batch of
+  //! kinematical points. Point ip sets the running values of the nkv
+  //! variables kv[] to values[ip*nkv ... ip*nkv+nkv-1]. On return, the input
+  //! interaction holds the last point. The default implementation loops over
+  //! XSec(); models able to evaluate several points at once may override it.
+  virtual void XSecBatch (Interaction* i, KinePhaseSpace_t k,
+                          int npoints, int nkv, const KineVar_t * kv,
+                          const double * values, double * xsec) const;
+
 protected:
   XSecAlgorithmI();
   XSecAlgorithmI(string name);
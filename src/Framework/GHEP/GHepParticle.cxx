@@ -9,6 +9,7 @@
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <cstring>
 #include <cassert>
 #include <iomanip>
 
@@ -420,13 +421,37 @@ void GHepParticle::Reset(void)
   this->Init();
 }
 //___________________________________________________________________________
-void GHepParticle::Clear(Option_t * /*option*/)
+void GHepParticle::Clear(Option_t * option)
 {
 // implement the Clear(Option_t *) method so that the GHepParticle when is a
 // member of a GHepRecord, gets deleted properly when calling TClonesArray's
 // Clear("C")
+// With option "K" (GHepRecord::Recycle() calls TClonesArray's Clear("C+K"))
+// the particle is re-initialized but its 4-vectors are kept, so that the
+// GHepRecord slot can be reused without any memory allocation
 
-  this->CleanUp();
+  bool keep = (option && strchr(option,'K'));
+  if(!keep) {
+    this->CleanUp();
+    return;
+  }
+
+  fPdgCode       = 0;
+  fStatus        = kIStUndefined;
+  fRescatterCode = -1;
+  fFirstMother   = -1;
+  fLastMother    = -1;
+  fFirstDaughter = -1;
+  fLastDaughter  = -1;
+  fPolzTheta     = -999;
+  fPolzPhi       = -999;
+  fIsBound       = false;
+  fRemovalEnergy = 0.;
+
+  if(fP4) fP4->SetPxPyPzE(0,0,0,0);
+  else    fP4 = new TLorentzVector(0,0,0,0);
+  if(fX4) fX4->SetXYZT(0,0,0,0);
+  else    fX4 = new TLorentzVector(0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::Print(ostream & stream) const
@@ -101,6 +101,15 @@ void GHepRecord::AttachSummary(Interaction * interaction)
   fInteraction = interaction;
 }
 //___________________________________________________________________________
+void GHepRecord::CopySummary(const Interaction & interaction)
+{
+// Attaches a copy of the input interaction summary, reusing the already
+// attached Interaction object (if any)
+
+  if(fInteraction) fInteraction->Copy(interaction);
+  else fInteraction = new Interaction(interaction);
+}
+//___________________________________________________________________________
 GHepParticle * GHepRecord::Particle(int position) const
 {
 // Returns the GHepParticle from the specified position of the event record.
@@ -506,7 +515,8 @@ void GHepRecord::AddParticle(const GHepParticle & p)
   LOG("GHEP", pINFO)
     << "Adding particle with pdgc = " << p.Pdg() << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(p);
+  GHepParticle * particle = (GHepParticle *) this->ConstructedAt(pos);
+  particle->Copy(p);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -525,7 +535,16 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(pdg,status, mom1,mom2,dau1,dau2, p, v);
+  GHepParticle * particle = (GHepParticle *) this->ConstructedAt(pos);
+  particle->Clear("K");
+  particle->SetPdgCode       (pdg);
+  particle->SetStatus        (status);
+  particle->SetFirstMother   (mom1);
+  particle->SetLastMother    (mom2);
+  particle->SetFirstDaughter (dau1);
+  particle->SetLastDaughter  (dau2);
+  particle->SetMomentum      (p);
+  particle->SetPosition      (v);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -545,8 +564,16 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ( (*this)[pos] ) GHepParticle (
-            pdg, status, mom1, mom2, dau1, dau2, px, py, pz, E, x, y, z, t);
+  GHepParticle * particle = (GHepParticle *) this->ConstructedAt(pos);
+  particle->Clear("K");
+  particle->SetPdgCode       (pdg);
+  particle->SetStatus        (status);
+  particle->SetFirstMother   (mom1);
+  particle->SetLastMother    (mom2);
+  particle->SetFirstDaughter (dau1);
+  particle->SetLastDaughter  (dau2);
+  particle->SetMomentum      (px, py, pz, E);
+  particle->SetPosition      (x, y, z, t);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -880,8 +907,50 @@ void GHepRecord::ResetRecord(void)
   this->InitRecord();
 }
 //___________________________________________________________________________
+void GHepRecord::Recycle(void)
+{
+// Resets the record, as ResetRecord() does, but keeps the allocated storage
+// for reuse: The GHepParticle slots (and their 4-vectors) are kept by the
+// TClonesArray and get recycled by subsequent insertions, and the vertex,
+// flag and mask objects are reset rather than re-allocated.
+// The attached summary is kept, so that it can be overwritten with
+// CopySummary().
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("GHEP", pDEBUG) << "Recycling GHepRecord";
+#endif
+  TClonesArray::Clear("C+K");
+  this->SetOwner(true);
+
+  fWeight       = 1.;
+  fProb         = 1.;
+  fXSec         = 0.;
+  fDiffXSec     = 0.;
+  fDiffXSecPhSp = kPSNull;
+
+  if(fVtx) fVtx->SetXYZT(0,0,0,0);
+  else     fVtx = new TLorentzVector(0,0,0,0);
+
+  if(!fEventFlags) fEventFlags = new TBits(GHepFlags::NFlags());
+  fEventFlags -> ResetAllBits(false);
+
+  if(!fEventMask) fEventMask = new TBits(GHepFlags::NFlags());
+  for(unsigned int i = 0; i < GHepFlags::NFlags(); i++) {
+   fEventMask->SetBitNumber(i, true);
+  }
+}
+//___________________________________________________________________________
 void GHepRecord::Clear(Option_t * opt)
 {
+  // release the 4-vectors of GHepParticle slots kept by Recycle() beyond the
+  // last entry (the ones up to the last entry are handled by TClonesArray)
+  if (fKeep) {
+    for(int i = this->GetEntriesFast(); i < fKeep->GetSize(); i++) {
+      GHepParticle * p = (GHepParticle *) fKeep->UncheckedAt(i);
+      if(p && p->TestBit(kNotDeleted)) p->Clear("");
+    }
+  }
+
   if (fInteraction) delete fInteraction;
   fInteraction=0;
 
@@ -906,18 +975,25 @@ void GHepRecord::Clear(Option_t * opt)
 //___________________________________________________________________________
 void GHepRecord::Copy(const GHepRecord & record)
 {
-  // clean up
-  this->ResetRecord();
+  // clean up (keeping the allocated storage for reuse)
+  this->Recycle();
 
   // copy event record entries
   unsigned int ientry = 0;
   GHepParticle * p = 0;
   TIter ghepiter(&record);
-  while ( (p = (GHepParticle *) ghepiter.Next()) )
-                              new ( (*this)[ientry++] ) GHepParticle(*p);
+  while ( (p = (GHepParticle *) ghepiter.Next()) ) {
+    GHepParticle * entry = (GHepParticle *) this->ConstructedAt(ientry++);
+    entry->Copy(*p);
+  }
 
   // copy summary
-  fInteraction = new Interaction( *record.fInteraction );
+  if(record.fInteraction) {
+    this->CopySummary( *record.fInteraction );
+  } else {
+    if(fInteraction) delete fInteraction;
+    fInteraction = 0;
+  }
 
   // copy flags & mask
   *fEventFlags = *(record.EventFlags());
@@ -58,6 +58,7 @@ public :
 
   virtual Interaction * Summary       (void) const;
   virtual void          AttachSummary (Interaction * interaction);
+  virtual void          CopySummary   (const Interaction & interaction);
 
   // Provide a simplified wrapper of the 'new with placement'
   // TClonesArray object insertion method
@@ -147,6 +148,7 @@ public :
   virtual void Copy        (const GHepRecord & record);
   virtual void Clear       (Option_t * opt="");
   virtual void ResetRecord (void);
+  virtual void Recycle     (void);
   virtual void CompactifyDaughterLists     (void);
   virtual void RemoveIntermediateParticles (void);
 
@@ -9,9 +9,11 @@
 //____________________________________________________________________________
 
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "Framework/GHEP/GHepRecordHistory.h"
 #include "Framework/GHEP/GHepRecord.h"
+#include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -29,14 +31,177 @@ namespace genie {
  }
 }
 //___________________________________________________________________________
+namespace {
+  bool SameVector(const TLorentzVector * a, const TLorentzVector * b)
+  {
+    if(!a || !b) return (a == b);
+    return (*a == *b);
+  }
+  // Compares all GHepParticle data members (GHepParticle::Compare() only
+  // looks at the PDG/status codes, the family links and the momentum)
+  bool SameEntry(const GHepParticle * a, const GHepParticle * b)
+  {
+    if(!a || !b) return (a == b);
+    return (a->Pdg()              == b->Pdg()              &&
+            a->Status()           == b->Status()           &&
+            a->RescatterCode()    == b->RescatterCode()    &&
+            a->FirstMother()      == b->FirstMother()      &&
+            a->LastMother()       == b->LastMother()       &&
+            a->FirstDaughter()    == b->FirstDaughter()    &&
+            a->LastDaughter()     == b->LastDaughter()     &&
+            a->IsBound()          == b->IsBound()          &&
+            a->RemovalEnergy()    == b->RemovalEnergy()    &&
+            a->PolzPolarAngle()   == b->PolzPolarAngle()   &&
+            a->PolzAzimuthAngle() == b->PolzAzimuthAngle() &&
+            SameVector(a->P4(), b->P4())                   &&
+            SameVector(a->X4(), b->X4()));
+  }
+  // Copies the summary, vertex, flags, weights and cross sections
+  void CopyHeader(const GHepRecord & from, GHepRecord & to)
+  {
+    Interaction * summary = to.Summary();
+    if(from.Summary()) {
+      if(summary) summary->Copy(*from.Summary());
+      else to.AttachSummary(new Interaction(*from.Summary()));
+    } else if(summary) {
+      delete summary;
+      to.AttachSummary(0);
+    }
+    to.SetVertex(*from.Vertex());
+    *to.EventFlags() = *from.EventFlags();
+    *to.EventMask()  = *from.EventMask();
+    to.SetWeight      (from.Weight());
+    to.SetProbability (from.Probability());
+    to.SetXSec        (from.XSec());
+    to.SetDiffXSec    (from.DiffXSec(), from.DiffXSecVars());
+  }
+}
+//___________________________________________________________________________
+GHepRecordHistory::JournalEntry::JournalEntry() :
+Step(-1),
+NEntries(0),
+NEntriesAfter(0),
+Summary(0),
+Weight(0),
+Prob(0),
+XSec(0),
+DiffXSec(0),
+DiffXSecPhSp(kPSNull)
+{
+
+}
+//___________________________________________________________________________
+GHepRecordHistory::JournalEntry::JournalEntry(const JournalEntry & entry) :
+Summary(0)
+{
+  *this = entry;
+}
+//___________________________________________________________________________
+GHepRecordHistory::JournalEntry::~JournalEntry()
+{
+  if(Summary) delete Summary;
+}
+//___________________________________________________________________________
+GHepRecordHistory::JournalEntry &
+  GHepRecordHistory::JournalEntry::operator = (const JournalEntry & entry)
+{
+  if(this == &entry) return *this;
+
+  Step          = entry.Step;
+  NEntries      = entry.NEntries;
+  NEntriesAfter = entry.NEntriesAfter;
+  Positions     = entry.Positions;
+  Particles     = entry.Particles;
+  Vertex        = entry.Vertex;
+  Flags         = entry.Flags;
+  Mask          = entry.Mask;
+  Weight        = entry.Weight;
+  Prob          = entry.Prob;
+  XSec          = entry.XSec;
+  DiffXSec      = entry.DiffXSec;
+  DiffXSecPhSp  = entry.DiffXSecPhSp;
+
+  if(Summary) delete Summary;
+  Summary = (entry.Summary) ? new Interaction(*entry.Summary) : 0;
+
+  return *this;
+}
+//___________________________________________________________________________
+void GHepRecordHistory::JournalEntry::Reset(void)
+{
+// The summary and the particle slots are kept, so that they can be reused
+// by the next step recorded in this journal entry
+
+  Step          = -1;
+  NEntries      = 0;
+  NEntriesAfter = 0;
+  Positions.clear();
+}
+//___________________________________________________________________________
+void GHepRecordHistory::JournalEntry::AddEntry(
+                                    int pos, const GHepParticle & particle)
+{
+// Saves a GHEP entry, copying it into an existing particle slot if there is
+// one left over from an earlier step
+
+  unsigned int n = Positions.size();
+  Positions.push_back(pos);
+  if(n < Particles.size()) Particles[n].Copy(particle);
+  else Particles.push_back(particle);
+}
+//___________________________________________________________________________
+void GHepRecordHistory::JournalEntry::SaveHeader(const GHepRecord & record)
+{
+  if(record.Summary()) {
+    if(Summary) Summary->Copy(*record.Summary());
+    else Summary = new Interaction(*record.Summary());
+  } else if(Summary) {
+    delete Summary;
+    Summary = 0;
+  }
+  Vertex       = *record.Vertex();
+  Flags        = *record.EventFlags();
+  Mask         = *record.EventMask();
+  Weight       = record.Weight();
+  Prob         = record.Probability();
+  XSec         = record.XSec();
+  DiffXSec     = record.DiffXSec();
+  DiffXSecPhSp = record.DiffXSecVars();
+}
+//___________________________________________________________________________
+void GHepRecordHistory::JournalEntry::LoadHeader(GHepRecord & record) const
+{
+  Interaction * summary = record.Summary();
+  if(Summary) {
+    if(summary) summary->Copy(*Summary);
+    else record.AttachSummary(new Interaction(*Summary));
+  } else if(summary) {
+    delete summary;
+    record.AttachSummary(0);
+  }
+  record.SetVertex(Vertex);
+  *record.EventFlags() = Flags;
+  *record.EventMask()  = Mask;
+  record.SetWeight      (Weight);
+  record.SetProbability (Prob);
+  record.SetXSec        (XSec);
+  record.SetDiffXSec    (DiffXSec, DiffXSecPhSp);
+}
+//___________________________________________________________________________
 GHepRecordHistory::GHepRecordHistory() :
-map<int, GHepRecord*>()
+map<int, GHepRecord*>(),
+fBootstrap(0),
+fCurrent(0),
+fNJournal(0)
 {
   this->ReadFlags();
 }
 //___________________________________________________________________________
 GHepRecordHistory::GHepRecordHistory(const GHepRecordHistory & history) :
-map<int, GHepRecord*>()
+map<int, GHepRecord*>(),
+fBootstrap(0),
+fCurrent(0),
+fNJournal(0)
 {
   this->Copy(history);
   this->ReadFlags();
@@ -45,11 +210,16 @@ map<int, GHepRecord*>()
 GHepRecordHistory::~GHepRecordHistory()
 {
   this->PurgeHistory();
+  if(fBootstrap) delete fBootstrap;
+  if(fCurrent)   delete fCurrent;
 }
 //___________________________________________________________________________
 void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
 {
-// Adds a GHepRecord 'snapshot' at the history buffer
+// Adds a GHepRecord 'snapshot' at the history buffer.
+// A full copy is made only for the record that bootstrapped the generation
+// cycle (step = -1), into a record kept from event to event. Subsequent
+// processing steps are journaled.
 
   bool go_on = (fEnabledFull || (fEnabledBootstrapStep && step==-1));
   if(!go_on) return;
@@ -60,21 +230,157 @@ void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
     return;
   }
 
-  if( this->count(step) == 0 ) {
+  if(step == -1) {
+    if( this->count(step) == 0 ) {
 
-     LOG("GHEP", pNOTICE)
+       LOG("GHEP", pNOTICE)
                      << "Adding GHEP snapshot for processing step: " << step;
 
-     GHepRecord * snapshot = new GHepRecord(*record);
-     this->insert( map<int, GHepRecord*>::value_type(step,snapshot));
+       if(fBootstrap) fBootstrap->Copy(*record);
+       else fBootstrap = new GHepRecord(*record);
+       this->insert( map<int, GHepRecord*>::value_type(step,fBootstrap));
 
-  } else {
+       // start journaling from the bootstrap record
+       if(fEnabledFull) {
+         if(fCurrent) fCurrent->Copy(*record);
+         else fCurrent = new GHepRecord(*record);
+         fNJournal = 0;
+       }
+    } else {
+       LOG("GHEP", pWARN)
+        << "GHEP snapshot for processing step: " << step << " already exists!";
+    }
+    return;
+  }
+
+  if(!fCurrent || this->count(-1) == 0) {
+    LOG("GHEP", pWARN)
+      << "No bootstrap GHEP snapshot. Processing step: " << step
+      << " is not added at history record";
+    return;
+  }
+
+  if(fNJournal > 0 && fJournal[fNJournal-1].Step >= step) {
      // If you have already stepped back and reprocessing, then you should
      // have purged the 'recent' history (corresponing to 'after the return
      // processing step')
      LOG("GHEP", pWARN)
       << "GHEP snapshot for processing step: " << step << " already exists!";
+     return;
+  }
+
+  this->Journal(step, *record);
+}
+//___________________________________________________________________________
+bool GHepRecordHistory::RestoreSnapshot(int step, GHepRecord * record)
+{
+// Restores the input GHepRecord as it was after the input processing step
+// (step = -1 corresponds to the record that bootstrapped the generation
+// cycle) and purges the history recorded after that step.
+// Returns false if no history is available for the input step.
+
+  if(!record) return false;
+
+  LOG("GHEP", pNOTICE)
+       << "Restoring GHEP snapshot for processing step: " << step;
+
+  if(step == -1) {
+    GHepRecordHistory::const_iterator history_iter = this->find(step);
+    if(history_iter == this->end() || !history_iter->second) {
+      LOG("GHEP", pWARN)
+        << "No GHEP snapshot for processing step: " << step;
+      return false;
+    }
+    record->Copy(*(history_iter->second));
+    if(fCurrent) fCurrent->Copy(*(history_iter->second));
+    fNJournal = 0;
+    return true;
   }
+
+  bool found = false;
+  for(unsigned int ij = 0; ij < fNJournal; ij++) {
+    if(fJournal[ij].Step == step) found = true;
+  }
+  if(!found) {
+    LOG("GHEP", pWARN)
+      << "No GHEP snapshot for processing step: " << step;
+    return false;
+  }
+
+  this->PurgeRecentHistory(step+1);
+  record->Copy(*fCurrent);
+
+  return true;
+}
+//___________________________________________________________________________
+void GHepRecordHistory::Journal(int step, const GHepRecord & record)
+{
+// Records the changes made to the GHEP record by the input processing step
+// and brings the internal record (as it was after the last journaled step)
+// up to date
+
+  if(fNJournal == fJournal.size()) fJournal.push_back(JournalEntry());
+
+  JournalEntry & entry = fJournal[fNJournal];
+  entry.Reset();
+
+  int nbefore = fCurrent->GetEntriesFast();
+  int nafter  = record.GetEntriesFast();
+  int ncommon = TMath::Min(nbefore, nafter);
+
+  entry.Step          = step;
+  entry.NEntries      = nbefore;
+  entry.NEntriesAfter = nafter;
+  entry.SaveHeader(*fCurrent);
+
+  // modified entries
+  for(int i = 0; i < ncommon; i++) {
+    GHepParticle * before = (GHepParticle *) fCurrent->At(i);
+    GHepParticle * after  = (GHepParticle *) record.At(i);
+    if(SameEntry(before, after)) continue;
+    entry.AddEntry(i, *before);
+    *before = *after;
+  }
+  // removed entries
+  for(int i = ncommon; i < nbefore; i++) {
+    entry.AddEntry(i, *((GHepParticle *) fCurrent->At(i)));
+  }
+  for(int i = nbefore-1; i >= ncommon; i--) {
+    fCurrent->RemoveAt(i);
+  }
+  // appended entries
+  for(int i = ncommon; i < nafter; i++) {
+    GHepParticle * appended = (GHepParticle *) fCurrent->ConstructedAt(i);
+    appended->Copy( *((GHepParticle *) record.At(i)) );
+  }
+
+  CopyHeader(record, *fCurrent);
+
+  fNJournal++;
+
+  LOG("GHEP", pINFO)
+    << "Journaled GHEP changes for processing step: " << step
+    << " (" << entry.Positions.size() << " entries modified or removed, "
+    << TMath::Max(0, nafter-nbefore) << " appended)";
+}
+//___________________________________________________________________________
+void GHepRecordHistory::Undo(const JournalEntry & entry)
+{
+// Brings the internal record back to its state before the processing step
+// described by the input journal entry
+
+  // remove appended entries
+  for(int i = fCurrent->GetEntriesFast()-1; i >= entry.NEntries; i--) {
+    fCurrent->RemoveAt(i);
+  }
+  // restore modified / removed entries
+  for(unsigned int k = 0; k < entry.Positions.size(); k++) {
+    int pos = entry.Positions[k];
+    GHepParticle * p = (GHepParticle *) fCurrent->ConstructedAt(pos);
+    p->Copy(entry.Particles[k]);
+  }
+
+  entry.LoadHeader(*fCurrent);
 }
 //___________________________________________________________________________
 void GHepRecordHistory::PurgeHistory(void)
@@ -89,13 +395,17 @@ void GHepRecordHistory::PurgeHistory(void)
     LOG("GHEP", pINFO)
                   << "Deleting GHEP snapshot for processing step: " << step;
 
+    // the bootstrap record is kept for reuse
     GHepRecord * record = history_iter->second;
-    if(record) {
+    if(record && record != fBootstrap) {
       delete record;
       record = 0;
     }
   }
   this->clear();
+
+  // journal entries (and the internal record) are kept for reuse
+  fNJournal = 0;
 }
 //___________________________________________________________________________
 void GHepRecordHistory::PurgeRecentHistory(int start_step)
@@ -104,6 +414,8 @@ void GHepRecordHistory::PurgeRecentHistory(int start_step)
 // (marked 0,1,2,...). A special snapshot corresponding to the event record
 // before any processing step is added with key = -1.
 // Therefore GHepRecordHistory keys should be: -1,0,1,2,3,...
+// Only the step -1 snapshot is kept in full: The journal entries for steps
+// >= start_step are undone in reverse order.
 
   LOG("GHEP", pNOTICE)
        << "Purging recent GHEP history buffer (processing step >= "
@@ -121,16 +433,12 @@ void GHepRecordHistory::PurgeRecentHistory(int start_step)
     return;
   }
 
-  GHepRecordHistory::iterator history_iter;
-  for(history_iter = this->begin();
-                              history_iter != this->end(); ++history_iter) {
-
-    if(history_iter->first >= start_step) {
-       int step = history_iter->first;
-       LOG("GHEP", pINFO)
-                  << "Deleting GHEP snapshot for processing step: " << step;
-       this->erase(history_iter);
-    }
+  while(fNJournal > 0 && fJournal[fNJournal-1].Step >= start_step) {
+    LOG("GHEP", pINFO)
+       << "Undoing GHEP changes for processing step: "
+       << fJournal[fNJournal-1].Step;
+    this->Undo(fJournal[fNJournal-1]);
+    fNJournal--;
   }
 }
 //___________________________________________________________________________
@@ -142,23 +450,40 @@ void GHepRecordHistory::Copy(const GHepRecordHistory & history)
   for(history_iter = history.begin();
                            history_iter != history.end(); ++history_iter) {
 
-    unsigned int step   = history_iter->first;
+    int          step   = history_iter->first;
     GHepRecord * record = history_iter->second;
 
-    this->AddSnapshot(step, record);
+    if(!record) continue;
+
+    GHepRecord * snapshot = 0;
+    if(step == -1) {
+      if(fBootstrap) fBootstrap->Copy(*record);
+      else fBootstrap = new GHepRecord(*record);
+      snapshot = fBootstrap;
+    } else {
+      snapshot = new GHepRecord(*record);
+    }
+    this->insert( map<int, GHepRecord*>::value_type(step, snapshot));
+  }
+
+  if(history.fCurrent) {
+    if(fCurrent) fCurrent->Copy(*history.fCurrent);
+    else fCurrent = new GHepRecord(*history.fCurrent);
   }
+  fJournal  = history.fJournal;
+  fNJournal = history.fNJournal;
 }
 //___________________________________________________________________________
 void GHepRecordHistory::Print(ostream & stream) const
 {
   stream << "\n ****** Printing GHEP record history"
-                              << " [depth: " << this->size() << "]" << endl;
+         << " [depth: " << this->size() + fNJournal << "]" << endl;
 
   GHepRecordHistory::const_iterator history_iter;
   for(history_iter = this->begin();
                               history_iter != this->end(); ++history_iter) {
 
-    unsigned int step   = history_iter->first;
+    int          step   = history_iter->first;
     GHepRecord * record = history_iter->second;
 
     stream << "\n[After processing step = " << step << "] :";
@@ -170,6 +495,19 @@ void GHepRecordHistory::Print(ostream & stream) const
       stream << *record;
     }
   }
+
+  for(unsigned int ij = 0; ij < fNJournal; ij++) {
+    const JournalEntry & entry = fJournal[ij];
+    int nremoved = TMath::Max(0, entry.NEntries - entry.NEntriesAfter);
+    stream << "\n[After processing step = " << entry.Step << "] : "
+           << entry.Positions.size() - nremoved << " entries modified, "
+           << TMath::Max(0, entry.NEntriesAfter - entry.NEntries)
+           << " appended, " << nremoved << " removed";
+  }
+  if(fNJournal > 0 && fCurrent) {
+    stream << "\n[After processing step = " << fJournal[fNJournal-1].Step
+           << "] :" << *fCurrent;
+  }
 }
 //___________________________________________________________________________
 void GHepRecordHistory::ReadFlags(void)
@@ -183,6 +521,8 @@ void GHepRecordHistory::ReadFlags(void)
 
   } else {
      // set defaults
+     // (no module steps back further than the bootstrap record, so the
+     // full history is only kept on request)
      fEnabledFull          = false;
      fEnabledBootstrapStep = true;
   }
@@ -9,6 +9,15 @@
           sequence if a processing step is to be re-run (this the GENIE event
           generation framework equivalent of an 'Undo')
 
+          Only the record that bootstrapped the generation cycle (step -1) is
+          kept as a full snapshot. When the full history is enabled, each
+          subsequent processing step is recorded as a journal entry holding
+          only the GHEP entries it modified, appended or removed (plus the
+          record summary, vertex, flags, weights and cross sections as they
+          were before the step). Stepping back replays the journal in reverse.
+          The full history is off by default (set GHEPHISTENABLE=FULL to
+          enable it).
+
 \author   Costas Andreopoulos <c.andreopoulos \at cern.ch>
           University of Liverpool
 
@@ -25,15 +34,24 @@
 #include <map>
 #include <string>
 #include <ostream>
+#include <vector>
+
+#include <TBits.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/GHEP/GHepParticle.h"
 
 using std::map;
 using std::string;
 using std::ostream;
+using std::vector;
 
 namespace genie {
 
 class GHepRecordHistory;
 class GHepRecord;
+class Interaction;
 
 ostream & operator << (ostream & stream, const GHepRecordHistory & history);
 
@@ -46,6 +64,7 @@ public :
   ~GHepRecordHistory();
 
   void AddSnapshot        (int step, GHepRecord * r);
+  bool RestoreSnapshot    (int step, GHepRecord * r);
   void PurgeHistory       (void);
   void PurgeRecentHistory (int start_step);
   void ReadFlags          (void);
@@ -57,8 +76,45 @@ public :
 
 private:
 
+  // Undo information for a single processing step
+  class JournalEntry {
+  public:
+    JournalEntry();
+    JournalEntry(const JournalEntry & entry);
+   ~JournalEntry();
+    JournalEntry & operator = (const JournalEntry & entry);
+
+    void Reset      (void);
+    void AddEntry   (int pos, const GHepParticle & particle);
+    void SaveHeader (const GHepRecord & record);
+    void LoadHeader (GHepRecord & record) const;
+
+    int                  Step;           ///< processing step
+    int                  NEntries;       ///< number of GHEP entries before the step
+    int                  NEntriesAfter;  ///< number of GHEP entries after the step
+    vector<int>          Positions;      ///< positions of modified / removed entries
+    vector<GHepParticle> Particles;      ///< modified / removed entries, before the step (first Positions.size() slots in use)
+    Interaction *        Summary;        ///< summary before the step
+    TLorentzVector       Vertex;         ///< vertex before the step
+    TBits                Flags;          ///< event flags before the step
+    TBits                Mask;           ///< event mask before the step
+    double               Weight;         ///< event weight before the step
+    double               Prob;           ///< event probability before the step
+    double               XSec;           ///< cross section before the step
+    double               DiffXSec;       ///< differential cross section before the step
+    KinePhaseSpace_t     DiffXSecPhSp;   ///< differential cross section variables before the step
+  };
+
+  void Journal (int step, const GHepRecord & record);
+  void Undo    (const JournalEntry & entry);
+
   bool fEnabledFull;          ///< keep the full GHEP record history
   bool fEnabledBootstrapStep; ///< keep only the record that bootsrapped the generation cycle
+
+  GHepRecord *         fBootstrap; //! bootstrap record (step = -1), reused from event to event
+  GHepRecord *         fCurrent;  //! record as it was after the last journaled step
+  vector<JournalEntry> fJournal;  //! journal (entries are reused from event to event)
+  unsigned int         fNJournal; //! number of journal entries in use
 };
 
 }      // genie namespace
@@ -13,6 +13,9 @@
 #pragma link C++ class genie::NtpMCRecHeader;
 #pragma link C++ class genie::NtpMCRecordI;
 #pragma link C++ class genie::NtpMCEventRecord-;
+#pragma link C++ class genie::NtpMCEventSummary;
+#pragma link C++ class genie::NtpMCEventVisitorI;
+#pragma link C++ class genie::NtpMCEventScanner;
 #pragma link C++ class genie::NtpWriter;
 
 #endif
@@ -0,0 +1,422 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2025, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <iostream>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TBranch.h>
+#include <TChain.h>
+#include <TChainElement.h>
+#include <TMath.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCEventScanner.h"
+#include "Framework/Ntuple/NtpMCEventVisitorI.h"
+#include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpMCTreeHeader.h"
+#include "Framework/Utils/StringUtils.h"
+
+using namespace genie;
+
+namespace {
+  void FlushOutput(void)
+  {
+    std::cout.flush();
+    std::cerr.flush();
+    fflush(0);
+  }
+}
+
+//____________________________________________________________________________
+NtpMCEventScanner::NtpMCEventScanner() :
+fCounted(false),
+fFirst(-1),
+fLast(-1),
+fNWorkers(1),
+fCacheSize(30000000),
+fCurFile(-1),
+fCurEntry(-1),
+fSumOnly(false),
+fFile(0),
+fTree(0),
+fRecBranch(0),
+fSumBranch(0),
+fRecord(new NtpMCEventRecord),
+fRecLoaded(false)
+{
+
+}
+//____________________________________________________________________________
+NtpMCEventScanner::~NtpMCEventScanner()
+{
+  this->CloseFile();
+  delete fRecord;
+}
+//____________________________________________________________________________
+void NtpMCEventScanner::AddFiles(string filenames)
+{
+  vector<string> patterns = utils::str::Split(filenames, ",");
+  vector<string>::const_iterator it = patterns.begin();
+  for( ; it != patterns.end(); ++it) {
+    string pattern = utils::str::TrimSpaces(*it);
+    if(pattern.size() == 0) continue;
+
+    // let TChain expand the wildcards
+    TChain chain("gtree");
+    chain.Add(pattern.c_str());
+    TIter next_file(chain.GetListOfFiles());
+    TChainElement * element = 0;
+    while (( element = (TChainElement *) next_file() )) {
+      fFiles.push_back(element->GetTitle());
+    }
+  }
+  fCounted = false;
+}
+//____________________________________________________________________________
+void NtpMCEventScanner::SetEntryRange(Long64_t first, Long64_t last)
+{
+  fFirst = first;
+  fLast  = last;
+}
+//____________________________________________________________________________
+Long64_t NtpMCEventScanner::NEntries(void)
+{
+  if(!this->CountEntries()) return 0;
+  if(fFiles.size() == 0) return 0;
+
+  Long64_t ntot  = fFileOffsets.back() + fFileEntries.back();
+  Long64_t first = (fFirst < 0) ? 0      : fFirst;
+  Long64_t last  = (fLast  < 0) ? ntot-1 : TMath::Min(fLast, ntot-1);
+  return TMath::Max((Long64_t)0, last-first+1);
+}
+//____________________________________________________________________________
+Long64_t NtpMCEventScanner::GlobalEntry(void) const
+{
+  if(fCurFile < 0) return -1;
+  return fFileOffsets[fCurFile] + fCurEntry;
+}
+//____________________________________________________________________________
+NtpMCEventRecord * NtpMCEventScanner::Record(void)
+{
+  if(!fRecLoaded && fRecBranch) {
+    fRecBranch->GetEntry(fCurEntry);
+    fRecLoaded = true;
+  }
+  return (fRecLoaded) ? fRecord : 0;
+}
+//____________________________________________________________________________
+EventRecord * NtpMCEventScanner::Event(void)
+{
+  NtpMCEventRecord * rec = this->Record();
+  return (rec) ? rec->event : 0;
+}
+//____________________________________________________________________________
+EventRecord * NtpMCEventScanner::ReadEvent(Long64_t global_entry)
+{
+  if(!this->CountEntries()) return 0;
+
+  int ifile = -1;
+  for(unsigned int i = 0; i < fFiles.size(); i++) {
+    if(global_entry >= fFileOffsets[i] &&
+       global_entry <  fFileOffsets[i] + fFileEntries[i]) {
+      ifile = i;
+      break;
+    }
+  }
+  if(ifile < 0) {
+    LOG("Ntp", pERROR) << "No input event with global entry " << global_entry;
+    return 0;
+  }
+  if(ifile != fCurFile || !fTree || fSumOnly) {
+    if(!this->OpenFile(ifile, false)) return 0;
+  }
+
+  this->ClearRecord();
+  fCurEntry = global_entry - fFileOffsets[ifile];
+  return this->Event();
+}
+//____________________________________________________________________________
+bool NtpMCEventScanner::Run(NtpMCEventVisitorI & visitor)
+{
+  if(!this->CountEntries()) return false;
+
+  int nworkers = this->BuildTasks();
+
+  LOG("Ntp", pNOTICE)
+    << "Scanning " << this->NEntries() << " events from " << fFiles.size()
+    << " file(s) in " << fTasks.size() << " task(s) using "
+    << nworkers << " worker process(es)";
+
+  if(nworkers == 1) {
+    bool ok = this->RunWorker(0, 1, visitor);
+    if(ok) visitor.Merge(1);
+    return ok;
+  }
+
+  // Fork the worker processes. Everything buffered so far is flushed first,
+  // so that it is not written out again by the children.
+  FlushOutput();
+
+  vector<pid_t> pids;
+  bool ok = true;
+  for(int iw = 0; iw < nworkers; iw++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("Ntp", pERROR) << "Could not start worker process " << iw;
+      ok = false;
+      break;
+    }
+    if(pid == 0) {
+      bool wok = this->RunWorker(iw, nworkers, visitor);
+      FlushOutput();
+      _exit(wok ? 0 : 1);
+    }
+    pids.push_back(pid);
+  }
+
+  for(unsigned int iw = 0; iw < pids.size(); iw++) {
+    int status = 0;
+    bool wok = (waitpid(pids[iw], &status, 0) == pids[iw]) &&
+               WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+    if(!wok) {
+      LOG("Ntp", pERROR) << "Worker process " << iw << " failed";
+      ok = false;
+    }
+  }
+  if(!ok) return false;
+
+  visitor.Merge(nworkers);
+  return true;
+}
+//____________________________________________________________________________
+bool NtpMCEventScanner::CountEntries(void)
+{
+  if(fCounted) return true;
+
+  fFileEntries.clear();
+  fFileOffsets.clear();
+
+  Long64_t offset = 0;
+  for(unsigned int ifile = 0; ifile < fFiles.size(); ifile++) {
+    const string & filename = fFiles[ifile];
+    TFile * file = TFile::Open(filename.c_str(), "READ");
+    if(!file || file->IsZombie()) {
+      LOG("Ntp", pERROR) << "Could not open input file: " << filename;
+      delete file;
+      return false;
+    }
+
+    Long64_t nentries = 0;
+    NtpMCTreeHeader * thdr =
+       dynamic_cast <NtpMCTreeHeader *> ( file->Get("header") );
+    TTree * tree = dynamic_cast <TTree *> ( file->Get("gtree") );
+    if(thdr) {
+      LOG("Ntp", pINFO) << "Input tree header: " << *thdr;
+    }
+    if(thdr && thdr->format != kNFGHEP) {
+      LOG("Ntp", pWARN)
+        << "Unsupported event tree format ("
+        << NtpMCFormat::AsString(thdr->format) << ") in " << filename
+        << ". Skipping file...";
+    } else if(!tree) {
+      LOG("Ntp", pWARN)
+        << "No GHEP tree found in " << filename << ". Skipping file...";
+    } else {
+      nentries = tree->GetEntries();
+    }
+    delete thdr;
+    file->Close();
+    delete file;
+
+    fFileEntries.push_back(nentries);
+    fFileOffsets.push_back(offset);
+    offset += nentries;
+  }
+
+  fCounted = true;
+  return true;
+}
+//____________________________________________________________________________
+int NtpMCEventScanner::BuildTasks(void)
+{
+// Splits the selected entries into tasks at file and cluster boundaries
+// and assigns contiguous blocks of tasks to the workers.
+// Returns the number of workers actually used.
+
+  fTasks.clear();
+  this->CloseFile();
+
+  Long64_t nsel = this->NEntries();
+  if(nsel == 0) return 1;
+
+  Long64_t ntot   = fFileOffsets.back() + fFileEntries.back();
+  Long64_t gfirst = (fFirst < 0) ? 0      : fFirst;
+  Long64_t glast  = (fLast  < 0) ? ntot-1 : TMath::Min(fLast, ntot-1);
+
+  for(unsigned int ifile = 0; ifile < fFiles.size(); ifile++) {
+    if(fFileEntries[ifile] == 0) continue;
+    Long64_t first = TMath::Max(gfirst - fFileOffsets[ifile], (Long64_t)0);
+    Long64_t last  = TMath::Min(glast  - fFileOffsets[ifile], fFileEntries[ifile]-1);
+    if(first > last) continue;
+
+    Task task;
+    task.File   = ifile;
+    task.Worker = 0;
+
+    if(fNWorkers == 1) {
+      // no need to look at the clusters
+      task.First = first;
+      task.Last  = last;
+      fTasks.push_back(task);
+      continue;
+    }
+
+    if(!this->OpenFile(ifile, false)) continue;
+    TTree::TClusterIterator clusters = fTree->GetClusterIterator(first);
+    Long64_t start = 0;
+    while( (start = clusters()) <= last ) {
+      task.First = TMath::Max(start, first);
+      task.Last  = TMath::Min(clusters.GetNextEntry()-1, last);
+      fTasks.push_back(task);
+    }
+    this->CloseFile();
+  }
+
+  int nworkers = TMath::Min(fNWorkers, (int)fTasks.size());
+  nworkers = TMath::Max(nworkers, 1);
+
+  Long64_t ndone = 0;
+  vector<Task>::iterator it = fTasks.begin();
+  for( ; it != fTasks.end(); ++it) {
+    it->Worker = TMath::Min(nworkers-1, (int)(ndone*nworkers/nsel));
+    ndone += it->Last - it->First + 1;
+  }
+
+  return nworkers;
+}
+//____________________________________________________________________________
+bool NtpMCEventScanner::RunWorker(
+   int iworker, int nworkers, NtpMCEventVisitorI & visitor)
+{
+  bool summary_only = !visitor.NeedsEventRecord();
+  bool ok = true;
+
+  visitor.BeginWorker(iworker, nworkers);
+
+  vector<Task>::const_iterator it = fTasks.begin();
+  for( ; it != fTasks.end(); ++it) {
+    if(it->Worker != iworker) continue;
+
+    if(it->File != fCurFile || !fTree) {
+      if(!this->OpenFile(it->File, summary_only)) { ok = false; break; }
+    }
+    if(fCacheSize > 0) {
+      fTree->SetCacheEntryRange(it->First, it->Last+1);
+    }
+
+    bool more = true;
+    for(Long64_t i = it->First; i <= it->Last; i++) {
+      fCurEntry = i;
+      fRecLoaded = false;
+      if(fSumOnly) {
+        fSumBranch->GetEntry(i);
+      } else {
+        this->Record();
+        if(fSumBranch) fSumBranch->GetEntry(i);
+        else fSummary.Fill(fRecord->hdr.ievent, *fRecord->event);
+      }
+      more = visitor.Visit(*this);
+      this->ClearRecord();
+      if(!more) break;
+    }
+    if(!more) break;
+  }
+
+  visitor.EndWorker(iworker);
+  this->CloseFile();
+
+  return ok;
+}
+//____________________________________________________________________________
+bool NtpMCEventScanner::OpenFile(int ifile, bool summary_only)
+{
+  this->CloseFile();
+
+  const string & filename = fFiles[ifile];
+  fFile = TFile::Open(filename.c_str(), "READ");
+  if(!fFile || fFile->IsZombie()) {
+    LOG("Ntp", pERROR) << "Could not open input file: " << filename;
+    this->CloseFile();
+    return false;
+  }
+  fTree = dynamic_cast <TTree *> ( fFile->Get("gtree") );
+  if(!fTree) {
+    LOG("Ntp", pERROR) << "No GHEP tree found in " << filename;
+    this->CloseFile();
+    return false;
+  }
+
+  fTree->SetBranchAddress("gmcrec", &fRecord);
+  fRecBranch = fTree->GetBranch("gmcrec");
+  fSumBranch = fTree->GetBranch("gsum");
+  if(fSumBranch) {
+    fTree->SetBranchAddress("gsum", (void *) &fSummary);
+  }
+  fSumOnly = summary_only && (fSumBranch != 0);
+  fCurFile = ifile;
+
+  LOG("Ntp", pINFO)
+    << "Reading " << (fSumOnly ? "event summaries" : "events")
+    << " from: " << filename;
+
+  EnableReadCache(fTree, fCacheSize, fSumOnly ? "gsum" : "*");
+  return true;
+}
+//____________________________________________________________________________
+void NtpMCEventScanner::CloseFile(void)
+{
+  this->ClearRecord();
+  if(fFile) {
+    fFile->Close();
+    delete fFile;
+  }
+  fFile      = 0;
+  fTree      = 0;
+  fRecBranch = 0;
+  fSumBranch = 0;
+  fSumOnly   = false;
+  fCurFile   = -1;
+  fCurEntry  = -1;
+}
+//____________________________________________________________________________
+void NtpMCEventScanner::ClearRecord(void)
+{
+  // clear out explicitly to prevent memory leak w/Root6
+  if(fRecLoaded) fRecord->Clear();
+  fRecLoaded = false;
+}
+//____________________________________________________________________________
+void NtpMCEventScanner::EnableReadCache(
+   TTree * tree, Long64_t nbytes, string branches)
+{
+  if(!tree || nbytes <= 0) return;
+
+  tree->SetCacheSize(nbytes);
+  tree->AddBranchToCache(branches.c_str(), kTRUE);
+  tree->StopCacheLearningPhase();
+}
+//____________________________________________________________________________
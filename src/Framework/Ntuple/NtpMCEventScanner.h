@@ -0,0 +1,142 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCEventScanner
+
+\brief   Runs an NtpMCEventVisitorI over the events of one or more GHEP event
+         trees.
+
+         The input files (wildcards accepted) and an optional global entry
+         range are split into tasks at file and TTree cluster boundaries.
+         The tasks are distributed, in contiguous blocks, among a number of
+         forked worker processes, each of which reads its entries through a
+         TTreeCache. The visitor merges the worker outputs in worker order.
+
+         Visitors which do not need the full event record for every event
+         only read the flat event summary branch ("gsum", see
+         NtpMCEventSummary) and de-serialize the full NtpMCEventRecord on
+         request for selected events. For files written before the summary
+         branch was added, the summary is computed from the full record.
+
+\author  The GENIE Collaboration
+
+\created October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_EVENT_SCANNER_H_
+#define _NTP_MC_EVENT_SCANNER_H_
+
+#include <string>
+#include <vector>
+
+#include <Rtypes.h>
+
+#include "Framework/Ntuple/NtpMCEventSummary.h"
+
+class TFile;
+class TTree;
+class TBranch;
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+class NtpMCEventRecord;
+class NtpMCEventVisitorI;
+
+class NtpMCEventScanner {
+
+public :
+  NtpMCEventScanner();
+ ~NtpMCEventScanner();
+
+  //! Add input files (comma-separated list, wildcards accepted)
+  void AddFiles (string filenames);
+
+  //! Scan only global entries first...last (inclusive, counting entries
+  //! across all input files in order). Use -1 for no limit.
+  void SetEntryRange (Long64_t first, Long64_t last);
+
+  //! Number of worker processes (1: scan in the calling process)
+  void SetNWorkers (int nworkers) { fNWorkers = (nworkers > 1) ? nworkers : 1; }
+
+  //! TTreeCache size in bytes (0 disables the cache)
+  void SetCacheSize (Long64_t nbytes) { fCacheSize = nbytes; }
+
+  //! Input files and events
+  int              NFiles     (void) const { return (int) fFiles.size(); }
+  const string &   File       (int ifile) const { return fFiles[ifile]; }
+  Long64_t         NEntries   (void);
+
+  //! Run the visitor over all selected entries. Returns false if the
+  //! input could not be read or if a worker process failed.
+  bool Run (NtpMCEventVisitorI & visitor);
+
+  //! Current event (valid within NtpMCEventVisitorI::Visit())
+  int                       CurrentFileIdx (void) const { return fCurFile;  }
+  const string &            CurrentFile    (void) const { return fFiles[fCurFile]; }
+  Long64_t                  CurrentEntry   (void) const { return fCurEntry; }
+  Long64_t                  GlobalEntry    (void) const;
+  const NtpMCEventSummary & Summary        (void) const { return fSummary;  }
+  NtpMCEventRecord *        Record         (void);
+  EventRecord *             Event          (void);
+
+  //! Current input GHEP tree, eg for reading additional (flux pass-through)
+  //! branches. Valid within Visit() and until the scan moves to the next
+  //! input file, ie. as long as CurrentFileIdx() does not change.
+  TTree *                   Tree           (void) const { return fTree; }
+
+  //! Random access to the full event record of a global entry.
+  //! The returned record is valid until the next read.
+  EventRecord * ReadEvent (Long64_t global_entry);
+
+  //! Set up a TTreeCache for the input branches of a tree
+  static void EnableReadCache (TTree * tree, Long64_t nbytes, string branches = "*");
+
+private:
+
+  struct Task {
+    int      File;   ///< input file index
+    Long64_t First;  ///< first entry in file
+    Long64_t Last;   ///< last entry in file (inclusive)
+    int      Worker; ///< worker process index
+  };
+
+  bool CountEntries (void);
+  int  BuildTasks   (void);
+  bool RunWorker    (int iworker, int nworkers, NtpMCEventVisitorI & visitor);
+  bool OpenFile     (int ifile, bool summary_only);
+  void CloseFile    (void);
+  void ClearRecord  (void);
+
+  vector<string>   fFiles;        ///< input files
+  vector<Long64_t> fFileEntries;  ///< number of entries in each input file
+  vector<Long64_t> fFileOffsets;  ///< global entry number of first entry in each file
+  bool             fCounted;      ///< input files already inspected?
+  vector<Task>     fTasks;        ///< scan tasks
+  Long64_t         fFirst;        ///< first global entry to scan
+  Long64_t         fLast;         ///< last global entry to scan
+  int              fNWorkers;     ///< number of worker processes
+  Long64_t         fCacheSize;    ///< TTreeCache size
+
+  int                fCurFile;    ///< current file index
+  Long64_t           fCurEntry;   ///< current entry in current file
+  bool               fSumOnly;    ///< reading only the summary branch?
+  TFile *            fFile;       ///< current file
+  TTree *            fTree;       ///< current GHEP tree
+  TBranch *          fRecBranch;  ///< current event record branch
+  TBranch *          fSumBranch;  ///< current event summary branch (null if absent)
+  NtpMCEventRecord * fRecord;     ///< current event record
+  bool               fRecLoaded;  ///< event record read for current entry?
+  NtpMCEventSummary  fSummary;    ///< current event summary
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_EVENT_SCANNER_H_
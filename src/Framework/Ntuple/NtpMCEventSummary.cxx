@@ -0,0 +1,165 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2025, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <TObjArray.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Ntuple/NtpMCEventSummary.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+
+using namespace genie;
+
+using std::endl;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const NtpMCEventSummary & sum)
+  {
+    sum.PrintToStream(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+NtpMCEventSummary::NtpMCEventSummary()
+{
+  this->Init();
+}
+//____________________________________________________________________________
+NtpMCEventSummary::NtpMCEventSummary(const NtpMCEventSummary & sum)
+{
+  *this = sum;
+}
+//____________________________________________________________________________
+NtpMCEventSummary::~NtpMCEventSummary()
+{
+
+}
+//____________________________________________________________________________
+const char * NtpMCEventSummary::LeafList(void)
+{
+  return "Ev/D:weight/D:prob/D:xsec/D:dxsec/D:"
+         "ievent/I:probe/I:tgt/I:hitnuc/I:scattype/I:inttype/I:charm/I:strange/I:"
+         "nfp/I:nfpbar/I:nfn/I:nfnbar/I:nfpip/I:nfpim/I:nfpi0/I:"
+         "nfkp/I:nfkm/I:nfk0/I:nfk0bar/I:nfhyp/I:nfother/I:npart/I";
+}
+//____________________________________________________________________________
+void NtpMCEventSummary::Init(void)
+{
+  Ev       = 0;
+  weight   = 0;
+  prob     = 0;
+  xsec     = 0;
+  dxsec    = 0;
+  ievent   = 0;
+  probe    = 0;
+  tgt      = 0;
+  hitnuc   = 0;
+  scattype = 0;
+  inttype  = 0;
+  charm    = 0;
+  strange  = 0;
+  nfp      = 0;
+  nfpbar   = 0;
+  nfn      = 0;
+  nfnbar   = 0;
+  nfpip    = 0;
+  nfpim    = 0;
+  nfpi0    = 0;
+  nfkp     = 0;
+  nfkm     = 0;
+  nfk0     = 0;
+  nfk0bar  = 0;
+  nfhyp    = 0;
+  nfother  = 0;
+  npart    = 0;
+}
+//____________________________________________________________________________
+void NtpMCEventSummary::Fill(unsigned int iev, const EventRecord & event)
+{
+  this->Init();
+
+  ievent = iev;
+  weight = event.Weight();
+  prob   = event.Probability();
+  xsec   = event.XSec();
+  dxsec  = event.DiffXSec();
+  npart  = event.GetEntries();
+
+  const Interaction * interaction = event.Summary();
+  if(interaction) {
+    const InitialState & init_state = interaction->InitState();
+    const ProcessInfo &  proc_info  = interaction->ProcInfo();
+    const XclsTag &      xcls_tag   = interaction->ExclTag();
+
+    Ev       = init_state.ProbeE(kRfLab);
+    probe    = init_state.ProbePdg();
+    tgt      = init_state.Tgt().Pdg();
+    hitnuc   = init_state.Tgt().HitNucIsSet() ? init_state.Tgt().HitNucPdg() : 0;
+    scattype = (int) proc_info.ScatteringTypeId();
+    inttype  = (int) proc_info.InteractionTypeId();
+    charm    = xcls_tag.IsCharmEvent()   ? 1 : 0;
+    strange  = xcls_tag.IsStrangeEvent() ? 1 : 0;
+  }
+
+  // Count the final state hadrons. As in gevpick, the primary final state
+  // lepton and pseudo-particles are not counted.
+  TObjArrayIter piter(&event);
+  GHepParticle * p = 0;
+  int ip = -1;
+  while( (p = (GHepParticle *) piter.Next()) ) {
+    ip++;
+    if(p->Status() != kIStStableFinalState) continue;
+    if(p->FirstMother() == 0) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsPseudoParticle(pdgc)) continue;
+
+    if      (pdgc == kPdgProton     ) nfp++;
+    else if (pdgc == kPdgAntiProton ) nfpbar++;
+    else if (pdgc == kPdgNeutron    ) nfn++;
+    else if (pdgc == kPdgAntiNeutron) nfnbar++;
+    else if (pdgc == kPdgPiP        ) nfpip++;
+    else if (pdgc == kPdgPiM        ) nfpim++;
+    else if (pdgc == kPdgPi0        ) nfpi0++;
+    else if (pdgc == kPdgKP         ) nfkp++;
+    else if (pdgc == kPdgKM         ) nfkm++;
+    else if (pdgc == kPdgK0         ) nfk0++;
+    else if (pdgc == kPdgAntiK0     ) nfk0bar++;
+    else if (pdgc == kPdgSigmaP  ||
+             pdgc == kPdgSigma0  ||
+             pdgc == kPdgSigmaM  ||
+             pdgc == kPdgLambda  ||
+             pdgc == kPdgXi0     ||
+             pdgc == kPdgXiM     ||
+             pdgc == kPdgOmegaM     ) nfhyp++;
+    else                              nfother++;
+  }
+}
+//____________________________________________________________________________
+void NtpMCEventSummary::PrintToStream(ostream & stream) const
+{
+  stream << "Event summary: " << ievent
+         << " [probe: " << probe << ", target: " << tgt
+         << ", hit nucleon: " << hitnuc << ", E = " << Ev << " GeV]" << endl
+         << " scattering type: " << scattype
+         << ", interaction type: " << inttype
+         << ", charm: " << charm << ", strange: " << strange << endl
+         << " final state: p: " << nfp << ", pbar: " << nfpbar
+         << ", n: " << nfn << ", nbar: " << nfnbar
+         << ", pi+: " << nfpip << ", pi-: " << nfpim << ", pi0: " << nfpi0
+         << ", K+: " << nfkp << ", K-: " << nfkm
+         << ", K0: " << nfk0 << ", K0bar: " << nfk0bar
+         << ", hyperons: " << nfhyp << ", other: " << nfother << endl
+         << " weight: " << weight << ", probability: " << prob
+         << ", xsec: " << xsec << ", dxsec: " << dxsec;
+}
+//____________________________________________________________________________
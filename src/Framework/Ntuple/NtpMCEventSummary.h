@@ -0,0 +1,89 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCEventSummary
+
+\brief   A flat summary of a GHEP event record, stored by the NtpWriter in a
+         separate "gsum" branch of the GHEP event tree next to the full
+         NtpMCEventRecord.
+
+         It holds the initial state, the process information, the event
+         weight / cross sections and the final state hadron multiplicities,
+         so that tools that only need these quantities can select events
+         without de-serializing the full event record.
+
+\author  The GENIE Collaboration
+
+\created October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_EVENT_SUMMARY_H_
+#define _NTP_MC_EVENT_SUMMARY_H_
+
+#include <ostream>
+
+#include <Rtypes.h>
+
+using std::ostream;
+
+namespace genie {
+
+class EventRecord;
+class NtpMCEventSummary;
+ostream & operator << (ostream & stream, const NtpMCEventSummary & sum);
+
+class NtpMCEventSummary {
+
+public :
+  NtpMCEventSummary();
+  NtpMCEventSummary(const NtpMCEventSummary & sum);
+ ~NtpMCEventSummary();
+
+  void Init (void);
+  void Fill (unsigned int ievent, const EventRecord & event);
+
+  //! Leaf list used for the "gsum" branch. The data members below are
+  //! stored in declaration order (doubles first, so no padding is needed)
+  static const char * LeafList (void);
+
+  void PrintToStream(ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const NtpMCEventSummary & sum);
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+  Double_t  Ev;        ///< probe energy in the LAB frame
+  Double_t  weight;    ///< event weight
+  Double_t  prob;      ///< event probability
+  Double_t  xsec;      ///< cross section for selected event
+  Double_t  dxsec;     ///< differential cross section for selected event kinematics
+  Int_t     ievent;    ///< event number
+  Int_t     probe;     ///< probe PDG code
+  Int_t     tgt;       ///< target PDG code
+  Int_t     hitnuc;    ///< hit nucleon PDG code (0 if none)
+  Int_t     scattype;  ///< scattering type (ScatteringType_t)
+  Int_t     inttype;   ///< interaction type (InteractionType_t)
+  Int_t     charm;     ///< charm production?
+  Int_t     strange;   ///< strange production?
+  Int_t     nfp;       ///< number of final state protons
+  Int_t     nfpbar;    ///< number of final state anti-protons
+  Int_t     nfn;       ///< number of final state neutrons
+  Int_t     nfnbar;    ///< number of final state anti-neutrons
+  Int_t     nfpip;     ///< number of final state \pi^+'s
+  Int_t     nfpim;     ///< number of final state \pi^-'s
+  Int_t     nfpi0;     ///< number of final state \pi^0's
+  Int_t     nfkp;      ///< number of final state K^+'s
+  Int_t     nfkm;      ///< number of final state K^-'s
+  Int_t     nfk0;      ///< number of final state K^0's
+  Int_t     nfk0bar;   ///< number of final state \bar{K^0}'s
+  Int_t     nfhyp;     ///< number of final state hyperons
+  Int_t     nfother;   ///< number of other final state particles
+  Int_t     npart;     ///< number of entries in the GHEP record
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_EVENT_SUMMARY_H_
@@ -0,0 +1,24 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2025, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include "Framework/Ntuple/NtpMCEventVisitorI.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpMCEventVisitorI::NtpMCEventVisitorI()
+{
+
+}
+//____________________________________________________________________________
+NtpMCEventVisitorI::~NtpMCEventVisitorI()
+{
+
+}
+//____________________________________________________________________________
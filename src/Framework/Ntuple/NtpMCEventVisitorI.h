@@ -0,0 +1,58 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCEventVisitorI
+
+\brief   Interface for the per-event analysis code run by the
+         NtpMCEventScanner over GHEP event trees.
+
+         When the scan is split among N worker processes, BeginWorker(),
+         Visit() and EndWorker() run in each worker (which has to store its
+         results, eg in a file tagged with the worker id), while Merge()
+         runs in the parent process after all workers have finished.
+         Workers process contiguous entry ranges in input order, so merging
+         the worker outputs in worker order reproduces a serial scan.
+
+\author  The GENIE Collaboration
+
+\created October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_EVENT_VISITOR_I_H_
+#define _NTP_MC_EVENT_VISITOR_I_H_
+
+namespace genie {
+
+class NtpMCEventScanner;
+
+class NtpMCEventVisitorI {
+
+public :
+  virtual ~NtpMCEventVisitorI();
+
+  //! Does the visitor need the full event record for every event?
+  //! If not, only the event summary branch is read, and the full record
+  //! is read on request (NtpMCEventScanner::Event()) for selected events.
+  virtual bool NeedsEventRecord (void) const { return true; }
+
+  //! Called at the start / end of the scan in each worker
+  virtual void BeginWorker (int /*iworker*/, int /*nworkers*/) { }
+  virtual void EndWorker   (int /*iworker*/) { }
+
+  //! Called for each event. Return false to stop the scan (in this worker).
+  virtual bool Visit (NtpMCEventScanner & scanner) = 0;
+
+  //! Called in the parent process once all workers completed successfully
+  virtual void Merge (int /*nworkers*/) { }
+
+protected:
+  NtpMCEventVisitorI();
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_EVENT_VISITOR_I_H_
@@ -20,6 +20,7 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCEventSummary.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCJobConfig.h"
 #include "Framework/Ntuple/NtpMCJobEnv.h"
@@ -39,7 +40,9 @@ fRunSeed(seed),
 fOutFile(0),
 fOutTree(0),
 fEventBranch(0),
+fSummaryBranch(0),
 fNtpMCEventRecord(0),
+fNtpMCEventSummary(0),
 fNtpMCTreeHeader(0)
 {
   LOG("Ntp", pNOTICE) << "Run number: " << runnu;
@@ -52,6 +55,7 @@ fNtpMCTreeHeader(0)
 NtpWriter::~NtpWriter()
 {
   delete fNtpMCTreeHeader;
+  delete fNtpMCEventSummary;
 }
 //____________________________________________________________________________
 void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
@@ -69,11 +73,12 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
 
   switch (fNtpFormat) {
      case kNFGHEP:
-          fNtpMCEventRecord = new NtpMCEventRecord();
+          // the branch's NtpMCEventRecord (and its event record storage)
+          // is reused
+          if(!fNtpMCEventRecord) fNtpMCEventRecord = new NtpMCEventRecord();
           fNtpMCEventRecord->Fill(ievent, ev_rec);
+          fNtpMCEventSummary->Fill(ievent, *ev_rec);
           fOutTree->Fill();
-          delete fNtpMCEventRecord;
-          fNtpMCEventRecord = 0;
           break;
      default:
         break;
@@ -191,6 +196,8 @@ void NtpWriter::CreateGHEPEventBranch(void)
 {
   LOG("Ntp", pINFO) << "Creating a NtpMCEventRecord TBranch";
 
+  // the NtpMCEventRecord is allocated by ROOT when the branch is created
+  // and is owned (and deleted) by the branch
   fNtpMCEventRecord = 0;
   TTree::SetBranchStyle(1);
 
@@ -205,6 +212,13 @@ void NtpWriter::CreateGHEPEventBranch(void)
   // was split=1 ... but, at least w/ ROOT 6.06/04, this generates
   //   Warning in <TTree::Bronch>: genie::NtpMCEventRecord cannot be split, resetting splitlevel to 0
   // which the art framework turns into a fatal error
+
+  // flat event summary, so that readers can select events without
+  // de-serializing the full event record (see NtpMCEventScanner)
+  if(fNtpMCEventSummary) delete fNtpMCEventSummary;
+  fNtpMCEventSummary = new NtpMCEventSummary();
+  fSummaryBranch = fOutTree->Branch("gsum",
+      (void *) fNtpMCEventSummary, NtpMCEventSummary::LeafList());
 }
 //____________________________________________________________________________
 void NtpWriter::CreateTreeHeader(void)
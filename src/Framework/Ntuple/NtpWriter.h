@@ -34,6 +34,7 @@ namespace genie {
 
 class EventRecord;
 class NtpMCEventRecord;
+class NtpMCEventSummary;
 class NtpMCTreeHeader;
 
 class NtpWriter {
@@ -75,7 +76,9 @@ private:
   TFile *            fOutFile;            ///< output file
   TTree *            fOutTree;            ///< output tree
   TBranch *          fEventBranch;        ///< the generated event branch
+  TBranch *          fSummaryBranch;      ///< the event summary branch
   NtpMCEventRecord * fNtpMCEventRecord;   ///<
+  NtpMCEventSummary* fNtpMCEventSummary;  ///<
   NtpMCTreeHeader *  fNtpMCTreeHeader;    ///<
 };
 
@@ -1,6 +1,10 @@
 #ifndef BLI2DNONUNIF_OBJECT_GRID_H_
 #define BLI2DNONUNIF_OBJECT_GRID_H_
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace genie {
 
 //____________________________________________________________________________
@@ -26,6 +30,11 @@ namespace genie {
             * The genie::BLI2DNonUnifGrid object does not take ownership of the
               grid vectors, which must be stored elsewhere
 
+            * If update_spacing() is called once the grid vectors have been
+              filled, evenly-spaced x and/or y axes are detected and the
+              bounding grid points along them are computed directly rather
+              than by a binary search
+
 \tparam   ZObject Type of the object describing each z coordinate
 \tparam   IndexType Type to use when computing indices in the vectors
 \tparam   XType Type used to represent x coordinates
@@ -58,9 +67,22 @@ template<typename ZObject, typename IndexType = int, typename XType = double,
   /// of the grid
   BLI2DNonUnifObjectGrid(const std::vector<XType>* X,
     const std::vector<YType>* Y, const std::vector<ZObject>* Z,
-    bool extrapolate = false) : fX(X), fY(Y), fZ(Z), fExtrapolate(extrapolate)
+    bool extrapolate = false) : fX(X), fY(Y), fZ(Z), fExtrapolate(extrapolate),
+    fUniformX(false), fUniformY(false), fStepX(0), fStepY(0)
   {}
 
+  /// Checks whether the x and y grid points are evenly spaced. Must be called
+  /// again whenever the grid vectors are modified.
+  void update_spacing()
+  {
+    fUniformX = is_uniform(fX, fStepX);
+    fUniformY = is_uniform(fY, fStepY);
+  }
+
+  /// Whether the x (y) grid points are evenly spaced
+  inline bool uniform_x() const { return fUniformX; }
+  inline bool uniform_y() const { return fUniformY; }
+
   /// Retrieve the minimum x value
   inline XType x_min() const { return fX->front(); }
 
@@ -108,8 +130,10 @@ template<typename ZObject, typename IndexType = int, typename XType = double,
     // desired x and y values. If the desired point is outside of
     // the x or y grid limits, get the indices of the two closest
     // grid points to use for possible extrapolation.
-    get_bound_indices(fX, evalx, ix_lo, ix_hi);
-    get_bound_indices(fY, evaly, iy_lo, iy_hi);
+    if ( fUniformX ) get_uniform_bound_indices(fX, fStepX, evalx, ix_lo, ix_hi);
+    else get_bound_indices(fX, evalx, ix_lo, ix_hi);
+    if ( fUniformY ) get_uniform_bound_indices(fY, fStepY, evaly, iy_lo, iy_hi);
+    else get_bound_indices(fY, evaly, iy_lo, iy_hi);
 
     // Get the x and y values corresponding to the lower (x1, y1) and
     // upper (x2, y2) bounds found previously
@@ -145,6 +169,56 @@ protected:
   /// x and coordinates outside of the grid using the grid endpoints (false)
   bool fExtrapolate;
 
+  bool fUniformX; ///< Whether the x grid points are evenly spaced
+  bool fUniformY; ///< Whether the y grid points are evenly spaced
+  XType fStepX;   ///< Spacing of the x grid points (if uniform)
+  YType fStepY;   ///< Spacing of the y grid points (if uniform)
+
+  /// Checks whether a vector of grid points is evenly spaced (to within
+  /// a small fraction of the step size) and returns the step size
+  template <typename Type> bool is_uniform(const std::vector<Type>* vec,
+    Type& step) const
+  {
+    step = 0;
+    size_t n = vec->size();
+    if (n < 2) return false;
+
+    step = ( vec->back() - vec->front() ) / (n - 1);
+    if (step <= 0) return false;
+
+    for (size_t k = 1; k < n; ++k) {
+      Type expected = vec->front() + k * step;
+      if ( std::abs(vec->at(k) - expected) > 1e-6 * step ) return false;
+    }
+    return true;
+  }
+
+  /// Same as get_bound_indices(), but for an evenly-spaced vector of grid
+  /// points. The lower index is computed directly from the step size and
+  /// then corrected (if needed) so that the result is the same as the
+  /// one of the binary search.
+  template <typename Type> bool get_uniform_bound_indices(
+    const std::vector<Type>* vec, Type step, Type val, int& lower_index,
+    int& upper_index) const
+  {
+    const Type* v = &vec->front();
+    int last = vec->size() - 1;
+
+    int k = static_cast<int>( std::floor( (val - v[0]) / step ) );
+    if (k < 0) k = 0;
+    else if (k > last - 1) k = last - 1;
+
+    // The binary search selects the closest grid point strictly
+    // less than the requested value
+    while (k > 0 && v[k] >= val) --k;
+    while (k < last - 1 && v[k+1] < val) ++k;
+
+    lower_index = k;
+    upper_index = k + 1;
+
+    return (val >= v[0] && val <= v[last]);
+  }
+
   /// Determines the indices for the two gridpoints surrounding a requested
   /// x or y coordinate. If the x or y coordinate is outside of the grid,
   /// this function returns the two closest grid points.
@@ -8,10 +8,40 @@
 
 #include <sstream>
 #include <iostream>
+#include <atomic>
+#include <mutex>
+#include <map>
+#include <string>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/Pythia8Singleton.h"
 
+namespace {
+  // protects the creation of the singleton and of the thread instances
+  std::mutex gPythia8Mutex;
+
+  // changed every time the setup of the primary instance changes
+  std::atomic<unsigned long> gPythia8Setup(1);
+
+  // Pythia8 instance used by this thread
+  struct ThreadPythia8 {
+    int           index;   ///< thread index (0: primary instance, -1: not given yet)
+    unsigned long setup;   ///< setup of the primary instance it was copied from
+#ifdef __GENIE_PYTHIA8_ENABLED__
+    Pythia8::Pythia * pythia;
+#endif
+  };
+#ifdef __GENIE_PYTHIA8_ENABLED__
+  thread_local ThreadPythia8 gThreadPythia8 = { -1, 0, 0 };
+#else
+  thread_local ThreadPythia8 gThreadPythia8 = { -1, 0 };
+#endif
+
+  // setup of the primary instance of each named setup the instances of
+  // this thread were copied from
+  thread_local std::map<std::string, unsigned long> gThreadNamedSetup;
+}
+
 namespace genie {
 
 //____________________________________________________________________________
@@ -38,6 +68,19 @@ Pythia8Singleton::~Pythia8Singleton()
   if (fPythia) {
     delete fPythia;
   }
+  for (unsigned int i = 0; i < fThreadPythia.size(); i++) {
+    if (fThreadPythia[i]) delete fThreadPythia[i];
+  }
+  fThreadPythia.clear();
+
+  std::map<std::string, NamedSetup>::iterator it = fNamedSetups.begin();
+  for ( ; it != fNamedSetups.end(); ++it) {
+    if (it->second.primary) delete it->second.primary;
+    for (unsigned int i = 0; i < it->second.threads.size(); i++) {
+      if (it->second.threads[i]) delete it->second.threads[i];
+    }
+  }
+  fNamedSetups.clear();
 #endif
   fInstance = 0;
 }
@@ -45,6 +88,9 @@ Pythia8Singleton::~Pythia8Singleton()
 Pythia8Singleton * Pythia8Singleton::Instance()
 {
   if (fInstance == 0) {
+    std::lock_guard<std::mutex> lock(gPythia8Mutex);
+    if (fInstance != 0) return fInstance;
+
     static Pythia8Singleton::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
 
@@ -54,10 +100,144 @@ Pythia8Singleton * Pythia8Singleton::Instance()
     // actually create the one to be held
     fInstance->fPythia = new Pythia8::Pythia();
 #endif
+    // the creating thread uses the primary instance
+    gThreadPythia8.index = 0;
   }
   return fInstance;
 }
 //____________________________________________________________________________
+#ifdef __GENIE_PYTHIA8_ENABLED__
+Pythia8::Pythia * Pythia8Singleton::Pythia8()
+{
+  ThreadPythia8 & local = gThreadPythia8;
+
+  if (local.index == 0) return fPythia;
+  if (local.pythia && local.setup == gPythia8Setup) return local.pythia;
+
+  std::lock_guard<std::mutex> lock(gPythia8Mutex);
+  int ithread = this->ThreadIndex();
+
+  Pythia8::Pythia * & pythia = fThreadPythia[ithread-1];
+  if (pythia) delete pythia;
+
+  local.setup  = gPythia8Setup;
+  local.pythia = pythia = this->NewThreadInstance(*fPythia, ithread);
+  return local.pythia;
+}
+//____________________________________________________________________________
+Pythia8::Pythia * Pythia8Singleton::Pythia8(const std::string & setup)
+{
+// Named setups are only asked for by modules which re-initialize their
+// instance anyway, so the mutex is always taken here.
+
+  std::lock_guard<std::mutex> lock(gPythia8Mutex);
+
+  NamedSetup & named = fNamedSetups[setup];
+  if (!named.primary) {
+    named.primary = new Pythia8::Pythia();
+    named.setup   = 1;
+  }
+  if (gThreadPythia8.index == 0) return named.primary;
+
+  int ithread = this->ThreadIndex();
+  if (named.threads.size() < (unsigned int) ithread) {
+    named.threads.resize(ithread, 0);
+  }
+
+  Pythia8::Pythia * & pythia = named.threads[ithread-1];
+  unsigned long & copied = gThreadNamedSetup[setup];
+  if (!pythia || copied != named.setup) {
+    if (pythia) delete pythia;
+    pythia = this->NewThreadInstance(*named.primary, ithread);
+    copied = named.setup;
+  }
+  return pythia;
+}
+//____________________________________________________________________________
+int Pythia8Singleton::ThreadIndex(void)
+{
+// Index of the calling thread, given on its first call. Called with the
+// mutex locked.
+
+  ThreadPythia8 & local = gThreadPythia8;
+  if (local.index < 0) {
+    fThreadPythia.push_back(0);
+    local.index = fThreadPythia.size();
+  }
+  return local.index;
+}
+//____________________________________________________________________________
+Pythia8::Pythia * Pythia8Singleton::NewThreadInstance(
+  Pythia8::Pythia & primary, int ithread)
+{
+// Create an instance for the input thread as a copy of the settings and the
+// particle data of the input primary one. Called with the mutex locked.
+
+  Pythia8::Pythia * pythia =
+    new Pythia8::Pythia(primary.settings, primary.particleData, false);
+
+  long seed = ThreadSeed(primary.settings.mode("Random:seed"), ithread);
+  pythia->readString("Random:setSeed = on");
+  pythia->settings.mode("Random:seed", seed);
+  pythia->init();
+
+  LOG("Pythia8Singleton", pNOTICE)
+    << "Created PYTHIA8 instance for thread " << ithread
+    << " with seed = " << pythia->settings.mode("Random:seed");
+
+  return pythia;
+}
+//____________________________________________________________________________
+void Pythia8Singleton::Init(void)
+{
+  fPythia->init();
+  this->SetupChanged();
+}
+//____________________________________________________________________________
+void Pythia8Singleton::ChangeSetup(
+  const std::function<void (Pythia8::Pythia &)> & change)
+{
+  std::lock_guard<std::mutex> lock(gPythia8Mutex);
+  change(*fPythia);
+  this->SetupChanged();
+}
+//____________________________________________________________________________
+void Pythia8Singleton::Init(const std::string & setup)
+{
+// Only the instance of the calling thread is touched (eg re-initialized for
+// the energy of the current event): call SetupChanged(setup) when the
+// configuration of the primary instance changes.
+
+  this->Pythia8(setup)->init();
+}
+//____________________________________________________________________________
+void Pythia8Singleton::SetupChanged(const std::string & setup)
+{
+  std::lock_guard<std::mutex> lock(gPythia8Mutex);
+  fNamedSetups[setup].setup++;
+}
+#endif // __GENIE_PYTHIA8_ENABLED__
+//____________________________________________________________________________
+void Pythia8Singleton::SetupChanged(void)
+{
+  gPythia8Setup++;
+}
+//____________________________________________________________________________
+long Pythia8Singleton::ThreadSeed(long seed, int ithread)
+{
+// Derive the seed of the instance of the input thread from the primary seed.
+// Pythia8 seeds are in [1, 900000000] (0 would seed from the time).
+
+  if (ithread == 0) return seed;
+
+  const long kMaxSeed = 900000000;
+  const long kStride  = 104729;   // spacing between the seeds of two threads
+
+  long s = (seed < 0) ? -seed : seed;
+  s = (s + kStride * ithread) % kMaxSeed;
+  return (s == 0) ? kMaxSeed : s;
+}
+//____________________________________________________________________________
 //void Pythia8Singleton::Print(ostream & stream) const
 //{
 //  stream << "\n [-] GENIE Pythia8Singleton:";
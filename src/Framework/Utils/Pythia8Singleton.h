@@ -3,7 +3,34 @@
 
 \class    genie::Pythia8Singleton
 
-\brief    Manage a single instance of pythia8
+\brief    Manage the instances of pythia8
+
+          The thread which creates the singleton uses the primary instance,
+          which is the one configured by the GENIE Pythia8 modules. Any other
+          thread calling Pythia8() gets its own instance, created on first
+          use as a copy of the settings and particle data (including the
+          decay tables) of the primary instance, and seeded with a seed
+          derived from the primary seed and the thread index. Thread indices
+          are given in order of first use, so a job which needs reproducible
+          output should call Pythia8() from its workers in a fixed order.
+
+          The primary instance must only be set up from the main thread.
+          Modules which change its setup call Init() (instead of
+          Pythia8::Pythia::init()) or SetupChanged(), after which the thread
+          instances are re-created from the primary one on their next use.
+          Threads other than the main one change the setup through
+          ChangeSetup(), which edits the primary instance (so that the
+          change survives the re-creation of the thread instances). It must
+          not be called while the main thread is generating.
+
+          Modules which need a setup of their own, independent of the shared
+          one (eg with process-level generation switched on), ask for the
+          instances of a named setup. Each named setup has its own primary
+          instance, used by the main thread and set up by the module, and
+          thread instances copied from it as above. For a named setup,
+          Init() only re-initializes the instance of the calling thread (eg
+          for the energy of the current event) and the module calls
+          SetupChanged() once it has configured the primary instance.
 
 \author   Robert Hatcher <rhatcher \at fnal.gov>
           Fermilab
@@ -18,6 +45,11 @@
 #ifndef _PYTHIA8SINGLETON_H_
 #define _PYTHIA8SINGLETON_H_
 
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
 #ifdef __GENIE_PYTHIA8_ENABLED__
 #include "Pythia8/Pythia.h"
 #endif // __GENIE_PYTHIA8_ENABLED__
@@ -35,9 +67,33 @@ public:
   static Pythia8Singleton * Instance(void);
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  Pythia8::Pythia * Pythia8() { return fPythia; }
+  //! Pythia8 instance of the calling thread
+  Pythia8::Pythia * Pythia8();
+
+  //! (Re)initialize the primary instance after changing its settings
+  void Init(void);
+
+  //! Apply a change to the setup of the primary instance, from any thread,
+  //! and re-create the thread instances on their next use
+  void ChangeSetup(const std::function<void (Pythia8::Pythia &)> & change);
+
+  //! Pythia8 instance of the calling thread for the input named setup
+  Pythia8::Pythia * Pythia8(const std::string & setup);
+
+  //! (Re)initialize the calling thread's instance of the input named setup
+  void Init(const std::string & setup);
+
+  //! The setup of the primary instance of the input named setup has changed
+  void SetupChanged(const std::string & setup);
 #endif // __GENIE_PYTHIA8_ENABLED__
 
+  //! The setup of the primary instance has changed: re-create the thread
+  //! instances on their next use
+  void SetupChanged(void);
+
+  //! Seed of the instance of the input thread
+  static long ThreadSeed(long seed, int ithread);
+
   //! print
   //void   Print (ostream & stream) const;
   //friend ostream & operator << (ostream & stream, const Pythia8Singleton & pythia8_1);
@@ -48,7 +104,19 @@ private:
   static Pythia8Singleton * fInstance;
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  mutable Pythia8::Pythia * fPythia; ///< actual Pythia8 instance
+  mutable Pythia8::Pythia * fPythia;              ///< primary Pythia8 instance
+  std::vector<Pythia8::Pythia *> fThreadPythia;   ///< instances of the other threads, by thread index - 1
+
+  //! instances of a named setup
+  struct NamedSetup {
+    Pythia8::Pythia *              primary;   ///< used by the main thread
+    std::vector<Pythia8::Pythia *> threads;   ///< by thread index - 1
+    unsigned long                  setup;     ///< changed at every Init()
+  };
+  std::map<std::string, NamedSetup> fNamedSetups;
+
+  Pythia8::Pythia * NewThreadInstance(Pythia8::Pythia & primary, int ithread);
+  int               ThreadIndex      (void);
 #endif // __GENIE_PYTHIA8_ENABLED__
 
   //! singleton class: constructors are private
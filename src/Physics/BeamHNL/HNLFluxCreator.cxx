@@ -14,6 +14,33 @@ using namespace genie;
 using namespace genie::hnl;
 using namespace genie::hnl::enums;
 
+// acceptance surface grid: log10( beta * gamma ) of the parent x rest-frame emission angle
+static const double kAccLogBGMin  = -2.0;
+static const double kAccLogBGStep =  0.02;
+static const int    kAccNBoost    =  276;  // up to log10( beta * gamma ) = 3.5
+static const double kAccAngleStep =  0.5;  // deg
+static const int    kAccNAngle    =  361;  // 0 .. 180 deg
+
+static double AccNodeBeta( int ib )
+{
+  double bg = std::pow( 10.0, kAccLogBGMin + ib * kAccLogBGStep );
+  return bg / std::sqrt( 1.0 + bg * bg );
+}
+
+// measure [deg] of t in [t1, t2] ( -180 <= t1 <= t2 <= 360 ) with cos(t) >= k
+static double ArcMeasure( double k, double t1, double t2 )
+{
+  if( k > 1.0 ) return 0.0;
+  if( k <= -1.0 ) return t2 - t1;
+  double A = TMath::ACos( k ) * TMath::RadToDeg();
+  double m = 0.0;
+  for( int n = 0; n <= 1; n++ ){
+    double lo = TMath::Max( t1, 360.0 * n - A ), hi = TMath::Min( t2, 360.0 * n + A );
+    if( hi > lo ) m += hi - lo;
+  }
+  return m;
+}
+
 //----------------------------------------------------------------------------
 FluxCreator::FluxCreator() :
   FluxRecordVisitorI("genie::hnl::FluxCreator")
@@ -1818,6 +1845,10 @@ double FluxCreator::CalculateAcceptanceCorrection( TLorentzVector p4par, TLorent
   double M = p4HNL.M();
   if( M < 1.0e-3 ) return 1.0;
 
+  // interpolate the tabulated lab angles where possible, scan labangle() numerically otherwise
+  double accCorr = 1.0;
+  if( this->SurfaceAcceptanceCorrection( p4par, p4HNL, SMECM, zm, zp, accCorr ) ) return accCorr;
+
   TF1 * fHNL = ( TF1* ) gROOT->GetListOfFunctions()->FindObject( "fHNL" );
   if( !fHNL ){ fHNL = new TF1( "fHNL", labangle, 0.0, 180.0, 6 ); }
   fHNL->SetParameter( 0, p4par.E()  );
@@ -1925,6 +1956,168 @@ double FluxCreator::CalculateAcceptanceCorrection( TLorentzVector p4par, TLorent
 
 }
 //----------------------------------------------------------------------------
+double FluxCreator::LabAngle( double thetaRest, double beta, double vRest )
+{
+  // lab frame angle [deg] wrt parent momentum of a particle emitted at rest-frame angle
+  // thetaRest [deg] wrt the boost direction, with speed vRest in the parent rest frame.
+  // Same as labangle() with Ehad = gamma * mpar, phad = beta * gamma * mpar, phnl / Ehnl = vRest
+  double gamma = 1.0 / std::sqrt( 1.0 - beta * beta );
+  double xrad = thetaRest * TMath::DegToRad();
+  double theta = TMath::ATan2( TMath::Sin( xrad ),
+			       gamma * ( TMath::Cos( xrad ) + beta / vRest ) );
+  return theta * TMath::RadToDeg();
+}
+//----------------------------------------------------------------------------
+bool FluxCreator::SurfaceAcceptanceCorrection( TLorentzVector p4par, TLorentzVector p4HNL,
+						double SMECM, double zm, double zp,
+						double & accCorr ) const
+{
+  /*
+   * labangle() boosts the rest-frame direction ( 0, sin x, cos x ) along the parent
+   * direction n, so the lab angle only depends on the rest-frame angle a between the two:
+   * labangle( x ) = LabAngle( a(x), beta, v ) with cos a(x) = ny sin x + nz cos x = R cos( x - x0 ).
+   * The pre-images in a of [zm, zp] are read off the tabulated LabAngle() and mapped back
+   * onto x exactly. Returns false if the parent is outside the grid.
+   */
+
+  // the HNL rest-frame speed is only fixed for 2-body production
+  HNLProd_t prodChan = static_cast< HNLProd_t >( fProdChan );
+  if( prodChan != kHNLProdPion2Muon && prodChan != kHNLProdPion2Electron &&
+      prodChan != kHNLProdKaon2Muon && prodChan != kHNLProdKaon2Electron ) return false;
+  if( SMECM <= 0.0 ) return false;
+
+  double beta = p4par.Beta();
+  double bg = beta * p4par.Gamma();
+  if( !( bg > 0.0 ) ) return false;
+  double lbg = std::log10( bg );
+  if( lbg < kAccLogBGMin || lbg >= kAccLogBGMin + ( kAccNBoost - 1 ) * kAccLogBGStep ) return false;
+
+  TVector3 npar = p4par.Vect().Unit();
+  double R = std::sqrt( npar.Y() * npar.Y() + npar.Z() * npar.Z() );
+  if( R < 1.0e-9 ) return false; // constant function
+  double x0 = TMath::ATan2( npar.Y(), npar.Z() ) * TMath::RadToDeg();
+
+  const AcceptanceSurface & surfHNL = this->GetAcceptanceSurface( fProdChan, p4HNL.P() / p4HNL.E() );
+  double range1 = SurfaceMeasure( surfHNL, lbg, beta, R, x0, zm, zp );
+  if( range1 < 0.0 ) return false;
+  if( range1 == 0.0 ){ accCorr = 0.0; return true; } // 0 pre-images
+
+  const AcceptanceSurface & surfSMv = this->GetAcceptanceSurface( -1, 1.0 );
+  double range2 = SurfaceMeasure( surfSMv, lbg, beta, R, x0, zm, zp );
+  if( range2 <= 0.0 ) return false; // no SMv pre-image, needs the dx/dz * dy/dz estimate
+
+  // sometimes this happens, gotta bail!
+  accCorr = ( range2 < 1.0e-6 || range1 / range2 > 10.0 ) ? 1.0 : range1 / range2;
+  return true;
+}
+//----------------------------------------------------------------------------
+const FluxCreator::AcceptanceSurface & FluxCreator::GetAcceptanceSurface( int key, double vRest ) const
+{
+  // vRest depends on the HNL mass, drop all tables when it changes
+  if( fAccSurfaceMass != fMass ){ fAccSurfaces.clear(); fAccSurfaceMass = fMass; }
+
+  std::map< int, AcceptanceSurface >::iterator sit = fAccSurfaces.find( key );
+  if( sit != fAccSurfaces.end() && std::abs( sit->second.vRest - vRest ) <= 1.0e-6 * vRest )
+    return sit->second;
+
+  AcceptanceSurface & surf = fAccSurfaces[ key ];
+  surf.vRest = vRest;
+  surf.aMax.assign( kAccNBoost, 180.0 );
+  surf.yMax.assign( kAccNBoost, 180.0 );
+  surf.y.resize( kAccNBoost * kAccNAngle );
+  for( int ib = 0; ib < kAccNBoost; ib++ ){
+    double beta = AccNodeBeta( ib );
+    if( beta > vRest ){ // lab angle turns over before 180 deg
+      surf.aMax[ib] = TMath::ACos( -vRest / beta ) * TMath::RadToDeg();
+      surf.yMax[ib] = LabAngle( surf.aMax[ib], beta, vRest );
+    }
+    for( int ia = 0; ia < kAccNAngle; ia++ )
+      surf.y[ ib * kAccNAngle + ia ] = LabAngle( ia * kAccAngleStep, beta, vRest );
+  }
+
+  LOG( "HNL", pINFO )
+    << "Tabulated acceptance surface for HNL mass " << fMass << " GeV, production channel "
+    << key << ", rest-frame speed " << vRest;
+
+  return surf;
+}
+//----------------------------------------------------------------------------
+double FluxCreator::SurfaceMeasure( const AcceptanceSurface & surf, double lbg, double beta,
+				    double R, double x0, double zm, double zp )
+{
+  // returns -1 if the boost nodes around lbg straddle beta == vRest, where the lab angle
+  // jumps from a turning point to a monotonic function
+  double u = ( lbg - kAccLogBGMin ) / kAccLogBGStep;
+  int ib = TMath::Min( static_cast< int >( u ), kAccNBoost - 2 );
+  double w = u - ib;
+  if( ( AccNodeBeta( ib ) - surf.vRest ) * ( AccNodeBeta( ib + 1 ) - surf.vRest ) <= 0.0 ) return -1.0;
+
+  // interpolate the pre-images at a fixed fraction of the maximum lab angle, so that
+  // they stay smooth near the turning point
+  double ymax = 180.0;
+  if( beta > surf.vRest )
+    ymax = LabAngle( TMath::ACos( -surf.vRest / beta ) * TMath::RadToDeg(), beta, surf.vRest );
+
+  // [ zm, zp ] before the maximum and [ zp, zm ] after it
+  double a[4] = { 0.0, 0.0, 0.0, 0.0 };
+  for( int k = 0; k < 2; k++ ){
+    double wk = ( k == 0 ) ? 1.0 - w : w;
+    double scale = surf.yMax[ ib + k ] / ymax;
+    a[0] += wk * SurfaceRestFrameAngle( surf, ib + k, zm * scale, true  );
+    a[1] += wk * SurfaceRestFrameAngle( surf, ib + k, zp * scale, true  );
+    a[2] += wk * SurfaceRestFrameAngle( surf, ib + k, zp * scale, false );
+    a[3] += wk * SurfaceRestFrameAngle( surf, ib + k, zm * scale, false );
+  }
+
+  return EmissionMeasure( a[0], a[1], R, x0 ) + EmissionMeasure( a[2], a[3], R, x0 );
+}
+//----------------------------------------------------------------------------
+double FluxCreator::SurfaceRestFrameAngle( const AcceptanceSurface & surf, int ib,
+					   double thetaLab, bool forward )
+{
+  // inverse of the tabulated lab angle at boost node ib, before ( forward == true ) or
+  // after its maximum. Linear between the angle nodes and the maximum.
+  double amax = surf.aMax[ib], ymax = surf.yMax[ib];
+  if( thetaLab >= ymax ) return amax;
+  const double * y = &surf.y[ ib * kAccNAngle ];
+
+  int imax = static_cast< int >( amax / kAccAngleStep ); // last node before the maximum
+  if( imax * kAccAngleStep >= amax ) imax--;
+
+  if( forward ){ // y increases on nodes 0 .. imax, then up to ymax
+    if( thetaLab <= y[0] ) return 0.0;
+    if( thetaLab >= y[imax] )
+      return imax * kAccAngleStep + ( amax - imax * kAccAngleStep ) * ( thetaLab - y[imax] ) / ( ymax - y[imax] );
+    int lo = 0, hi = imax;
+    while( hi - lo > 1 ){
+      int mid = ( lo + hi ) / 2;
+      if( y[mid] <= thetaLab ) lo = mid; else hi = mid;
+    }
+    return ( lo + ( thetaLab - y[lo] ) / ( y[hi] - y[lo] ) ) * kAccAngleStep;
+  }
+
+  if( amax >= 180.0 ) return 180.0; // monotonic, nothing after the maximum
+  int imin = imax + 1, ilast = kAccNAngle - 1; // y decreases from ymax on nodes imin .. ilast
+  if( thetaLab <= y[ilast] ) return 180.0;
+  if( thetaLab >= y[imin] )
+    return amax + ( imin * kAccAngleStep - amax ) * ( ymax - thetaLab ) / ( ymax - y[imin] );
+  int lo = imin, hi = ilast;
+  while( hi - lo > 1 ){
+    int mid = ( lo + hi ) / 2;
+    if( y[mid] >= thetaLab ) lo = mid; else hi = mid;
+  }
+  return ( lo + ( y[lo] - thetaLab ) / ( y[lo] - y[hi] ) ) * kAccAngleStep;
+}
+//----------------------------------------------------------------------------
+double FluxCreator::EmissionMeasure( double a1, double a2, double R, double x0 )
+{
+  // x in [0, 180] maps onto t = x - x0, where cos a = R cos t
+  if( a2 <= a1 ) return 0.0;
+  double t1 = -x0, t2 = 180.0 - x0;
+  return ArcMeasure( TMath::Cos( a2 * TMath::DegToRad() ) / R, t1, t2 )
+    - ArcMeasure( TMath::Cos( a1 * TMath::DegToRad() ) / R, t1, t2 );
+}
+//----------------------------------------------------------------------------
 double FluxCreator::labangle( double * x, double * par )
 {
   double xrad = x[0] * TMath::DegToRad();
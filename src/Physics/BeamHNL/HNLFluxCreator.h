@@ -11,6 +11,16 @@
 	     + Calculate kinematics of HNL
 	     + Return HNL as SimpleHNL object.
 
+  Acceptance correction: for each (HNL mass, 2-body production channel) the lab-frame
+  emission angle wrt the parent is tabulated once over parent boost and rest-frame
+  emission angle, and interpolated for every flux entry. 3-body channels (where the HNL
+  rest-frame momentum varies) and parents outside the tabulated boost range fall back
+  to numerical scans of labangle().
+
+  The flux input TChain is read in a single process. Per-entry state is kept in mutable
+  members, so there is no mode that splits the chain into chunks: use --firstEvent and
+  -n of gevgen_hnl to spread the flux entries over several jobs instead.
+
 \class      genie::hnl::FluxCreator
 
 \brief      Calculates HNL production kinematics & production vertex.
@@ -166,6 +176,26 @@ namespace genie{
       // collimation effect calc, returns HNL_acc / geom_acc
       double CalculateAcceptanceCorrection( TLorentzVector p4par, TLorentzVector p4HNL, double SMECM, double zm, double zp ) const;
       static double labangle( double * x, double * par ); // function formula for correction
+      // lab angle [deg] wrt parent, for parent speed beta and rest-frame speed vRest
+      static double LabAngle( double thetaRest, double beta, double vRest );
+
+      // tabulated lab angle over ( parent boost, rest-frame emission angle ) for one rest-frame speed
+      struct AcceptanceSurface {
+	double vRest;                // speed of emitted particle in parent rest frame
+	std::vector< double > aMax;  // rest-frame angle of maximum lab angle, per boost node [deg]
+	std::vector< double > yMax;  // maximum lab angle, per boost node [deg]
+	std::vector< double > y;     // lab angle, boost-major [deg]
+      };
+      const AcceptanceSurface & GetAcceptanceSurface( int key, double vRest ) const;
+      // correction from the surfaces. False if the parent is outside the grid
+      bool SurfaceAcceptanceCorrection( TLorentzVector p4par, TLorentzVector p4HNL,
+					double SMECM, double zm, double zp, double & accCorr ) const;
+      // measure of rest-frame angles x with lab angle in [zm, zp], interpolated at log10(beta*gamma)
+      static double SurfaceMeasure( const AcceptanceSurface & surf, double lbg, double beta,
+				    double R, double x0, double zm, double zp );
+      static double SurfaceRestFrameAngle( const AcceptanceSurface & surf, int ib, double thetaLab, bool forward );
+      // measure of x in [0, 180] with angle to parent in [a1, a2], parent at (R, x0) in the y'z' plane
+      static double EmissionMeasure( double a1, double a2, double R, double x0 );
       // get minimum and maximum deviation from parent momentum to hit detector, [deg]
       double GetAngDeviation( TLorentzVector p4par, TVector3 detO, bool seekingMax ) const;
       void GetAngDeviation( TLorentzVector p4par, TVector3 detO, double &zm, double &zp ) const;
@@ -231,6 +261,10 @@ namespace genie{
       mutable double fECM, fSMECM; // GeV
       mutable double fZm, fZp; // deg
 
+      // acceptance surfaces for fMass, keyed by production channel ( -1 == SM neutrino )
+      mutable std::map< int, AcceptanceSurface > fAccSurfaces;
+      mutable double fAccSurfaceMass = -1.0;
+
       mutable int fProdChan, fNuProdChan;
 
       mutable TVector3 fTargetPoint, fTargetPointUser;
@@ -54,8 +54,9 @@ cdouble AREikonalSolution::Element(const double radius, const double cosine_rz,
   integrationtools::SGNR(za, rmax, nz, sampling, absiz, junk, decoy);
 
   //do i=1,nzs
-//  cdouble ordez[sampling];
-  cdouble * ordez = new cdouble[sampling]; // CA
+  // optical potential buffer, re-used between calls
+  if( fOrdez.size() < sampling ) fOrdez.resize(sampling);
+  cdouble * ordez = &fOrdez[0];
   double zp, rp;
   cdouble piself;
 
@@ -89,7 +90,6 @@ cdouble AREikonalSolution::Element(const double radius, const double cosine_rz,
   // Eikonal approximation to the wave function
   cdouble uwaveik = exp( - cdouble(0,1) * ( ppim*za + resu ) );
 
-  delete [] ordez; // CA
 
   return uwaveik;
 }
@@ -20,6 +20,7 @@
 #define _AR_EIKONAL_SOLUTION_H_
 
 #include <complex>
+#include <vector>
 
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
 #include "Physics/Coherent/XSection/ARSampledNucleus.h"
@@ -63,6 +64,8 @@ class AREikonalSolution: public ARWFSolution
 
     bool owns_constants;
 
+    std::vector<std::complex<double> > fOrdez; // optical potential along z, filled by Element()
+
 };
 
 
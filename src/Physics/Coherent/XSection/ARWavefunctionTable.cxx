@@ -0,0 +1,92 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2025, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
+#include "Physics/Coherent/XSection/ARWavefunction.h"
+#include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
+
+typedef std::complex<double> cdouble;
+
+namespace genie {
+namespace alvarezruso {
+
+ARWavefunctionTable::ARWavefunctionTable(
+                  unsigned int sampling, double e_min, double e_step)
+  : fSampling(sampling),
+  fEMin(e_min),
+  fEStep(e_step)
+{
+}
+
+ARWavefunctionTable::~ARWavefunctionTable()
+{
+  std::map<unsigned int, Node>::iterator it = fNodes.begin();
+  for( ; it != fNodes.end(); ++it) {
+    delete it->second.uwave;
+    delete it->second.uwave_dr;
+    delete it->second.uwave_dtheta;
+  }
+  fNodes.clear();
+}
+
+unsigned int ARWavefunctionTable::NNodes() const
+{
+  return fNodes.size();
+}
+
+const ARWavefunctionTable::Node & ARWavefunctionTable::GetNode(
+                        unsigned int k, AlvarezRusoCOHPiPDXSec & solver)
+{
+  std::map<unsigned int, Node>::iterator it = fNodes.find(k);
+  if(it != fNodes.end()) return it->second;
+
+  Node node;
+  node.uwave        = new ARWavefunction(fSampling);
+  node.uwave_dr     = new ARWavefunction(fSampling);
+  node.uwave_dtheta = new ARWavefunction(fSampling);
+  solver.SolveWavefunctions(fEMin + k * fEStep,
+                   *node.uwave, *node.uwave_dr, *node.uwave_dtheta);
+
+  return fNodes.insert(std::make_pair(k, node)).first->second;
+}
+
+void ARWavefunctionTable::Interpolate(
+            double e_pion, AlvarezRusoCOHPiPDXSec & solver,
+            ARWavefunction & uwave, ARWavefunction & uwave_dr,
+            ARWavefunction & uwave_dtheta)
+{
+  double t = (e_pion - fEMin) / fEStep;
+  if(t < 0.) t = 0.;
+  unsigned int k = (unsigned int) std::floor(t);
+  double f = t - k;
+
+  const Node & lo = this->GetNode(k,   solver);
+  const Node & hi = this->GetNode(k+1, solver);
+
+  unsigned int n = uwave.sampling();
+  for(unsigned int i = 0; i != n; ++i)
+  {
+    for(unsigned int j = 0; j != n; ++j)
+    {
+      uwave.set       (i, j, (1.-f) * (*lo.uwave)(i,j)
+                                + f * (*hi.uwave)(i,j) );
+      uwave_dr.set    (i, j, (1.-f) * (*lo.uwave_dr)(i,j)
+                                + f * (*hi.uwave_dr)(i,j) );
+      uwave_dtheta.set(i, j, (1.-f) * (*lo.uwave_dtheta)(i,j)
+                                + f * (*hi.uwave_dtheta)(i,j) );
+    }
+  }
+}
+
+} //namespace alvarezruso
+} //namespace genie
@@ -0,0 +1,74 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::alvarezruso::ARWavefunctionTable
+
+\brief    Table of the distorted pion wavefunctions (and of their radial and
+          angular derivatives) used by the Alvarez-Ruso Coherent Pion
+          Production xsec, on a regular grid in pion energy.
+
+          The wavefunctions depend only on the nucleus, the pion mass and
+          the pion energy, so a table can be shared by all the
+          AlvarezRusoCOHPiPDXSec objects for the same nucleus and current.
+          Grid nodes are solved on first use and the wavefunctions at
+          intermediate energies are interpolated linearly between nodes.
+
+\ref
+
+\author   The GENIE Collaboration
+
+\created  October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _AR_WAVEFUNCTION_TABLE_H_
+#define _AR_WAVEFUNCTION_TABLE_H_
+
+#include <map>
+
+namespace genie
+{
+namespace alvarezruso
+{
+
+class AlvarezRusoCOHPiPDXSec;
+class ARWavefunction;
+
+class ARWavefunctionTable
+{
+  public:
+    // Grid nodes at e_min + k * e_step (in the internal units of
+    // AlvarezRusoCOHPiPDXSec, ie divided by hbar)
+    ARWavefunctionTable(unsigned int sampling, double e_min, double e_step);
+    ~ARWavefunctionTable();
+
+    // Fill the wavefunctions at pion energy e_pion. Missing grid nodes are
+    // solved using the given cross section object.
+    void Interpolate(double e_pion, AlvarezRusoCOHPiPDXSec & solver,
+                     ARWavefunction & uwave, ARWavefunction & uwave_dr,
+                     ARWavefunction & uwave_dtheta);
+
+    // Number of grid nodes solved so far
+    unsigned int NNodes() const;
+
+  private:
+    struct Node {
+      ARWavefunction * uwave;
+      ARWavefunction * uwave_dr;
+      ARWavefunction * uwave_dtheta;
+    };
+
+    const Node & GetNode(unsigned int k, AlvarezRusoCOHPiPDXSec & solver);
+
+    unsigned int fSampling;
+    double fEMin;
+    double fEStep;
+    std::map<unsigned int, Node> fNodes;
+};
+
+} //namespace alvarezruso
+} //namespace genie
+#endif
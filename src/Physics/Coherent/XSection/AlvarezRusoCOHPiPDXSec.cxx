@@ -36,6 +36,7 @@
 #include "Physics/Coherent/XSection/AREikonalSolution.h"
 #include "Framework/Numerical/IntegrationTools.h"
 #include "Physics/Coherent/XSection/ARWavefunction.h"
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
 
 using namespace genie::constants;
 
@@ -60,6 +61,7 @@ AlvarezRusoCOHPiPDXSec::AlvarezRusoCOHPiPDXSec(unsigned int Z_, unsigned int A_,
   fConstants ( new ARConstants() ),
   fNucleus   ( new ARSampledNucleus(fZ, fA, fSampling) ),
   fWfsolution ( new AREikonalSolution(debug_, this) ),
+  fWfTable   ( NULL ),
   fLastE_pi  (-9999999.),
   fUwave      ( new ARWavefunction(fSampling, debug_) ),
   fUwaveDr    ( new ARWavefunction(fSampling, debug_) ),
@@ -122,7 +124,12 @@ double AlvarezRusoCOHPiPDXSec::DXSec( const double E_nu_, const double E_l_, con
 
   // Only need to resolve wave funtions if Epi changes
   if ( TMath::Abs(fLastE_pi-fP_pi.E()) > 1E-10 ){
-    SolveWavefunctions();
+    if ( fWfTable ) {
+      fWfTable->Interpolate(fP_pi.E(), *this, *fUwave, *fUwaveDr, *fUwaveDtheta);
+    }
+    else {
+      SolveWavefunctions();
+    }
   }
 
   LorentzVector pni = fP_pi - fQ;
@@ -296,9 +303,15 @@ void AlvarezRusoCOHPiPDXSec::SetCurrent()
 /// This is only a function of the nucleus and pion momentum/energy
 /// so if neither of those have changed there is no need to re-calculate
 /// the wavefunction values.
-/// Such a caching has not been implemented here yet!
+/// Caching across pion energies is done by ARWavefunctionTable.
 
 void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
+{
+  SolveWavefunctions(fP_pi.E(), *fUwave, *fUwaveDr, *fUwaveDtheta);
+}
+
+void AlvarezRusoCOHPiPDXSec::SolveWavefunctions(double e_pion,
+     ARWavefunction & uwave, ARWavefunction & uwave_dr, ARWavefunction & uwave_dtheta)
 {
   unsigned int n_points = fNucleus->GetNDensities();
 
@@ -326,18 +339,18 @@ void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
       cosine_rz = x2 / radius;
 
       // Calculate wavefunction
-      fUwave->set(i, j, fWfsolution->Element(radius, -cosine_rz,
-                          fP_pi.E()));
+      uwave.set(i, j, fWfsolution->Element(radius, -cosine_rz,
+                          e_pion));
       delta_r = 0.0001;
       if( radius < delta_r ) delta_r = radius;
 
       // Calculate derivative of wavefunction in the radial direction
       uwave_plus  = fWfsolution->Element( (radius+delta_r), -cosine_rz,
-                                     fP_pi.E());
+                                     e_pion);
       uwave_minus = fWfsolution->Element( (radius-delta_r), -cosine_rz,
-                                     fP_pi.E());
+                                     e_pion);
 
-      fUwaveDr->set(i, j, (uwave_plus - uwave_minus) / (2.0 * delta_r) );
+      uwave_dr.set(i, j, (uwave_plus - uwave_minus) / (2.0 * delta_r) );
 
       // Calculate derivative of wavefunction in the angle space
       delta_c = 0.0001;
@@ -345,10 +358,10 @@ void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
       else if( (cosine_rz + delta_c) >=  1.0 )  delta_c = 1.0 - cosine_rz - 1E-12;
 
       uwave_plus  = fWfsolution->Element(radius, -(cosine_rz+delta_c),
-                                        fP_pi.E());
+                                        e_pion);
       uwave_minus = fWfsolution->Element(radius, -(cosine_rz-delta_c),
-                                        fP_pi.E());
-      fUwaveDtheta->set( i, j, (uwave_plus - uwave_minus) / (2.0 * delta_c) );
+                                        e_pion);
+      uwave_dtheta.set( i, j, (uwave_plus - uwave_minus) / (2.0 * delta_c) );
 
     }
   }
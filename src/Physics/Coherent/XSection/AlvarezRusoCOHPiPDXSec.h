@@ -37,6 +37,7 @@ namespace alvarezruso
 {
 
 class ARWFSolution;
+class ARWavefunctionTable;
 
 enum current_t{kCC, kNC};
 enum flavour_t{kE, kMu, kTau};
@@ -58,6 +59,14 @@ class AlvarezRusoCOHPiPDXSec
 
     void SetDebug(bool debug)  {  debug_ = debug;  };
 
+    // Take the pion wavefunctions from a (shared, not owned) table rather
+    // than solving them for every new pion energy
+    void SetWavefunctionTable(ARWavefunctionTable * table) { fWfTable = table; };
+
+    // Solve the pion wavefunctions at the given pion energy
+    void SolveWavefunctions(double e_pion, ARWavefunction & uwave,
+           ARWavefunction & uwave_dr, ARWavefunction & uwave_dtheta);
+
     ARConstants      & GetConstants(void);
     ARSampledNucleus & GetNucleus  (void);
 
@@ -124,6 +133,8 @@ class AlvarezRusoCOHPiPDXSec
         ARSampledNucleus * fNucleus;
         // Wavefunction calculator
         ARWFSolution* fWfsolution;
+        // Wavefunction table (optional)
+        ARWavefunctionTable* fWfTable;
 
         // Kinematics of the event
         double fE_nu;     // initial neutrino energy [GeV]
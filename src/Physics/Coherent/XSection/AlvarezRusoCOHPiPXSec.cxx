@@ -41,20 +41,20 @@ using namespace alvarezruso;
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec() :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec")
 {
-  fMultidiff = NULL;
-  fLastInteraction = NULL;
+  fUseLookupTable   = false;
+  fLookupTableEStep = 0.005;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec(string config) :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec", config)
 {
-  fMultidiff = NULL;
-  fLastInteraction = NULL;
+  fUseLookupTable   = false;
+  fLookupTableEStep = 0.005;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::~AlvarezRusoCOHPiPXSec()
 {
-  if (fMultidiff) delete fMultidiff;
+  this->ClearCache();
 }
 //____________________________________________________________________________
 double AlvarezRusoCOHPiPXSec::XSec(
@@ -74,51 +74,64 @@ double AlvarezRusoCOHPiPXSec::XSec(
   const TLorentzVector p4_pi  = kinematics.HadSystP4();
   double E_lep = p4_lep.E();
 
-  if (fLastInteraction!=interaction) {
-    if (fMultidiff != NULL) {
-      delete fMultidiff;
-      fMultidiff = NULL;
-    }
+  current_t current;
+  if ( interaction->ProcInfo().IsWeakCC() ) {
+    current = kCC;
+  }
+  else if ( interaction->ProcInfo().IsWeakNC() ) {
+    current = kNC;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
+    return 0.;
+  }
 
-    current_t current;
-    if ( interaction->ProcInfo().IsWeakCC() ) {
-      current = kCC;
-    }
-    else if ( interaction->ProcInfo().IsWeakNC() ) {
-      current = kNC;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
-      return 0.;
-    }
+  flavour_t flavour;
+  if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
+    flavour=kE;
+  }
+  else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
+    flavour=kMu;
+  }
+  else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
+    flavour=kTau;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
+    return 0.;
+  }
 
-    flavour_t flavour;
-    if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
-      flavour=kE;
-    }
-    else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
-      flavour=kMu;
-    }
-    else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
-      flavour=kTau;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
-      return 0.;
-    }
+  nutype_t nutype;
+  if ( init_state.ProbePdg() > 0) {
+    nutype = kNu;
+  } else {
+    nutype = kAntiNu;
+  }
 
-    nutype_t nutype;
-    if ( init_state.ProbePdg() > 0) {
-      nutype = kNu;
-    } else {
-      nutype = kAntiNu;
+  AlvarezRusoCOHPiPDXSec * multidiff = 0;
+  int key = (((A*200 + Z)*2 + current)*3 + flavour)*2 + nutype;
+  std::map<int, AlvarezRusoCOHPiPDXSec *>::iterator it = fMultidiff.find(key);
+  if (it != fMultidiff.end()) {
+    multidiff = it->second;
+  }
+  else {
+    multidiff = new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
+    if (fUseLookupTable) {
+      // the wavefunctions only depend on the nucleus and the pion mass
+      int table_key = (A*200 + Z)*2 + current;
+      ARWavefunctionTable * table = fWfTables[table_key];
+      if (!table) {
+        double hbar = multidiff->GetConstants().HBar();
+        table = new ARWavefunctionTable(multidiff->GetSampling(),
+                    multidiff->GetPiMass(), fLookupTableEStep / hbar);
+        fWfTables[table_key] = table;
+      }
+      multidiff->SetWavefunctionTable(table);
     }
-
-    fMultidiff = new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
-    fLastInteraction = interaction;
+    fMultidiff[key] = multidiff;
   }
 
-  double xsec = fMultidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
+  double xsec = multidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
   xsec = xsec * 1E-38 * units::cm2;
 
   if (kps != kPSElOlOpifE) {
@@ -180,6 +193,13 @@ void AlvarezRusoCOHPiPXSec::LoadConfig(void)
   ffStar   = fConfig->GetDoubleDef("fStar",         gc->GetDouble("COHAR-fStar"));*/
 
 
+  //-- pion wavefunction tables
+  GetParamDef( "UseLookupTable",             fUseLookupTable,   false ) ;
+  GetParamDef( "LookupTable-PionEnergyStep", fLookupTableEStep, 0.005 ) ;
+
+  // models / tables built with the previous configuration are stale
+  this->ClearCache();
+
   //-- load the differential cross section integrator
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
@@ -187,3 +207,14 @@ void AlvarezRusoCOHPiPXSec::LoadConfig(void)
 
 }
 //____________________________________________________________________________
+void AlvarezRusoCOHPiPXSec::ClearCache(void)
+{
+  std::map<int, AlvarezRusoCOHPiPDXSec *>::iterator mit = fMultidiff.begin();
+  for( ; mit != fMultidiff.end(); ++mit) delete mit->second;
+  fMultidiff.clear();
+
+  std::map<int, ARWavefunctionTable *>::iterator tit = fWfTables.begin();
+  for( ; tit != fWfTables.end(); ++tit) delete tit->second;
+  fWfTables.clear();
+}
+//____________________________________________________________________________
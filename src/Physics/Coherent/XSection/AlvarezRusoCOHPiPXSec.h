@@ -23,7 +23,10 @@
 #define _ALVAREZ_RUSO_COH_XSEC_H_
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
+#include <map>
+
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
 
 namespace genie {
 
@@ -48,16 +51,22 @@ public:
   void Configure(string config);
 
 private:
-  void LoadConfig(void);
+  void LoadConfig  (void);
+  void ClearCache  (void);
 
   //-- private data members loaded from config Registry or set to defaults
 
   const XSecIntegratorI * fXSecIntegrator;
 
-  mutable alvarezruso::AlvarezRusoCOHPiPDXSec * fMultidiff;
-  mutable const Interaction * fLastInteraction;
+  //-- cached multi-differential cross section objects, keyed by nucleus,
+  //   current, flavour and neutrino type, and pion wavefunction tables,
+  //   keyed by nucleus and current
+  mutable std::map<int, alvarezruso::AlvarezRusoCOHPiPDXSec *> fMultidiff;
+  mutable std::map<int, alvarezruso::ARWavefunctionTable *>    fWfTables;
+
   //Parameters
-  //bool fUseLookupTable;
+  bool   fUseLookupTable;     ///< interpolate pion wavefunctions from energy-gridded tables?
+  double fLookupTableEStep;   ///< pion energy step of the wavefunction tables (GeV)
   //double fa4;
   //double fa5;
   //double fb4;
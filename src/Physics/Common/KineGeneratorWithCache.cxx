@@ -17,6 +17,7 @@
 #include <TMath.h>
 
 #include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/EventGen/EventGenProfiler.h"
 #include "Physics/Common/KineGeneratorWithCache.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
@@ -24,27 +25,33 @@
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Conventions/Controls.h"
 
 using std::ostringstream;
 using std::map;
 
 using namespace genie;
+using namespace genie::controls;
 
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache() : 
-EventRecordVisitorI(), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1)
+EventRecordVisitorI(), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1),
+fRjStatsPrintPeriod(0), fRjBatchSize(1), fRjPointSize(0), fRjPhaseSpace(kPSNull)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name) : 
-EventRecordVisitorI(name), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1)
+EventRecordVisitorI(name), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1),
+fRjStatsPrintPeriod(0), fRjBatchSize(1), fRjPointSize(0), fRjPhaseSpace(kPSNull)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name, string config) : 
-EventRecordVisitorI(name, config), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1)
+EventRecordVisitorI(name, config), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1),
+fRjStatsPrintPeriod(0), fRjBatchSize(1), fRjPointSize(0), fRjPhaseSpace(kPSNull)
 {
 
 }
@@ -292,3 +299,117 @@ double KineGeneratorWithCache::ComputeMaxXSec (const Interaction * in, const int
   }
 }
 //___________________________________________________________________________
+bool KineGeneratorWithCache::SelectKinematics(
+  GHepRecord * evrec, double xsec_max, double & xsec) const
+{
+// Rejection method engine shared by the concrete kinematics generators.
+// Proposes fRjBatchSize points at a time (ProposeKinematics), evaluates the
+// differential xsec of the whole batch in one call (EvaluateKinematics) and
+// tests the points in order against xsec_max. If kinematics are generated
+// uniformly, the first point with a positive xsec is accepted instead.
+// Returns true once a point is accepted: the interaction then holds it and
+// xsec is set to its differential xsec. Returns false after kRjMaxIterations
+// proposals. The trials are recorded once per event (RecordRejectionTrials).
+// For a batch of size 1, random numbers are drawn in the same order as in a
+// conventional propose/evaluate/test loop.
+
+  Interaction * interaction = evrec->Summary();
+  RandomGen * rnd = RandomGen::Instance();
+
+  int nbatch = TMath::Max(1, fRjBatchSize);
+  if((int)fRjXSec.size()   < nbatch)              fRjXSec.resize(nbatch);
+  if((int)fRjPoints.size() < nbatch*fRjPointSize) fRjPoints.resize(nbatch*fRjPointSize);
+
+  unsigned int iter = 0;
+  int nevaluated = 0, nexceeded = 0;
+  while(iter < kRjMaxIterations) {
+
+     //-- propose a batch of points (proposals without a valid point count
+     //   as iterations but are not evaluated)
+     int npoints = 0;
+     while(npoints < nbatch && iter < kRjMaxIterations) {
+       iter++;
+       if(this->ProposeKinematics(evrec, &fRjPoints[npoints*fRjPointSize])) npoints++;
+     }
+     if(npoints == 0) break;
+
+     //-- compute the cross section for the whole batch
+     this->EvaluateKinematics(evrec, npoints, &fRjPoints[0], &fRjXSec[0]);
+     nevaluated += npoints;
+     int iheld = npoints-1; // point held by the interaction
+
+     //-- decide whether to accept one of the proposed points
+     for(int ip = 0; ip < npoints; ip++) {
+       const double * point = &fRjPoints[ip*fRjPointSize];
+       bool accept = false;
+       if(fGenerateUniformly) {
+         accept = (fRjXSec[ip]>0);
+       } else {
+         double t = xsec_max * rnd->RndKine().Rndm();
+         if(fRjXSec[ip] > xsec_max || fRjXSec[ip] < 0) {
+           if(ip != iheld) { this->ApplyKinematics(evrec, point); iheld = ip; }
+           this->AssertXSecLimits(interaction, fRjXSec[ip], xsec_max);
+           if(fRjXSec[ip] > xsec_max) nexceeded++;
+         }
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+         LOG("Kinematics", pDEBUG)
+           << "xsec= " << fRjXSec[ip] << ", Rnd= " << t;
+#endif
+         accept = (t < fRjXSec[ip]);
+       }
+       if(accept) {
+         if(ip != iheld) this->ApplyKinematics(evrec, point);
+         xsec = fRjXSec[ip];
+         this->RecordRejectionTrials(interaction, nevaluated, 1, nexceeded);
+         return true;
+       }
+     }
+  } // iterations
+
+  this->RecordRejectionTrials(interaction, nevaluated, 0, nexceeded);
+  return false;
+}
+//___________________________________________________________________________
+bool KineGeneratorWithCache::ProposeKinematics(
+  GHepRecord * /*evrec*/, double * /*point*/) const
+{
+  LOG("Kinematics", pFATAL)
+    << this->Id().Key() << " uses SelectKinematics() but does not propose points";
+  gAbortingInErr = true;
+  exit(1);
+  return false;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::EvaluateKinematics(
+  GHepRecord * evrec, int npoints, const double * points, double * xsec) const
+{
+  fXSecModel->XSecBatch(evrec->Summary(), fRjPhaseSpace,
+                        npoints, fRjPointSize, &fRjKineVars[0], points, xsec);
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::ApplyKinematics(
+  GHepRecord * evrec, const double * point) const
+{
+  Kinematics * kine = evrec->Summary()->KinePtr();
+  for(int j = 0; j < fRjPointSize; j++) {
+    kine->SetKV(fRjKineVars[j], point[j]);
+  }
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::RecordRejectionTrials(
+   const Interaction * interaction, int nevaluated, int naccepted,
+   int nexceeded) const
+{
+// Records the outcome of the rejection method for a single generated event:
+// concrete generators count the trials locally and call this once per event
+// (or once before giving up), keeping the bookkeeping out of the trial loop.
+
+  fRjStats.Record(this->Id().Key(), EventGenProfiler::ChannelKey(interaction),
+                  nevaluated, naccepted, nexceeded, fRjStatsPrintPeriod);
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::PrintRejectionStatistics(void) const
+{
+  fRjStats.Print(this->Id().Key());
+}
+//___________________________________________________________________________
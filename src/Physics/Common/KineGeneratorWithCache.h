@@ -18,6 +18,16 @@
           The example of using this opportunity see in 
           the class QELEventGeneratorSM.
 
+          The class also provides the rejection method engine shared by the
+          concrete generators (SelectKinematics): a batch of kinematical
+          points is proposed (ProposeKinematics), the differential xsec is
+          evaluated for the whole batch in one call (EvaluateKinematics,
+          by default XSecAlgorithmI::XSecBatch) and the points are tested in
+          order against the max xsec. The evaluated, accepted and
+          max-xsec-exceeding points are recorded once per event, per
+          interaction channel (see RejectionStatsTable), so that channels
+          with a low acceptance can be identified and their max xsec tuned.
+
 \author   Costas Andreopoulos <c.andreopoulos \at cern.ch>
           University of Liverpool \n
           Igor Kakorin <kakorin@jinr.ru>
@@ -34,12 +44,19 @@
 #define _KINE_GENERATOR_WITH_CACHE_H_
 
 #include <string>
+#include <map>
+#include <vector>
 
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/Conventions/KineVar.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Utils/Range1.h"
+#include "Physics/Common/RejectionStats.h"
 
 using std::string;
+using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -48,6 +65,11 @@ class XSecAlgorithmI;
 
 class KineGeneratorWithCache : public EventRecordVisitorI {
 
+public:
+  //! Rejection method statistics, keyed by interaction channel
+  const map<string, RejectionStats> & RejectionStatistics (void) const { return fRjStats.Stats(); }
+  void PrintRejectionStatistics (void) const;
+
 protected:
   KineGeneratorWithCache();
   KineGeneratorWithCache(string name);
@@ -65,6 +87,16 @@ protected:
 
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
+  virtual void RecordRejectionTrials (const Interaction * in, int nevaluated, int naccepted, int nexceeded=0) const;
+
+  //-- Rejection method engine. A point is an array of fRjPointSize values.
+  //   By default, point values are the running values of the fRjKineVars and
+  //   the xsec is evaluated in the fRjPhaseSpace phase space.
+  virtual bool ProposeKinematics  (GHepRecord * evrec, double * point) const;
+  virtual void EvaluateKinematics (GHepRecord * evrec, int npoints, const double * points, double * xsec) const;
+  virtual void ApplyKinematics    (GHepRecord * evrec, const double * point) const;
+  bool         SelectKinematics   (GHepRecord * evrec, double xsec_max, double & xsec) const;
+
   mutable const XSecAlgorithmI * fXSecModel;
 
   double fSafetyFactor;                     ///< ComputeMaxXSec -> ComputeMaxXSec * fSafetyFactor
@@ -75,6 +107,16 @@ protected:
   double fMaxXSecDiffTolerance;             ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
   double fEMin;                             ///< min E for which maxxsec is cached - forcing explicit calc.
   bool   fGenerateUniformly;                ///< uniform over allowed phase space + event weight?
+  int    fRjStatsPrintPeriod;               ///< print rejection stats every that many accepted points per channel (0: never)
+  int    fRjBatchSize;                      ///< number of kinematical points proposed per accept/reject batch
+  int    fRjPointSize;                      ///< number of values per proposed kinematical point
+  vector<KineVar_t> fRjKineVars;            ///< kinematic variables of a proposed point (default EvaluateKinematics)
+  KinePhaseSpace_t  fRjPhaseSpace;          ///< phase space of the proposed points (default EvaluateKinematics)
+
+private:
+  mutable RejectionStatsTable fRjStats;
+  mutable vector<double>      fRjPoints;
+  mutable vector<double>      fRjXSec;
 };
 
 }      // genie namespace
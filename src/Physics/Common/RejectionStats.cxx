@@ -0,0 +1,61 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2025, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <sstream>
+
+#include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/EventGen/EventGenProfiler.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/Common/RejectionStats.h"
+
+using std::ostringstream;
+
+using namespace genie;
+
+//___________________________________________________________________________
+void RejectionStatsTable::Record(
+   const string & module, const string & channel,
+   int nevaluated, int naccepted, int nexceeded, int print_period)
+{
+  RejectionStats & stats = fStats[channel];
+  stats.NEvaluated += nevaluated;
+  stats.NAccepted  += naccepted;
+  stats.NExceeded  += nexceeded;
+
+  EventGenProfiler * profiler = EventGenProfiler::Instance();
+  if(profiler->IsEnabled()) {
+    const EventGeneratorI * evg = RunningThreadInfo::Instance()->RunningThread();
+    profiler->AddRejectionTrials(evg ? evg->Id().Key() : "",
+                                 module, channel, nevaluated, naccepted);
+  }
+
+  if(print_period>0 && naccepted>0) {
+    if(stats.NAccepted % print_period == 0) {
+      this->Print(module);
+    }
+  }
+}
+//___________________________________________________________________________
+void RejectionStatsTable::Print(const string & module) const
+{
+  ostringstream mesg;
+  mesg << "Rejection method statistics for " << module << ":";
+  map<string, RejectionStats>::const_iterator it = fStats.begin();
+  for( ; it != fStats.end(); ++it) {
+    const RejectionStats & stats = it->second;
+    mesg << "\n  " << it->first
+         << " : evaluated = " << stats.NEvaluated
+         << ", accepted = "   << stats.NAccepted
+         << ", exceeded = "   << stats.NExceeded
+         << ", efficiency = " << stats.Efficiency();
+  }
+  LOG("Kinematics", pNOTICE) << mesg.str();
+}
+//___________________________________________________________________________
@@ -0,0 +1,67 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::RejectionStatsTable
+
+\brief    Rejection method statistics of an event generation module, kept per
+          interaction channel, so that channels with a low acceptance can be
+          identified and their max xsec (or envelope) tuned.
+
+          Modules count the evaluated, accepted and max-xsec-exceeding
+          kinematical points of each event and record them once per event
+          (or once before giving up). If the EventGenProfiler is enabled, the
+          trials are forwarded to it as well.
+
+\author   The GENIE Collaboration
+
+\created  October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _REJECTION_STATS_H_
+#define _REJECTION_STATS_H_
+
+#include <string>
+#include <map>
+
+using std::string;
+using std::map;
+
+namespace genie {
+
+//! Rejection method bookkeeping for a single interaction channel
+class RejectionStats {
+public:
+  RejectionStats() : NEvaluated(0), NAccepted(0), NExceeded(0) { }
+  double Efficiency (void) const { return (NEvaluated>0) ? (double)NAccepted/NEvaluated : 0.; }
+
+  long NEvaluated; ///< number of kinematical points with computed xsec
+  long NAccepted;  ///< number of accepted kinematical points
+  long NExceeded;  ///< number of points with xsec > max xsec
+};
+
+class RejectionStatsTable {
+
+public:
+  RejectionStatsTable() { }
+
+  //! Add the trials of one event of module `module` in channel `channel`.
+  //! The table is printed every print_period accepted events of a channel
+  //! (never if print_period <= 0).
+  void Record (const string & module, const string & channel,
+               int nevaluated, int naccepted, int nexceeded, int print_period);
+  void Print  (const string & module) const;
+
+  //! Statistics, keyed by channel (see EventGenProfiler::ChannelKey)
+  const map<string, RejectionStats> & Stats (void) const { return fStats; }
+
+private:
+  map<string, RejectionStats> fStats;
+};
+
+}      // genie namespace
+
+#endif // _REJECTION_STATS_H_
@@ -263,13 +263,14 @@ void Pythia8Decayer2023::Initialize(void) const
   LOG("Pythia8Decay", pINFO)
     << "PYTHIA8 seed = " << gPythia->settings.mode("Random:seed");
 
-  gPythia->init();
+  Pythia8Singleton::Instance()->Init();
 
   // shut off decays of pi0's as we want Geant4 to handle them
   // if other immediate decay products should be handled by Geant4,
   // their respective decay modes should be shut off as well
   //
   gPythia->readString("111:onMode = off");
+  Pythia8Singleton::Instance()->SetupChanged();
 
 #else
   LOG("Pythia8Decay", pFATAL)
@@ -329,26 +330,32 @@ void Pythia8Decayer2023::InhibitDecay(int pdg_code, TDecayChannel * dc) const
   //          << " of " << pdg_code << std::endl;
   //gPythia->particleData.list(pdg_code);
 
-  for (int ichan=ifirst_chan; ichan<=ilast_chan; ++ichan) {
-    int onMode = pdentry->channel(ichan).onMode();
-    // 4 possible modes:  0=off particle & antiparticle; 1=on both; 2=on particle only; 3=on antiparticle only
-    bool is_particle = (pdg_code>0);
-    // we're trying to turn off the mode
-    switch ( onMode ) {
-    case 0: // off for particles & antiparticles
-      break; // already off
-    case 1: // on for both particle & antiparticle
-      onMode = (is_particle ? 3 : 2);
-      break;
-    case 2: // on for particle only
-      onMode = (is_particle ? 0 : 2);
-      break;
-    case 3: // on for antiparticle only
-      onMode = (is_particle ? 3 : 0);
-      break;
+  // edit the decay table of the primary instance, from which the thread
+  // instances (including this one) are re-created
+  Pythia8Singleton::Instance()->ChangeSetup(
+    [pdg_code, ifirst_chan, ilast_chan] (Pythia8::Pythia & primary) {
+    auto pdentry = primary.particleData.particleDataEntryPtr(pdg_code);
+    for (int ichan=ifirst_chan; ichan<=ilast_chan; ++ichan) {
+      int onMode = pdentry->channel(ichan).onMode();
+      // 4 possible modes:  0=off particle & antiparticle; 1=on both; 2=on particle only; 3=on antiparticle only
+      bool is_particle = (pdg_code>0);
+      // we're trying to turn off the mode
+      switch ( onMode ) {
+      case 0: // off for particles & antiparticles
+        break; // already off
+      case 1: // on for both particle & antiparticle
+        onMode = (is_particle ? 3 : 2);
+        break;
+      case 2: // on for particle only
+        onMode = (is_particle ? 0 : 2);
+        break;
+      case 3: // on for antiparticle only
+        onMode = (is_particle ? 3 : 0);
+        break;
+      }
+      pdentry->channel(ichan).onMode(onMode);
     }
-    pdentry->channel(ichan).onMode(onMode);
-  }
+  });
 
   //std::cout << "After inhibiting channels " << ifirst_chan << "," << ilast_chan
   //          << " of " << pdg_code << std::endl;
@@ -400,26 +407,32 @@ void Pythia8Decayer2023::UnInhibitDecay(int pdg_code, TDecayChannel * dc) const
   //          << " of " << pdg_code << std::endl;
   //gPythia->particleData.list(pdg_code);
 
-  for (int ichan=ifirst_chan; ichan<=ilast_chan; ++ichan) {
-    int onMode = pdentry->channel(ichan).onMode();
-    // 4 possible modes:  0=off particle & antiparticle; 1=on both; 2=on particle only; 3=on antiparticle only
-    bool is_particle = (pdg_code>0);
-    // we're trying to turn off the mode
-    switch ( onMode ) {
-    case 0: // off for particles & antiparticles
-      onMode = (is_particle ? 2 : 3);
-      break;
-    case 1: // on for both particle & antiparticle
-      break; // already on
-    case 2: // on for particle only
-      onMode = (is_particle ? 2 : 0);
-      break;
-    case 3: // on for antiparticle only
-      onMode = (is_particle ? 0 : 3);
-      break;
+  // edit the decay table of the primary instance, from which the thread
+  // instances (including this one) are re-created
+  Pythia8Singleton::Instance()->ChangeSetup(
+    [pdg_code, ifirst_chan, ilast_chan] (Pythia8::Pythia & primary) {
+    auto pdentry = primary.particleData.particleDataEntryPtr(pdg_code);
+    for (int ichan=ifirst_chan; ichan<=ilast_chan; ++ichan) {
+      int onMode = pdentry->channel(ichan).onMode();
+      // 4 possible modes:  0=off particle & antiparticle; 1=on both; 2=on particle only; 3=on antiparticle only
+      bool is_particle = (pdg_code>0);
+      // we're trying to turn off the mode
+      switch ( onMode ) {
+      case 0: // off for particles & antiparticles
+        onMode = (is_particle ? 2 : 3);
+        break;
+      case 1: // on for both particle & antiparticle
+        break; // already on
+      case 2: // on for particle only
+        onMode = (is_particle ? 2 : 0);
+        break;
+      case 3: // on for antiparticle only
+        onMode = (is_particle ? 0 : 3);
+        break;
+      }
+      pdentry->channel(ichan).onMode(onMode);
     }
-    pdentry->channel(ichan).onMode(onMode);
-  }
+  });
 
   //std::cout << "After uninhibiting channels " << ifirst_chan << "," << ilast_chan
   //          << " of " << pdg_code << std::endl;
@@ -58,9 +58,6 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
           << "Generating kinematics uniformly over the allowed phase space";
   }
 
-  //-- Get the random number generators
-  RandomGen * rnd = RandomGen::Instance();
-
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
@@ -103,101 +100,70 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   space the max xsec is irrelevant
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
 
-  //-- Try to select a valid (x,y) pair using the rejection method
-
-  double dx = xl.max - xl.min;
-  double dy = yl.max - yl.min;
-  double gx=-1, gy=-1, gW=-1, gQ2=-1, xsec=-1;
-
-  unsigned int iter = 0;
-  bool accept = false;
-  while(1) {
-     iter++;
-     if(iter > kRjMaxIterations) {
-       LOG("DISKinematics", pWARN)
-         << " Couldn't select kinematics after " << iter << " iterations";
-       evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't select kinematics");
-       exception.SwitchOnFastForward();
-       throw exception;
-     }
+  //-- Try to select a valid (x,y) pair using the rejection method.
+  //   Candidate (x,y) pairs are proposed in batches of fRjBatchSize points
+  //   and passed to the common accept/reject step
+  fXLim = xl;
+  fYLim = yl;
+  fEv   = Ev;
+  fM    = M;
+
+  double xsec = -1;
+  bool accept = this->SelectKinematics(evrec, xsec_max, xsec);
+  if(!accept) {
+     LOG("DISKinematics", pWARN)
+       << " Couldn't select kinematics after " << kRjMaxIterations << " iterations";
+     evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
+     genie::exceptions::EVGThreadException exception;
+     exception.SetReason("Couldn't select kinematics");
+     exception.SwitchOnFastForward();
+     throw exception;
+  }
 
-     //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
-     interaction->KinePtr()->Setx(gx);
-     interaction->KinePtr()->Sety(gy);
-     kinematics::UpdateWQ2FromXY(interaction);
+  //-- The generated kinematics are accepted, finish-up module's job
+  double gx = interaction->KinePtr()->x();
+  double gy = interaction->KinePtr()->y();
+  double gW=-1, gQ2=-1;
 
-     LOG("DISKinematics", pNOTICE)
-        << "Trying: x = " << gx << ", y = " << gy
-        << " (W  = " << interaction->KinePtr()->W()  << ","
-        << " (Q2 = " << interaction->KinePtr()->Q2() << ")";
+  LOG("DISKinematics", pNOTICE)
+     << "Selected:  x = " << gx << ", y = " << gy
+     << " (W  = " << interaction->KinePtr()->W()  << ","
+     << " (Q2 = " << interaction->KinePtr()->Q2() << ")";
 
-     //-- compute the cross section for current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSxyfE);
+  // reset trust bits
+  interaction->ResetBit(kISkipProcessChk);
+  interaction->ResetBit(kISkipKinematicChk);
 
-     //-- decide whether to accept the current kinematics
-     if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
-        double t = xsec_max * rnd->RndKine().Rndm();
-	double J = 1;
+  // set the cross section for the selected kinematics
+  evrec->SetDiffXSec(xsec,kPSxyfE);
 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-        LOG("DISKinematics", pDEBUG)
-              << "xsec= " << xsec << ", J= " << J << ", Rnd= " << t;
-#endif
-        accept = (t < J*xsec);
-     }
-     else {
-        accept = (xsec>0);
-     }
+  // for uniform kinematics, compute an event weight as
+  // wght = (phase space volume)*(differential xsec)/(event total xsec)
+  if(fGenerateUniformly) {
+     double vol     = kinematics::PhaseSpaceVolume(interaction,kPSxyfE);
+     double totxsec = evrec->XSec();
+     double wght    = (vol/totxsec)*xsec;
+     LOG("DISKinematics", pNOTICE)  << "Kinematics wght = "<< wght;
+
+     // apply computed weight to the current event weight
+     wght *= evrec->Weight();
+     LOG("DISKinematics", pNOTICE) << "Current event wght = " << wght;
+     evrec->SetWeight(wght);
+  }
 
-     //-- If the generated kinematics are accepted, finish-up module's job
-     if(accept) {
-         LOG("DISKinematics", pNOTICE)
-            << "Selected:  x = " << gx << ", y = " << gy
-            << " (W  = " << interaction->KinePtr()->W()  << ","
-            << " (Q2 = " << interaction->KinePtr()->Q2() << ")";
-
-         // reset trust bits
-         interaction->ResetBit(kISkipProcessChk);
-         interaction->ResetBit(kISkipKinematicChk);
-
-         // set the cross section for the selected kinematics
-         evrec->SetDiffXSec(xsec,kPSxyfE);
-
-         // for uniform kinematics, compute an event weight as
-         // wght = (phase space volume)*(differential xsec)/(event total xsec)
-         if(fGenerateUniformly) {
-            double vol     = kinematics::PhaseSpaceVolume(interaction,kPSxyfE);
-            double totxsec = evrec->XSec();
-            double wght    = (vol/totxsec)*xsec;
-            LOG("DISKinematics", pNOTICE)  << "Kinematics wght = "<< wght;
-
-            // apply computed weight to the current event weight
-            wght *= evrec->Weight();
-            LOG("DISKinematics", pNOTICE) << "Current event wght = " << wght;
-            evrec->SetWeight(wght);
-         }
-
-         // compute W,Q2 for selected x,y
-         //bool is_em = interaction->ProcInfo().IsEM();
-         kinematics::XYtoWQ2(Ev,M,gW,gQ2,gx,gy);
-
-         LOG("DISKinematics", pNOTICE)
-                        << "Selected x,y => W = " << gW << ", Q2 = " << gQ2;
-
-         // lock selected kinematics & clear running values
-         interaction->KinePtr()->SetW (gW,  true);
-         interaction->KinePtr()->SetQ2(gQ2, true);
-         interaction->KinePtr()->Setx (gx,  true);
-         interaction->KinePtr()->Sety (gy,  true);
-         interaction->KinePtr()->ClearRunningValues();
-         return;
-     }
-  } // iterations
+  // compute W,Q2 for selected x,y
+  //bool is_em = interaction->ProcInfo().IsEM();
+  kinematics::XYtoWQ2(Ev,M,gW,gQ2,gx,gy);
+
+  LOG("DISKinematics", pNOTICE)
+                 << "Selected x,y => W = " << gW << ", Q2 = " << gQ2;
+
+  // lock selected kinematics & clear running values
+  interaction->KinePtr()->SetW (gW,  true);
+  interaction->KinePtr()->SetQ2(gQ2, true);
+  interaction->KinePtr()->Setx (gx,  true);
+  interaction->KinePtr()->Sety (gy,  true);
+  interaction->KinePtr()->ClearRunningValues();
 }
 //___________________________________________________________________________
 void DISKinematicsGenerator::Configure(const Registry & config)
@@ -233,6 +199,46 @@ void DISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Number of kinematical points proposed per accept/reject batch and
+  //   period (in accepted events per channel) for printing the rejection
+  //   method statistics
+    GetParamDef( "RejectionBatchSize", fRjBatchSize, 1 ) ;
+    assert(fRjBatchSize>0);
+    GetParamDef( "RejectionStats-PrintPeriod", fRjStatsPrintPeriod, 0 ) ;
+
+  //-- Proposed points are (x,y,W,Q2) tuples, evaluated in kPSxyfE
+    fRjPhaseSpace = kPSxyfE;
+    fRjKineVars.clear();
+    fRjKineVars.push_back(kKVx);
+    fRjKineVars.push_back(kKVy);
+    fRjKineVars.push_back(kKVW);
+    fRjKineVars.push_back(kKVQ2);
+    fRjPointSize = fRjKineVars.size();
+
+}
+//____________________________________________________________________________
+bool DISKinematicsGenerator::ProposeKinematics(
+                                 GHepRecord * /*evrec*/, double * point) const
+{
+// Proposes an (x,y) pair uniformly in the x,y range of the current event
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double gx = fXLim.min + (fXLim.max - fXLim.min) * rnd->RndKine().Rndm();
+  double gy = fYLim.min + (fYLim.max - fYLim.min) * rnd->RndKine().Rndm();
+  double gW=-1, gQ2=-1;
+  kinematics::XYtoWQ2(fEv,fM,gW,gQ2,gx,gy);
+
+  LOG("DISKinematics", pNOTICE)
+     << "Trying: x = " << gx << ", y = " << gy
+     << " (W  = " << gW  << ","
+     << " (Q2 = " << gQ2 << ")";
+
+  point[0] = gx;
+  point[1] = gy;
+  point[2] = gW;
+  point[3] = gQ2;
+  return true;
 }
 //____________________________________________________________________________
 double DISKinematicsGenerator::ComputeMaxXSec(
@@ -45,8 +45,14 @@ public :
   void Configure(string config);
 
 private:
-  void   LoadConfig      (void);
-  double ComputeMaxXSec  (const Interaction * interaction) const;
+  void   LoadConfig        (void);
+  double ComputeMaxXSec    (const Interaction * interaction) const;
+  bool   ProposeKinematics (GHepRecord * evrec, double * point) const;
+
+  mutable Range1D_t fXLim; ///< x range of the current event
+  mutable Range1D_t fYLim; ///< y range of the current event
+  mutable double    fEv;   ///< probe energy at the hit nucleon rest frame, current event
+  mutable double    fM;    ///< hit nucleon mass (can be off m-shell), current event
 };
 
 }      // genie namespace
@@ -32,6 +32,8 @@ public:
   BYPDF(string config);
   virtual ~BYPDF();
 
+  using PDFModelI::AllPDFs; // inherit versions not overridden here
+
   //! PDFModelI interface implementation
   double UpValence   (double x, double q2) const;
   double DownValence (double x, double q2) const;
@@ -23,6 +23,8 @@
 */
 //____________________________________________________________________________
 
+#include <tuple>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -32,6 +34,7 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Physics/DeepInelastic/XSection/QPMDISStrucFuncBase.h"
 #include "Physics/PartonDistributions/PDFModelI.h"
+#include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
@@ -124,6 +127,14 @@ void QPMDISStrucFuncBase::LoadConfig(void)
   GetParam( "WeinbergAngle", thw ) ;
   fSin2thw = TMath::Power(TMath::Sin(thw), 2);
 
+  //-- interpolate F1-F6 in tables filled on a (log10(x), log10(Q2)) grid?
+  GetParamDef( "SF-UseTable",     fUseSFTable,    false ) ;
+  GetParamDef( "SF-Table-dlogx",  fSFTableDlogx,  0.01  ) ;
+  GetParamDef( "SF-Table-dlogQ2", fSFTableDlogQ2, 0.02  ) ;
+
+  // the tabulated values depend on the configuration
+  fSFTable.clear();
+
   LOG("DISSF", pDEBUG) << "Done loading configuration";
 }
 //____________________________________________________________________________
@@ -135,6 +146,14 @@ void QPMDISStrucFuncBase::InitPDF(void)
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
+{
+  if(fUseSFTable) {
+    if(this->CalculateFromTable(interaction)) return;
+  }
+  this->CalculateSF(interaction);
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::CalculateSF(const Interaction * interaction) const
 {
   // Reset mutable members
   fF1 = 0;
@@ -396,6 +415,106 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
 #endif
 }
 //____________________________________________________________________________
+bool QPMDISStrucFuncBase::CalculateFromTable(
+                                      const Interaction * interaction) const
+{
+// Interpolates F1-F6 bi-linearly in (log10(x), log10(Q2)) between the nodes
+// of a table which is filled lazily, separately for each structure function
+// 'channel' (probe, interaction type, target, hit nucleon and hit quark).
+// The nodes are computed for an on-shell hit nucleon at rest, so that the
+// off-shellness of the hit nucleon is not taken into account.
+// Returns false if the input kinematics can not be interpolated and the SFs
+// have to be calculated exactly.
+
+  const Kinematics & kinematics = interaction->Kine();
+  double x     = kinematics.x();
+  double Q2val = this->Q2(interaction);
+  if(x <= 0. || x >= 1. || Q2val <= 0.) return false;
+
+  double u = -TMath::Log10(x)     / fSFTableDlogx;
+  double v =  TMath::Log10(Q2val) / fSFTableDlogQ2;
+  if(u > 1E6 || TMath::Abs(v) > 1E6) return false;
+
+  const InitialState & init_state = interaction->InitState();
+  const Target & tgt = init_state.Tgt();
+
+  SFTableKey key;
+  key.probe   = init_state.ProbePdg();
+  key.proc    = interaction->ProcInfo().InteractionTypeId();
+  key.nucleon = tgt.HitNucPdg();
+  key.quark   = tgt.HitQrkIsSet() ? tgt.HitQrkPdg() : 0;
+  key.sea     = tgt.HitQrkIsSet() && tgt.HitSeaQrk();
+  key.Z       = tgt.Z();
+  key.A       = tgt.A();
+  key.nuclmod = !interaction->TestBit(kIAssumeFreeNucleon) &&
+                !interaction->TestBit(kINoNuclearCorrection);
+
+  int    ix = TMath::FloorNint(u);
+  int    iq = TMath::FloorNint(v);
+  double dx = u - ix;
+  double dq = v - iq;
+
+  double F[6] = { 0., 0., 0., 0., 0., 0. };
+  for(int i = 0; i < 2; i++) {
+    for(int j = 0; j < 2; j++) {
+      key.ix = ix + i;
+      key.iq = iq + j;
+      const SFTableNode & node = this->SFNode(interaction, key);
+      double w = (i ? dx : 1.-dx) * (j ? dq : 1.-dq);
+      for(int k = 0; k < 6; k++) {
+        F[k] += w * node.F[k];
+      }
+    }
+  }
+
+  fF1 = F[0];
+  fF2 = F[1];
+  fF3 = F[2];
+  fF4 = F[3];
+  fF5 = F[4];
+  fF6 = F[5];
+
+  return true;
+}
+//____________________________________________________________________________
+const QPMDISStrucFuncBase::SFTableNode & QPMDISStrucFuncBase::SFNode(
+         const Interaction * interaction, const SFTableKey & key) const
+{
+  std::map<SFTableKey, SFTableNode>::const_iterator it = fSFTable.find(key);
+  if(it != fSFTable.end()) return it->second;
+
+  double x     = TMath::Power(10., -key.ix * fSFTableDlogx);
+  double Q2val = TMath::Power(10.,  key.iq * fSFTableDlogQ2);
+
+  Interaction node_interaction(*interaction);
+  Kinematics * kine = node_interaction.KinePtr();
+  kine->Setx (x);
+  kine->SetQ2(Q2val);
+  double M = PDGLibrary::Instance()->Find(key.nucleon)->Mass();
+  node_interaction.InitStatePtr()->TgtPtr()->SetHitNucP4(
+                                            TLorentzVector(0.,0.,0.,M));
+
+  this->CalculateSF(&node_interaction);
+
+  SFTableNode node;
+  node.F[0] = fF1;
+  node.F[1] = fF2;
+  node.F[2] = fF3;
+  node.F[3] = fF4;
+  node.F[4] = fF5;
+  node.F[5] = fF6;
+
+  return fSFTable.insert(std::make_pair(key, node)).first->second;
+}
+//____________________________________________________________________________
+bool QPMDISStrucFuncBase::SFTableKey::operator < (
+                                        const SFTableKey & key) const
+{
+  return std::tie(probe, proc, nucleon, quark, sea, Z, A, nuclmod, ix, iq) <
+         std::tie(key.probe, key.proc, key.nucleon, key.quark, key.sea,
+                  key.Z, key.A, key.nuclmod, key.ix, key.iq);
+}
+//____________________________________________________________________________
 double QPMDISStrucFuncBase::Q2(const Interaction * interaction) const
 {
 // Return Q2 from the kinematics or, if not set, compute it from x,y
@@ -27,6 +27,8 @@
 #ifndef _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 #define _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 
+#include <map>
+
 #include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/PartonDistributions/PDF.h"
@@ -69,6 +71,30 @@ protected:
   virtual double R          (const Interaction * i) const;
   virtual void   KFactors   (const Interaction * i, double & kuv,
                                      double & kdv, double & kus, double & kds) const;
+
+  // exact SF calculation, and optional interpolation of F1-F6 in tables
+  // filled lazily on a (log10(x), log10(Q2)) grid
+  void   CalculateSF        (const Interaction * i) const;
+  bool   CalculateFromTable (const Interaction * i) const;
+
+  struct SFTableKey {
+    int  probe;              ///< probe pdg code
+    int  proc;               ///< interaction type
+    int  nucleon;            ///< hit nucleon pdg code
+    int  quark;              ///< hit quark pdg code (0 if not set)
+    bool sea;                ///< hit sea quark?
+    int  Z;                  ///< target Z
+    int  A;                  ///< target A
+    bool nuclmod;            ///< nuclear modification allowed for this interaction?
+    int  ix;                 ///< node index in -log10(x)
+    int  iq;                 ///< node index in log10(Q2)
+    bool operator < (const SFTableKey & key) const;
+  };
+  struct SFTableNode {
+    double F[6];             ///< F1-F6 at the node
+  };
+  const SFTableNode & SFNode (const Interaction * i, const SFTableKey & key) const;
+
   // configuration
   //
   double fQ2min;             ///< min Q^2 allowed for PDFs: PDF(Q2<Q2min):=PDF(Q2min)
@@ -87,6 +113,9 @@ protected:
   double fSin2thw;           ///<
   bool   fUse2016Corrections;///< Use 2016 SF relation corrections
   double fLowQ2CutoffF1F2;   ///< Set min for relation between 2xF1 and F2
+  bool   fUseSFTable;        ///< interpolate F1-F6 in lazily filled (x,Q2) tables?
+  double fSFTableDlogx;      ///< table step in log10(x)
+  double fSFTableDlogQ2;     ///< table step in log10(Q2)
 
   mutable double fF1;
   mutable double fF2;
@@ -109,6 +138,8 @@ protected:
   mutable double fs_c;
   mutable double fc_c;
 
+  mutable std::map<SFTableKey, SFTableNode> fSFTable; ///< F1-F6 table nodes
+
 };
 
 }         // genie namespace
@@ -137,15 +137,20 @@ bool GLRESWdecPythia8::Wdecay(GHepRecord *
     //And we have to change the seed because it would regenerate the same event
     //if we dont do it.
     RandomGen * rnd = RandomGen::Instance();
-    fPythia->settings.mode("Random:seed", rnd->RndLep().Integer(100000000));
-    fPythia->settings.parm("Beams:eCM",sqrtl(s_r));
-    fPythia->init(); 
-    fPythia->next();
+    Pythia8::Pythia* gPythia = Pythia8Singleton::Instance()->Pythia8(this->Id().Name()); // instance of the current thread
+    if ( ! gPythia->settings.flag("WeakSingleBoson:ffbar2ffbar(s:W)") ) {
+      LOG("GLRESGenerator", pERROR) << "PYTHIA8 instance is not set up for W production";
+      return false;
+    }
+    gPythia->settings.mode("Random:seed", rnd->RndLep().Integer(100000000));
+    gPythia->settings.parm("Beams:eCM",sqrtl(s_r));
+    Pythia8Singleton::Instance()->Init(this->Id().Name());
+    gPythia->next();
 
-    // fPythia->event.list();
-    // fPythia->stat();
+    // gPythia->event.list();
+    // gPythia->stat();
 
-    Pythia8::Event &fEvent = fPythia->event;
+    Pythia8::Event &fEvent = gPythia->event;
     int np = fEvent.size();
     assert(np>0);
 
@@ -226,6 +231,8 @@ void GLRESWdecPythia8::LoadConfig(void)
 {
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
+  Pythia8::Pythia* gPythia = Pythia8Singleton::Instance()->Pythia8(this->Id().Name());
+
   GetParam( "SSBarSuppression",       fSSBarSuppression       );
   GetParam( "GaussianPt2",            fGaussianPt2            );
   GetParam( "NonGaussianPt2Tail",     fNonGaussianPt2Tail     );
@@ -237,16 +244,16 @@ void GLRESWdecPythia8::LoadConfig(void)
   GetParam( "Lundb",                  fLundb                  );
   GetParam( "LundaDiq",               fLundaDiq               );
 
-  fPythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
-  fPythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
-  fPythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
-  fPythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
-  fPythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
-  fPythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
-  fPythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
-  fPythia->settings.parm("StringZ:aLund",                fLunda);
-  fPythia->settings.parm("StringZ:bLund",                fLundb);
-  fPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
+  gPythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
+  gPythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
+  gPythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
+  gPythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
+  gPythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
+  gPythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
+  gPythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
+  gPythia->settings.parm("StringZ:aLund",                fLunda);
+  gPythia->settings.parm("StringZ:bLund",                fLundb);
+  gPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
 
   // Same default mass of the W boson in pythia8 and genie, so no need to change in pythia8
   // No problem with energy conservation W and top decays, so no need to set the width to 0
@@ -263,7 +270,7 @@ void GLRESWdecPythia8::LoadConfig(void)
   // So we loop over all the particles for which we inhibit decay in the config file
   // for the Decayer stage and we inhibit it also at hadronization.
   // This is not need in LeptonHadronization and PhotonCOH because they use the 
-  // Pythia8Singleton class which already defines the decays consistently
+  // shared setup of the Pythia8Singleton which already defines the decays consistently
   //
   RgKeyList klist = GetConfig().FindKeys("DecayParticleWithCode=");
   RgKeyList::const_iterator kiter = klist.begin();
@@ -274,7 +281,7 @@ void GLRESWdecPythia8::LoadConfig(void)
     int pdg_code = atoi(kv[1].c_str());
     if(!decay) {
       LOG("GLRESGenerator", pDEBUG) << "Configured to inhibit decays for  " <<  pdg_code;
-      auto pdentry = fPythia->particleData.particleDataEntryPtr(pdg_code);
+      auto pdentry = gPythia->particleData.particleDataEntryPtr(pdg_code);
       for (int ichan=0; ichan<=pdentry->sizeChannels()-1; ++ichan) {
         int onMode = pdentry->channel(ichan).onMode();
         bool is_particle = (pdg_code>0);
@@ -296,6 +303,9 @@ void GLRESWdecPythia8::LoadConfig(void)
     }
   }
 
+  // The thread instances are copied from this one on their next use
+  Pythia8Singleton::Instance()->SetupChanged(this->Id().Name());
+
   //Important: We dont initialize Pythia8 here because it must be done event by event. See above
 #endif
 
@@ -305,20 +315,23 @@ void GLRESWdecPythia8::Initialize(void) const
 {
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  fPythia = new Pythia8::Pythia();
+  // Own setup (see below) of the Pythia8Singleton, with an instance per thread.
+  // It is named after the class, not the algorithm key: this runs in the
+  // constructor, before the configuration name is added to the key.
+  Pythia8::Pythia* gPythia = Pythia8Singleton::Instance()->Pythia8(this->Id().Name());
 
-  fPythia->readString("Print:quiet = on");
-  fPythia->readString("Random:setSeed = on");
+  gPythia->readString("Print:quiet = on");
+  gPythia->readString("Random:setSeed = on");
 
   //One cool feature of having independent Pythia8 instances
   //We can define our intial state with the proper setting (i.e. disabling decays)
   //without affecting other classes of GENIE that also use Pythia8
-  fPythia->readString("WeakSingleBoson:ffbar2ffbar(s:W) = on");
-  fPythia->readString("PDF:lepton = off");
-  fPythia->readString("24:onMode = off");
-  fPythia->readString("24:onIfAny = 1 2 3 4 5"); //enable W->hadron only 
-  fPythia->readString("Beams:idA = -12");
-  fPythia->readString("Beams:idB = 11");
+  gPythia->readString("WeakSingleBoson:ffbar2ffbar(s:W) = on");
+  gPythia->readString("PDF:lepton = off");
+  gPythia->readString("24:onMode = off");
+  gPythia->readString("24:onIfAny = 1 2 3 4 5"); //enable W->hadron only 
+  gPythia->readString("Beams:idA = -12");
+  gPythia->readString("Beams:idB = 11");
 #endif
 
 }
@@ -32,6 +32,7 @@
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Physics/HELepton/XSection/Born.h"
+#include "Framework/Utils/Pythia8Singleton.h"
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
 #include "Pythia8/Pythia.h"
@@ -79,10 +80,6 @@ private:
 
   Born * born;
 
-#ifdef __GENIE_PYTHIA8_ENABLED__
-  mutable Pythia8::Pythia * fPythia;
-#endif
-
 };
 
 }      // genie namespace
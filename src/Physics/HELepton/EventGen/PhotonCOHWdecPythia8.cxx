@@ -126,15 +126,16 @@ bool PhotonCOHWdecPythia8::Wdecay(GHepRecord *
 
   int pdgboson = pdg::IsNeutrino(init_state.ProbePdg()) ? kPdgWP : kPdgWM;
 
-  fPythia->event.reset();
-  fPythia->event.append(pdgboson, 23, 0, 0, 0., p*sinth, p*costh, EW, kMw);
+  Pythia8::Pythia* gPythia = Pythia8Singleton::Instance()->Pythia8(); // instance of the current thread
+  gPythia->event.reset();
+  gPythia->event.append(pdgboson, 23, 0, 0, 0., p*sinth, p*costh, EW, kMw);
 
-  fPythia->next();
+  gPythia->next();
 
-  // fPythia->event.list();
-  // fPythia->stat();
+  // gPythia->event.list();
+  // gPythia->stat();
 
-  Pythia8::Event &fEvent = fPythia->event;
+  Pythia8::Event &fEvent = gPythia->event;
   int np = fEvent.size();
   assert(np>0);
 
@@ -216,6 +217,8 @@ void PhotonCOHWdecPythia8::LoadConfig(void)
 {
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
+  Pythia8::Pythia* gPythia = Pythia8Singleton::Instance()->Pythia8();
+
   GetParam( "SSBarSuppression",       fSSBarSuppression       );
   GetParam( "GaussianPt2",            fGaussianPt2            );
   GetParam( "NonGaussianPt2Tail",     fNonGaussianPt2Tail     );
@@ -227,22 +230,22 @@ void PhotonCOHWdecPythia8::LoadConfig(void)
   GetParam( "Lundb",                  fLundb                  );
   GetParam( "LundaDiq",               fLundaDiq               );
 
-  fPythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
-  fPythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
-  fPythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
-  fPythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
-  fPythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
-  fPythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
-  fPythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
-  fPythia->settings.parm("StringZ:aLund",                fLunda);
-  fPythia->settings.parm("StringZ:bLund",                fLundb);
-  fPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
+  gPythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
+  gPythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
+  gPythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
+  gPythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
+  gPythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
+  gPythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
+  gPythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
+  gPythia->settings.parm("StringZ:aLund",                fLunda);
+  gPythia->settings.parm("StringZ:bLund",                fLundb);
+  gPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
 
   // Same default mass of the W boson in pythia8 and genie, so no need to change in pythia8
   // No problem with energy conservation W and top decays, so no need to set the width to 0
 
   LOG("PhotonCOHGenerator", pINFO) << "Initialising PYTHIA..." ;
-  fPythia->init(); 
+  Pythia8Singleton::Instance()->Init();
 #endif
 
 }
@@ -251,19 +254,19 @@ void PhotonCOHWdecPythia8::Initialize(void) const
 {
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  fPythia = Pythia8Singleton::Instance()->Pythia8();
+  Pythia8::Pythia* gPythia = Pythia8Singleton::Instance()->Pythia8();
 
-  fPythia->readString("Print:quiet = on");
+  gPythia->readString("Print:quiet = on");
 
   // sync GENIE and PYTHIA8 seeds
   RandomGen * rnd = RandomGen::Instance();
   long int seed = rnd->GetSeed();
-  fPythia->readString("Random:setSeed = on");
-  fPythia->settings.mode("Random:seed", seed);
-  LOG("LeptoHad", pINFO) << "PYTHIA8  seed = " << fPythia->settings.mode("Random:seed");
+  gPythia->readString("Random:setSeed = on");
+  gPythia->settings.mode("Random:seed", seed);
+  LOG("LeptoHad", pINFO) << "PYTHIA8  seed = " << gPythia->settings.mode("Random:seed");
 
   //needed to only do hadronization
-  fPythia->readString("ProcessLevel:all = off");
+  gPythia->readString("ProcessLevel:all = off");
 #endif
 
 }
@@ -140,22 +140,32 @@ bool PhotonRESWdecPythia8::Wdecay(GHepRecord *
     RandomGen * rnd = RandomGen::Instance();
     Pythia8::Event fEvent;
     if (pdg::IsNeutrino(probepdg)) {
-      fPythiaP->settings.mode("Random:seed", rnd->RndLep().Integer(100000000));
-      fPythiaP->settings.parm("Beams:eCM",sqrtl(s_r));
-      fPythiaP->init(); 
-      fPythiaP->next();
-      // fPythiaP->event.list();
-      // fPythiaP->stat();
-      fEvent = fPythiaP->event;
+      Pythia8::Pythia* gPythiaP = Pythia8Singleton::Instance()->Pythia8(this->Id().Name() + "/P"); // instance of the current thread
+      if ( ! gPythiaP->settings.flag("WeakSingleBoson:ffbar2ffbar(s:W)") ) {
+        LOG("PhotonRESGenerator", pERROR) << "PYTHIA8 instance is not set up for W production";
+        return false;
+      }
+      gPythiaP->settings.mode("Random:seed", rnd->RndLep().Integer(100000000));
+      gPythiaP->settings.parm("Beams:eCM",sqrtl(s_r));
+      Pythia8Singleton::Instance()->Init(this->Id().Name() + "/P");
+      gPythiaP->next();
+      // gPythiaP->event.list();
+      // gPythiaP->stat();
+      fEvent = gPythiaP->event;
     }
     else {
-      fPythiaN->settings.mode("Random:seed", rnd->RndLep().Integer(100000000));
-      fPythiaN->settings.parm("Beams:eCM",sqrtl(s_r));
-      fPythiaN->init(); 
-      fPythiaN->next();
-      // fPythiaN->event.list();
-      // fPythiaN->stat();
-      fEvent = fPythiaN->event;      
+      Pythia8::Pythia* gPythiaN = Pythia8Singleton::Instance()->Pythia8(this->Id().Name() + "/N"); // instance of the current thread
+      if ( ! gPythiaN->settings.flag("WeakSingleBoson:ffbar2ffbar(s:W)") ) {
+        LOG("PhotonRESGenerator", pERROR) << "PYTHIA8 instance is not set up for W production";
+        return false;
+      }
+      gPythiaN->settings.mode("Random:seed", rnd->RndLep().Integer(100000000));
+      gPythiaN->settings.parm("Beams:eCM",sqrtl(s_r));
+      Pythia8Singleton::Instance()->Init(this->Id().Name() + "/N");
+      gPythiaN->next();
+      // gPythiaN->event.list();
+      // gPythiaN->stat();
+      fEvent = gPythiaN->event;      
     }
 
     int np = fEvent.size();
@@ -238,6 +248,9 @@ void PhotonRESWdecPythia8::LoadConfig(void)
 {
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
+  Pythia8::Pythia* gPythiaP = Pythia8Singleton::Instance()->Pythia8(this->Id().Name() + "/P");
+  Pythia8::Pythia* gPythiaN = Pythia8Singleton::Instance()->Pythia8(this->Id().Name() + "/N");
+
   GetParam( "SSBarSuppression",       fSSBarSuppression       );
   GetParam( "GaussianPt2",            fGaussianPt2            );
   GetParam( "NonGaussianPt2Tail",     fNonGaussianPt2Tail     );
@@ -251,27 +264,27 @@ void PhotonRESWdecPythia8::LoadConfig(void)
 
   GetParam( "Q2Grid-Min", fQ2PDFmin );
 
-  fPythiaP->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
-  fPythiaP->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
-  fPythiaP->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
-  fPythiaP->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
-  fPythiaP->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
-  fPythiaP->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
-  fPythiaP->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
-  fPythiaP->settings.parm("StringZ:aLund",                fLunda);
-  fPythiaP->settings.parm("StringZ:bLund",                fLundb);
-  fPythiaP->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
-
-  fPythiaN->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
-  fPythiaN->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
-  fPythiaN->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
-  fPythiaN->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
-  fPythiaN->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
-  fPythiaN->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
-  fPythiaN->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
-  fPythiaN->settings.parm("StringZ:aLund",                fLunda);
-  fPythiaN->settings.parm("StringZ:bLund",                fLundb);
-  fPythiaN->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
+  gPythiaP->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
+  gPythiaP->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
+  gPythiaP->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
+  gPythiaP->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
+  gPythiaP->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
+  gPythiaP->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
+  gPythiaP->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
+  gPythiaP->settings.parm("StringZ:aLund",                fLunda);
+  gPythiaP->settings.parm("StringZ:bLund",                fLundb);
+  gPythiaP->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
+
+  gPythiaN->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
+  gPythiaN->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
+  gPythiaN->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
+  gPythiaN->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
+  gPythiaN->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
+  gPythiaN->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
+  gPythiaN->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
+  gPythiaN->settings.parm("StringZ:aLund",                fLunda);
+  gPythiaN->settings.parm("StringZ:bLund",                fLundb);
+  gPythiaN->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
 
   // Same default mass of the W boson in pythia8 and genie, so no need to change in pythia8
   // No problem with energy conservation W and top decays, so no need to set the width to 0
@@ -288,7 +301,7 @@ void PhotonRESWdecPythia8::LoadConfig(void)
   // So we loop over all the particles for which we inhibit decay in the config file
   // for the Decayer stage and we inhibit it also at hadronization.
   // This is not need in LeptonHadronization and PhotonCOH because they use the 
-  // Pythia8Singleton class which already defines the decays consistently
+  // shared setup of the Pythia8Singleton which already defines the decays consistently
   //
   RgKeyList klist = GetConfig().FindKeys("DecayParticleWithCode=");
   RgKeyList::const_iterator kiter = klist.begin();
@@ -299,7 +312,7 @@ void PhotonRESWdecPythia8::LoadConfig(void)
     int pdg_code = atoi(kv[1].c_str());
     if(!decay) {
       LOG("PhotonRESGenerator", pDEBUG) << "Configured to inhibit decays for  " <<  pdg_code;
-      auto pdentryP = fPythiaP->particleData.particleDataEntryPtr(pdg_code);
+      auto pdentryP = gPythiaP->particleData.particleDataEntryPtr(pdg_code);
       for (int ichan=0; ichan<=pdentryP->sizeChannels()-1; ++ichan) {
         int onMode = pdentryP->channel(ichan).onMode();
         bool is_particle = (pdg_code>0);
@@ -319,7 +332,7 @@ void PhotonRESWdecPythia8::LoadConfig(void)
         pdentryP->channel(ichan).onMode(onMode);
       }
       
-      auto pdentryN = fPythiaN->particleData.particleDataEntryPtr(pdg_code);
+      auto pdentryN = gPythiaN->particleData.particleDataEntryPtr(pdg_code);
       for (int ichan=0; ichan<=pdentryN->sizeChannels()-1; ++ichan) {
         int onMode = pdentryN->channel(ichan).onMode();
         bool is_particle = (pdg_code>0);
@@ -342,6 +355,10 @@ void PhotonRESWdecPythia8::LoadConfig(void)
     }
   }
 
+  // The thread instances are copied from these ones on their next use
+  Pythia8Singleton::Instance()->SetupChanged(this->Id().Name() + "/P");
+  Pythia8Singleton::Instance()->SetupChanged(this->Id().Name() + "/N");
+
   //Important: We dont initialize Pythia8 here because it must be done event by event. See above
 #endif
 
@@ -355,25 +372,29 @@ void PhotonRESWdecPythia8::Initialize(void) const
   //We can define our intial state with the proper setting (i.e. disabling decays)
   //without affecting other classes of GENIE that also use Pythia8
 
-  fPythiaP = new Pythia8::Pythia();
-  fPythiaP->readString("Print:quiet = on");
-  fPythiaP->readString("Random:setSeed = on");
-  fPythiaP->readString("WeakSingleBoson:ffbar2ffbar(s:W) = on");
-  fPythiaP->readString("PDF:lepton = off");
-  fPythiaP->readString("24:onMode = off");
-  fPythiaP->readString("24:onIfAny = 1 2 3 4 5"); //enable W->hadron only 
-  fPythiaP->readString("Beams:idA = 12");
-  fPythiaP->readString("Beams:idB = -11");
-
-  fPythiaN = new Pythia8::Pythia();
-  fPythiaN->readString("Print:quiet = on");
-  fPythiaN->readString("Random:setSeed = on");
-  fPythiaN->readString("WeakSingleBoson:ffbar2ffbar(s:W) = on");
-  fPythiaN->readString("PDF:lepton = off");
-  fPythiaN->readString("24:onMode = off");
-  fPythiaN->readString("24:onIfAny = 1 2 3 4 5"); //enable W->hadron only 
-  fPythiaN->readString("Beams:idA = -12");
-  fPythiaN->readString("Beams:idB = 11");
+  // Own setups of the Pythia8Singleton, with an instance per thread. We need
+  // two because we have to simulate anue+e->W- (N) and nue+e+>W+ (P) decays.
+  // They are named after the class, not the algorithm key: this runs in the
+  // constructor, before the configuration name is added to the key.
+  Pythia8::Pythia* gPythiaP = Pythia8Singleton::Instance()->Pythia8(this->Id().Name() + "/P");
+  gPythiaP->readString("Print:quiet = on");
+  gPythiaP->readString("Random:setSeed = on");
+  gPythiaP->readString("WeakSingleBoson:ffbar2ffbar(s:W) = on");
+  gPythiaP->readString("PDF:lepton = off");
+  gPythiaP->readString("24:onMode = off");
+  gPythiaP->readString("24:onIfAny = 1 2 3 4 5"); //enable W->hadron only 
+  gPythiaP->readString("Beams:idA = 12");
+  gPythiaP->readString("Beams:idB = -11");
+
+  Pythia8::Pythia* gPythiaN = Pythia8Singleton::Instance()->Pythia8(this->Id().Name() + "/N");
+  gPythiaN->readString("Print:quiet = on");
+  gPythiaN->readString("Random:setSeed = on");
+  gPythiaN->readString("WeakSingleBoson:ffbar2ffbar(s:W) = on");
+  gPythiaN->readString("PDF:lepton = off");
+  gPythiaN->readString("24:onMode = off");
+  gPythiaN->readString("24:onIfAny = 1 2 3 4 5"); //enable W->hadron only 
+  gPythiaN->readString("Beams:idA = -12");
+  gPythiaN->readString("Beams:idB = 11");
 #endif
 
 }
@@ -32,6 +32,7 @@
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Physics/HELepton/XSection/Born.h"
+#include "Framework/Utils/Pythia8Singleton.h"
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
 #include "Pythia8/Pythia.h"
@@ -81,12 +82,6 @@ private:
 
   Born * born;
 
-#ifdef __GENIE_PYTHIA8_ENABLED__
-  // we need to classes because we have to simulate anue+e->W- (N) and nue+e+>W+ (P) decays
-  mutable Pythia8::Pythia * fPythiaP;
-  mutable Pythia8::Pythia * fPythiaN;
-#endif
-
 };
 
 }      // genie namespace
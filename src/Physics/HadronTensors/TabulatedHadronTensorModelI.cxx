@@ -191,6 +191,26 @@ namespace {
     return std::ifstream(file_name.c_str()).good();
   }
 
+  /// Per-process registry of hadron tensor objects, shared by all tabulated
+  /// hadron tensor model instances so that each table is loaded only once.
+  /// Keys combine the name of the model class (which determines how a file
+  /// is parsed) with the full path to the tensor file.
+  class TensorRegistry {
+  public:
+    ~TensorRegistry() {
+      std::map< std::string, genie::HadronTensorI* >::iterator it;
+      for (it = fTensors.begin(); it != fTensors.end(); ++it) {
+        delete it->second;
+      }
+    }
+    std::map< std::string, genie::HadronTensorI* > fTensors;
+  };
+
+  TensorRegistry& tensor_registry() {
+    static TensorRegistry registry;
+    return registry;
+  }
+
 }
 
 //____________________________________________________________________________
@@ -254,11 +274,7 @@ void genie::TabulatedHadronTensorModelI::LoadConfig(void)
 //____________________________________________________________________________
 genie::TabulatedHadronTensorModelI::~TabulatedHadronTensorModelI()
 {
-  std::map< HadronTensorID, HadronTensorI* >::iterator it;
-  for (it = fTensors.begin(); it != fTensors.end(); ++it) {
-    HadronTensorI* t = it->second;
-    if ( t ) delete t;
-  }
+  // The hadron tensor objects are owned by the shared registry
   fTensors.clear();
 }
 //____________________________________________________________________________
@@ -290,6 +306,9 @@ std::string genie::TabulatedHadronTensorModelI::FindTensorTableFile(
   for (size_t p = 0; p < fDataPaths.size(); ++p) {
     const std::string& path = fDataPaths.at( p );
     std::string full_name = path + '/' + basename;
+    // Prefer a table converted to the binary format (see ght2bin), if any
+    std::string bin_name = full_name + ".bin";
+    if ( file_exists(bin_name) ) return bin_name;
     if ( file_exists(full_name) ) return full_name;
   }
 
@@ -315,11 +334,24 @@ const genie::HadronTensorI* genie::TabulatedHadronTensorModelI::BuildTensor(
 
   if ( tensor_ok ) {
 
-    // Create the new hadron tensor object
-    LOG("TabulatedHadronTensorModelI", pINFO) << "Loading the hadron"
-      << " tensor data file " << full_file_name;
-
-    genie::HadronTensorI* temp_ptr = this->ParseTensorFile( full_file_name );
+    // Reuse the hadron tensor object if the same file has already been
+    // loaded by another model instance. Otherwise create a new one.
+    std::string reg_key = this->Id().Name() + ':' + full_file_name;
+    std::map< std::string, HadronTensorI* >& registry
+      = tensor_registry().fTensors;
+
+    genie::HadronTensorI* temp_ptr = NULL;
+    if ( registry.count(reg_key) ) {
+      LOG("TabulatedHadronTensorModelI", pINFO) << "Reusing the already"
+        << " loaded hadron tensor data file " << full_file_name;
+      temp_ptr = registry[reg_key];
+    }
+    else {
+      LOG("TabulatedHadronTensorModelI", pINFO) << "Loading the hadron"
+        << " tensor data file " << full_file_name;
+      temp_ptr = this->ParseTensorFile( full_file_name );
+      registry[reg_key] = temp_ptr;
+    }
 
     // Place a pointer to it in the map of loaded tensor objects for easy
     // retrieval.
@@ -80,7 +80,9 @@ protected:
 
   /// Cache of hadron tensor objects that have been fully loaded into memory
   ///
-  /// Keys are tensor IDs, values are pointers to hadron tensor objects
+  /// Keys are tensor IDs, values are pointers to hadron tensor objects.
+  /// The objects themselves are owned by a per-process registry shared by
+  /// all model instances, so that each tensor file is loaded only once.
   mutable std::map< HadronTensorID, HadronTensorI* > fTensors;
 
   /// Paths to check when searching for hadron tensor data files
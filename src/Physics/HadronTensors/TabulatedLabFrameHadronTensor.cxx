@@ -1,7 +1,15 @@
 // standard library includes
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 
+// POSIX includes (memory-mapped binary tables)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 // GENIE includes
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
@@ -25,6 +33,50 @@ namespace {
     kHadronTensorGridFlag_COUNT = 2
   };
 
+  /// Binary hadron tensor table format. The header below is followed by
+  /// the q0 grid points, the |q| grid points and, for each (q0, |q|) pair
+  /// (|q| varying fastest), the values of W00, ReW0z, Wxx, ImWxy and Wzz.
+  /// All values are native-endian doubles. The header also records the
+  /// size and modification time of the text table that was converted.
+  const char kBinaryMagic[] = "GHTENSOR";
+  const size_t kBinaryMagicSize = 8;
+  const int kBinaryVersion = 2;
+  const int kBinaryByteOrder = 0x01020304;
+
+  struct BinaryTableHeader {
+    char magic[8];
+    int version;
+    int byte_order;
+    int Z;
+    int A;
+    int num_q0;
+    int num_q_mag;
+    char type_name[64];
+    int64_t source_size;
+    int64_t source_mtime;
+  };
+
+  /// Retrieves the size and modification time of a file
+  bool source_stamp(const std::string& file_name, int64_t& size,
+    int64_t& mtime)
+  {
+    struct stat info;
+    if ( stat(file_name.c_str(), &info) != 0 ) return false;
+    size  = info.st_size;
+    mtime = info.st_mtime;
+    return true;
+  }
+
+  /// Name of the text table from which a binary table was converted (the
+  /// binary table name without its ".bin" suffix), or an empty string
+  std::string source_table_name(const std::string& bin_file_name) {
+    const std::string suffix = ".bin";
+    if ( bin_file_name.size() <= suffix.size() ) return "";
+    size_t pos = bin_file_name.size() - suffix.size();
+    if ( bin_file_name.compare(pos, suffix.size(), suffix) != 0 ) return "";
+    return bin_file_name.substr( 0, pos );
+  }
+
   /// Definition of sqrt() that returns zero if the argument is negative.
   /// Used to prevent spurious NaNs due to numerical roundoff.
   double real_sqrt(double x) {
@@ -35,11 +87,54 @@ namespace {
 
 genie::TabulatedLabFrameHadronTensor::TabulatedLabFrameHadronTensor(
   const std::string& table_file_name)
-  : fGrid(&fq0Points, &fqmagPoints, &fEntries)
+  : fSourceSize(0), fSourceMTime(0),
+  fGrid(&fq0Points, &fqmagPoints, &fEntries)
+{
+  // Read in the table. If a binary table can't be used (corrupt, or out of
+  // date with respect to its text table), fall back to the text table.
+  if ( IsBinaryTable(table_file_name) ) {
+    if ( !ReadBinaryTable(table_file_name) ) {
+      std::string source = source_table_name( table_file_name );
+      int64_t size, mtime;
+      if ( !source.empty() && source_stamp(source, size, mtime) ) {
+        LOG("TabulatedLabFrameHadronTensor", pWARN)
+          << "Can't use the binary hadron tensor table " << table_file_name
+          << ". Reading the text table " << source << " instead";
+        ReadTextTable(source);
+      }
+    }
+  }
+  else {
+    ReadTextTable(table_file_name);
+  }
+
+  if ( fq0Points.empty() || fqmagPoints.empty()
+    || fEntries.size() != fq0Points.size() * fqmagPoints.size() )
+  {
+    LOG("TabulatedLabFrameHadronTensor", pFATAL)
+      << "Failed to read the hadron tensor table " << table_file_name;
+    std::exit(1);
+  }
+
+  // Enable the fast grid point look-up for evenly-spaced q0 and |q| grids
+  fGrid.update_spacing();
+
+  LOG("TabulatedLabFrameHadronTensor", pINFO)
+    << "q0 grid is " << (fGrid.uniform_x() ? "" : "not ")
+    << "evenly spaced, |q| grid is " << (fGrid.uniform_y() ? "" : "not ")
+    << "evenly spaced";
+}
+
+void genie::TabulatedLabFrameHadronTensor::ReadTextTable(
+  const std::string& table_file_name)
 {
-  // Read in the table
   std::ifstream in_file( table_file_name.c_str() );
 
+  // Remember which version of the text table was read, so that a binary
+  // table converted from it can be checked against it later
+  if ( !source_stamp(table_file_name, fSourceSize, fSourceMTime) ) {
+    fSourceSize = fSourceMTime = 0;
+  }
 
   // Skip the initial comment line
   std::string dummy;
@@ -51,6 +146,7 @@ genie::TabulatedLabFrameHadronTensor::TabulatedLabFrameHadronTensor(
 
   /// \todo Use type name
   in_file >> Z >> A >> type_name >> num_q0 >> num_q_mag;
+  fTypeName = type_name;
 
   int q0_flag;
   in_file >> q0_flag;
@@ -70,7 +166,8 @@ genie::TabulatedLabFrameHadronTensor::TabulatedLabFrameHadronTensor(
   std::cout<< "num_q_mag:        " << num_q_mag << std::endl;
 
   double W00, ReW0z, Wxx, ImWxy, Wzz;
-  int lineCount=1;
+
+  fEntries.reserve( num_q0 * num_q_mag );
 
   for (long j = 0; j < num_q0; ++j) {
     for (long k = 0; k < num_q_mag; ++k) {
@@ -78,9 +175,6 @@ genie::TabulatedLabFrameHadronTensor::TabulatedLabFrameHadronTensor(
       fEntries.push_back( TableEntry() );
       TableEntry& entry = fEntries.back();
 
-      // in_file >> entry.W00 >> entry.ReW0z >> entry.Wxx
-      //   >> entry.ImWxy >> entry.Wzz;
-
       in_file >> W00 >> ReW0z >> Wxx >> ImWxy >> Wzz;
 
       entry.W00  = W00;
@@ -88,15 +182,138 @@ genie::TabulatedLabFrameHadronTensor::TabulatedLabFrameHadronTensor(
       entry.Wxx  = Wxx;
       entry.ImWxy= ImWxy;
       entry.Wzz  = Wzz;
+    }
+  }
+}
+
+bool genie::TabulatedLabFrameHadronTensor::IsBinaryTable(
+  const std::string& file_name)
+{
+  std::ifstream in_file( file_name.c_str(), std::ios::binary );
+  char magic[kBinaryMagicSize];
+  if ( !in_file.read(magic, kBinaryMagicSize) ) return false;
+  return std::memcmp(magic, kBinaryMagic, kBinaryMagicSize) == 0;
+}
+
+bool genie::TabulatedLabFrameHadronTensor::ReadBinaryTable(
+  const std::string& table_file_name)
+{
+  int fd = open( table_file_name.c_str(), O_RDONLY );
+  if ( fd < 0 ) return false;
+
+  struct stat st;
+  if ( fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(BinaryTableHeader) ) {
+    close( fd );
+    return false;
+  }
+
+  size_t size = st.st_size;
+  void* addr = mmap( NULL, size, PROT_READ, MAP_SHARED, fd, 0 );
+  close( fd );
+  if ( addr == MAP_FAILED ) return false;
+
+  const char* data = static_cast<const char*>( addr );
+  BinaryTableHeader header;
+  std::memcpy( &header, data, sizeof(header) );
+
+  size_t num_q0    = header.num_q0;
+  size_t num_q_mag = header.num_q_mag;
+  size_t expected_size = sizeof(header)
+    + sizeof(double) * ( num_q0 + num_q_mag + 5*num_q0*num_q_mag );
+
+  bool ok = ( header.version == kBinaryVersion
+    && header.byte_order == kBinaryByteOrder && size == expected_size );
 
-      //if(W00 > 0.0) {
-      //  std::cout<< "line count is" << lineCount << std::endl;
-      //  std::cout<< "Entry: " << entry.W00 << " " << entry.ReW0z << " " << entry.Wxx << " " << entry.ImWxy << " " << entry.Wzz << std::endl;
-      //  std::cout<< "File:  " << W00 << " " << ReW0z << " " << Wxx << " " << ImWxy << " " << Wzz << std::endl;
-      //}
-      lineCount++;
+  if ( !ok ) {
+    LOG("TabulatedLabFrameHadronTensor", pWARN)
+      << "Invalid binary hadron tensor table " << table_file_name;
+  }
+
+  // Reject a binary table whose text table has been edited since the
+  // conversion
+  std::string source = source_table_name( table_file_name );
+  int64_t source_size, source_mtime;
+  if ( ok && !source.empty()
+    && source_stamp(source, source_size, source_mtime)
+    && ( source_size != header.source_size
+      || source_mtime != header.source_mtime ) )
+  {
+    LOG("TabulatedLabFrameHadronTensor", pWARN)
+      << "The binary hadron tensor table " << table_file_name
+      << " is out of date with respect to " << source;
+    ok = false;
+  }
+
+  if ( ok ) {
+    fSourceSize  = header.source_size;
+    fSourceMTime = header.source_mtime;
+    fTypeName = std::string( header.type_name,
+      strnlen(header.type_name, sizeof(header.type_name)) );
+    set_pdg( genie::pdg::IonPdgCode(header.A, header.Z) );
+
+    const double* values = reinterpret_cast<const double*>(
+      data + sizeof(header) );
+
+    fq0Points.assign( values, values + num_q0 );
+    values += num_q0;
+    fqmagPoints.assign( values, values + num_q_mag );
+    values += num_q_mag;
+
+    fEntries.resize( num_q0 * num_q_mag );
+    for (size_t i = 0; i < fEntries.size(); ++i, values += 5) {
+      TableEntry& entry = fEntries[i];
+      entry.W00   = values[0];
+      entry.ReW0z = values[1];
+      entry.Wxx   = values[2];
+      entry.ImWxy = values[3];
+      entry.Wzz   = values[4];
     }
+
+    LOG("TabulatedLabFrameHadronTensor", pNOTICE)
+      << "Loaded binary hadron tensor table " << table_file_name
+      << " (Z = " << header.Z << ", A = " << header.A
+      << ", type = " << fTypeName << ", num_q0 = " << num_q0
+      << ", num_q_mag = " << num_q_mag << ")";
   }
+
+  munmap( addr, size );
+  return ok;
+}
+
+bool genie::TabulatedLabFrameHadronTensor::WriteBinaryTable(
+  const std::string& file_name) const
+{
+  BinaryTableHeader header;
+  std::memset( &header, 0, sizeof(header) );
+  std::memcpy( header.magic, kBinaryMagic, kBinaryMagicSize );
+  header.version    = kBinaryVersion;
+  header.byte_order = kBinaryByteOrder;
+  header.Z          = this->Z();
+  header.A          = this->A();
+  header.num_q0     = fq0Points.size();
+  header.num_q_mag  = fqmagPoints.size();
+  std::strncpy( header.type_name, fTypeName.c_str(),
+    sizeof(header.type_name) - 1 );
+  header.source_size  = fSourceSize;
+  header.source_mtime = fSourceMTime;
+
+  std::ofstream out_file( file_name.c_str(), std::ios::binary );
+  if ( !out_file ) return false;
+
+  out_file.write( reinterpret_cast<const char*>(&header), sizeof(header) );
+  out_file.write( reinterpret_cast<const char*>(&fq0Points.front()),
+    sizeof(double) * fq0Points.size() );
+  out_file.write( reinterpret_cast<const char*>(&fqmagPoints.front()),
+    sizeof(double) * fqmagPoints.size() );
+
+  for (size_t i = 0; i < fEntries.size(); ++i) {
+    const TableEntry& entry = fEntries[i];
+    double values[5] = { entry.W00, entry.ReW0z, entry.Wxx,
+      entry.ImWxy, entry.Wzz };
+    out_file.write( reinterpret_cast<const char*>(values), sizeof(values) );
+  }
+
+  return out_file.good();
 }
 
 genie::TabulatedLabFrameHadronTensor::~TabulatedLabFrameHadronTensor()
@@ -8,6 +8,14 @@
           using precomputed tables.
           Is a concrete implementation of the HadronTensorI interface.
 
+          Tables can be read either from the original text format or from a
+          binary format (see WriteBinaryTable), which is memory-mapped and
+          copied in bulk instead of being parsed line by line. The format of
+          an input file is detected from its first bytes. A binary table
+          records the size and modification time of the text table it was
+          converted from and is not used if that text table (same name
+          without the ".bin" suffix) has changed since.
+
 \author   Steven Gardiner <gardiner \at fnal.gov>
           Fermi National Accelerator Laboratory
 
@@ -23,6 +31,7 @@
 #define TABULATED_VALENCIA_HADRON_TENSOR_H
 
 // standard library includes
+#include <cstdint>
 #include <vector>
 
 // GENIE includes
@@ -78,6 +87,14 @@ class TabulatedLabFrameHadronTensor : public LabFrameHadronTensorI {
   inline virtual double qMagMin() const /*override*/ { return fGrid.y_min(); }
   inline virtual double qMagMax() const /*override*/ { return fGrid.y_max(); }
 
+  /// Writes the table in the binary format understood by the constructor
+  /// \param[in] file_name Name of the output file
+  /// \return true if the file was written successfully
+  bool WriteBinaryTable(const std::string& file_name) const;
+
+  /// Checks whether a file is a binary hadron tensor table
+  static bool IsBinaryTable(const std::string& file_name);
+
   protected:
 
   /// Helper function that allows this class to handle variations in the
@@ -90,6 +107,12 @@ class TabulatedLabFrameHadronTensor : public LabFrameHadronTensorI {
   void read1DGridValues(int num_points, int flag, std::ifstream& in_file,
     std::vector<double>& vec_to_fill);
 
+  /// Read the table from a text file
+  void ReadTextTable(const std::string& table_file_name);
+
+  /// Read the table from a memory-mapped binary file
+  bool ReadBinaryTable(const std::string& table_file_name);
+
   class TableEntry {
 
     public:
@@ -200,6 +223,10 @@ class TabulatedLabFrameHadronTensor : public LabFrameHadronTensorI {
   virtual double W6(double q0, double q_mag, const TableEntry& entry) const;
   ///@}
 
+  std::string fTypeName; ///< Tensor type name read from the table file
+  int64_t fSourceSize;   ///< Size of the text table the tensor was read from
+  int64_t fSourceMTime;  ///< Modification time of that text table
+
   std::vector<double> fq0Points;
   std::vector<double> fqmagPoints;
   std::vector<TableEntry> fEntries;
@@ -36,9 +36,19 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <string>
+#include <fstream>
+#include <mutex>
+
+#include <sys/stat.h>
 
 #include <TSystem.h>
+#include <TROOT.h>
+#include <TH1.h>
+#include <TMD5.h>
 #include <TNtupleD.h>
 #include <TGraph2D.h>
 #include <TTree.h>
@@ -53,13 +63,117 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/StringUtils.h"
 
 using std::ostringstream;
 using std::ios;
+using std::vector;
 
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // Kinetic energies (in MeV) of the hN angular distribution files
+  const double khNEnergiesNN[] = {
+     50,  100,  150,  200,  250,  300,  350,  400,  450,  500,
+    550,  600,  650,  700,  750,  800,  850,  900,  950, 1000
+  };
+  const double khNEnergiesPiN[] = {
+     10,   20,   30,   40,   50,   60,   70,   80,   90,  100,
+    110,  120,  130,  140,  150,  160,  170,  180,  190,  200,
+    210,  220,  230,  240,  250,  260,  270,  280,  290,  300,
+    340,  380,  420,  460,  500,  540,  580,  620,  660,  700,
+    740,  780,  820,  860,  900,  940,  980, 1020, 1060, 1100,
+   1140, 1180, 1220, 1260, 1300, 1340, 1380, 1420, 1460, 1500
+  };
+  const double khNEnergiesPiNAbs[] = {
+     50,   75,  100,  125,  150,  175,  200,  225,  250,  275,
+    300,  325,  350,  375,  400,  425,  450,  475,  500
+  };
+  const double khNEnergiesKN[] = {
+    100,  200,  300,  400,  500,  600,  700,  800,  900, 1000,
+   1100, 1200, 1300, 1400, 1500, 1600, 1700, 1800
+  };
+  const double khNEnergiesGamN[] = {
+    160,  180,  200,  220,  240,  260,  280,  300,  320,  340,
+    360,  380,  400,  450,  500,  550,  600,  650,  700,  750,
+    800,  850,  900,  950, 1000, 1050, 1100, 1150, 1200
+  };
+  const int kNhNEnergiesNN     = sizeof(khNEnergiesNN)    /sizeof(double);
+  const int kNhNEnergiesPiN    = sizeof(khNEnergiesPiN)   /sizeof(double);
+  const int kNhNEnergiesPiNAbs = sizeof(khNEnergiesPiNAbs)/sizeof(double);
+  const int kNhNEnergiesKN     = sizeof(khNEnergiesKN)    /sizeof(double);
+  const int kNhNEnergiesGamN   = sizeof(khNEnergiesGamN)  /sizeof(double);
+
+  // Nuclei of the pi+A x-section fraction files
+  const int kPipANuclei[] = {
+    1, 2, 3, 4, 7, 9, 12, 16, 27, 48, 56, 58, 63, 93, 120, 165, 181, 209
+  };
+  const int kPipAInelasNuclei[] = {
+    1, 2, 3, 4, 7, 9, 12, 16, 27, 40, 48, 56, 58, 63, 93, 120, 165, 181, 208, 209
+  };
+  const int kPipAPiProNuclei[] = {
+    1, 2, 3, 4, 7, 9, 12, 16, 48, 56, 58, 63, 93, 120, 165, 181, 209
+  };
+  const int kNPipANuclei       = sizeof(kPipANuclei)      /sizeof(int);
+  const int kNPipAInelasNuclei = sizeof(kPipAInelasNuclei)/sizeof(int);
+  const int kNPipAPiProNuclei  = sizeof(kPipAPiProNuclei) /sizeof(int);
+
+  // Channel names, as stored in the binary dataset (in INukeHDChannel_t order)
+  const char * kChannelName[] = {
+    "NN", "PipN", "Pi0N", "NA", "KA", "GamN", "KN",
+    "hN_PP_Elas", "hN_NP_Elas", "hN_PipN_Elas", "hN_Pi0N_Elas", "hN_PimN_Elas",
+    "hN_KpN_Elas", "hN_KpN_CEx", "hN_KpP_Elas", "hN_PiN_CEx", "hN_PiN_Abs",
+    "hN_GamPi0P_Inelas", "hN_GamPi0N_Inelas", "hN_GamPipN_Inelas", "hN_GamPimP_Inelas",
+    "PipA_Abs", "PipA_CEx", "PipA_Inelas", "PipA_PiPro"
+  };
+
+  // Binary dataset layout: header, table of contents (one entry per
+  // channel) and channel records. Each record holds the number of source
+  // files followed by their entries, then the number of columns followed,
+  // for each column, by its header and its values.
+  const char kBinaryMagic[]    = "GINUKEHD";
+  const int  kBinaryMagicSize  = 8;
+  const int  kBinaryVersion    = 2;
+  const int  kBinaryByteOrder  = 0x01020304;
+
+  struct BinaryDatasetHeader {
+    char magic[kBinaryMagicSize];
+    int  version;
+    int  byte_order;
+    int  nchannels;
+    int  padding;
+  };
+  struct BinaryChannelEntry {
+    char      name[32];
+    long long offset;
+    long long size;
+    char      md5[32];   // hex digest of the record
+  };
+  struct BinarySourceEntry {
+    char      name[128];   // path relative to the data directory
+    long long size;
+    long long mtime;
+  };
+  struct BinaryColumnHeader {
+    char      name[32];
+    long long n;
+  };
+
+  // ROOT text / ntuple reading is not thread-safe: channels are loaded
+  // one at a time
+  std::mutex gLoadMutex;
+
+  bool source_stamp(const string & filename, long long & size, long long & mtime)
+  {
+    struct stat info;
+    if(stat(filename.c_str(), &info) != 0) return false;
+    size  = info.st_size;
+    mtime = info.st_mtime;
+    return true;
+  }
+}
+
 //____________________________________________________________________________
 INukeHadroData2018 * INukeHadroData2018::fInstance = 0;
 //____________________________________________________________________________
@@ -69,7 +183,68 @@ double INukeHadroData2018::fMaxKinEnergyHN = 1799.0; // MeV
 //____________________________________________________________________________
 INukeHadroData2018::INukeHadroData2018()
 {
-  this->LoadCrossSections();
+  fXSecPipn_Tot = 0;  fXSecPipn_CEx = 0;  fXSecPipn_Elas = 0; fXSecPipn_Reac = 0;
+  fXSecPipp_Tot = 0;  fXSecPipp_CEx = 0;  fXSecPipp_Elas = 0; fXSecPipp_Reac = 0;
+  fXSecPipd_Abs = 0;
+  fXSecPi0n_Tot = 0;  fXSecPi0n_CEx = 0;  fXSecPi0n_Elas = 0; fXSecPi0n_Reac = 0;
+  fXSecPi0p_Tot = 0;  fXSecPi0p_CEx = 0;  fXSecPi0p_Elas = 0; fXSecPi0p_Reac = 0;
+  fXSecPi0d_Abs = 0;
+  fXSecPp_Tot   = 0;  fXSecPp_Elas  = 0;  fXSecPp_Reac   = 0;
+  fXSecPn_Tot   = 0;  fXSecPn_Elas  = 0;  fXSecPn_Reac   = 0;
+  fXSecNn_Tot   = 0;  fXSecNn_Elas  = 0;  fXSecNn_Reac   = 0;
+  fXSecPp_Cmp   = 0;  fXSecPn_Cmp   = 0;  fXSecNn_Cmp    = 0;
+  fXSecKpn_Elas = 0;  fXSecKpp_Elas = 0;  fXSecKpn_CEx    = 0;
+  fXSecKpN_Abs  = 0;  fXSecKpN_Tot  = 0;
+  fXSecGamp_fs  = 0;  fXSecGamn_fs  = 0;  fXSecGamN_Tot   = 0;
+  fFracPA_Tot   = 0;  fFracPA_Elas  = 0;  fFracPA_Inel = 0;  fFracPA_CEx = 0;
+  fFracPA_Abs   = 0;  fFracPA_PiPro = 0;  fFracPA_Cmp  = 0;
+  fFracNA_Tot   = 0;  fFracNA_Elas  = 0;  fFracNA_Inel = 0;  fFracNA_CEx = 0;
+  fFracNA_Abs   = 0;  fFracNA_PiPro = 0;  fFracNA_Cmp  = 0;
+  fFracKA_Tot   = 0;  fFracKA_Elas  = 0;  fFracKA_CEx  = 0;  fFracKA_Inel = 0;
+  fFracKA_Abs   = 0;
+
+  TfracPipA_CEx    = 0;
+  TfracPipA_Inelas = 0;
+  TfracPipA_Abs    = 0;
+  TfracPipA_PiPro  = 0;
+
+  fhN2dXSecPP_Elas        = 0;
+  fhN2dXSecNP_Elas        = 0;
+  fhN2dXSecPipN_Elas      = 0;
+  fhN2dXSecPi0N_Elas      = 0;
+  fhN2dXSecPimN_Elas      = 0;
+  fhN2dXSecKpN_Elas       = 0;
+  fhN2dXSecKpP_Elas       = 0;
+  fhN2dXSecKpN_CEx        = 0;
+  fhN2dXSecKpN_Abs        = 0;
+  fhN2dXSecPiN_CEx        = 0;
+  fhN2dXSecPiN_Abs        = 0;
+  fhN2dXSecGamPi0P_Inelas = 0;
+  fhN2dXSecGamPi0N_Inelas = 0;
+  fhN2dXSecGamPipN_Inelas = 0;
+  fhN2dXSecGamPimP_Inelas = 0;
+
+  //-- Get the top-level directory with input hadron cross-section data
+  //   (search for $GINUKEHADRONDATA or use default location)
+  fDataDir = (gSystem->Getenv("GINUKEHADRONDATA")) ?
+             string(gSystem->Getenv("GINUKEHADRONDATA")) :
+             string(gSystem->Getenv("GENIE")) + string("/data/evgen/intranuke");
+
+  //-- Use the binary dataset, if one was made in the data directory
+  string binary_dataset = fDataDir + "/" + BinaryDatasetName();
+  if( ! gSystem->AccessPathName(binary_dataset.c_str()) ) {
+    if( this->OpenBinaryDataset(binary_dataset) ) {
+      LOG("INukeData", pINFO)
+        << "Using the binary INTRANUKE hadron dataset: " << binary_dataset;
+    } else {
+      LOG("INukeData", pWARN)
+        << "Ignoring invalid binary INTRANUKE hadron dataset: " << binary_dataset;
+    }
+  }
+
+  LOG("INukeData", pINFO)
+      << "INTRANUKE hadron data will be loaded on demand from: " << fDataDir;
+
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -183,155 +358,85 @@ INukeHadroData2018 * INukeHadroData2018::Instance()
   return fInstance;
 }
 //____________________________________________________________________________
-void INukeHadroData2018::LoadCrossSections(void)
+void INukeHadroData2018::LoadChannel(INukeHDChannel_t ch)
 {
-// Loads hadronic x-section data
-
-  //-- Get the top-level directory with input hadron cross-section data
-  //   (search for $GINUKEHADRONDATA or use default location)
-  string data_dir = (gSystem->Getenv("GINUKEHADRONDATA")) ?
-             string(gSystem->Getenv("GINUKEHADRONDATA")) :
-             string(gSystem->Getenv("GENIE")) + string("/data/evgen/intranuke");
+// Materialises the splines / grids of the input channel, reading its data
+// from the binary dataset (if one is used) or from the text / ntuple files.
+// Called once per channel, through Load().
 
-  LOG("INukeData", pINFO)
-      << "Loading INTRANUKE hadron data from: " << data_dir;
-
-  //-- Build filenames
-
-  string datafile_NN   = data_dir + "/tot_xsec/intranuke-xsections-NN2014.dat";
-  string datafile_pipN = data_dir + "/tot_xsec/intranuke-xsections-pi+N.dat";
-  string datafile_pi0N = data_dir + "/tot_xsec/intranuke-xsections-pi0N.dat";
-  string datafile_NA   = data_dir + "/tot_xsec/intranuke-fractions-NA2016.dat";
-  string datafile_KA   = data_dir + "/tot_xsec/intranuke-fractions-KA.dat";
-  string datafile_gamN = data_dir + "/tot_xsec/intranuke-xsections-gamN.dat";
-  string datafile_kN   = data_dir + "/tot_xsec/intranuke-xsections-kaonN2018.dat";
-
-  //-- Make sure that all data files are available
-
-  assert( ! gSystem->AccessPathName(datafile_NN.  c_str()) );
-  assert( ! gSystem->AccessPathName(datafile_pipN.c_str()) );
-  assert( ! gSystem->AccessPathName(datafile_pi0N.c_str()) );
-  assert( ! gSystem->AccessPathName(datafile_NA.  c_str()) );
-  assert( ! gSystem->AccessPathName(datafile_KA. c_str())  );
-  assert( ! gSystem->AccessPathName(datafile_gamN.c_str())  );
-  assert( ! gSystem->AccessPathName(datafile_kN.  c_str())  );
-
-  LOG("INukeData", pINFO)  << "Found all necessary data files...";
-
-  //-- Load data files
-
-  TTree data_NN;
-  TTree data_pipN;
-  TTree data_pi0N;
-  TTree data_NA;
-  TTree data_KA;
-  TTree data_gamN;
-  TTree data_kN;
-
-  data_NN.ReadFile(datafile_NN.c_str(),"ke/D:pp_tot/D:pp_elas/D:pp_reac/D:pn_tot/D:pn_elas/D:pn_reac/D:nn_tot/D:nn_elas/D:nn_reac/D:pp_cmp/D:pn_cmp/D:nn_cmp/D");
-  data_pipN.ReadFile(datafile_pipN.c_str(),
-     "ke/D:pipn_tot/D:pipn_cex/D:pipn_elas/D:pipn_reac/D:pipp_tot/D:pipp_cex/D:pipp_elas/D:pipp_reac/D:pipd_abs");
-  data_pi0N.ReadFile(datafile_pi0N.c_str(),
-     "ke/D:pi0n_tot/D:pi0n_cex/D:pi0n_elas/D:pi0n_reac/D:pi0p_tot/D:pi0p_cex/D:pi0p_elas/D:pi0p_reac/D:pi0d_abs");
-  //data_NA.ReadFile(datafile_NA.c_str(),
-  //"ke/D:pA_tot/D:pA_elas/D:pA_inel/D:pA_cex/D:pA_abs/D:pA_pipro/D");  // add support for cmp here (?)
-  data_NA.ReadFile(datafile_NA.c_str(),
-		   "ke/D:pA_tot/D:pA_inel/D:pA_cex/D:pA_abs/D:pA_pipro/D:pA_cmp/D");  // add support for cmp here (?)
-  data_gamN.ReadFile(datafile_gamN.c_str(),
-    "ke/D:pi0p_tot/D:pipn_tot/D:pimp_tot/D:pi0n_tot/D:gamp_fs/D:gamn_fs/D:gamN_tot/D");
-  data_kN.ReadFile(datafile_kN.c_str(),
-		   "ke/D:kpp_elas/D:kpn_elas/D:kpn_cex/D:kp_abs/D:kpN_tot/D");
-  data_KA.ReadFile(datafile_KA.c_str(),
-     "ke/D:KA_tot/D:KA_elas/D:KA_inel/D:KA_abs/D");
-
-  LOG("INukeData", pDEBUG)  << "Number of data rows in NN : "   << data_NN.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in pipN : " << data_pipN.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in pi0N : " << data_pi0N.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in NA  : "  << data_NA.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in KA : "   << data_KA.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in gamN : " << data_gamN.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in kN  : "  << data_kN.GetEntries();
-
-  LOG("INukeData", pINFO)  << "Done loading all x-section files...";
-
-  //-- Build x-section splines
-
-  // p/n+p/n hA x-section splines
-  fXSecPp_Tot      = new Spline(&data_NN, "ke:pp_tot");
-  fXSecPp_Elas     = new Spline(&data_NN, "ke:pp_elas");
-  fXSecPp_Reac     = new Spline(&data_NN, "ke:pp_reac");
-  fXSecPn_Tot      = new Spline(&data_NN, "ke:pn_tot");
-  fXSecPn_Elas     = new Spline(&data_NN, "ke:pn_elas");
-  fXSecPn_Reac     = new Spline(&data_NN, "ke:pn_reac");
-  fXSecNn_Tot      = new Spline(&data_NN, "ke:nn_tot");
-  fXSecNn_Elas     = new Spline(&data_NN, "ke:nn_elas");
-  fXSecNn_Reac     = new Spline(&data_NN, "ke:nn_reac");
-  fXSecPp_Cmp      = new Spline(&data_NN, "ke:pp_cmp"); //for compound nucleus fate
-  fXSecPn_Cmp      = new Spline(&data_NN, "ke:pn_cmp");
-  fXSecNn_Cmp      = new Spline(&data_NN, "ke:nn_cmp");
+  std::lock_guard<std::mutex> lock(gLoadMutex);
 
-  // pi+n/p hA x-section splines
-  fXSecPipn_Tot     = new Spline(&data_pipN, "ke:pipn_tot");
-  fXSecPipn_CEx     = new Spline(&data_pipN, "ke:pipn_cex");
-  fXSecPipn_Elas    = new Spline(&data_pipN, "ke:pipn_elas");
-  fXSecPipn_Reac    = new Spline(&data_pipN, "ke:pipn_reac");
-  fXSecPipp_Tot     = new Spline(&data_pipN, "ke:pipp_tot");
-  fXSecPipp_CEx     = new Spline(&data_pipN, "ke:pipp_cex");
-  fXSecPipp_Elas    = new Spline(&data_pipN, "ke:pipp_elas");
-  fXSecPipp_Reac    = new Spline(&data_pipN, "ke:pipp_reac");
-  fXSecPipd_Abs     = new Spline(&data_pipN, "ke:pipd_abs");
-
-  // pi0n/p hA x-section splines
-  fXSecPi0n_Tot     = new Spline(&data_pi0N, "ke:pi0n_tot");
-  fXSecPi0n_CEx     = new Spline(&data_pi0N, "ke:pi0n_cex");
-  fXSecPi0n_Elas    = new Spline(&data_pi0N, "ke:pi0n_elas");
-  fXSecPi0n_Reac    = new Spline(&data_pi0N, "ke:pi0n_reac");
-  fXSecPi0p_Tot     = new Spline(&data_pi0N, "ke:pi0p_tot");
-  fXSecPi0p_CEx     = new Spline(&data_pi0N, "ke:pi0p_cex");
-  fXSecPi0p_Elas    = new Spline(&data_pi0N, "ke:pi0p_elas");
-  fXSecPi0p_Reac    = new Spline(&data_pi0N, "ke:pi0p_reac");
-  fXSecPi0d_Abs     = new Spline(&data_pi0N, "ke:pi0d_abs");
-
-   // K+N x-section splines
-  fXSecKpn_Elas   = new Spline(&data_kN,  "ke:kpn_elas");
-  fXSecKpp_Elas   = new Spline(&data_kN,  "ke:kpp_elas");
-  fXSecKpn_CEx    = new Spline(&data_kN,  "ke:kpn_cex");
-  fXSecKpN_Abs    = 0; // new Spline(&data_kN,  "ke:kp_abs");  why not used?
-  fXSecKpN_Tot    = new Spline(&data_kN,  "ke:kpN_tot");
+  ChannelTable table;
 
-  // gamma x-section splines
-  fXSecGamp_fs     = new Spline(&data_gamN, "ke:gamp_fs");
-  fXSecGamn_fs     = new Spline(&data_gamN, "ke:gamn_fs");
-  fXSecGamN_Tot    = new Spline(&data_gamN, "ke:gamN_tot");
+  bool from_binary = false;
+  if(fBinaryDataset.size() > 0) {
+    from_binary = this->ReadBinaryChannel(ch, table);
+    if(!from_binary) {
+      LOG("INukeData", pERROR)
+        << "Failed to read channel " << kChannelName[ch] << " from "
+        << fBinaryDataset << ". Reading it from the text files.";
+      table = ChannelTable();
+    }
+  }
+  if(!from_binary) {
+    this->ReadTextChannel(ch, table);
+  }
 
-  // N+A x-section fraction splines
-  fFracPA_Tot      = new Spline(&data_NA, "ke:pA_tot");
-  //  fFracPA_Elas     = new Spline(&data_NA, "ke:pA_elas");
-  fFracPA_Inel     = new Spline(&data_NA, "ke:pA_inel");
-  fFracPA_CEx      = new Spline(&data_NA, "ke:pA_cex");
-  fFracPA_Abs      = new Spline(&data_NA, "ke:pA_abs");
-  fFracPA_PiPro    = new Spline(&data_NA, "ke:pA_pipro");
-  fFracNA_Tot      = new Spline(&data_NA, "ke:pA_tot");  // assuming nA same as pA
-  //  fFracNA_Elas     = new Spline(&data_NA, "ke:pA_elas");
-  fFracNA_Inel     = new Spline(&data_NA, "ke:pA_inel");
-  fFracNA_CEx      = new Spline(&data_NA, "ke:pA_cex");
-  fFracNA_Abs      = new Spline(&data_NA, "ke:pA_abs");
-  fFracNA_PiPro    = new Spline(&data_NA, "ke:pA_pipro");
-
-  fFracPA_Cmp      = new Spline(&data_NA, "ke:pA_cmp");  //cmp - add support later
-  fFracNA_Cmp      = new Spline(&data_NA, "ke:pA_cmp");
+  this->BuildChannel(ch, table);
 
-  // K+A x-section fraction splines
-  fFracKA_Tot      = new Spline(&data_KA, "ke:KA_tot");
-  fFracKA_Elas     = new Spline(&data_KA, "ke:KA_elas");
-  fFracKA_CEx      = 0; // new Spline(&data_KA, "ke:KA_cex"); //Added, but needs to be computed
-  fFracKA_Inel     = new Spline(&data_KA, "ke:KA_inel");
-  fFracKA_Abs      = new Spline(&data_KA, "ke:KA_abs");
-  //
-  // hN stuff
+  LOG("INukeData", pINFO)
+     << "Loaded INTRANUKE hadron data channel: " << kChannelName[ch]
+     << (from_binary ? " (binary dataset)" : "");
+}
+//____________________________________________________________________________
+void INukeHadroData2018::ReadTextChannel(
+  INukeHDChannel_t ch, ChannelTable & table) const
+{
+  string tot_xsec = fDataDir + "/tot_xsec/";
+  string diff_ang = fDataDir + "/diff_ang/";
+
+  switch(ch) {
+
+  //-- h+N and h+A x-section tables
+
+  case (kIHDNN):
+    this->ReadTextTable(tot_xsec + "intranuke-xsections-NN2014.dat",
+       "ke/D:pp_tot/D:pp_elas/D:pp_reac/D:pn_tot/D:pn_elas/D:pn_reac/D:nn_tot/D:nn_elas/D:nn_reac/D:pp_cmp/D:pn_cmp/D:nn_cmp/D",
+       table);
+    break;
+  case (kIHDPipN):
+    this->ReadTextTable(tot_xsec + "intranuke-xsections-pi+N.dat",
+       "ke/D:pipn_tot/D:pipn_cex/D:pipn_elas/D:pipn_reac/D:pipp_tot/D:pipp_cex/D:pipp_elas/D:pipp_reac/D:pipd_abs",
+       table);
+    break;
+  case (kIHDPi0N):
+    this->ReadTextTable(tot_xsec + "intranuke-xsections-pi0N.dat",
+       "ke/D:pi0n_tot/D:pi0n_cex/D:pi0n_elas/D:pi0n_reac/D:pi0p_tot/D:pi0p_cex/D:pi0p_elas/D:pi0p_reac/D:pi0d_abs",
+       table);
+    break;
+  case (kIHDNA):
+    this->ReadTextTable(tot_xsec + "intranuke-fractions-NA2016.dat",
+       "ke/D:pA_tot/D:pA_inel/D:pA_cex/D:pA_abs/D:pA_pipro/D:pA_cmp/D",  // add support for cmp here (?)
+       table);
+    break;
+  case (kIHDKA):
+    this->ReadTextTable(tot_xsec + "intranuke-fractions-KA.dat",
+       "ke/D:KA_tot/D:KA_elas/D:KA_inel/D:KA_abs/D",
+       table);
+    break;
+  case (kIHDGamN):
+    this->ReadTextTable(tot_xsec + "intranuke-xsections-gamN.dat",
+       "ke/D:pi0p_tot/D:pipn_tot/D:pimp_tot/D:pi0n_tot/D:gamp_fs/D:gamn_fs/D:gamN_tot/D",
+       table);
+    break;
+  case (kIHDKN):
+    this->ReadTextTable(tot_xsec + "intranuke-xsections-kaonN2018.dat",
+       "ke/D:kpp_elas/D:kpn_elas/D:kpn_cex/D:kp_abs/D:kpN_tot/D",
+       table);
+    break;
+
+  //-- hN angular distributions
   //
-
-
   // 	kIHNFtElas
   //	  pp, nn --> read from pp/pp%.txt
   //	  pn, np --> read from pp/pn%.txt
@@ -342,6 +447,7 @@ void INukeHadroData2018::LoadCrossSections(void)
   //      K+  P  --> read from kpp/kpp%.txt
   //    kIHNFtCEx
   //	  pi+, pi0, pi- --> read from pie/pie%.txt (using pip+n->pi0+p data)
+  //      K+  N  --> read from kpncex/kpcex%.txt
   //    kIHNFtAbs
   //      pi+, pi0, pi- --> read from pid2p/pid2p%.txt (using pip+D->2p data)
   //    kIHNFtInelas
@@ -350,836 +456,559 @@ void INukeHadroData2018::LoadCrossSections(void)
   //      gamma n -> n pi0 --> read from gampi0n/%-pi0n.txt
   //      gamma n -> p pi- --> read from gampi-p/%-pi-p.txt
 
-
-  // kIHNFtElas, pp&nn :
-  {
-    const int hN_ppelas_nfiles = 20;
-    const int hN_ppelas_points_per_file = 21;
-    const int hN_ppelas_npoints = hN_ppelas_points_per_file * hN_ppelas_nfiles;
-
-    double hN_ppelas_energies[hN_ppelas_nfiles] = {
-        50, 100, 150, 200, 250, 300, 350, 400, 450, 500,
-       550, 600, 650, 700, 750, 800, 850, 900, 950, 1000
-    };
-
-    double hN_ppelas_costh [hN_ppelas_points_per_file];
-    double hN_ppelas_xsec  [hN_ppelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_ppelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_ppelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/pp/pp" << ke << ".txt";
-     // read data
-     ReadhNFile(
-		hN_datafile.str(), ke, hN_ppelas_points_per_file,
-		ipoint, hN_ppelas_costh, hN_ppelas_xsec,2);
-    }//loop over files
-
-    fhN2dXSecPP_Elas = new BLI2DNonUnifGrid(hN_ppelas_nfiles,hN_ppelas_points_per_file,
-			   hN_ppelas_energies,hN_ppelas_costh,hN_ppelas_xsec);
+  case (kIHDhNPPElas):
+    this->ReadhNFiles(diff_ang + "pp/pp", ".txt",
+       khNEnergiesNN, kNhNEnergiesNN, 21, 2, table);
+    break;
+  case (kIHDhNNPElas):
+    this->ReadhNFiles(diff_ang + "pn/pn", ".txt",
+       khNEnergiesNN, kNhNEnergiesNN, 21, 2, table);
+    break;
+  case (kIHDhNPipNElas):
+    this->ReadhNFiles(diff_ang + "pip/pip", ".txt",
+       khNEnergiesPiN, kNhNEnergiesPiN, 21, 2, table);
+    break;
+  case (kIHDhNPi0NElas):
+    this->ReadhNFiles(diff_ang + "pip/pip", ".txt",
+       khNEnergiesPiN, kNhNEnergiesPiN, 21, 2, table);
+    break;
+  case (kIHDhNPimNElas):
+    this->ReadhNFiles(diff_ang + "pim/pim", ".txt",
+       khNEnergiesPiN, kNhNEnergiesPiN, 21, 2, table);
+    break;
+  case (kIHDhNKpNElas):
+    this->ReadhNFiles(diff_ang + "kpn/kpn", ".txt",
+       khNEnergiesKN, kNhNEnergiesKN, 37, 2, table);
+    break;
+  case (kIHDhNKpNCEx):
+    this->ReadhNFiles(diff_ang + "kpncex/kpcex", ".txt",
+       khNEnergiesKN, kNhNEnergiesKN, 37, 2, table);
+    break;
+  case (kIHDhNKpPElas):
+    this->ReadhNFiles(diff_ang + "kpp/kpp", ".txt",
+       khNEnergiesKN, kNhNEnergiesKN, 37, 2, table);
+    break;
+  case (kIHDhNPiNCEx):
+    this->ReadhNFiles(diff_ang + "pie/pie", ".txt",
+       khNEnergiesPiN, kNhNEnergiesPiN, 21, 2, table);
+    break;
+  case (kIHDhNPiNAbs):
+    this->ReadhNFiles(diff_ang + "pid2p/pid2p", ".txt",
+       khNEnergiesPiNAbs, kNhNEnergiesPiNAbs, 21, 2, table);
+    break;
+  case (kIHDhNGamPi0PInelas):
+    this->ReadhNFiles(diff_ang + "gampi0p/", "-pi0p.txt",
+       khNEnergiesGamN, kNhNEnergiesGamN, 37, 3, table);
+    break;
+  case (kIHDhNGamPi0NInelas):
+    this->ReadhNFiles(diff_ang + "gampi0n/", "-pi0n.txt",
+       khNEnergiesGamN, kNhNEnergiesGamN, 37, 3, table);
+    break;
+  case (kIHDhNGamPipNInelas):
+    this->ReadhNFiles(diff_ang + "gampi+n/", "-pi+n.txt",
+       khNEnergiesGamN, kNhNEnergiesGamN, 37, 3, table);
+    break;
+  case (kIHDhNGamPimPInelas):
+    this->ReadhNFiles(diff_ang + "gampi-p/", "-pi-p.txt",
+       khNEnergiesGamN, kNhNEnergiesGamN, 37, 3, table);
+    break;
+
+  //-- pi+A x-section fractions vs A
+
+  case (kIHDPipAAbs):
+    this->ReadADepFiles(tot_xsec + "pipA_abs_frac/pip", "_abs_frac.txt",
+       kPipANuclei, kNPipANuclei, table);
+    break;
+  case (kIHDPipACEx):
+    this->ReadADepFiles(tot_xsec + "pipA_cex_frac/pip", "_cex_frac.txt",
+       kPipANuclei, kNPipANuclei, table);
+    break;
+  case (kIHDPipAInelas):
+    this->ReadADepFiles(tot_xsec + "pipA_inelas_frac/pip", "_inelas_frac.txt",
+       kPipAInelasNuclei, kNPipAInelasNuclei, table);
+    break;
+  case (kIHDPipAPiPro):
+    this->ReadADepFiles(tot_xsec + "pipA_pipro_frac/pip", "_pipro_frac.txt",
+       kPipAPiProNuclei, kNPipAPiProNuclei, table);
+    break;
+
+  default:
+    break;
   }
+}
+//____________________________________________________________________________
+void INukeHadroData2018::BuildChannel(
+  INukeHDChannel_t ch, const ChannelTable & table)
+{
+  switch(ch) {
 
-  // kIHNFtElas, pn&np :
-  {
-    const int hN_npelas_nfiles = 20;
-    const int hN_npelas_points_per_file = 21;
-    const int hN_npelas_npoints = hN_npelas_points_per_file * hN_npelas_nfiles;
-
-    double hN_npelas_energies[hN_npelas_nfiles] = {
-        50, 100, 150, 200, 250, 300, 350, 400, 450, 500,
-       550, 600, 650, 700, 750, 800, 850, 900, 950, 1000
-    };
-
-    double hN_npelas_costh [hN_npelas_points_per_file];
-    double hN_npelas_xsec  [hN_npelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_npelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_npelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/pn/pn" << ke << ".txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_npelas_points_per_file,
-       ipoint, hN_npelas_costh, hN_npelas_xsec,2);
-    }//loop over files
-
-    fhN2dXSecNP_Elas = new BLI2DNonUnifGrid(hN_npelas_nfiles,hN_npelas_points_per_file,
-			   hN_npelas_energies,hN_npelas_costh,hN_npelas_xsec);
-  }
+  // p/n+p/n hA x-section splines
+  case (kIHDNN):
+    fXSecPp_Tot      = TableSpline(table, "pp_tot");
+    fXSecPp_Elas     = TableSpline(table, "pp_elas");
+    fXSecPp_Reac     = TableSpline(table, "pp_reac");
+    fXSecPn_Tot      = TableSpline(table, "pn_tot");
+    fXSecPn_Elas     = TableSpline(table, "pn_elas");
+    fXSecPn_Reac     = TableSpline(table, "pn_reac");
+    fXSecNn_Tot      = TableSpline(table, "nn_tot");
+    fXSecNn_Elas     = TableSpline(table, "nn_elas");
+    fXSecNn_Reac     = TableSpline(table, "nn_reac");
+    fXSecPp_Cmp      = TableSpline(table, "pp_cmp"); //for compound nucleus fate
+    fXSecPn_Cmp      = TableSpline(table, "pn_cmp");
+    fXSecNn_Cmp      = TableSpline(table, "nn_cmp");
+    break;
 
-  // kIHNFtElas, pipN :
-  {
-    const int hN_pipNelas_nfiles = 60;
-    const int hN_pipNelas_points_per_file = 21;
-    const int hN_pipNelas_npoints = hN_pipNelas_points_per_file * hN_pipNelas_nfiles;
-
-    double hN_pipNelas_energies[hN_pipNelas_nfiles] = {
-      10,  20,  30,  40,  50,  60,  70,  80,  90,
-     100, 110, 120, 130, 140, 150, 160, 170, 180, 190,
-     200, 210, 220, 230, 240, 250, 260, 270, 280, 290,
-     300, 340, 380, 420, 460, 500, 540, 580, 620, 660,
-     700, 740, 780, 820, 860, 900, 940, 980,
-     1020, 1060, 1100, 1140, 1180, 1220, 1260,
-     1300, 1340, 1380, 1420, 1460, 1500
-    };
-
-    double hN_pipNelas_costh [hN_pipNelas_points_per_file];
-    double hN_pipNelas_xsec  [hN_pipNelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_pipNelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_pipNelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/pip/pip" << ke << ".txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_pipNelas_points_per_file,
-       ipoint, hN_pipNelas_costh, hN_pipNelas_xsec,2);
-    }//loop over files
-
-    fhN2dXSecPipN_Elas = new BLI2DNonUnifGrid(hN_pipNelas_nfiles,hN_pipNelas_points_per_file,
-			   hN_pipNelas_energies,hN_pipNelas_costh,hN_pipNelas_xsec);
-  }
+  // pi+n/p hA x-section splines
+  case (kIHDPipN):
+    fXSecPipn_Tot     = TableSpline(table, "pipn_tot");
+    fXSecPipn_CEx     = TableSpline(table, "pipn_cex");
+    fXSecPipn_Elas    = TableSpline(table, "pipn_elas");
+    fXSecPipn_Reac    = TableSpline(table, "pipn_reac");
+    fXSecPipp_Tot     = TableSpline(table, "pipp_tot");
+    fXSecPipp_CEx     = TableSpline(table, "pipp_cex");
+    fXSecPipp_Elas    = TableSpline(table, "pipp_elas");
+    fXSecPipp_Reac    = TableSpline(table, "pipp_reac");
+    fXSecPipd_Abs     = TableSpline(table, "pipd_abs");
+    break;
 
-  // kIHNFtElas, pi0N :
-  {
-    const int hN_pi0Nelas_nfiles = 60;
-    const int hN_pi0Nelas_points_per_file = 21;
-    const int hN_pi0Nelas_npoints = hN_pi0Nelas_points_per_file * hN_pi0Nelas_nfiles;
-
-    double hN_pi0Nelas_energies[hN_pi0Nelas_nfiles] = {
-      10,  20,  30,  40,  50,  60,  70,  80,  90,
-     100, 110, 120, 130, 140, 150, 160, 170, 180, 190,
-     200, 210, 220, 230, 240, 250, 260, 270, 280, 290,
-     300, 340, 380, 420, 460, 500, 540, 580, 620, 660,
-     700, 740, 780, 820, 860, 900, 940, 980,
-     1020, 1060, 1100, 1140, 1180, 1220, 1260,
-     1300, 1340, 1380, 1420, 1460, 1500
-    };
-
-    double hN_pi0Nelas_costh [hN_pi0Nelas_points_per_file];
-    double hN_pi0Nelas_xsec  [hN_pi0Nelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_pi0Nelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_pi0Nelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/pip/pip" << ke << ".txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_pi0Nelas_points_per_file,
-       ipoint, hN_pi0Nelas_costh, hN_pi0Nelas_xsec,2);
-    }//loop over files
-
-    fhN2dXSecPi0N_Elas = new BLI2DNonUnifGrid(hN_pi0Nelas_nfiles,hN_pi0Nelas_points_per_file,
-			   hN_pi0Nelas_energies,hN_pi0Nelas_costh,hN_pi0Nelas_xsec);
-  }
+  // pi0n/p hA x-section splines
+  case (kIHDPi0N):
+    fXSecPi0n_Tot     = TableSpline(table, "pi0n_tot");
+    fXSecPi0n_CEx     = TableSpline(table, "pi0n_cex");
+    fXSecPi0n_Elas    = TableSpline(table, "pi0n_elas");
+    fXSecPi0n_Reac    = TableSpline(table, "pi0n_reac");
+    fXSecPi0p_Tot     = TableSpline(table, "pi0p_tot");
+    fXSecPi0p_CEx     = TableSpline(table, "pi0p_cex");
+    fXSecPi0p_Elas    = TableSpline(table, "pi0p_elas");
+    fXSecPi0p_Reac    = TableSpline(table, "pi0p_reac");
+    fXSecPi0d_Abs     = TableSpline(table, "pi0d_abs");
+    break;
 
-  // kIHNFtElas, pimN :
-  {
-    const int hN_pimNelas_nfiles = 60;
-    const int hN_pimNelas_points_per_file = 21;
-    const int hN_pimNelas_npoints = hN_pimNelas_points_per_file * hN_pimNelas_nfiles;
-
-    double hN_pimNelas_energies[hN_pimNelas_nfiles] = {
-      10,  20,  30,  40,  50,  60,  70,  80,  90,
-     100, 110, 120, 130, 140, 150, 160, 170, 180, 190,
-     200, 210, 220, 230, 240, 250, 260, 270, 280, 290,
-     300, 340, 380, 420, 460, 500, 540, 580, 620, 660,
-     700, 740, 780, 820, 860, 900, 940, 980,
-     1020, 1060, 1100, 1140, 1180, 1220, 1260,
-     1300, 1340, 1380, 1420, 1460, 1500
-    };
-
-    double hN_pimNelas_costh [hN_pimNelas_points_per_file];
-    double hN_pimNelas_xsec  [hN_pimNelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_pimNelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_pimNelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/pim/pim" << ke << ".txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_pimNelas_points_per_file,
-       ipoint, hN_pimNelas_costh, hN_pimNelas_xsec,2);
-    }//loop over files
-
-    fhN2dXSecPimN_Elas = new BLI2DNonUnifGrid(hN_pimNelas_nfiles,hN_pimNelas_points_per_file,
-			   hN_pimNelas_energies,hN_pimNelas_costh,hN_pimNelas_xsec);
-  }
+  // N+A x-section fraction splines
+  case (kIHDNA):
+    fFracPA_Tot      = TableSpline(table, "pA_tot");
+    fFracPA_Inel     = TableSpline(table, "pA_inel");
+    fFracPA_CEx      = TableSpline(table, "pA_cex");
+    fFracPA_Abs      = TableSpline(table, "pA_abs");
+    fFracPA_PiPro    = TableSpline(table, "pA_pipro");
+    fFracNA_Tot      = TableSpline(table, "pA_tot");  // assuming nA same as pA
+    fFracNA_Inel     = TableSpline(table, "pA_inel");
+    fFracNA_CEx      = TableSpline(table, "pA_cex");
+    fFracNA_Abs      = TableSpline(table, "pA_abs");
+    fFracNA_PiPro    = TableSpline(table, "pA_pipro");
+    fFracPA_Cmp      = TableSpline(table, "pA_cmp");  //cmp - add support later
+    fFracNA_Cmp      = TableSpline(table, "pA_cmp");
+    break;
 
-  // kIHNFtElas, kpn :
-  {
-    const int hN_kpNelas_nfiles = 18;
-    const int hN_kpNelas_points_per_file = 37;
-    const int hN_kpNelas_npoints = hN_kpNelas_points_per_file * hN_kpNelas_nfiles;
-
-    double hN_kpNelas_energies[hN_kpNelas_nfiles] = {
-     100, 200, 300, 400, 500, 600, 700, 800, 900, 1000,
-     1100, 1200, 1300, 1400, 1500, 1600, 1700, 1800
-    };
-
-    double hN_kpNelas_costh [hN_kpNelas_points_per_file];
-    double hN_kpNelas_xsec  [hN_kpNelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_kpNelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_kpNelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/kpn/kpn" << ke << ".txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_kpNelas_points_per_file,
-       ipoint, hN_kpNelas_costh, hN_kpNelas_xsec,2);
-    }//loop over files
-
-    fhN2dXSecKpN_Elas = new BLI2DNonUnifGrid(hN_kpNelas_nfiles,hN_kpNelas_points_per_file,
-			   hN_kpNelas_energies,hN_kpNelas_costh,hN_kpNelas_xsec);
-  }
-  // kIHNFtCEx, kpn :
-  {
-    const int hN_kpNcex_nfiles = 18;
-    const int hN_kpNcex_points_per_file = 37;
-    const int hN_kpNcex_npoints = hN_kpNcex_points_per_file * hN_kpNcex_nfiles;
-
-    double hN_kpNcex_energies[hN_kpNcex_nfiles] = {
-     100, 200, 300, 400, 500, 600, 700, 800, 900, 1000,
-     1100, 1200, 1300, 1400, 1500, 1600, 1700, 1800
-    };
-
-    double hN_kpNcex_costh [hN_kpNcex_points_per_file];
-    double hN_kpNcex_xsec  [hN_kpNcex_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_kpNcex_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_kpNcex_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/kpncex/kpcex" << ke << ".txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_kpNcex_points_per_file,
-       ipoint, hN_kpNcex_costh, hN_kpNcex_xsec,2);
-    }//loop over files
-
-    /*double hN_kpNcex_costh_cond [hN_kpNcex_points_per_file];
-    for (int ient = 0; ient < hN_kpNcex_points_per_file; ient++) {
-      hN_kpNcex_costh_cond[ient] = hN_kpNcex_costh[ient];
-      }*/
-
-    fhN2dXSecKpN_CEx = new BLI2DNonUnifGrid(hN_kpNcex_nfiles,hN_kpNcex_points_per_file,
-			   hN_kpNcex_energies,hN_kpNcex_costh,hN_kpNcex_xsec);
+  // K+A x-section fraction splines
+  case (kIHDKA):
+    fFracKA_Tot      = TableSpline(table, "KA_tot");
+    fFracKA_Elas     = TableSpline(table, "KA_elas");
+    fFracKA_CEx      = 0; // TableSpline(table, "KA_cex"); //Added, but needs to be computed
+    fFracKA_Inel     = TableSpline(table, "KA_inel");
+    fFracKA_Abs      = TableSpline(table, "KA_abs");
+    break;
+
+  // gamma x-section splines
+  case (kIHDGamN):
+    fXSecGamp_fs     = TableSpline(table, "gamp_fs");
+    fXSecGamn_fs     = TableSpline(table, "gamn_fs");
+    fXSecGamN_Tot    = TableSpline(table, "gamN_tot");
+    break;
+
+  // K+N x-section splines
+  case (kIHDKN):
+    fXSecKpn_Elas   = TableSpline(table, "kpn_elas");
+    fXSecKpp_Elas   = TableSpline(table, "kpp_elas");
+    fXSecKpn_CEx    = TableSpline(table, "kpn_cex");
+    fXSecKpN_Abs    = 0; // TableSpline(table, "kp_abs");  why not used?
+    fXSecKpN_Tot    = TableSpline(table, "kpN_tot");
+    break;
+
+  // hN angular distributions
+  case (kIHDhNPPElas):        fhN2dXSecPP_Elas        = TableGrid(table); break;
+  case (kIHDhNNPElas):        fhN2dXSecNP_Elas        = TableGrid(table); break;
+  case (kIHDhNPipNElas):      fhN2dXSecPipN_Elas      = TableGrid(table); break;
+  case (kIHDhNPi0NElas):      fhN2dXSecPi0N_Elas      = TableGrid(table); break;
+  case (kIHDhNPimNElas):      fhN2dXSecPimN_Elas      = TableGrid(table); break;
+  case (kIHDhNKpNElas):       fhN2dXSecKpN_Elas       = TableGrid(table); break;
+  case (kIHDhNKpNCEx):        fhN2dXSecKpN_CEx        = TableGrid(table); break;
+  case (kIHDhNKpPElas):       fhN2dXSecKpP_Elas       = TableGrid(table); break;
+  case (kIHDhNPiNCEx):        fhN2dXSecPiN_CEx        = TableGrid(table); break;
+  case (kIHDhNPiNAbs):        fhN2dXSecPiN_Abs        = TableGrid(table); break;
+  case (kIHDhNGamPi0PInelas): fhN2dXSecGamPi0P_Inelas = TableGrid(table); break;
+  case (kIHDhNGamPi0NInelas): fhN2dXSecGamPi0N_Inelas = TableGrid(table); break;
+  case (kIHDhNGamPipNInelas): fhN2dXSecGamPipN_Inelas = TableGrid(table); break;
+  case (kIHDhNGamPimPInelas): fhN2dXSecGamPimP_Inelas = TableGrid(table); break;
+
+  // pi+A x-section fractions vs A
+  case (kIHDPipAAbs):    TfracPipA_Abs    = TableGraph2D(table, "TfracPipA_Abs");    break;
+  case (kIHDPipACEx):    TfracPipA_CEx    = TableGraph2D(table, "TfracPipA_CEx");    break;
+  case (kIHDPipAInelas): TfracPipA_Inelas = TableGraph2D(table, "TfracPipA_Inelas"); break;
+  case (kIHDPipAPiPro):  TfracPipA_PiPro  = TableGraph2D(table, "TfracPipA_PiPro");  break;
+
+  default:
+    break;
   }
-//----------------------------------------------------------------------------------------
+}
+//____________________________________________________________________________
+void INukeHadroData2018::ReadTextTable(
+  string filename, string descriptor, ChannelTable & table) const
+{
+// Reads a table of x-sections vs kinetic energy, with the columns described
+// by the input TTree::ReadFile() descriptor
 
+  assert( ! gSystem->AccessPathName(filename.c_str()) );
+  table.sources.push_back(filename);
 
-  // kIHNFtElas, kpp :
-  {
-    const int hN_kpPelas_nfiles = 18;
-    const int hN_kpPelas_points_per_file = 37;
-    const int hN_kpPelas_npoints = hN_kpPelas_points_per_file * hN_kpPelas_nfiles;
-
-    double hN_kpPelas_energies[hN_kpPelas_nfiles] = {
-     100, 200, 300, 400, 500, 600, 700, 800, 900, 1000,
-     1100, 1200, 1300, 1400, 1500, 1600, 1700, 1800
-    };
-
-    double hN_kpPelas_costh [hN_kpPelas_points_per_file];
-    double hN_kpPelas_xsec  [hN_kpPelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_kpPelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_kpPelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/kpp/kpp" << ke << ".txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_kpPelas_points_per_file,
-       ipoint, hN_kpPelas_costh, hN_kpPelas_xsec,2);
-    }//loop over files
-
-    fhN2dXSecKpP_Elas = new BLI2DNonUnifGrid(hN_kpPelas_nfiles,hN_kpPelas_points_per_file,
-			   hN_kpPelas_energies,hN_kpPelas_costh,hN_kpPelas_xsec);
-	}
+  TTree data;
+  data.ReadFile(filename.c_str(), descriptor.c_str());
 
-  // kIHNFtCEx, (pi+, pi0, pi-) N
-  {
-    const int hN_piNcex_nfiles = 60;
-    const int hN_piNcex_points_per_file = 21;
-    const int hN_piNcex_npoints = hN_piNcex_points_per_file * hN_piNcex_nfiles;
-
-    double hN_piNcex_energies[hN_piNcex_nfiles] = {
-      10,  20,  30,  40,  50,  60,  70,  80,  90,
-     100, 110, 120, 130, 140, 150, 160, 170, 180, 190,
-     200, 210, 220, 230, 240, 250, 260, 270, 280, 290,
-     300, 340, 380, 420, 460, 500, 540, 580, 620, 660,
-     700, 740, 780, 820, 860, 900, 940, 980,
-     1020, 1060, 1100, 1140, 1180, 1220, 1260,
-     1300, 1340, 1380, 1420, 1460, 1500
-    };
-
-    double hN_piNcex_costh [hN_piNcex_points_per_file];
-    double hN_piNcex_xsec  [hN_piNcex_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_piNcex_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_piNcex_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/pie/pie" << ke << ".txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_piNcex_points_per_file,
-       ipoint, hN_piNcex_costh, hN_piNcex_xsec,2);
-    }//loop over files
-
-    fhN2dXSecPiN_CEx = new BLI2DNonUnifGrid(hN_piNcex_nfiles,hN_piNcex_points_per_file,
-			   hN_piNcex_energies,hN_piNcex_costh,hN_piNcex_xsec);
-  }
+  LOG("INukeData", pDEBUG)
+     << "Number of data rows in " << filename << " : " << data.GetEntries();
 
-  // kIHNFtAbs, (pi+, pi0, pi-) N
-  {
-    const int hN_piNabs_nfiles = 19;
-    const int hN_piNabs_points_per_file = 21;
-    const int hN_piNabs_npoints = hN_piNabs_points_per_file * hN_piNabs_nfiles;
-
-    double hN_piNabs_energies[hN_piNabs_nfiles] = {
-      50,  75, 100, 125, 150, 175, 200, 225, 250, 275,
-     300, 325, 350, 375, 400, 425, 450, 475, 500
-    };
-
-    double hN_piNabs_costh [hN_piNabs_points_per_file];
-    double hN_piNabs_xsec  [hN_piNabs_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_piNabs_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_piNabs_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/pid2p/pid2p" << ke << ".txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_piNabs_points_per_file,
-       ipoint, hN_piNabs_costh, hN_piNabs_xsec,2);
-    }//loop over files
-
-    fhN2dXSecPiN_Abs = new BLI2DNonUnifGrid(hN_piNabs_nfiles,hN_piNabs_points_per_file,
-			   hN_piNabs_energies,hN_piNabs_costh,hN_piNabs_xsec);
-  }
+  vector<string> branches = utils::str::Split(descriptor, ":");
+  for(unsigned int i = 0; i < branches.size(); i++) {
+    string name = utils::str::Split(branches[i], "/")[0];
 
-  // kIHNFtInelas, gamma p -> p pi0
-    {
-    const int hN_gampi0pInelas_nfiles = 29;
-    const int hN_gampi0pInelas_points_per_file = 37;
-    const int hN_gampi0pInelas_npoints = hN_gampi0pInelas_points_per_file * hN_gampi0pInelas_nfiles;
-
-    double hN_gampi0pInelas_energies[hN_gampi0pInelas_nfiles] = {
-      160,  180,  200,  220,  240,  260,  280,  300,  320,  340,
-      360,  380,  400,  450,  500,  550,  600,  650,  700,  750,
-      800,  850,  900,  950,  1000, 1050, 1100, 1150, 1200
-    };
-
-    double hN_gampi0pInelas_costh [hN_gampi0pInelas_points_per_file];
-    double hN_gampi0pInelas_xsec  [hN_gampi0pInelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_gampi0pInelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_gampi0pInelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/gampi0p/" << ke << "-pi0p.txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_gampi0pInelas_points_per_file,
-       ipoint, hN_gampi0pInelas_costh, hN_gampi0pInelas_xsec,3);
-    }//loop over files
-
-    fhN2dXSecGamPi0P_Inelas = new BLI2DNonUnifGrid(hN_gampi0pInelas_nfiles,hN_gampi0pInelas_points_per_file,
-			   hN_gampi0pInelas_energies,hN_gampi0pInelas_costh,hN_gampi0pInelas_xsec);
-  }
+    data.Draw(name.c_str(), "", "GOFF");
+    TH1 * hst = (TH1*) gROOT->FindObject("htemp");
+    if(hst) { hst->SetDirectory(0); delete hst; }
 
-  // kIHNFtInelas, gamma n -> n pi0
-  {
-    const int hN_gampi0nInelas_nfiles = 29;
-    const int hN_gampi0nInelas_points_per_file = 37;
-    const int hN_gampi0nInelas_npoints = hN_gampi0nInelas_points_per_file * hN_gampi0nInelas_nfiles;
-
-    double hN_gampi0nInelas_energies[hN_gampi0nInelas_nfiles] = {
-      160,  180,  200,  220,  240,  260,  280,  300,  320,  340,
-      360,  380,  400,  450,  500,  550,  600,  650,  700,  750,
-      800,  850,  900,  950,  1000, 1050, 1100, 1150, 1200
-    };
-
-    double hN_gampi0nInelas_costh [hN_gampi0nInelas_points_per_file];
-    double hN_gampi0nInelas_xsec  [hN_gampi0nInelas_npoints];
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_gampi0nInelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_gampi0nInelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/gampi0n/" << ke << "-pi0n.txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_gampi0nInelas_points_per_file,
-       ipoint, hN_gampi0nInelas_costh, hN_gampi0nInelas_xsec,3);
-    }//loop over files
-
-    fhN2dXSecGamPi0N_Inelas = new BLI2DNonUnifGrid(hN_gampi0nInelas_nfiles,hN_gampi0nInelas_points_per_file,
-			   hN_gampi0nInelas_energies,hN_gampi0nInelas_costh,hN_gampi0nInelas_xsec);
+    int n = data.GetSelectedRows();
+    table.names.push_back(name);
+    table.columns.push_back(vector<double>(data.GetV1(), data.GetV1() + n));
   }
-
-  // kIHNFtInelas, gamma p -> n pi+
-  {
-    const int hN_gampipnInelas_nfiles = 29;
-    const int hN_gampipnInelas_points_per_file = 37;
-    const int hN_gampipnInelas_npoints = hN_gampipnInelas_points_per_file * hN_gampipnInelas_nfiles;
-
-    double hN_gampipnInelas_energies[hN_gampipnInelas_nfiles] = {
-      160,  180,  200,  220,  240,  260,  280,  300,  320,  340,
-      360,  380,  400,  450,  500,  550,  600,  650,  700,  750,
-      800,  850,  900,  950,  1000, 1050, 1100, 1150, 1200
-    };
-
-    double hN_gampipnInelas_costh [hN_gampipnInelas_points_per_file];
-    double hN_gampipnInelas_xsec  [hN_gampipnInelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_gampipnInelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_gampipnInelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/gampi+n/" << ke << "-pi+n.txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_gampipnInelas_points_per_file,
-       ipoint, hN_gampipnInelas_costh, hN_gampipnInelas_xsec,3);
-    }//loop over files
-
-    fhN2dXSecGamPipN_Inelas = new BLI2DNonUnifGrid(hN_gampipnInelas_nfiles,hN_gampipnInelas_points_per_file,
-			   hN_gampipnInelas_energies,hN_gampipnInelas_costh,hN_gampipnInelas_xsec);
+}
+//____________________________________________________________________________
+void INukeHadroData2018::ReadhNFiles(
+  string prefix, string suffix, const double * energies,
+  int nfiles, int npoints, int cols, ChannelTable & table) const
+{
+// Reads a hN angular distribution, stored in one file per kinetic energy
+
+  vector<double> costh(npoints);
+  vector<double> xsec (nfiles * npoints);
+
+  int ipoint=0;
+
+  for(int ifile = 0; ifile < nfiles; ifile++) {
+    // build filename
+    ostringstream hN_datafile;
+    double ke = energies[ifile];
+    hN_datafile << prefix << ke << suffix;
+    table.sources.push_back(hN_datafile.str());
+    // read data
+    ReadhNFile(
+      hN_datafile.str(), ke, npoints, ipoint, &costh[0], &xsec[0], cols);
+  }//loop over files
+
+  table.names.push_back("ke");
+  table.names.push_back("costh");
+  table.names.push_back("xsec");
+  table.columns.push_back(vector<double>(energies, energies + nfiles));
+  table.columns.push_back(costh);
+  table.columns.push_back(xsec);
+}
+//____________________________________________________________________________
+void INukeHadroData2018::ReadADepFiles(
+  string prefix, string suffix, const int * nuclei,
+  int nfiles, ChannelTable & table) const
+{
+// Reads an A-dependent x-section fraction, stored in one file per nucleus
+
+  vector<double> A, ke, frac;
+  double x, y;
+
+  for(int ifile=0; ifile < nfiles; ifile++) {
+    ostringstream ADep_datafile;
+    int nucleus = nuclei[ifile];
+    ADep_datafile << prefix << nucleus << suffix;
+    table.sources.push_back(ADep_datafile.str());
+    TGraph * buff = new TGraph(ADep_datafile.str().c_str());
+    for(int i=0; i < buff->GetN(); i++) {
+      buff -> GetPoint(i,x,y);
+      A   .push_back((double)nucleus);
+      ke  .push_back(x);
+      frac.push_back(y);
+    }
+    delete buff;
   }
 
-  // kIHNFtInelas, gamma n -> p pi-
-  {
-    const int hN_gampimpInelas_nfiles = 29;
-    const int hN_gampimpInelas_points_per_file = 37;
-    const int hN_gampimpInelas_npoints = hN_gampimpInelas_points_per_file * hN_gampimpInelas_nfiles;
-
-    double hN_gampimpInelas_energies[hN_gampimpInelas_nfiles] = {
-      160,  180,  200,  220,  240,  260,  280,  300,  320,  340,
-      360,  380,  400,  450,  500,  550,  600,  650,  700,  750,
-      800,  850,  900,  950,  1000, 1050, 1100, 1150, 1200
-    };
-
-    double hN_gampimpInelas_costh [hN_gampimpInelas_points_per_file];
-    double hN_gampimpInelas_xsec  [hN_gampimpInelas_npoints];
-
-    int ipoint=0;
-
-    for(int ifile = 0; ifile < hN_gampimpInelas_nfiles; ifile++) {
-     // build filename
-     ostringstream hN_datafile;
-     double ke = hN_gampimpInelas_energies[ifile];
-     hN_datafile << data_dir << "/diff_ang/gampi-p/" << ke << "-pi-p.txt";
-     // read data
-     ReadhNFile(
-       hN_datafile.str(), ke, hN_gampimpInelas_points_per_file,
-       ipoint, hN_gampimpInelas_costh, hN_gampimpInelas_xsec,3);
-    }//loop over files
-
-    fhN2dXSecGamPimP_Inelas = new BLI2DNonUnifGrid(hN_gampimpInelas_nfiles,hN_gampimpInelas_points_per_file,
-			   hN_gampimpInelas_energies,hN_gampimpInelas_costh,hN_gampimpInelas_xsec);
+  table.names.push_back("A");
+  table.names.push_back("ke");
+  table.names.push_back("frac");
+  table.columns.push_back(A);
+  table.columns.push_back(ke);
+  table.columns.push_back(frac);
+}
+//____________________________________________________________________________
+const vector<double> & INukeHadroData2018::ChannelTable::Column(string name) const
+{
+  for(unsigned int i = 0; i < names.size(); i++) {
+    if(names[i] == name) return columns[i];
   }
+  LOG("INukeData", pFATAL) << "No column " << name << " in INTRANUKE hadron data";
+  gAbortingInErr = true;
+  exit(1);
+}
+//____________________________________________________________________________
+Spline * INukeHadroData2018::TableSpline(
+  const ChannelTable & table, string column)
+{
+// Builds a spline of the input column vs kinetic energy. As in the spline
+// built from a TTree, the data are sorted in kinetic energy first.
 
+  const vector<double> & ke   = table.Column("ke");
+  const vector<double> & xsec = table.Column(column);
 
+  int n = ke.size();
+  vector<int>    idx(n);
+  vector<double> x  (n);
+  vector<double> y  (n);
 
-
-  TFile TGraphs_file;
-  bool saveTGraphsToFile = false;  //true;
-
-  if (saveTGraphsToFile) {
-    string filename = "TGraphs.root";
-    LOG("INukeHadroData2018", pNOTICE) << "Saving INTRANUKE hadron x-section data to ROOT file: " << filename;
-    TGraphs_file.Open(filename.c_str(), "RECREATE");
+  TMath::Sort(n, &ke[0], &idx[0], false);
+  for(int i = 0; i < n; i++) {
+    x[i] = ke  [idx[i]];
+    y[i] = xsec[idx[i]];
   }
+  return new Spline(n, &x[0], &y[0]);
+}
+//____________________________________________________________________________
+BLI2DNonUnifGrid * INukeHadroData2018::TableGrid(const ChannelTable & table)
+{
+  vector<double> ke    = table.Column("ke");
+  vector<double> costh = table.Column("costh");
+  vector<double> xsec  = table.Column("xsec");
 
-  /*
-  // kIHNFtTot,   pip + A                                            PipA_Tot
-  {
-    const int pipATot_nfiles = 22;
-    const int pipATot_nuclei[pipATot_nfiles] = {1, 2, 3, 4, 6, 7, 9, 12, 16, 27, 28, 32, 40, 48, 56, 58, 63, 93, 120, 165, 181, 209};
-    const int pipATot_npoints = 203;
-
-    TPipA_Tot = new TGraph2D(pipATot_npoints);
-    TPipA_Tot->SetNameTitle("TPipA_Tot","TPipA_Tot");
-    TPipA_Tot->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-
-    for(int ifile=0; ifile < pipATot_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipATot_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_tot/pip" << nucleus << "_tot.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TPipA_Tot -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
-      }
-      delete buff;
-    }
-
-    if (saveTGraphsToFile) {
-      TPipA_Tot -> Write("TPipA_Tot"); // TPipA_Tot will be _key_ name
-    }
+  return new BLI2DNonUnifGrid(ke.size(), costh.size(), &ke[0], &costh[0], &xsec[0]);
+}
+//____________________________________________________________________________
+TGraph2D * INukeHadroData2018::TableGraph2D(
+  const ChannelTable & table, string name)
+{
+  const vector<double> & A    = table.Column("A");
+  const vector<double> & ke   = table.Column("ke");
+  const vector<double> & frac = table.Column("frac");
+
+  TGraph2D * graph = new TGraph2D(A.size());
+  graph->SetNameTitle(name.c_str(), name.c_str());
+  graph->SetDirectory(0);
+  for(unsigned int i = 0; i < A.size(); i++) {
+    graph->SetPoint(i, A[i], ke[i], frac[i]);
   }
-  */
-
-  // kIHNFtAbs, pip + A                                                            PipA_Abs_frac
-  {
-    const int pipAAbs_f_nfiles = 18;
-    const int pipAAbs_f_nuclei[pipAAbs_f_nfiles] = {1, 2, 3, 4, 7, 9, 12, 16, 27, 48, 56, 58, 63, 93, 120, 165, 181, 209};
-    const int pipAAbs_f_npoints = 111;
-
-    TfracPipA_Abs = new TGraph2D(pipAAbs_f_npoints);
-    TfracPipA_Abs->SetNameTitle("TfracPipA_Abs","TfracPipA_Abs");
-    TfracPipA_Abs->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-    for(int ifile=0; ifile < pipAAbs_f_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipAAbs_f_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_abs_frac/pip" << nucleus << "_abs_frac.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TfracPipA_Abs -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
-      }
-      delete buff;
-    }
-    if (saveTGraphsToFile) {
-      TfracPipA_Abs -> Write("TfracPipA_Abs");
-    }
-
+  return graph;
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::OpenBinaryDataset(string filename)
+{
+// Reads and validates the header and the table of contents of the binary
+// dataset. The channel records are read (and their checksums and source
+// files verified) only when the channels are first used.
+
+  std::ifstream in(filename.c_str(), ios::in | ios::binary);
+  if(!in.good()) return false;
+
+  in.seekg(0, ios::end);
+  long long file_size = in.tellg();
+  in.seekg(0, ios::beg);
+
+  BinaryDatasetHeader header;
+  if(!in.read((char *) &header, sizeof(header))) return false;
+  if(std::memcmp(header.magic, kBinaryMagic, kBinaryMagicSize) != 0) return false;
+  if(header.version    != kBinaryVersion   ) return false;
+  if(header.byte_order != kBinaryByteOrder ) return false;
+  if(header.nchannels  != kNIHDChannels    ) return false;
+
+  fBinaryOffset.clear();
+  fBinarySize  .clear();
+  fBinaryDigest.clear();
+
+  for(int ich = 0; ich < kNIHDChannels; ich++) {
+    BinaryChannelEntry entry;
+    if(!in.read((char *) &entry, sizeof(entry))) return false;
+    string name(entry.name, strnlen(entry.name, sizeof(entry.name)));
+    if(name != kChannelName[ich]) return false;
+    if(entry.offset < 0 || entry.size < 0 ||
+       entry.offset + entry.size > file_size) return false;
+    fBinaryOffset.push_back(entry.offset);
+    fBinarySize  .push_back(entry.size);
+    fBinaryDigest.push_back(string(entry.md5, sizeof(entry.md5)));
   }
 
-
-  // kIHNFtCEx, pip + A      PipA_CEx_frac
-  {
-    const int pipACEx_f_nfiles = 18;
-    const int pipACEx_f_nuclei[pipACEx_f_nfiles] = {1, 2, 3, 4, 7, 9, 12, 16, 27, 48, 56, 58, 63, 93, 120, 165, 181, 209};
-    const int pipACEx_f_npoints = 129;
-
-    TfracPipA_CEx = new TGraph2D(pipACEx_f_npoints);
-    TfracPipA_CEx->SetNameTitle("TfracPipA_CEx","TfracPipA_CEx");
-    TfracPipA_CEx->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-
-    for(int ifile=0; ifile < pipACEx_f_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipACEx_f_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_cex_frac/pip" << nucleus << "_cex_frac.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TfracPipA_CEx -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
-      }
-      delete buff;
-    }
-
-    if (saveTGraphsToFile) {
-      TfracPipA_CEx -> Write("TfracPipA_CEx");
+  fBinaryDataset = filename;
+  return true;
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::ReadBinaryChannel(
+  INukeHDChannel_t ch, ChannelTable & table) const
+{
+  std::ifstream in(fBinaryDataset.c_str(), ios::in | ios::binary);
+  if(!in.good()) return false;
+
+  vector<char> record(fBinarySize[ch]);
+  in.seekg(fBinaryOffset[ch]);
+  if(record.size() == 0 || !in.read(&record[0], record.size())) return false;
+
+  // verify the record checksum
+  TMD5 md5;
+  md5.Update((const UChar_t *) &record[0], record.size());
+  md5.Final();
+  if(fBinaryDigest[ch] != md5.AsString()) return false;
+
+  const char * p   = &record[0];
+  const char * end = p + record.size();
+
+  // check that the source files did not change since the record was made
+  int nsources = 0;
+  if(p + sizeof(nsources) > end) return false;
+  std::memcpy(&nsources, p, sizeof(nsources)); p += sizeof(nsources);
+  if(nsources < 0) return false;
+
+  for(int isrc = 0; isrc < nsources; isrc++) {
+    BinarySourceEntry source;
+    if(p + sizeof(source) > end) return false;
+    std::memcpy(&source, p, sizeof(source)); p += sizeof(source);
+
+    string filename = fDataDir + "/" +
+       string(source.name, strnlen(source.name, sizeof(source.name)));
+    long long size = 0, mtime = 0;
+    if(!source_stamp(filename, size, mtime) ||
+       size != source.size || mtime != source.mtime) {
+      LOG("INukeData", pWARN)
+        << "Channel " << kChannelName[ch] << " of " << fBinaryDataset
+        << " is out of date with " << filename << " (re-run ginuke2bin)";
+      return false;
     }
-
   }
 
+  // unpack the columns
+  int ncolumns = 0;
+  if(p + sizeof(ncolumns) > end) return false;
+  std::memcpy(&ncolumns, p, sizeof(ncolumns)); p += sizeof(ncolumns);
 
+  for(int icol = 0; icol < ncolumns; icol++) {
+    BinaryColumnHeader column;
+    if(p + sizeof(column) > end) return false;
+    std::memcpy(&column, p, sizeof(column)); p += sizeof(column);
+    if(column.n < 0 || p + column.n * sizeof(double) > end) return false;
 
-  // kIHNFtCEx, pip + A                                                            PipA_CEx (just for developmental purposes)
-  {
-    TGraph2D * TPipA_CEx;
-
-    const int pipACEx_nfiles = 18;
-    const int pipACEx_nuclei[pipACEx_nfiles] = {1, 2, 3, 4, 7, 9, 12, 16, 27, 48, 56, 58, 63, 93, 120, 165, 181, 209};
-    const int pipACEx_npoints = 129;
-
-    TPipA_CEx = new TGraph2D(pipACEx_npoints);
-    TPipA_CEx->SetNameTitle("TPipA_CEx","TPipA_CEx");
-    TPipA_CEx->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-
-    for(int ifile=0; ifile < pipACEx_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipACEx_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_cex/pip" << nucleus << "_cex.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TPipA_CEx -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
-      }
-      delete buff;
-    }
+    vector<double> values(column.n);
+    if(column.n > 0) std::memcpy(&values[0], p, column.n * sizeof(double));
+    p += column.n * sizeof(double);
 
-    if (saveTGraphsToFile) {
-      TPipA_CEx -> Write("TPipA_CEx");
-    }
-    delete TPipA_CEx;
-   
+    table.names.push_back(string(column.name, strnlen(column.name, sizeof(column.name))));
+    table.columns.push_back(values);
   }
-
-  // kIHNFtAbs, pip + A                                                            PipA_Abs (just for developmental purposes)
-  {
-    TGraph2D * TPipA_Abs;
-
-    const int pipAAbs_nfiles = 18;
-    const int pipAAbs_nuclei[pipAAbs_nfiles] = {1, 2, 3, 4, 7, 9, 12, 16, 27, 48, 56, 58, 63, 93, 120, 165, 181, 209};
-    const int pipAAbs_npoints = 111;
-
-    TPipA_Abs = new TGraph2D(pipAAbs_npoints);
-    TPipA_Abs->SetNameTitle("TPipA_Abs","TPipA_Abs");
-    TPipA_Abs->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-
-    for(int ifile=0; ifile < pipAAbs_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipAAbs_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_abs/pip" << nucleus << "_abs.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TPipA_Abs -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
+  return (p == end);
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::WriteBinaryDataset(string filename) const
+{
+// Reads all channels from the text / ntuple files and writes them in the
+// binary dataset format
+
+  vector<string> records;
+  for(int ich = 0; ich < kNIHDChannels; ich++) {
+    ChannelTable table;
+    this->ReadTextChannel((INukeHDChannel_t) ich, table);
+
+    string record;
+    int nsources = table.sources.size();
+    record.append((const char *) &nsources, sizeof(nsources));
+    for(int isrc = 0; isrc < nsources; isrc++) {
+      // store the path relative to the data directory
+      string name = table.sources[isrc];
+      string dir  = fDataDir + "/";
+      if(name.compare(0, dir.size(), dir) == 0) name = name.substr(dir.size());
+
+      BinarySourceEntry source;
+      std::memset(&source, 0, sizeof(source));
+      if(name.size() >= sizeof(source.name) ||
+         !source_stamp(table.sources[isrc], source.size, source.mtime)) {
+        LOG("INukeData", pERROR)
+          << "Can not record source file " << table.sources[isrc];
+        return false;
       }
-      delete buff;
+      std::strncpy(source.name, name.c_str(), sizeof(source.name) - 1);
+      record.append((const char *) &source, sizeof(source));
     }
 
-    if (saveTGraphsToFile) {
-      TPipA_Abs -> Write("TPipA_Abs");
-    }
-    delete TPipA_Abs;
-   
-  }
-
-  // kIHNFtElas, pip + A                                                            PipA_Elas (just for developmental purposes)
-  {
-    TGraph2D * TPipA_Elas;
-
-    const int pipAElas_nfiles = 18;
-    const int pipAElas_nuclei[pipAElas_nfiles] = {1, 2, 3, 4, 7, 9, 12, 16, 27, 48, 56, 58, 63, 93, 120, 165, 181, 209};
-    const int pipAElas_npoints = 125;
-
-    TPipA_Elas = new TGraph2D(pipAElas_npoints);
-    TPipA_Elas->SetNameTitle("TPipA_Elas","TPipA_Elas");
-    TPipA_Elas->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-
-    for(int ifile=0; ifile < pipAElas_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipAElas_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_elas/pip" << nucleus << "_elas.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TPipA_Elas -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
+    int ncolumns = table.columns.size();
+    record.append((const char *) &ncolumns, sizeof(ncolumns));
+    for(int icol = 0; icol < ncolumns; icol++) {
+      BinaryColumnHeader column;
+      std::memset(&column, 0, sizeof(column));
+      std::strncpy(column.name, table.names[icol].c_str(), sizeof(column.name) - 1);
+      column.n = table.columns[icol].size();
+      record.append((const char *) &column, sizeof(column));
+      if(column.n > 0) {
+        record.append((const char *) &table.columns[icol][0],
+                      column.n * sizeof(double));
       }
-      delete buff;
     }
-
-    if (saveTGraphsToFile) {
-      TPipA_Elas -> Write("TPipA_Elas");
-    }
-    delete TPipA_Elas; 
+    records.push_back(record);
   }
 
-  // kIHNFtInelas, pip + A                                                            PipA_Inelas (just for developmental purposes)
-  {
-    TGraph2D * TPipA_Inelas;
-
-    const int pipAInelas_nfiles = 20;
-    const int pipAInelas_nuclei[pipAInelas_nfiles] = {1, 2, 3, 4, 7, 9, 12, 16, 27, 40, 48, 56, 58, 63, 93, 120, 165, 181, 208, 209};
-    const int pipAInelas_npoints = 118;
-
-    TPipA_Inelas = new TGraph2D(pipAInelas_npoints);
-    TPipA_Inelas->SetNameTitle("TPipA_Inelas","TPipA_Inelas");
-    TPipA_Inelas->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-
-    for(int ifile=0; ifile < pipAInelas_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipAInelas_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_inelas/pip" << nucleus << "_inelas.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TPipA_Inelas -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
-      }
-      delete buff;
-    }
-
-    if (saveTGraphsToFile) {
-      TPipA_Inelas -> Write("TPipA_Inelas");
-    }
-    delete TPipA_Inelas;
+  BinaryDatasetHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kBinaryMagic, kBinaryMagicSize);
+  header.version    = kBinaryVersion;
+  header.byte_order = kBinaryByteOrder;
+  header.nchannels  = kNIHDChannels;
+
+  // write a temporary file and rename it, so that jobs never see a
+  // partially written dataset
+  ostringstream tmpfilename;
+  tmpfilename << filename << ".tmp" << gSystem->GetPid();
+
+  std::ofstream out(tmpfilename.str().c_str(), ios::out | ios::binary);
+  if(!out.good()) return false;
+
+  out.write((const char *) &header, sizeof(header));
+
+  long long offset = sizeof(header) + kNIHDChannels * sizeof(BinaryChannelEntry);
+  for(int ich = 0; ich < kNIHDChannels; ich++) {
+    BinaryChannelEntry entry;
+    std::memset(&entry, 0, sizeof(entry));
+    std::strncpy(entry.name, kChannelName[ich], sizeof(entry.name) - 1);
+    entry.offset = offset;
+    entry.size   = records[ich].size();
+
+    TMD5 md5;
+    md5.Update((const UChar_t *) records[ich].data(), records[ich].size());
+    md5.Final();
+    std::memcpy(entry.md5, md5.AsString(), sizeof(entry.md5));
+
+    out.write((const char *) &entry, sizeof(entry));
+    offset += entry.size;
   }
-
-
-  /*
-  // kIHNFtElas, pip + A                                                            PipA_Elas_frac
-  {
-    const int pipAElas_f_nfiles = 18;
-    const int pipAElas_f_nuclei[pipAElas_f_nfiles] = {1, 2, 3, 4, 7, 9, 12, 16, 27, 48, 56, 58, 63, 93, 120, 165, 181, 209};
-    const int pipAElas_f_npoints = 125;
-
-    TfracPipA_Elas = new TGraph2D(pipAElas_f_npoints);
-    TfracPipA_Elas->SetNameTitle("TfracPipA_Elas","TfracPipA_Elas");
-    TfracPipA_Elas->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-
-    for(int ifile=0; ifile < pipAElas_f_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipAElas_f_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_elas_frac/pip" << nucleus << "_elas_frac.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TfracPipA_Elas -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
-      }
-      delete buff;
-    }
-
-    if (saveTGraphsToFile) {
-      TfracPipA_Elas -> Write("TfracPipA_Elas");
-    }
-
+  for(int ich = 0; ich < kNIHDChannels; ich++) {
+    out.write(records[ich].data(), records[ich].size());
   }
-  */
-
-  // kIHNFtInelas, pip + A                                                            PipA_Inelas_frac
-  {
-    const int pipAInelas_f_nfiles = 20;
-    const int pipAInelas_f_nuclei[pipAInelas_f_nfiles] = {1, 2, 3, 4, 7, 9, 12, 16, 27, 40, 48, 56, 58, 63, 93, 120, 165, 181, 208, 209};
-    const int pipAInelas_f_npoints = 118;
-
-    TfracPipA_Inelas = new TGraph2D(pipAInelas_f_npoints);
-    TfracPipA_Inelas->SetNameTitle("TfracPipA_Inelas","TfracPipA_Inelas");
-    TfracPipA_Inelas->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-
-    for(int ifile=0; ifile < pipAInelas_f_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipAInelas_f_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_inelas_frac/pip" << nucleus << "_inelas_frac.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TfracPipA_Inelas -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
-      }
-      delete buff;
-    }
-
-    if (saveTGraphsToFile) {
-      TfracPipA_Inelas -> Write("TfracPipA_Inelas");
-    }
+  out.close();
 
+  if(!out || std::rename(tmpfilename.str().c_str(), filename.c_str()) != 0) {
+    std::remove(tmpfilename.str().c_str());
+    return false;
   }
+  return true;
+}
+//____________________________________________________________________________
+void INukeHadroData2018::LoadhNTotXSec(int hpdgc) const
+{
+// Loads the h+N x-section splines for the input hadron
 
-
-  // kIHNFtPiPro, pip + A                                                            PipA_PiPro_frac
-   {
-    const int pipAPiPro_f_nfiles = 17;
-    const int pipAPiPro_f_nuclei[pipAPiPro_f_nfiles] = {1, 2, 3, 4, 7, 9, 12, 16, 48, 56, 58, 63, 93, 120, 165, 181, 209};
-    const int pipAPiPro_f_npoints = 76;
-
-    TfracPipA_PiPro = new TGraph2D(pipAPiPro_f_npoints);
-    TfracPipA_PiPro->SetNameTitle("TfracPipA_PiPro","TfracPipA_PiPro");
-    TfracPipA_PiPro->SetDirectory(0);
-
-    int ipoint=0;
-    double x, y;
-
-    for(int ifile=0; ifile < pipAPiPro_f_nfiles; ifile++) {
-      ostringstream ADep_datafile;
-      int nucleus = pipAPiPro_f_nuclei[ifile];
-      ADep_datafile << data_dir << "/tot_xsec/pipA_pipro_frac/pip" << nucleus << "_pipro_frac.txt";
-      TGraph * buff = new TGraph(ADep_datafile.str().c_str());
-      buff->SetNameTitle("buff","buff");
-      for(int i=0; i < buff->GetN(); i++) {
-	buff -> GetPoint(i,x,y);
-	TfracPipA_PiPro -> SetPoint(ipoint,(double)nucleus,x,y);
-	ipoint++;
-      }
-      delete buff;
-    }
-
-    if (saveTGraphsToFile) {
-      TfracPipA_PiPro -> Write("TfracPipA_PiPro");
-    }
-   }
-
-   TGraphs_file.Close();
-
-   LOG("INukeData", pINFO)  << "Done building x-section splines...";
-   
+  if      (hpdgc == kPdgPiP || hpdgc == kPdgPiM    ) this->Load(kIHDPipN);
+  else if (hpdgc == kPdgPi0                        ) this->Load(kIHDPi0N);
+  else if (hpdgc == kPdgProton || hpdgc == kPdgNeutron) this->Load(kIHDNN);
+  else if (hpdgc == kPdgKP                         ) this->Load(kIHDKN);
+  else if (hpdgc == kPdgGamma                      ) this->Load(kIHDGamN);
 }
 //____________________________________________________________________________
 void INukeHadroData2018::ReadhNFile(
   string filename, double ke, int npoints, int & curr_point,
-  double * costh_array, double * xsec_array, int cols)
+  double * costh_array, double * xsec_array, int cols) const
 {
   // open
   std::ifstream hN_stream(filename.c_str(), ios::in);
@@ -1253,7 +1082,7 @@ double INukeHadroData2018::XSec(
      {
        ke_eval = TMath::Min(ke_eval, 999.);
        ke_eval = TMath::Max(ke_eval,  50.);
-       return fhN2dXSecPP_Elas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecPP_Elas()->Evaluate(ke_eval, costh_eval);
      }
      else
      if( (hpdgc==kPdgProton  && tgtpdgc==kPdgNeutron) ||
@@ -1261,42 +1090,42 @@ double INukeHadroData2018::XSec(
      {
        ke_eval = TMath::Min(ke_eval, 999.);
        ke_eval = TMath::Max(ke_eval,  50.);
-       return fhN2dXSecNP_Elas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecNP_Elas()->Evaluate(ke_eval, costh_eval);
      }
      else
      if(hpdgc==kPdgPiP)
      {
        ke_eval = TMath::Min(ke_eval, 1499.);
        ke_eval = TMath::Max(ke_eval,   10.);
-       return fhN2dXSecPipN_Elas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecPipN_Elas()->Evaluate(ke_eval, costh_eval);
      }
      else
      if(hpdgc==kPdgPi0)
      {
        ke_eval = TMath::Min(ke_eval, 1499.);
        ke_eval = TMath::Max(ke_eval,   10.);
-       return fhN2dXSecPi0N_Elas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecPi0N_Elas()->Evaluate(ke_eval, costh_eval);
      }
      else
      if(hpdgc==kPdgPiM)
      {
        ke_eval = TMath::Min(ke_eval, 1499.);
        ke_eval = TMath::Max(ke_eval,   10.);
-       return fhN2dXSecPimN_Elas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecPimN_Elas()->Evaluate(ke_eval, costh_eval);
      }
      else
      if(hpdgc==kPdgKP && tgtpdgc==kPdgNeutron)
      {
        ke_eval = TMath::Min(ke_eval, 1799.);
        ke_eval = TMath::Max(ke_eval,  100.);
-       return fhN2dXSecKpN_Elas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecKpN_Elas()->Evaluate(ke_eval, costh_eval);
      }
      else
      if(hpdgc==kPdgKP && tgtpdgc==kPdgProton)
      {
        ke_eval = TMath::Min(ke_eval, 1799.);
        ke_eval = TMath::Max(ke_eval,  100.);
-       return fhN2dXSecKpP_Elas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecKpP_Elas()->Evaluate(ke_eval, costh_eval);
      }
   }
 
@@ -1306,7 +1135,7 @@ double INukeHadroData2018::XSec(
      {
         ke_eval = TMath::Min(ke_eval, 1499.);
         ke_eval = TMath::Max(ke_eval,   10.);
-        return fhN2dXSecPiN_CEx->Evaluate(ke_eval, costh_eval);
+        return this->hN2dXSecPiN_CEx()->Evaluate(ke_eval, costh_eval);
      }
     else if( (hpdgc == kPdgProton && tgtpdgc == kPdgProton) ||
 	     (hpdgc == kPdgNeutron && tgtpdgc == kPdgNeutron) )
@@ -1314,19 +1143,19 @@ double INukeHadroData2018::XSec(
 	LOG("INukeData", pWARN)  << "Inelastic pp does not exist!";
 	ke_eval = TMath::Min(ke_eval, 999.);
 	ke_eval = TMath::Max(ke_eval,  50.);
-	return fhN2dXSecPP_Elas->Evaluate(ke_eval, costh_eval);
+	return this->hN2dXSecPP_Elas()->Evaluate(ke_eval, costh_eval);
       }
     else if( (hpdgc == kPdgProton && tgtpdgc == kPdgNeutron) ||
 	     (hpdgc == kPdgNeutron && tgtpdgc == kPdgProton) )
       {
 	ke_eval = TMath::Min(ke_eval, 999.);
 	ke_eval = TMath::Max(ke_eval,  50.);
-	return fhN2dXSecNP_Elas->Evaluate(ke_eval, costh_eval);
+	return this->hN2dXSecNP_Elas()->Evaluate(ke_eval, costh_eval);
       }
     else if(hpdgc == kPdgKP && tgtpdgc == kPdgNeutron) {
     	ke_eval = TMath::Min(ke_eval, 1799.);
     	ke_eval = TMath::Max(ke_eval,  100.);
-    	return fhN2dXSecKpN_CEx->Evaluate(ke_eval, costh_eval);
+    	return this->hN2dXSecKpN_CEx()->Evaluate(ke_eval, costh_eval);
     }
   }
 
@@ -1336,7 +1165,7 @@ double INukeHadroData2018::XSec(
      {
         ke_eval = TMath::Min(ke_eval, 499.);
         ke_eval = TMath::Max(ke_eval,  50.);
-        return fhN2dXSecPiN_Abs->Evaluate(ke_eval, costh_eval);
+        return this->hN2dXSecPiN_Abs()->Evaluate(ke_eval, costh_eval);
      }
     if(hpdgc==kPdgKP) return 1.;  //isotropic since no data ???
   }
@@ -1346,28 +1175,28 @@ double INukeHadroData2018::XSec(
     {
        ke_eval = TMath::Min(ke_eval, 1199.);
        ke_eval = TMath::Max(ke_eval,  160.);
-       return fhN2dXSecGamPi0P_Inelas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecGamPi0P_Inelas()->Evaluate(ke_eval, costh_eval);
     }
     else
     if( hpdgc==kPdgGamma && tgtpdgc==kPdgProton  && nppdgc==kPdgNeutron )
     {
        ke_eval = TMath::Min(ke_eval, 1199.);
        ke_eval = TMath::Max(ke_eval,  160.);
-       return fhN2dXSecGamPipN_Inelas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecGamPipN_Inelas()->Evaluate(ke_eval, costh_eval);
     }
     else
     if( hpdgc==kPdgGamma && tgtpdgc==kPdgNeutron && nppdgc==kPdgProton  )
     {
        ke_eval = TMath::Min(ke_eval, 1199.);
        ke_eval = TMath::Max(ke_eval,  160.);
-       return fhN2dXSecGamPimP_Inelas->Evaluate(ke_eval, costh_eval);
+       return this->hN2dXSecGamPimP_Inelas()->Evaluate(ke_eval, costh_eval);
     }
     else
     if( hpdgc==kPdgGamma && tgtpdgc==kPdgNeutron && nppdgc==kPdgNeutron )
     {
        ke_eval = TMath::Min(ke_eval, 1199.);
        ke_eval = TMath::Max(ke_eval,  160.);
-      return fhN2dXSecGamPi0N_Inelas->Evaluate(ke_eval, costh_eval);
+      return this->hN2dXSecGamPi0N_Inelas()->Evaluate(ke_eval, costh_eval);
     }
   }
 
@@ -1389,6 +1218,11 @@ double INukeHadroData2018::FracADep(int hpdgc, INukeFateHA_t fate, double ke, in
   // Handle pions (currently the same cross sections are used for pi+, pi-, and pi0)
   if ( hpdgc == kPdgPiP || hpdgc == kPdgPiM || hpdgc == kPdgPi0 ) {
 
+    this->Load(kIHDPipACEx);
+    this->Load(kIHDPipAInelas);
+    this->Load(kIHDPipAAbs);
+    this->Load(kIHDPipAPiPro);
+
     double frac_cex = TfracPipA_CEx->Interpolate(targA, ke);
     //double frac_elas = TfracPipA_Elas->Interpolate(targA, ke);
     double frac_inelas = TfracPipA_Inelas->Interpolate(targA, ke);
@@ -1426,6 +1260,9 @@ double INukeHadroData2018::FracAIndep(int hpdgc, INukeFateHA_t fate, double ke)
 
   LOG("INukeData", pDEBUG)  << "Querying hA cross section at ke = " << ke;
 
+  if      (hpdgc == kPdgProton || hpdgc == kPdgNeutron) this->Load(kIHDNA);
+  else if (hpdgc == kPdgKP) this->Load(kIHDKA);
+
   // TODO: reduce code duplication here
   if (hpdgc == kPdgProton) {
     // handle protons
@@ -1507,6 +1344,8 @@ double INukeHadroData2018::XSec(int hpdgc, INukeFateHN_t fate, double ke, int ta
 
   LOG("INukeData", pDEBUG)  << "Querying hN cross section at ke = " << ke;
 
+  this->LoadhNTotXSec(hpdgc);
+
   double xsec=0;
 
     if (hpdgc == kPdgPiP) {
@@ -1645,6 +1484,7 @@ double INukeHadroData2018::Frac(int hpdgc, INukeFateHN_t fate, double ke, int ta
   double xsec = this->XSec(hpdgc,fate,ke,targA,targZ);
 
   // get max x-section
+  this->LoadhNTotXSec(hpdgc);
   double xsec_tot = 0;
        if (hpdgc == kPdgPiP    ){xsec_tot = TMath::Max(0., fXSecPipp_Tot  -> Evaluate(ke)) *  targZ;
 				 xsec_tot+= TMath::Max(0., fXSecPipn_Tot  -> Evaluate(ke)) * (targA-targZ);}
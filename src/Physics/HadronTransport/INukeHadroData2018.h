@@ -21,6 +21,16 @@
           data and extrapolations, and INC model results from Mashnik et al.
           for h+Fe56.
 
+          The splines / grids are built on demand, one channel (data file or
+          group of angular distribution / fraction files) at a time, the
+          first time they are used. If a binary dataset (see ginuke2bin) is
+          found in the data directory, channels are read from it instead of
+          the text files; each record is checked against its MD5 digest and
+          the size / modification time of the text files it was made from,
+          and the text files are used if either check fails.
+          Channels may be first used concurrently from several threads: each
+          one is loaded exactly once and the loading is serialised.
+
 \author   Costas Andreopoulos <c.andreopoulos \at cern.ch>, Rutherford Lab.
           Steve Dytman <dytman+@pitt.edu>, Pittsburgh Univ.
 	  Aaron Meyer <asm58@pitt.edu>, Pittsburgh Univ.
@@ -38,6 +48,10 @@
 #ifndef _INTRANUKE_HADRON_CROSS_SECTIONS_2018_H_
 #define _INTRANUKE_HADRON_CROSS_SECTIONS_2018_H_
 
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "Physics/HadronTransport/INukeHadroFates2018.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Numerical/BLI2D.h"
@@ -68,79 +82,87 @@ public:
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // hN mode hadron x-section splines
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  const Spline * XSecPipn_Tot     (void) const { return fXSecPipn_Tot;     }
-  const Spline * XSecPipn_CEx     (void) const { return fXSecPipn_CEx;     }
-  const Spline * XSecPipn_Elas    (void) const { return fXSecPipn_Elas;    }
-  const Spline * XSecPipn_Reac    (void) const { return fXSecPipn_Reac;    }
-  const Spline * XSecPipp_Tot     (void) const { return fXSecPipp_Tot;     }
-  const Spline * XSecPipp_CEx     (void) const { return fXSecPipp_CEx;     }
-  const Spline * XSecPipp_Elas    (void) const { return fXSecPipp_Elas;    }
-  const Spline * XSecPipp_Reac    (void) const { return fXSecPipp_Reac;    }
-  const Spline * XSecPipp_Abs     (void) const { return fXSecPipd_Abs;     }
-  const Spline * XSecPi0n_Tot     (void) const { return fXSecPi0n_Tot;     }
-  const Spline * XSecPi0n_CEx     (void) const { return fXSecPi0n_CEx;     }
-  const Spline * XSecPi0n_Elas    (void) const { return fXSecPi0n_Elas;    }
-  const Spline * XSecPi0n_Reac    (void) const { return fXSecPi0n_Reac;    }
-  const Spline * XSecPi0p_Tot     (void) const { return fXSecPi0p_Tot;     }
-  const Spline * XSecPi0p_CEx     (void) const { return fXSecPi0p_CEx;     }
-  const Spline * XSecPi0p_Elas    (void) const { return fXSecPi0p_Elas;    }
-  const Spline * XSecPi0p_Reac    (void) const { return fXSecPi0p_Reac;    }
-  const Spline * XSecPi0p_Abs     (void) const { return fXSecPi0d_Abs;     }
-  const Spline * XSecPp_Tot       (void) const { return fXSecPp_Tot;       }
-  const Spline * XSecPp_Elas      (void) const { return fXSecPp_Elas;      }
-  const Spline * XSecPp_Reac      (void) const { return fXSecPp_Reac;      }
-  const Spline * XSecPn_Tot       (void) const { return fXSecPn_Tot;       }
-  const Spline * XSecPn_Elas      (void) const { return fXSecPn_Elas;      }
-  const Spline * XSecPn_Reac      (void) const { return fXSecPn_Reac;      }
-  const Spline * XSecNn_Tot       (void) const { return fXSecNn_Tot;       }
-  const Spline * XSecNn_Elas      (void) const { return fXSecNn_Elas;      }
-  const Spline * XSecNn_Reac      (void) const { return fXSecNn_Reac;      }
-  const Spline * XSecKpn_Elas     (void) const { return fXSecKpn_Elas;     }
-  const Spline * XSecKpn_CEx      (void) const { return fXSecKpn_CEx;      }
-  const Spline * XSecKpp_Elas     (void) const { return fXSecKpp_Elas;     }
-  const Spline * XSecKpN_Abs      (void) const { return fXSecKpN_Abs;      } //not implemented
-  const Spline * XSecKpN_Tot      (void) const { return fXSecKpN_Tot;      }
-  const Spline * XSecGamp_fs      (void) const { return fXSecGamp_fs;      }
-  const Spline * XSecGamn_fs      (void) const { return fXSecGamn_fs;      }
-  const Spline * XSecGamN_Tot     (void) const { return fXSecGamN_Tot;     }
+  const Spline * XSecPipn_Tot     (void) const { this->Load(kIHDPipN); return fXSecPipn_Tot; }
+  const Spline * XSecPipn_CEx     (void) const { this->Load(kIHDPipN); return fXSecPipn_CEx; }
+  const Spline * XSecPipn_Elas    (void) const { this->Load(kIHDPipN); return fXSecPipn_Elas; }
+  const Spline * XSecPipn_Reac    (void) const { this->Load(kIHDPipN); return fXSecPipn_Reac; }
+  const Spline * XSecPipp_Tot     (void) const { this->Load(kIHDPipN); return fXSecPipp_Tot; }
+  const Spline * XSecPipp_CEx     (void) const { this->Load(kIHDPipN); return fXSecPipp_CEx; }
+  const Spline * XSecPipp_Elas    (void) const { this->Load(kIHDPipN); return fXSecPipp_Elas; }
+  const Spline * XSecPipp_Reac    (void) const { this->Load(kIHDPipN); return fXSecPipp_Reac; }
+  const Spline * XSecPipp_Abs     (void) const { this->Load(kIHDPipN); return fXSecPipd_Abs; }
+  const Spline * XSecPi0n_Tot     (void) const { this->Load(kIHDPi0N); return fXSecPi0n_Tot; }
+  const Spline * XSecPi0n_CEx     (void) const { this->Load(kIHDPi0N); return fXSecPi0n_CEx; }
+  const Spline * XSecPi0n_Elas    (void) const { this->Load(kIHDPi0N); return fXSecPi0n_Elas; }
+  const Spline * XSecPi0n_Reac    (void) const { this->Load(kIHDPi0N); return fXSecPi0n_Reac; }
+  const Spline * XSecPi0p_Tot     (void) const { this->Load(kIHDPi0N); return fXSecPi0p_Tot; }
+  const Spline * XSecPi0p_CEx     (void) const { this->Load(kIHDPi0N); return fXSecPi0p_CEx; }
+  const Spline * XSecPi0p_Elas    (void) const { this->Load(kIHDPi0N); return fXSecPi0p_Elas; }
+  const Spline * XSecPi0p_Reac    (void) const { this->Load(kIHDPi0N); return fXSecPi0p_Reac; }
+  const Spline * XSecPi0p_Abs     (void) const { this->Load(kIHDPi0N); return fXSecPi0d_Abs; }
+  const Spline * XSecPp_Tot       (void) const { this->Load(kIHDNN); return fXSecPp_Tot; }
+  const Spline * XSecPp_Elas      (void) const { this->Load(kIHDNN); return fXSecPp_Elas; }
+  const Spline * XSecPp_Reac      (void) const { this->Load(kIHDNN); return fXSecPp_Reac; }
+  const Spline * XSecPn_Tot       (void) const { this->Load(kIHDNN); return fXSecPn_Tot; }
+  const Spline * XSecPn_Elas      (void) const { this->Load(kIHDNN); return fXSecPn_Elas; }
+  const Spline * XSecPn_Reac      (void) const { this->Load(kIHDNN); return fXSecPn_Reac; }
+  const Spline * XSecNn_Tot       (void) const { this->Load(kIHDNN); return fXSecNn_Tot; }
+  const Spline * XSecNn_Elas      (void) const { this->Load(kIHDNN); return fXSecNn_Elas; }
+  const Spline * XSecNn_Reac      (void) const { this->Load(kIHDNN); return fXSecNn_Reac; }
+  const Spline * XSecKpn_Elas     (void) const { this->Load(kIHDKN); return fXSecKpn_Elas; }
+  const Spline * XSecKpn_CEx      (void) const { this->Load(kIHDKN); return fXSecKpn_CEx; }
+  const Spline * XSecKpp_Elas     (void) const { this->Load(kIHDKN); return fXSecKpp_Elas; }
+  const Spline * XSecKpN_Abs      (void) const { this->Load(kIHDKN); return fXSecKpN_Abs; } //not implemented
+  const Spline * XSecKpN_Tot      (void) const { this->Load(kIHDKN); return fXSecKpN_Tot; }
+  const Spline * XSecGamp_fs      (void) const { this->Load(kIHDGamN); return fXSecGamp_fs; }
+  const Spline * XSecGamn_fs      (void) const { this->Load(kIHDGamN); return fXSecGamn_fs; }
+  const Spline * XSecGamN_Tot     (void) const { this->Load(kIHDGamN); return fXSecGamN_Tot; }
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // hA mode hadron x-section splines
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  const Spline * FracPA_Tot       (void) const { return fFracPA_Tot;       }
-  const Spline * FracPA_Elas      (void) const { return fFracPA_Elas;      }
-  const Spline * FracPA_Inel      (void) const { return fFracPA_Inel;      }
-  const Spline * FracPA_CEx       (void) const { return fFracPA_CEx;       }
-  const Spline * FracPA_Abs       (void) const { return fFracPA_Abs;       }
-  const Spline * FracPA_PiPro     (void) const { return fFracPA_PiPro;     }
-  const Spline * FracNA_Tot       (void) const { return fFracNA_Tot;       }
-  const Spline * FracNA_Elas      (void) const { return fFracNA_Elas;      }
-  const Spline * FracNA_Inel      (void) const { return fFracNA_Inel;      }
-  const Spline * FracNA_CEx       (void) const { return fFracNA_CEx;       }
-  const Spline * FracNA_Abs       (void) const { return fFracNA_Abs;       }
-  const Spline * FracNA_PiPro     (void) const { return fFracNA_PiPro;     }
-  const Spline * FracKA_Tot       (void) const { return fFracKA_Tot;       }
-  const Spline * FracKA_Elas      (void) const { return fFracKA_Elas;      }
-  const Spline * FracKA_Inel      (void) const { return fFracKA_Inel;      }
-  const Spline * FracKA_CEx       (void) const { return fFracKA_CEx;       }
-  const Spline * FracKA_Abs       (void) const { return fFracKA_Abs;       }
-
-  const Spline * FracPA_Cmp       (void) const { return fFracPA_Cmp;      }
-  const Spline * FracNA_Cmp       (void) const { return fFracNA_Cmp;      } //suarez
-
-
-  const BLI2DNonUnifGrid * hN2dXSecPP_Elas          (void) const { return fhN2dXSecPP_Elas;          }
-  const BLI2DNonUnifGrid * hN2dXSecNP_Elas          (void) const { return fhN2dXSecNP_Elas;          }
-  const BLI2DNonUnifGrid * hN2dXSecPipN_Elas        (void) const { return fhN2dXSecPipN_Elas;        }
-  const BLI2DNonUnifGrid * hN2dXSecPi0N_Elas        (void) const { return fhN2dXSecPi0N_Elas;        }
-  const BLI2DNonUnifGrid * hN2dXSecPimN_Elas        (void) const { return fhN2dXSecPimN_Elas;        }
-  const BLI2DNonUnifGrid * hN2dXSecKpN_Elas         (void) const { return fhN2dXSecKpN_Elas;         }
-  const BLI2DNonUnifGrid * hN2dXSecKpP_Elas         (void) const { return fhN2dXSecKpP_Elas;         }
-  const BLI2DNonUnifGrid * hN2dXSecPiN_CEx          (void) const { return fhN2dXSecPiN_CEx;          }
-  const BLI2DNonUnifGrid * hN2dXSecPiN_Abs          (void) const { return fhN2dXSecPiN_Abs;          }
-  const BLI2DNonUnifGrid * hN2dXSecGamPi0P_Inelas   (void) const { return fhN2dXSecGamPi0P_Inelas;   }
-  const BLI2DNonUnifGrid * hN2dXSecGamPi0N_Inelas   (void) const { return fhN2dXSecGamPi0N_Inelas;   }
-  const BLI2DNonUnifGrid * hN2dXSecGamPipN_Inelas   (void) const { return fhN2dXSecGamPipN_Inelas;   }
-  const BLI2DNonUnifGrid * hN2dXSecGamPimP_Inelas   (void) const { return fhN2dXSecGamPimP_Inelas;   }
+  const Spline * FracPA_Tot       (void) const { this->Load(kIHDNA); return fFracPA_Tot; }
+  const Spline * FracPA_Elas      (void) const { this->Load(kIHDNA); return fFracPA_Elas; }
+  const Spline * FracPA_Inel      (void) const { this->Load(kIHDNA); return fFracPA_Inel; }
+  const Spline * FracPA_CEx       (void) const { this->Load(kIHDNA); return fFracPA_CEx; }
+  const Spline * FracPA_Abs       (void) const { this->Load(kIHDNA); return fFracPA_Abs; }
+  const Spline * FracPA_PiPro     (void) const { this->Load(kIHDNA); return fFracPA_PiPro; }
+  const Spline * FracNA_Tot       (void) const { this->Load(kIHDNA); return fFracNA_Tot; }
+  const Spline * FracNA_Elas      (void) const { this->Load(kIHDNA); return fFracNA_Elas; }
+  const Spline * FracNA_Inel      (void) const { this->Load(kIHDNA); return fFracNA_Inel; }
+  const Spline * FracNA_CEx       (void) const { this->Load(kIHDNA); return fFracNA_CEx; }
+  const Spline * FracNA_Abs       (void) const { this->Load(kIHDNA); return fFracNA_Abs; }
+  const Spline * FracNA_PiPro     (void) const { this->Load(kIHDNA); return fFracNA_PiPro; }
+  const Spline * FracKA_Tot       (void) const { this->Load(kIHDKA); return fFracKA_Tot; }
+  const Spline * FracKA_Elas      (void) const { this->Load(kIHDKA); return fFracKA_Elas; }
+  const Spline * FracKA_Inel      (void) const { this->Load(kIHDKA); return fFracKA_Inel; }
+  const Spline * FracKA_CEx       (void) const { this->Load(kIHDKA); return fFracKA_CEx; }
+  const Spline * FracKA_Abs       (void) const { this->Load(kIHDKA); return fFracKA_Abs; }
+
+  const Spline * FracPA_Cmp       (void) const { this->Load(kIHDNA); return fFracPA_Cmp; }
+  const Spline * FracNA_Cmp       (void) const { this->Load(kIHDNA); return fFracNA_Cmp; } //suarez
+
+
+  const BLI2DNonUnifGrid * hN2dXSecPP_Elas          (void) const { this->Load(kIHDhNPPElas); return fhN2dXSecPP_Elas; }
+  const BLI2DNonUnifGrid * hN2dXSecNP_Elas          (void) const { this->Load(kIHDhNNPElas); return fhN2dXSecNP_Elas; }
+  const BLI2DNonUnifGrid * hN2dXSecPipN_Elas        (void) const { this->Load(kIHDhNPipNElas); return fhN2dXSecPipN_Elas; }
+  const BLI2DNonUnifGrid * hN2dXSecPi0N_Elas        (void) const { this->Load(kIHDhNPi0NElas); return fhN2dXSecPi0N_Elas; }
+  const BLI2DNonUnifGrid * hN2dXSecPimN_Elas        (void) const { this->Load(kIHDhNPimNElas); return fhN2dXSecPimN_Elas; }
+  const BLI2DNonUnifGrid * hN2dXSecKpN_Elas         (void) const { this->Load(kIHDhNKpNElas); return fhN2dXSecKpN_Elas; }
+  const BLI2DNonUnifGrid * hN2dXSecKpP_Elas         (void) const { this->Load(kIHDhNKpPElas); return fhN2dXSecKpP_Elas; }
+  const BLI2DNonUnifGrid * hN2dXSecKpN_CEx          (void) const { this->Load(kIHDhNKpNCEx); return fhN2dXSecKpN_CEx; }
+  const BLI2DNonUnifGrid * hN2dXSecPiN_CEx          (void) const { this->Load(kIHDhNPiNCEx); return fhN2dXSecPiN_CEx; }
+  const BLI2DNonUnifGrid * hN2dXSecPiN_Abs          (void) const { this->Load(kIHDhNPiNAbs); return fhN2dXSecPiN_Abs; }
+  const BLI2DNonUnifGrid * hN2dXSecGamPi0P_Inelas   (void) const { this->Load(kIHDhNGamPi0PInelas); return fhN2dXSecGamPi0P_Inelas; }
+  const BLI2DNonUnifGrid * hN2dXSecGamPi0N_Inelas   (void) const { this->Load(kIHDhNGamPi0NInelas); return fhN2dXSecGamPi0N_Inelas; }
+  const BLI2DNonUnifGrid * hN2dXSecGamPipN_Inelas   (void) const { this->Load(kIHDhNGamPipNInelas); return fhN2dXSecGamPipN_Inelas; }
+  const BLI2DNonUnifGrid * hN2dXSecGamPimP_Inelas   (void) const { this->Load(kIHDhNGamPimPInelas); return fhN2dXSecGamPimP_Inelas; }
+
+  //! Write all the hadron data, read from the text / ntuple files, in a
+  //! single binary dataset (see ginuke2bin)
+  bool WriteBinaryDataset (string filename) const;
+
+  //! Name of the binary dataset looked for in the data directory
+  static string BinaryDatasetName (void) { return "intranuke-hadro-data-2018.bin"; }
 
   static double fMinKinEnergy;   ///<
   static double fMaxKinEnergyHA; ///<
@@ -151,11 +173,69 @@ private:
   INukeHadroData2018(const INukeHadroData2018 & shx);
  ~INukeHadroData2018();
 
-  void LoadCrossSections(void);
+  // The hadron data are split in 'channels', each materialised (read and
+  // turned into splines / grids) on first use only
+  typedef enum EINukeHDChannel {
+    kIHDNN = 0,            ///< NN x-sections
+    kIHDPipN,              ///< pi+N x-sections
+    kIHDPi0N,              ///< pi0N x-sections
+    kIHDNA,                ///< NA x-section fractions
+    kIHDKA,                ///< KA x-section fractions
+    kIHDGamN,              ///< gamma N x-sections
+    kIHDKN,                ///< K+N x-sections
+    kIHDhNPPElas,          ///< hN angular distributions
+    kIHDhNNPElas,          ///<
+    kIHDhNPipNElas,        ///<
+    kIHDhNPi0NElas,        ///<
+    kIHDhNPimNElas,        ///<
+    kIHDhNKpNElas,         ///<
+    kIHDhNKpNCEx,          ///<
+    kIHDhNKpPElas,         ///<
+    kIHDhNPiNCEx,          ///<
+    kIHDhNPiNAbs,          ///<
+    kIHDhNGamPi0PInelas,   ///<
+    kIHDhNGamPi0NInelas,   ///<
+    kIHDhNGamPipNInelas,   ///<
+    kIHDhNGamPimPInelas,   ///<
+    kIHDPipAAbs,           ///< pi+A x-section fractions vs A
+    kIHDPipACEx,           ///<
+    kIHDPipAInelas,        ///<
+    kIHDPipAPiPro,         ///<
+    kNIHDChannels
+  } INukeHDChannel_t;
+
+  // Raw data of a channel, as named columns of values, and the files
+  // they were read from
+  struct ChannelTable {
+    std::vector<string>                names;
+    std::vector< std::vector<double> > columns;
+    std::vector<string>                sources;
+    const std::vector<double> & Column (string name) const;
+  };
+
+  void Load (INukeHDChannel_t ch) const {
+    std::call_once(fLoadOnce[ch], &INukeHadroData2018::LoadChannel,
+                   const_cast<INukeHadroData2018 *>(this), ch);
+  }
+  void LoadChannel          (INukeHDChannel_t ch);
+  void BuildChannel         (INukeHDChannel_t ch, const ChannelTable & table);
+  void ReadTextChannel      (INukeHDChannel_t ch, ChannelTable & table) const;
+  void ReadTextTable        (string filename, string descriptor, ChannelTable & table) const;
+  void ReadhNFiles          (string prefix, string suffix, const double * energies,
+                             int nfiles, int npoints, int cols, ChannelTable & table) const;
+  void ReadADepFiles        (string prefix, string suffix, const int * nuclei,
+                             int nfiles, ChannelTable & table) const;
+  bool OpenBinaryDataset    (string filename);
+  bool ReadBinaryChannel    (INukeHDChannel_t ch, ChannelTable & table) const;
+  void LoadhNTotXSec        (int hpdgc) const;
+
+  static Spline *           TableSpline  (const ChannelTable & table, string column);
+  static BLI2DNonUnifGrid * TableGrid    (const ChannelTable & table);
+  static TGraph2D *         TableGraph2D (const ChannelTable & table, string name);
 
   void ReadhNFile(
          string filename, double ke, int npoints, int & curr_point,
-         /*double * ke_array,*/ double * costh_array, double * xsec_array, int cols);
+         /*double * ke_array,*/ double * costh_array, double * xsec_array, int cols) const;
 
   static INukeHadroData2018 * fInstance;
 
@@ -240,6 +320,13 @@ private:
   BLI2DNonUnifGrid * fhN2dXSecGamPipN_Inelas;
   BLI2DNonUnifGrid * fhN2dXSecGamPimP_Inelas;
 
+  string fDataDir;                             ///< directory with the text / ntuple files
+  mutable std::once_flag fLoadOnce[kNIHDChannels]; ///< materialise each channel once
+  string fBinaryDataset;                      ///< binary dataset (empty if not used)
+  std::vector<long long> fBinaryOffset;       ///< channel record offsets in the binary dataset
+  std::vector<long long> fBinarySize;         ///< channel record sizes
+  std::vector<string>    fBinaryDigest;       ///< channel record MD5 digests
+
   //-- Sinleton cleaner
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
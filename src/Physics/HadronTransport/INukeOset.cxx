@@ -11,11 +11,23 @@ INukeOset :: INukeOset () : fNuclearDensity (-1.0), fPionKineticEnergy (-1.0)
 }
 
 void INukeOset :: setCrossSections (const int &pionPDG, const double &protonFraction)
-{  
+{
+  averageCrossSections (fQelCrossSections, fCexCrossSections, fAbsorptionCrossSection,
+                        pionPDG, protonFraction, fTotalCrossSection, fCexCrossSection);
+}
+
+void INukeOset :: averageCrossSections (const double *qelCrossSections,
+                                        const double *cexCrossSections,
+                                        const double &absorptionCrossSection,
+                                        const int &pionPDG,
+                                        const double &protonFraction,
+                                        double &totalCrossSection,
+                                        double &cexCrossSection)
+{
   if (pionPDG == kPdgPi0)
   {
-      fCexCrossSection = fCexCrossSections[2];
-    fTotalCrossSection = fQelCrossSections[2] + fAbsorptionCrossSection;
+      cexCrossSection = cexCrossSections[2];
+    totalCrossSection = qelCrossSections[2] + absorptionCrossSection;
   }
   else
   {
@@ -24,10 +36,10 @@ void INukeOset :: setCrossSections (const int &pionPDG, const double &protonFrac
     const int channelIndexOnNeutron = (pionPDG == kPdgPiM); // 0 = pi+, 1 = pi-
 
     // total xsec = (Z * xsec_proton + (A-Z) * xsec_neutron) / A
-    fCexCrossSection = protonFraction * fCexCrossSections[channelIndexOnProton] +
-                       (1.0 - protonFraction) * fCexCrossSections[channelIndexOnNeutron];
+    cexCrossSection = protonFraction * cexCrossSections[channelIndexOnProton] +
+                      (1.0 - protonFraction) * cexCrossSections[channelIndexOnNeutron];
 
-    fTotalCrossSection = protonFraction * fQelCrossSections[channelIndexOnProton] +
-                        (1.0 - protonFraction) * fQelCrossSections[channelIndexOnNeutron] + fAbsorptionCrossSection;
+    totalCrossSection = protonFraction * qelCrossSections[channelIndexOnProton] +
+                       (1.0 - protonFraction) * qelCrossSections[channelIndexOnNeutron] + absorptionCrossSection;
   }
-}  
+}
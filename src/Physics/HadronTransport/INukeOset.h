@@ -49,16 +49,16 @@ class INukeOset
     return fAbsorptionCrossSection;
   }
   
-  //! return fraction of cex events
+  //! return fraction of cex events (0 if total cross section vanishes)
   inline double getCexFraction () const
   {
-    return fCexCrossSection / fTotalCrossSection;
+    return fTotalCrossSection > 0 ? fCexCrossSection / fTotalCrossSection : 0;
   }
   
-  //! return fraction of absorption events
+  //! return fraction of absorption events (0 if total cross section vanishes)
   inline double getAbsorptionFraction () const
   {
-    return fAbsorptionCrossSection / fTotalCrossSection;
+    return fTotalCrossSection > 0 ? fAbsorptionCrossSection / fTotalCrossSection : 0;
   }
 
   protected:
@@ -90,6 +90,15 @@ class INukeOset
   //! calculate avg cross sections according to proton / neutron fraction
   void setCrossSections (const int &pionPDG,
                          const double &protonFraction);
+
+  //! average channel cross sections according to proton / neutron fraction
+  static void averageCrossSections (const double *qelCrossSections,
+                                    const double *cexCrossSections,
+                                    const double &absorptionCrossSection,
+                                    const int &pionPDG,
+                                    const double &protonFraction,
+                                    double &totalCrossSection,
+                                    double &cexCrossSection);
 };
 
 namespace osetUtils
@@ -2,14 +2,43 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <cstdio>
+#include <stdint.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "INukeOsetTable.h"
 
 using namespace osetUtils;
 
-//! load tables from file and check its integrity
+namespace
+{
+  // binary cache: magic, version, text file size and modification time,
+  // grid, values, and the number of values again as a trailer
+  const char     kBinaryMagic[8] = {'G','O','S','E','T','B','I','N'};
+  const uint32_t kBinaryVersion  = 1;
+
+  // size and modification time of the text file the binary cache was made from
+  bool sourceStamp (const std::string &file, int64_t &size, int64_t &mtime)
+  {
+    struct stat info;
+    if (stat (file.c_str(), &info) != 0) return false;
+    size  = info.st_size;
+    mtime = info.st_mtime;
+    return true;
+  }
+}
+
+//! load tables from binary cache or from file (and check its integrity)
+/*! the binary cache (filename + ".bin") is used if it was made from the current
+ *  version of the text file; otherwise the text file is parsed and the cache
+ *  is (re)written, if the directory is writable
+ */
 INukeOsetTable :: INukeOsetTable (const char *filename) : fNDensityBins (0), fNEnergyBins (0), 
                                                           fDensityBinWidth (0.0), fEnergyBinWidth (0.0)
 {
+  const std::string binaryFile = std::string (filename) + ".bin";
+  if (readBinary (binaryFile, filename)) return;
+
   // open file with Oset table
   std::ifstream fileWithTables (filename);
   // check if file is open
@@ -30,8 +59,11 @@ INukeOsetTable :: INukeOsetTable (const char *filename) : fNDensityBins (0), fNE
   // reset counter (in the case other file will be loaded)
   checkIntegrity (-1.0, -1.0);
 
-  fDensityHandler.setHandler (fDensityBinWidth, fNDensityBins);
-  fEnergyHandler.setHandler  (fEnergyBinWidth,  fNEnergyBins);
+  // the last point read is not a point cross sections were set up for
+  fNuclearDensity    = -1.0;
+  fPionKineticEnergy = -1.0;
+
+  writeBinary (binaryFile, filename);
 }
 
 // process single line from table file, push values to proper vector
@@ -57,21 +89,14 @@ int INukeOsetTable :: processLine (const std::string &line)
   if (int exitCode = checkIntegrity (currentDensityValue, currentEnergyValue))
     return exitCode; // stop in the case of error (exit code != 0)
 
-  for (unsigned int i = 0; i < fNChannels; i++) // channel loop
+  // save qel and cex cross sections for each channel and absorption cross
+  // section, in the order they are read
+  for (unsigned int i = 0; i < fNValues; i++)
   {
-    // get qel and cex cross sections for i-th channel
-    double xsecQel, xsecCex;
-    splitLine >> xsecQel >> xsecCex;
-    // save them in proper vector
-    fQelCrossSectionTable[i].push_back (xsecQel);
-    fCexCrossSectionTable[i].push_back (xsecCex);
-  } // channel loop
-
-  // get absorption cross section
-  double absorption;
-  splitLine >> absorption;
-  // save it in proper vector
-  fAbsorptionCrossSectionTable.push_back (absorption);
+    double value;
+    splitLine >> value;
+    fCrossSectionTable.push_back (value);
+  }
 
   return 0; // no errors
 }
@@ -155,85 +180,158 @@ void INukeOsetTable :: badFile (const char* file, const int &errorCode, const in
   exit(errorCode);
 }
 
+//! read tables from binary cache; return false if it is missing or out of date
+bool INukeOsetTable :: readBinary (const std::string &binaryFile, const std::string &textFile)
+{
+  int64_t textSize, textTime;
+  if (not sourceStamp (textFile, textSize, textTime)) return false;
+
+  std::ifstream in (binaryFile.c_str(), std::ios::binary);
+  if (not in.is_open()) return false;
+
+  char magic[8];
+  uint32_t version, nDensityBins, nEnergyBins;
+  int64_t size, time;
+  double densityBinWidth, energyBinWidth;
+  uint64_t nValues;
+
+  in.read (magic, sizeof (magic));
+  in.read ((char*) &version,         sizeof (version));
+  in.read ((char*) &size,            sizeof (size));
+  in.read ((char*) &time,            sizeof (time));
+  in.read ((char*) &nDensityBins,    sizeof (nDensityBins));
+  in.read ((char*) &nEnergyBins,     sizeof (nEnergyBins));
+  in.read ((char*) &densityBinWidth, sizeof (densityBinWidth));
+  in.read ((char*) &energyBinWidth,  sizeof (energyBinWidth));
+  in.read ((char*) &nValues,         sizeof (nValues));
+
+  if (not in or not std::equal (magic, magic + 8, kBinaryMagic)) return false;
+  if (version != kBinaryVersion or size != textSize or time != textTime) return false;
+  if (nDensityBins < 2 or nEnergyBins < 2) return false;
+  if (nValues != (uint64_t) nDensityBins * nEnergyBins * fNValues) return false;
+
+  std::vector <double> table (nValues);
+  in.read ((char*) &table[0], nValues * sizeof (double));
+
+  uint64_t trailer = 0;
+  in.read ((char*) &trailer, sizeof (trailer));
+  if (not in or trailer != nValues) return false;
+
+  fCrossSectionTable.swap (table);
+  fNDensityBins    = nDensityBins;
+  fNEnergyBins     = nEnergyBins;
+  fDensityBinWidth = densityBinWidth;
+  fEnergyBinWidth  = energyBinWidth;
+
+  return true;
+}
+
+//! write tables to binary cache (skipped silently if the file can not be written)
+void INukeOsetTable :: writeBinary (const std::string &binaryFile, const std::string &textFile) const
+{
+  int64_t size, time;
+  if (not sourceStamp (textFile, size, time)) return;
+
+  // write a temporary file and rename it, so that concurrent jobs never
+  // read a partially written cache
+  std::ostringstream tmpName;
+  tmpName << binaryFile << ".tmp" << getpid();
+  const std::string tmpFile = tmpName.str();
+
+  std::ofstream out (tmpFile.c_str(), std::ios::binary);
+  if (not out.is_open()) return;
+
+  uint32_t nDensityBins = fNDensityBins;
+  uint32_t nEnergyBins  = fNEnergyBins;
+  uint64_t nValues      = fCrossSectionTable.size();
+
+  out.write (kBinaryMagic, sizeof (kBinaryMagic));
+  out.write ((const char*) &kBinaryVersion,   sizeof (kBinaryVersion));
+  out.write ((const char*) &size,             sizeof (size));
+  out.write ((const char*) &time,             sizeof (time));
+  out.write ((const char*) &nDensityBins,     sizeof (nDensityBins));
+  out.write ((const char*) &nEnergyBins,      sizeof (nEnergyBins));
+  out.write ((const char*) &fDensityBinWidth, sizeof (fDensityBinWidth));
+  out.write ((const char*) &fEnergyBinWidth,  sizeof (fEnergyBinWidth));
+  out.write ((const char*) &nValues,          sizeof (nValues));
+  out.write ((const char*) &fCrossSectionTable[0], nValues * sizeof (double));
+  out.write ((const char*) &nValues,          sizeof (nValues));
+  out.close();
+
+  if (not out or std::rename (tmpFile.c_str(), binaryFile.c_str()) != 0)
+    std::remove (tmpFile.c_str());
+}
+
+//! set up table index and weight of high boundary for given point
+/*! values outside the table are moved to its edge */
+void INukeOsetTable :: gridPoint (const double &value, const double &binWidth,
+                                  const unsigned int &nBins,
+                                  unsigned int &index, double &highWeight)
+{
+  const double position = value / binWidth;
+
+  if (not (position > 0.0)) // also catches NaN
+  {
+    index      = 0;
+    highWeight = 0.0;
+  }
+  else if (position >= nBins - 1)
+  {
+    index      = nBins - 2;
+    highWeight = 1.0;
+  }
+  else
+  {
+    index      = (unsigned int) position;
+    highWeight = position - index;
+  }
+}
+
 //! make bilinear interpolation between four points around (density, energy)
-double INukeOsetTable :: interpolate (const std::vector<double> &data) const
+/*! all cross sections are interpolated in one pass, with the same weights */
+void INukeOsetTable :: interpolate (const double &density, const double &pionTk,
+                                    double *values) const
 {
   // take four points adjacent to (density, energy) = (d,E):
   // (d0, E0), (d1, E0), (d0, E1), (d1, E1)
   // where d0 < d < d1, E0 < E < E1
   // each point goes in with weight = proper distance
 
-  // total bin width for normalization
-  static const double totalBinWidth = fDensityBinWidth * fEnergyBinWidth;
-  
-  // extract low boundary value from table
-  double lowValue = data[fEnergyHandler.index +
-                         fDensityHandler.index * fNEnergyBins]; // (d0, E0)
-  // high boundaries = low boundary if on edge
-  double highDensityValue = lowValue; // (d1, E0)
-  double highEnergyValue  = lowValue; // (d0, E1)
-  double highValue        = lowValue; // (d1, E1)
-
-  // extract high boundaries values from table (if not on edge)
-  if (not fDensityHandler.isEdge)
-  {
-    highDensityValue = data[fEnergyHandler.index +
-                            (fDensityHandler.index + 1) * fNEnergyBins];
+  unsigned int densityIndex, energyIndex;
+  double densityWeight, energyWeight;
 
-    if (not fEnergyHandler.isEdge)
-    {
-      highEnergyValue = data[fEnergyHandler.index + 1 +
-                             fDensityHandler.index * fNEnergyBins];
-      highValue       = data[fEnergyHandler.index + 1 +
-                             (fDensityHandler.index + 1) * fNEnergyBins];
-    }
-  }
-  else if (not fEnergyHandler.isEdge)
-    highEnergyValue = data[fEnergyHandler.index + 1 +
-                           fDensityHandler.index * fNEnergyBins];
-
-  lowValue         *= fDensityHandler.lowWeight  * fEnergyHandler.lowWeight;
-  highDensityValue *= fDensityHandler.highWeight * fEnergyHandler.lowWeight;
-  highEnergyValue  *= fDensityHandler.lowWeight  * fEnergyHandler.highWeight;
-  highValue        *= fDensityHandler.highWeight * fEnergyHandler.highWeight;
-  
-  return (lowValue + highDensityValue + highEnergyValue + highValue) /
-          totalBinWidth;
-}
+  gridPoint (density, fDensityBinWidth, fNDensityBins, densityIndex, densityWeight);
+  gridPoint (pionTk,  fEnergyBinWidth,  fNEnergyBins,  energyIndex,  energyWeight);
 
-//! set up table index and weights for given point
-void INukeOsetTable :: PointHandler :: update (const double &newValue)
-{
-  value = newValue;         // update value
-  index = value / binWidth; // update index
+  const double w00 = (1.0 - densityWeight) * (1.0 - energyWeight); // (d0, E0)
+  const double w10 =        densityWeight  * (1.0 - energyWeight); // (d1, E0)
+  const double w01 = (1.0 - densityWeight) *        energyWeight;  // (d0, E1)
+  const double w11 =        densityWeight  *        energyWeight;  // (d1, E1)
 
-  // in the case value > max value use max; check if it is on edge
-  if (index >= nBins - 1)
-  {
-    index  = nBins - 1;
-    isEdge = true;
-  }
-  else isEdge = false;
-  // calcualte weights for boundary values
-  lowWeight  = (index + 1) * binWidth - value;
-  highWeight = value - index * binWidth;
-}
+  const double *p00 = &fCrossSectionTable[fNValues * (energyIndex + densityIndex * fNEnergyBins)];
+  const double *p01 = p00 + fNValues;
+  const double *p10 = p00 + fNValues * fNEnergyBins;
+  const double *p11 = p10 + fNValues;
 
+  for (unsigned int i = 0; i < fNValues; i++)
+    values[i] = w00 * p00[i] + w10 * p10[i] + w01 * p01[i] + w11 * p11[i];
+}
 
 /*! <ul>
- *  <li> set up density, pion Tk and their handlers (for interpolation)
- *  <li> get interpolated cross sections
+ *  <li> set up density and pion Tk
+ *  <li> get interpolated cross sections (if density or Tk changed)
  *  <li> set up proper cross section variables
  *  </ul> 
  */ 
 void INukeOsetTable :: setupOset (const double &density, const double &pionTk, const int &pionPDG,
                                   const double &protonFraction)
 {
-  fNuclearDensity    = density;
-  fPionKineticEnergy = pionTk;
-  fDensityHandler.update (fNuclearDensity);    // update density index / weights
-  fEnergyHandler.update  (fPionKineticEnergy); // update energy index / weights
-  setCrossSections();
+  if (density != fNuclearDensity or pionTk != fPionKineticEnergy)
+  {
+    fNuclearDensity    = density;
+    fPionKineticEnergy = pionTk;
+    setCrossSections();
+  }
   INukeOset::setCrossSections (pionPDG, protonFraction);  
 }
 
@@ -242,11 +340,14 @@ void INukeOsetTable :: setupOset (const double &density, const double &pionTk, c
  */ 
 void INukeOsetTable :: setCrossSections ()
 {
+    double values[fNValues];
+    interpolate (fNuclearDensity, fPionKineticEnergy, values);
+
     for (unsigned int i = 0; i < fNChannels; i++) // channel loop
     {
-      fQelCrossSections[i] = interpolate (fQelCrossSectionTable[i]);
-      fCexCrossSections[i] = interpolate (fCexCrossSectionTable[i]);
+      fQelCrossSections[i] = values[2 * i];
+      fCexCrossSections[i] = values[2 * i + 1];
     }
 
-    fAbsorptionCrossSection = interpolate (fAbsorptionCrossSectionTable); 
+    fAbsorptionCrossSection = values[2 * fNChannels]; 
 }
@@ -33,34 +33,30 @@ class INukeOsetTable : public INukeOset
   void setupOset (const double &density, const double &pionTk, const int &pionPDG, const double &protonFraction);
 
   private:
-  
-  //! quasi-elastic piN cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
-   * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
-   */
-  std::vector <double> fQelCrossSectionTable [fNChannels]; 
-  
-  //! charge-exchange piN cross section
-  /*! vector contains values in the following order:
+
+  //! number of values per table point: qel and cex for each channel + absorption
+  static const unsigned int fNValues = 2 * fNChannels + 1;
+
+  //! cross sections on a regular (density, energy) grid
+  /*! vector contains fNValues values per point, for points in the following order:
    * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
+   * values in the following order (the same as in the text file):
+   * qel, cex for channel 0, 1, 2 and absorption \n
    * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
    */
-  std::vector <double> fCexCrossSectionTable [fNChannels];
-  
-  //! pi absorption cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ...
-   */
-  std::vector <double> fAbsorptionCrossSectionTable;
+  std::vector <double> fCrossSectionTable;
 
   unsigned int fNDensityBins; //!< number of denisty bins
   unsigned int fNEnergyBins;  //!< number of energy bins
   double fDensityBinWidth;    //!< density step (must be fixed)
   double fEnergyBinWidth;     //!< energy step (must be fixed)
 
-  //! interpolate cross section (method fixed for Oset tables)
-  double interpolate (const std::vector<double> &data) const;
+  //! interpolate all cross sections at once (method fixed for Oset tables)
+  void interpolate (const double &density, const double &pionTk, double *values) const;
+
+  //! table index of low boundary and weight of high boundary for given value
+  static void gridPoint (const double &value, const double &binWidth, const unsigned int &nBins,
+                         unsigned int &index, double &highWeight);
 
   //! process single line from table file, push values to proper vector (method fixed for Oset tables)
   int processLine (const std::string &line);
@@ -71,34 +67,14 @@ class INukeOsetTable : public INukeOset
   //! stop program and through an error if input file is corrupted (method fixed for Oset tables)
   void badFile (const char* file, const int &errorCode, const int &line = 0) const;
 
+  //! read tables from binary cache (if it exists and matches the text file)
+  bool readBinary  (const std::string &binaryFile, const std::string &textFile);
+
+  //! write tables to binary cache
+  void writeBinary (const std::string &binaryFile, const std::string &textFile) const;
+
   //! calculalte cross sections for each channel
   void setCrossSections ();
-
-  //! handle table's index and weights for given density and energy 
-  struct PointHandler
-  {
-    double value;      //!< exact value as read from table
-    double lowWeight;  //!< distance from high boundary
-    double highWeight; //!< distance from low boundary
-    int index;         //!< point index = index of low boundary
-    double binWidth;   //!< bin width used to calculate distances
-    int nBins;         //!< nBins to check isEdge
-    bool isEdge; //!< true if value is on edge of table (should never happen)
-
-    PointHandler () : value (-1.0) {}; //!< constructor
-
-    //! set up binWidth and nBins
-    inline void setHandler (const double &width, const int &bins)
-    {
-      binWidth = width;
-      nBins    = bins;
-    }
-    
-    void update (const double &newValue); //!< update point if changed
-  };
-
-  PointHandler fDensityHandler; //!< nuclear density handler
-  PointHandler fEnergyHandler;  //!< pion kinetic energy handler
 };
 
 #endif // INUKE_OSET_TABLE_H
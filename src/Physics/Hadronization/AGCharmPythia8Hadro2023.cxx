@@ -77,7 +77,7 @@ void AGCharmPythia8Hadro2023::Initialize(void) const
   gPythia->settings.mode("Random:seed", seed);
   LOG("AGCharmPythia8Hadro2023", pINFO)
     << "PYTHIA8 seed = " << gPythia->settings.mode("Random:seed");
-  gPythia->init();
+  Pythia8Singleton::Instance()->Init();
 
   fOriDecayFlag_pi0       = false;
   fOriDecayFlag_K0        = false;
@@ -33,6 +33,7 @@
 #include <TMath.h>
 #include <TF1.h>
 #include <TROOT.h>
+#include <TRandom.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Algorithm/AlgFactory.h"
@@ -259,18 +260,20 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
   LOG("KNOHad", pINFO) << "Hadron Shower Charge = " << maxQ;
 
    //-- Build the multiplicity probabilities for the input interaction
+  //   (tabulated as a cumulative distribution on the stack, so that no
+  //   histogram needs to be allocated for every hadronic system)
   LOG("KNOHad", pDEBUG) << "Building Multiplicity Probability distribution";
   LOG("KNOHad", pDEBUG) << *interaction;
   Option_t * opt = "+LowMultSuppr+Renormalize";
-  TH1D * mprob = this->MultiplicityProb(interaction,opt);
+  double mcdf[kMaxKNOMultiplicity];
+  int nmult = this->MultiplicityCDF(interaction, opt, mcdf);
 
-  if(!mprob) {
+  if(nmult<=0) {
     LOG("KNOHad", pWARN) << "Null multiplicity probability distribution!";
     return 0;
   }
-  if(mprob->Integral("width")<=0) {
+  if(mcdf[nmult-1]<=0) {
     LOG("KNOHad", pWARN) << "Empty multiplicity probability distribution!";
-    delete mprob;
     return 0;
   }
 
@@ -288,12 +291,11 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
        LOG("KNOHad", pERROR)
          << "Couldn't select hadronic shower particles after: "
          << itry << " attempts!";
-       delete mprob;
        return 0;
     }
 
     //-- Generate a hadronic multiplicity
-    mult = TMath::Nint( mprob->GetRandom() );
+    mult = this->GenerateMultiplicity(mcdf, nmult);
 
     LOG("KNOHad", pINFO) << "Hadron multiplicity  = " << mult;
 
@@ -318,7 +320,6 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
       } else {
         LOG("KNOHad", pWARN)
            << "Generated multiplicity: " << mult << " is too low! Quitting";
-        delete mprob;
         return 0;
       }
     }
@@ -362,8 +363,6 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
 
   } // attempts
 
-  delete mprob;
-
   return pdgcv;
 }
 //____________________________________________________________________________
@@ -381,6 +380,29 @@ TH1D * AGKYLowW2019::MultiplicityProb(
 //    algorithm using the integrated probability reduction as a cross section
 //    section reduction factor then the output histogram should not be re-
 //    normalized after applying the scaling factors.
+// The probabilities are computed by MultiplicityProb(interaction,opt,prob)
+// and are copied to a newly created histogram owned by the caller.
+
+  double prob[kMaxKNOMultiplicity];
+  int nmult = this->MultiplicityProb(interaction, opt, prob);
+  if(nmult<=0) return 0;
+
+  double maxmult = nmult + 1;
+  TH1D * mult_prob = this->CreateMultProbHist(maxmult);
+  for(int i = 0; i < nmult; i++) {
+     mult_prob->SetBinContent(i+1, prob[i]);
+  }
+  return mult_prob;
+}
+//____________________________________________________________________________
+int AGKYLowW2019::MultiplicityProb(
+  const Interaction * interaction, Option_t * opt, double * prob) const
+{
+// Computes the multiplicity probabilities P(n), n = 2,...,maxmult, for the
+// input interaction and stores them in prob[n-2]. The input array must have
+// room for kMaxKNOMultiplicity entries. See MultiplicityProb(interaction,opt)
+// for the meaning of the input option. Returns the number of tabulated
+// multiplicities (maxmult-1), or 0 if no distribution can be computed.
 
   if(!this->AssertValidity(interaction)) {
      LOG("KNOHad", pWARN)
@@ -412,7 +434,7 @@ TH1D * AGKYLowW2019::MultiplicityProb(
   // Set maximum multiplicity so that it does not exceed the max number of
   // particles accepted by the ROOT phase space decayer (18)
   // Change this if ROOT authors remove the TGenPhaseSpace limitation.
-  if(maxmult>18) maxmult=18;
+  if(maxmult>kMaxKNOMultiplicity) maxmult=kMaxKNOMultiplicity;
 
   SLOG("KNOHad", pDEBUG) << "Computed maximum multiplicity = " << maxmult;
 
@@ -421,18 +443,16 @@ TH1D * AGKYLowW2019::MultiplicityProb(
      return 0;
   }
 
-  // Create multiplicity probability histogram
-  TH1D * mult_prob = this->CreateMultProbHist(maxmult);
+  int nmult = TMath::Nint(maxmult) - 1;
+  for(int i = 0; i < nmult; i++) prob[i] = 0.;
 
-  // Compute the multiplicity probabilities values up to the bin corresponding
-  // to the computed maximum multiplicity
+  // Compute the multiplicity probabilities values up to the computed
+  // maximum multiplicity
 
   if(maxmult>2) {
-    int nbins = mult_prob->FindBin(maxmult);
-
-    for(int i = 1; i <= nbins; i++) {
+    for(int i = 0; i < nmult; i++) {
        // KNO distribution is <n>*P(n) vs n/<n>
-       double n    = mult_prob->GetBinCenter(i);  // bin centre
+       double n    = i+2;
        double z    = n/avn;                       // z=n/<n>
        double avnP = this->KNO(nu_pdg,nuc_pdg,z); // <n>*P(n)
        double P    = avnP / avn;                  // P(n)
@@ -441,20 +461,21 @@ TH1D * AGKYLowW2019::MultiplicityProb(
           << "n = " << n << " (n/<n> = " << z
           << ", <n>*P = " << avnP << ") => P = " << P;
 
-       mult_prob->Fill(n,P);
+       prob[i] = P;
     }
   } else {
        SLOG("KNOHad", pDEBUG) << "Fixing multiplicity to 2";
-       mult_prob->Fill(2,1.);
+       prob[0] = 1.;
   }
 
-  double integral = mult_prob->Integral("width");
+  double integral = 0.;
+  for(int i = 0; i < nmult; i++) integral += prob[i];
   if(integral>0) {
     // Normalize the probability distribution
-    mult_prob->Scale(1.0/integral);
+    for(int i = 0; i < nmult; i++) prob[i] *= 1.0/integral;
   } else {
     SLOG("KNOHad", pWARN) << "probability distribution integral = 0";
-    return mult_prob;
+    return nmult;
   }
 
   string option(opt);
@@ -467,7 +488,7 @@ TH1D * AGKYLowW2019::MultiplicityProb(
     SLOG("KNOHad", pINFO) << "Applying NeuGEN scaling factors";
      // Only do so for W<Wcut
      if(W<fWcut) {
-       this->ApplyRijk(interaction, renormalize, mult_prob);
+       this->ApplyRijk(interaction, renormalize, prob, nmult);
      } else {
         SLOG("KNOHad", pDEBUG)
               << "W = " << W << " < Wcut = " << fWcut
@@ -475,7 +496,40 @@ TH1D * AGKYLowW2019::MultiplicityProb(
      }//<wcut?
   }//apply?
 
-  return mult_prob;
+  return nmult;
+}
+//____________________________________________________________________________
+int AGKYLowW2019::MultiplicityCDF(
+  const Interaction * interaction, Option_t * opt, double * cdf) const
+{
+// Same as MultiplicityProb(interaction,opt,prob) but the output array is
+// filled with the (unnormalized) cumulative distribution: cdf[i] = sum of
+// P(n) for n = 2,...,i+2
+
+  int nmult = this->MultiplicityProb(interaction, opt, cdf);
+  for(int i = 1; i < nmult; i++) cdf[i] += cdf[i-1];
+  return nmult;
+}
+//____________________________________________________________________________
+int AGKYLowW2019::GenerateMultiplicity(const double * cdf, int nmult) const
+{
+// Generates a hadronic multiplicity from the cumulative distribution built
+// by MultiplicityCDF().
+// The same (single) random number and the same bin search as TH1::GetRandom()
+// are used, so that the generated multiplicities are identical to the ones
+// obtained by sampling the histogram returned by MultiplicityProb().
+
+  double r    = gRandom->Rndm();
+  double norm = cdf[nmult-1];
+
+  int lo = 0;
+  int hi = nmult-1;
+  while(lo < hi) {
+    int mid = (lo+hi)/2;
+    if(cdf[mid]/norm > r) hi = mid;
+    else                  lo = mid+1;
+  }
+  return lo+2;
 }
 //____________________________________________________________________________
 double AGKYLowW2019::Weight(void) const
@@ -1576,11 +1630,12 @@ TH1D * AGKYLowW2019::CreateMultProbHist(double maxmult) const
 }
 //____________________________________________________________________________
 void AGKYLowW2019::ApplyRijk( const Interaction * interaction,
-                                  bool norm, TH1D * mp ) const
+                         bool norm, double * prob, int nmult ) const
 {
-  // Apply the NEUGEN multiplicity probability scaling factors
+  // Apply the NEUGEN multiplicity probability scaling factors to the
+  // multiplicity probabilities prob[n-2], n = 2,...,nmult+1
   //
-  if(!mp) return;
+  if(!prob) return;
 
   const InitialState & init_state = interaction->InitState();
   int probe_pdg = init_state.ProbePdg();
@@ -1660,29 +1715,31 @@ void AGKYLowW2019::ApplyRijk( const Interaction * interaction,
   // Apply to the multiplicity probability distribution
   //
 
-  int nbins = mp->GetNbinsX();
-  for(int i = 1; i <= nbins; i++) {
-    int n = TMath::Nint( mp->GetBinCenter(i) );
+  for(int i = 0; i < nmult; i++) {
+    int n = i+2;
 
     double R=1;
     if      (n==2) R=R2;
     else if (n==3) R=R3;
 
     if(n==2 || n==3) {
-      double P   = mp->GetBinContent(i);
+      double P   = prob[i];
       double Psc = R*P;
       LOG("Hadronization", pDEBUG)
 	<< "n=" << n << "/ Scaling factor R = "
 	<< R << "/ P " << P << " --> " << Psc;
-      mp->SetBinContent(i, Psc);
+      prob[i] = Psc;
     }
     if(n>3) break;
   }
 
-  // renormalize the histogram?
+  // renormalize the distribution?
   if(norm) {
-    double histo_norm = mp->Integral("width");
-    if(histo_norm>0) mp->Scale(1.0/histo_norm);
+    double norm_sum = 0.;
+    for(int i = 0; i < nmult; i++) norm_sum += prob[i];
+    if(norm_sum>0) {
+      for(int i = 0; i < nmult; i++) prob[i] *= 1.0/norm_sum;
+    }
   }
 }
 //____________________________________________________________________________
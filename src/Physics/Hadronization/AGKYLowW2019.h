@@ -43,6 +43,7 @@
 
 #include <TGenPhaseSpace.h>
 
+#include "Framework/Conventions/Controls.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/Decay/Decayer.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
@@ -71,6 +72,14 @@ public:
   virtual void Configure(const Registry & config);
   virtual void Configure(string config);
 
+  // Hadronic multiplicity probabilities, P(n) for n = 2,...,maxmult.
+  // The array versions fill a caller-provided buffer with room for
+  // controls::kMaxKNOMultiplicity entries and return the number of filled entries.
+  TH1D *         MultiplicityProb      (const Interaction*, Option_t* opt = "")      const;
+  int            MultiplicityProb      (const Interaction*, Option_t* opt, double * prob) const;
+  int            MultiplicityCDF       (const Interaction*, Option_t* opt, double * cdf)  const;
+  int            GenerateMultiplicity  (const double * cdf, int nmult)               const;
+
   friend class KNOTunedQPMDISPXSec ;
 
 private:
@@ -80,7 +89,6 @@ private:
   TClonesArray * Hadronize             (const Interaction* )                         const;
   double         Weight                (void)                                        const;
   PDGCodeList *  SelectParticles       (const Interaction*)                          const;
-  TH1D *         MultiplicityProb      (const Interaction*, Option_t* opt = "")      const;
   bool           AssertValidity        (const Interaction * i)                       const;
   PDGCodeList *  GenerateHadronCodes   (int mult, int maxQ, double W)                const;
   int            GenerateBaryonPdgCode (int mult, int maxQ, double W)                const;
@@ -91,7 +99,7 @@ private:
   double         ReWeightPt2           (const PDGCodeList & pdgcv)                   const;
   double         MaxMult               (const Interaction * i)                       const;
   TH1D *         CreateMultProbHist    (double maxmult)                              const;
-  void           ApplyRijk             (const Interaction * i, bool norm, TH1D * mp) const;
+  void           ApplyRijk             (const Interaction * i, bool norm, double * prob, int nmult) const;
   double         Wmin                  (void)                                        const;
 
   TClonesArray* DecayMethod1    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
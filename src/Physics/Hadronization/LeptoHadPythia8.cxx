@@ -133,6 +133,9 @@ bool LeptoHadPythia8::Hadronize(GHepRecord *
 {
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
+  // PYTHIA8 instance of the current thread
+  Pythia8::Pythia* gPythia = Pythia8Singleton::Instance()->Pythia8();
+
   // Compute kinematics of hadronic system with energy/momentum conservation
   LongLorentzVector p4v( * event->Probe()->P4()                   );
   LongLorentzVector p4N( * event->HitNucleon()->P4()              );
@@ -176,7 +179,7 @@ bool LeptoHadPythia8::Hadronize(GHepRecord *
   //
   // Generate the hadron combination to input PYTHIA
   //
-  fPythia->event.reset();
+  gPythia->event.reset();
 
   //If the hit quark is a d we have these options:
   /* uud(->q)     => uu + q */
@@ -201,8 +204,8 @@ bool LeptoHadPythia8::Hadronize(GHepRecord *
     double e_frag    = (W*W - m_diquark*m_diquark + m_frag*m_frag)/2./W;
     double e_diquark = (W*W + m_diquark*m_diquark - m_frag*m_frag)/2./W;
     double pz_cm = Pythia8::sqrtpos( e_frag*e_frag - m_frag*m_frag );
-    fPythia->event.append(frag_quark, 23, 101, 0, 0., 0.,  pz_cm, e_frag, m_frag);
-    fPythia->event.append(diquark,    23, 0, 101, 0., 0., -pz_cm, e_diquark, m_diquark);
+    gPythia->event.append(frag_quark, 23, 101, 0, 0., 0.,  pz_cm, e_frag, m_frag);
+    gPythia->event.append(diquark,    23, 0, 101, 0., 0., -pz_cm, e_diquark, m_diquark);
   }
 
   //If the hit quark is a u we have these options:
@@ -228,8 +231,8 @@ bool LeptoHadPythia8::Hadronize(GHepRecord *
     double e_frag    = (W*W - m_diquark*m_diquark + m_frag*m_frag)/2./W;
     double e_diquark = (W*W + m_diquark*m_diquark - m_frag*m_frag)/2./W;
     double pz_cm = Pythia8::sqrtpos( e_frag*e_frag - m_frag*m_frag );
-    fPythia->event.append(frag_quark, 23, 101, 0, 0., 0.,  pz_cm, e_frag, m_frag);
-    fPythia->event.append(diquark,    23, 0, 101, 0., 0., -pz_cm, e_diquark, m_diquark);
+    gPythia->event.append(frag_quark, 23, 101, 0, 0., 0.,  pz_cm, e_frag, m_frag);
+    gPythia->event.append(diquark,    23, 0, 101, 0., 0., -pz_cm, e_diquark, m_diquark);
   }
 
 
@@ -327,28 +330,28 @@ bool LeptoHadPythia8::Hadronize(GHepRecord *
 
         // Input the three particles to PYTHIA in the CM frame
         // If a top quark is produced we decay it because it does not hadronize
-        fPythia->event.append(frag_quark, 23, 101, 0, 0., 0., sqrt(E_frag*E_frag-m_frag*m_frag), E_frag, m_frag);
+        gPythia->event.append(frag_quark, 23, 101, 0, 0., 0., sqrt(E_frag*E_frag-m_frag*m_frag), E_frag, m_frag);
 
         double p_rema  = sqrt(E_rema*E_rema-m_rema*m_rema);
-        fPythia->event.append(rema, 23, 0, 101, p_rema*sin(theta_rema)*sin(phi), p_rema*sin(theta_rema)*cos(phi), p_rema*cos(theta_rema), E_rema, m_rema);
+        gPythia->event.append(rema, 23, 0, 101, p_rema*sin(theta_rema)*sin(phi), p_rema*sin(theta_rema)*cos(phi), p_rema*cos(theta_rema), E_rema, m_rema);
 
-        fPythia->event.bst(0,0,dbez);
+        gPythia->event.bst(0,0,dbez);
 
         double theta_hadron = TMath::ATan2(pT,pz_hadron);
 
         double p_hadron = sqrt(E_hadron*E_hadron-m_hadron*m_hadron);
-        fPythia->event.append(hadron, 23, 0, 0, p_hadron*sin(theta_hadron)*sin(phi+kPi), p_hadron*sin(theta_hadron)*cos(phi+kPi), p_hadron*cos(theta_hadron), E_hadron, m_hadron);
+        gPythia->event.append(hadron, 23, 0, 0, p_hadron*sin(theta_hadron)*sin(phi+kPi), p_hadron*sin(theta_hadron)*cos(phi+kPi), p_hadron*cos(theta_hadron), E_hadron, m_hadron);
 
         // Target remnants required to go backwards in hadronic cms
-        int nsize = fPythia->event.size();
-        if ( fPythia->event[nsize-1].pz()<0 && fPythia->event[nsize-2].pz()<0 ) break; //quit the while( counter<fMaxIterHad )
+        int nsize = gPythia->event.size();
+        if ( gPythia->event[nsize-1].pz()<0 && gPythia->event[nsize-2].pz()<0 ) break; //quit the while( counter<fMaxIterHad )
 
         // break;
 
         LOG("LeptoHad", pINFO) << "Not backward hadron or rema";
-        LOG("LeptoHad", pINFO) << "hadron     = " << hadron     << " -> Pz = " << fPythia->event[nsize-1].pz() ;
-        LOG("LeptoHad", pINFO) << "rema = " << rema << " -> Pz = " << fPythia->event[nsize-2].pz() ;
-        fPythia->event.reset();
+        LOG("LeptoHad", pINFO) << "hadron     = " << hadron     << " -> Pz = " << gPythia->event[nsize-1].pz() ;
+        LOG("LeptoHad", pINFO) << "rema = " << rema << " -> Pz = " << gPythia->event[nsize-2].pz() ;
+        gPythia->event.reset();
         
       }
       else {
@@ -372,19 +375,19 @@ bool LeptoHadPythia8::Hadronize(GHepRecord *
   double phi   = -2*kPi*rnd->RndHadro().Rndm();
   double theta = 0.;
 
-  fPythia->event.rot(theta,phi);
+  gPythia->event.rot(theta,phi);
   phi   = -1 * phi;
   theta = TMath::ATan(2.*pT/W);
-  fPythia->event.rot(theta,phi);
+  gPythia->event.rot(theta,phi);
 
-  // fPythia->event.list();
-  // fPythia->stat();
+  // gPythia->event.list();
+  // gPythia->stat();
 
   // Run PYTHIA with the input particles
-  fPythia->next();
-  // fPythia->event.list();
-  // fPythia->stat();
-  Pythia8::Event &fEvent = fPythia->event;
+  gPythia->next();
+  // gPythia->event.list();
+  // gPythia->stat();
+  Pythia8::Event &fEvent = gPythia->event;
   int np = fEvent.size();
   assert(np>0);
 
@@ -489,6 +492,8 @@ void LeptoHadPythia8::LoadConfig(void)
 {
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
+  Pythia8::Pythia* gPythia = Pythia8Singleton::Instance()->Pythia8();
+
   GetParam("MaxIter-Had", fMaxIterHad ) ;
 
   // Width of Gaussian distribution for transverse momentums
@@ -512,22 +517,22 @@ void LeptoHadPythia8::LoadConfig(void)
   GetParam( "Lundb",                  fLundb                  );
   GetParam( "LundaDiq",               fLundaDiq               );
 
-  fPythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
-  fPythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
-  fPythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
-  fPythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
-  fPythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
-  fPythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
-  fPythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
-  fPythia->settings.parm("StringZ:aLund",                fLunda);
-  fPythia->settings.parm("StringZ:bLund",                fLundb);
-  fPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
+  gPythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
+  gPythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
+  gPythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
+  gPythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
+  gPythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
+  gPythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
+  gPythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
+  gPythia->settings.parm("StringZ:aLund",                fLunda);
+  gPythia->settings.parm("StringZ:bLund",                fLundb);
+  gPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
 
   // Same default mass of the W boson in pythia8 and genie, so no need to change in pythia8
   // No problem with energy conservation W and top decays, so no need to set the width to 0
 
-  Afrag = fPythia->settings.parm("StringZ:aLund");
-  Bfrag = fPythia->settings.parm("StringZ:bLund");
+  Afrag = gPythia->settings.parm("StringZ:aLund");
+  Bfrag = gPythia->settings.parm("StringZ:bLund");
 
   bool isAvalid = true;
   if (Afrag<0.02 || abs(Afrag-1)==0.01 ) isAvalid = false;
@@ -537,15 +542,15 @@ void LeptoHadPythia8::LoadConfig(void)
     exit(1);
   }
 
-  mesonRateSum[0] = 1. + fPythia->settings.parm("StringFlav:mesonSvector"); //0.55 
-  mesonRateSum[1] = 1. + fPythia->settings.parm("StringFlav:mesonCvector"); //0.88 
-  mesonRateSum[2] = 1. + fPythia->settings.parm("StringFlav:mesonBvector"); //2.20 
+  mesonRateSum[0] = 1. + gPythia->settings.parm("StringFlav:mesonSvector"); //0.55 
+  mesonRateSum[1] = 1. + gPythia->settings.parm("StringFlav:mesonCvector"); //0.88 
+  mesonRateSum[2] = 1. + gPythia->settings.parm("StringFlav:mesonBvector"); //2.20 
 
-  double decupletSup = fPythia->settings.parm("StringFlav:decupletSup");;
+  double decupletSup = gPythia->settings.parm("StringFlav:decupletSup");;
   for (int i = 0; i < 6; ++i) CGSum[i] = CGOct[i] + decupletSup*CGDec[i];
 
   LOG("LeptoHad", pINFO) << "Initialising PYTHIA..." ;
-  fPythia->init(); 
+  Pythia8Singleton::Instance()->Init();
 #endif
 
 }
@@ -554,19 +559,19 @@ void LeptoHadPythia8::Initialize(void) const
 {
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  fPythia = Pythia8Singleton::Instance()->Pythia8();
+  Pythia8::Pythia* gPythia = Pythia8Singleton::Instance()->Pythia8();
 
-  fPythia->readString("Print:quiet = on");
+  gPythia->readString("Print:quiet = on");
 
   // sync GENIE and PYTHIA8 seeds
   RandomGen * rnd = RandomGen::Instance();
   long int seed = rnd->GetSeed();
-  fPythia->readString("Random:setSeed = on");
-  fPythia->settings.mode("Random:seed", seed);
-  LOG("LeptoHad", pINFO) << "PYTHIA8  seed = " << fPythia->settings.mode("Random:seed");
+  gPythia->readString("Random:setSeed = on");
+  gPythia->settings.mode("Random:seed", seed);
+  LOG("LeptoHad", pINFO) << "PYTHIA8  seed = " << gPythia->settings.mode("Random:seed");
 
   //needed to only do hadronization
-  fPythia->readString("ProcessLevel:all = off");
+  gPythia->readString("ProcessLevel:all = off");
 #endif
 
 }
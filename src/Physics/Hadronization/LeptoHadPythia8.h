@@ -93,10 +93,6 @@ private:
   double fLundb;                  ///< Lund b parameter
   double fLundaDiq;               ///< adjustment of Lund a for di-quark
 
-#ifdef __GENIE_PYTHIA8_ENABLED__
-  mutable Pythia8::Pythia * fPythia;         ///< PYTHIA8 object
-#endif
-
 };
 
 }         // genie namespace
@@ -353,7 +353,7 @@ void Pythia8Hadro2019::LoadConfig(void)
   gPythia->settings.parm("StringZ:bLund",                fLundb);
   gPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
 
-  gPythia->init(); // needed again to read the above?
+  Pythia8Singleton::Instance()->Init(); // needed again to read the above?
 
 #endif
 
@@ -376,7 +376,7 @@ void Pythia8Hadro2019::Initialize(void)
   LOG("Pythia8Had", pINFO)
     << "PYTHIA8  seed = " << gPythia->settings.mode("Random:seed");
 
-  gPythia->init();
+  Pythia8Singleton::Instance()->Init();
 
 #endif
 }
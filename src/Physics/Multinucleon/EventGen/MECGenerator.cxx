@@ -21,6 +21,7 @@
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
 #include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/EventGen/EventGenProfiler.h"
 #include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/GHEP/GHepStatus.h"
@@ -40,6 +41,8 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -50,13 +53,15 @@ using namespace genie::controls;
 
 //___________________________________________________________________________
 MECGenerator::MECGenerator() :
-EventRecordVisitorI("genie::MECGenerator")
+EventRecordVisitorI("genie::MECGenerator"),
+fNEnvelopeLookups(0), fNEnvelopeExceeded(0), fRjStatsPrintPeriod(0)
 {
 
 }
 //___________________________________________________________________________
 MECGenerator::MECGenerator(string config) :
-EventRecordVisitorI("genie::MECGenerator", config)
+EventRecordVisitorI("genie::MECGenerator", config),
+fNEnvelopeLookups(0), fNEnvelopeExceeded(0), fRjStatsPrintPeriod(0)
 {
 
 }
@@ -641,27 +646,32 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   }
 
   // Set Tmin for throwing rndm in the accept/reject loop
-  // the hadron tensors we expect will be limited in q3
-  // therefore also the outgoing lepton KE can't be too low or costheta too backward
-  // make the accept/reject loop more efficient by using Min values.
-  if(Enu < fQ3Max){
-    TMin = 0 ;
-    CosthMin = -1 ;
-  } else {
-    TMin = TMath::Sqrt(TMath::Power(LepMass, 2) + TMath::Power((Enu - fQ3Max), 2)) - LepMass;
-    CosthMin = TMath::Sqrt(1 - TMath::Power((fQ3Max / Enu ), 2));
+  Range1D_t Tl_range, ctl_range ;
+  this->NSVLeptonLimits( Enu, LepMass, Tl_range, ctl_range ) ;
+  TMin = Tl_range.min ;
+  CosthMin = ctl_range.min ;
+
+  // Get the maximum xsec value from the tabulated envelope, or compute it
+  // for the current event if no envelope is available
+  bool use_envelope = false ;
+  double XSecMax = -1. ;
+  if ( fUseMaxXSecEnvelope ) {
+    XSecMax = this->MaxXSecEnvelope( *interaction, Enu, false ) ;
+    use_envelope = ( XSecMax > 0. ) ;
   }
+  if ( ! use_envelope ) XSecMax = GetXSecMaxTlctl( *interaction, Tl_range, ctl_range ) ;
+  const int HitNucPDG = interaction->InitState().Tgt().HitNucPdg() ;
 
-  // Compute the maximum xsec value:
-  Range1D_t Tl_range ( TMin, TMax ) ;
-  Range1D_t ctl_range ( CosthMin, CosthMax ) ;
-  double XSecMax = GetXSecMaxTlctl( *interaction, Tl_range, ctl_range ) ;
+  // The trials are recorded against the channel as it enters the loop
+  // (the loop changes the hit nucleon cluster and the resonance)
+  const string channel = EventGenProfiler::ChannelKey(interaction) ;
 
   // -- Generate and Test the Kinematics----------------------------------//
 
   RandomGen * rnd = RandomGen::Instance();
   bool accept = false;
   unsigned int iter = 0;
+  int nevaluated = 0, nexceeded = 0;
 
   // loop over different (randomly) selected T and Costh
   while (!accept) {
@@ -671,6 +681,7 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
           LOG("MEC", pWARN)
               << "Couldn't select a valid Tmu, CosTheta pair after "
               << iter << " iterations";
+          this->RecordRejectionTrials(channel, nevaluated, 0, nexceeded);
           event->EventFlags()->SetBitNumber(kKineGenErr, true);
           genie::exceptions::EVGThreadException exception;
           exception.SetReason("Couldn't select lepton kinematics");
@@ -720,7 +731,23 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
 	// now get delta-less PN
 	interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
 	double XSecPN = fXSecModel->XSec(interaction, kPSTlctl);
-
+	nevaluated++;
+	if (XSec > XSecMax) nexceeded++;
+
+	if (XSec > XSecMax && use_envelope) {
+	  // the envelope was exceeded: fall back to the per-event maximum
+	  // and throw again
+	  fNEnvelopeExceeded++;
+	  LOG("MEC", pWARN) << "XSec = " << XSec << " > envelope = " << XSecMax
+			    << " at E = " << Enu << " for " << interaction->AsString()
+			    << " (exceeded " << fNEnvelopeExceeded << " times in "
+			    << fNEnvelopeLookups << " events)";
+	  interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(HitNucPDG);
+	  XSecMax = TMath::Max( GetXSecMaxTlctl( *interaction, Tl_range, ctl_range ),
+				fSafetyFactor * XSec );
+	  use_envelope = false;
+	  continue;
+	}
 	if (XSec > XSecMax) {
 	  LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " "
 			     << XSec << " > " << XSecMax
@@ -800,6 +827,8 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
 
   } // end while
 
+  this->RecordRejectionTrials(channel, nevaluated, 1, nexceeded);
+
   // -- finish lepton kinematics
   // If the code got here, then we accepted some kinematics
   // and we can proceed to generate the final state.
@@ -935,9 +964,18 @@ void MECGenerator::SelectSuSALeptonKinematics(GHepRecord* event) const
   // e-scat xsecs blow up close to theta=0, MC methods won't work ...
   if ( NuPDG == 11 ) maxIter *= 100000;
 
-  // Scan the accessible phase space to find the maximum differential cross
-  // section to throw against
-  double XSecMax = utils::mec::GetMaxXSecTlctl( *fXSecModel, *interaction );
+  // Get the maximum differential cross section to throw against from the
+  // tabulated envelope. If no envelope is available, scan the accessible
+  // phase space for the current event
+  bool use_envelope = false ;
+  double XSecMax = -1. ;
+  if ( fUseMaxXSecEnvelope ) {
+    XSecMax = this->MaxXSecEnvelope( *interaction, Enu, true );
+    use_envelope = ( XSecMax > 0. );
+  }
+  if ( ! use_envelope ) {
+    XSecMax = utils::mec::GetMaxXSecTlctl( *fXSecModel, *interaction );
+  }
 
   // loop over different (randomly) selected T and Costh
   while ( !accept ) {
@@ -984,6 +1022,20 @@ void MECGenerator::SelectSuSALeptonKinematics(GHepRecord* event) const
       // Get total xsec (nn+np)
       double XSec = fXSecModel->XSec( interaction, kPSTlctl );
 
+      if ( XSec > XSecMax && use_envelope ) {
+        // the envelope was exceeded: fall back to the per-event maximum
+        // and throw again
+        fNEnvelopeExceeded++;
+        LOG("MEC", pWARN) << "XSec = " << XSec << " > envelope = " << XSecMax
+          << " at E = " << Enu << " for " << interaction->AsString()
+          << " (exceeded " << fNEnvelopeExceeded << " times in "
+          << fNEnvelopeLookups << " events)";
+        XSecMax = std::max( utils::mec::GetMaxXSecTlctl( *fXSecModel, *interaction ),
+          XSec );
+        use_envelope = false;
+        continue;
+      }
+
       if ( XSec > XSecMax ) {
         LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " "
           << XSec << " > " << XSecMax << " don't let this happen.";
@@ -1351,6 +1403,32 @@ void MECGenerator::LoadConfig(void)
     // in the accept/reject loop for selecting lepton kinematics for SuSAv2.
     // Similar to the tolerance used by QELEventGenerator.
     GetParamDef( "SuSA-MaxXSec-DiffTolerance", fSuSAMaxXSecDiffTolerance, 999999. );
+
+    // Use a tabulated max xsec envelope (as a function of the probe energy)
+    // instead of a per-event maximisation in the lepton kinematics selection,
+    // and spacing of the envelope energy nodes in ln(E)
+    GetParamDef( "MaxXSec-UseEnvelope", fUseMaxXSecEnvelope, true );
+    GetParamDef( "MaxXSec-EnvelopeLogStep", fEnvelopeLogStep, 0.02 );
+    assert(fEnvelopeLogStep > 0.);
+
+    // Period (in accepted events per channel) for printing the rejection
+    // method statistics of the NSV lepton kinematics selection
+    GetParamDef( "RejectionStats-PrintPeriod", fRjStatsPrintPeriod, 0 );
+}
+//___________________________________________________________________________
+void MECGenerator::RecordRejectionTrials(const string & channel,
+                        int nevaluated, int naccepted, int nexceeded) const
+{
+// Records the outcome of the rejection method for a single generated event
+// (see KineGeneratorWithCache::RecordRejectionTrials)
+
+  fRjStats.Record(this->Id().Key(), channel,
+                  nevaluated, naccepted, nexceeded, fRjStatsPrintPeriod);
+}
+//___________________________________________________________________________
+void MECGenerator::PrintRejectionStatistics(void) const
+{
+  fRjStats.Print(this->Id().Key());
 }
 //___________________________________________________________________________
 double MECGenerator::GetXSecMaxTlctl( const Interaction & in,
@@ -1410,3 +1488,81 @@ double MECGenerator::GetXSecMaxTlctl( const Interaction & in,
 }
 
 //___________________________________________________________________________
+double MECGenerator::MaxXSecEnvelope( const Interaction & in, double E,
+                                      bool susa ) const
+{
+  if ( E <= 0. ) return -1.;
+
+  // Access the cache branch for this algorithm and channel
+  Cache * cache = Cache::Instance();
+  string key = cache->CacheBranchKey( this->Id().Key(), in.AsString(),
+                                      "MaxXSecEnvelope" );
+  CacheBranchFx * cb =
+              dynamic_cast<CacheBranchFx *> ( cache->FindCacheBranch(key) );
+  if ( ! cb ) {
+    LOG("MEC", pINFO) << "Creating max xsec envelope cache branch: " << key;
+    cb = new CacheBranchFx("Max xsec envelope vs probe energy");
+    cache->AddCacheBranch(key, cb);
+  }
+
+  // Bracketing nodes of the logarithmic energy grid
+  int k = TMath::FloorNint( TMath::Log(E) / fEnvelopeLogStep );
+  double node_xsec[2] = { 0., 0. };
+  for ( int i = 0; i < 2; ++i ) {
+    double Ek = TMath::Exp( (k+i) * fEnvelopeLogStep );
+    map<double,double>::const_iterator it = cb->Map().find(Ek);
+    if ( it != cb->Map().end() ) {
+      node_xsec[i] = it->second;
+    } else {
+      node_xsec[i] = this->ComputeNodeMaxXSec( in, Ek, susa );
+      cb->AddValues( Ek, node_xsec[i] );
+      LOG("MEC", pINFO) << "Max xsec envelope for " << in.AsString()
+                        << " @ E = " << Ek << " : " << node_xsec[i];
+    }
+  }
+
+  double xsec_max = TMath::Max( node_xsec[0], node_xsec[1] );
+  if ( xsec_max > 0. ) fNEnvelopeLookups++;
+
+  return xsec_max;
+}
+//___________________________________________________________________________
+double MECGenerator::ComputeNodeMaxXSec( const Interaction & in, double E,
+                                         bool susa ) const
+{
+  double LepMass = in.FSPrimLepton()->Mass();
+  if ( E <= LepMass ) return 0.;
+
+  Interaction interaction( in );
+  interaction.InitStatePtr()->SetProbeE( E );
+
+  if ( susa ) {
+    return utils::mec::GetMaxXSecTlctl( *fXSecModel, interaction );
+  }
+
+  double Enu = interaction.InitState().ProbeE(kRfHitNucRest);
+  Range1D_t Tl_range, ctl_range;
+  this->NSVLeptonLimits( Enu, LepMass, Tl_range, ctl_range );
+  if ( Tl_range.max <= Tl_range.min ) return 0.;
+
+  return this->GetXSecMaxTlctl( interaction, Tl_range, ctl_range );
+}
+//___________________________________________________________________________
+void MECGenerator::NSVLeptonLimits( double Enu, double LepMass,
+                Range1D_t & Tl_range, Range1D_t & ctl_range ) const
+{
+  // The hadron tensors we expect will be limited in q3, therefore the
+  // outgoing lepton KE can't be too low or costheta too backward.
+  // Make the accept/reject loop more efficient by using Min values.
+  Tl_range.max  = Enu - LepMass;
+  ctl_range.max = 1.;
+  if ( Enu < fQ3Max ) {
+    Tl_range.min  = 0.;
+    ctl_range.min = -1.;
+  } else {
+    Tl_range.min  = TMath::Sqrt( TMath::Power(LepMass, 2) +
+                                 TMath::Power(Enu - fQ3Max, 2) ) - LepMass;
+    ctl_range.min = TMath::Sqrt( 1. - TMath::Power(fQ3Max / Enu, 2) );
+  }
+}
+//___________________________________________________________________________
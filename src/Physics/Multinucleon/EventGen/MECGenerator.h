@@ -26,6 +26,7 @@
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/ParticleData/PDGCodeList.h"
+#include "Physics/Common/RejectionStats.h"
 
 namespace genie {
 
@@ -48,6 +49,11 @@ public :
   void Configure(const Registry & config);
   void Configure(string config);
 
+  //! Rejection method statistics of the NSV lepton kinematics selection,
+  //! keyed by interaction channel
+  const map<string, RejectionStats> & RejectionStatistics (void) const { return fRjStats.Stats(); }
+  void PrintRejectionStatistics (void) const;
+
 private:
 
   void    LoadConfig                        (void);
@@ -67,6 +73,17 @@ private:
   // in the kPSTlctl phase space
   double GetXSecMaxTlctl( const Interaction & inter, const Range1D_t & Tl_range, const Range1D_t & ctl_range ) const;
 
+  // Tabulated max differential cross section in the kPSTlctl phase space as
+  // a function of the probe energy. The maximum is computed (with the safety
+  // factor applied) on first use at the nodes of a logarithmic energy grid
+  // and kept in the GENIE cache, so it is persisted if a cache file is used.
+  // At a given energy, the envelope is the larger of the two bracketing nodes.
+  // Returns a non-positive value if no envelope is available.
+  double MaxXSecEnvelope    ( const Interaction & inter, double E, bool susa ) const;
+  double ComputeNodeMaxXSec ( const Interaction & inter, double E, bool susa ) const;
+  void   NSVLeptonLimits    ( double Enu, double LepMass, Range1D_t & Tl_range, Range1D_t & ctl_range ) const;
+  void   RecordRejectionTrials ( const string & channel, int nevaluated, int naccepted, int nexceeded ) const;
+
   mutable const XSecAlgorithmI * fXSecModel;
   mutable TGenPhaseSpace         fPhaseSpaceGenerator;
   const NuclearModelI *          fNuclModel;
@@ -79,6 +96,14 @@ private:
   
   double fQ3Max;
 
+  bool   fUseMaxXSecEnvelope ;   // use the tabulated max xsec envelope?
+  double fEnvelopeLogStep ;      // spacing of the envelope energy nodes in ln(E)
+  mutable long fNEnvelopeLookups ;  // number of events using the envelope
+  mutable long fNEnvelopeExceeded ; // number of times the envelope was exceeded
+
+  int fRjStatsPrintPeriod ;                // print rejection stats every that many accepted events per channel (0: never)
+  mutable RejectionStatsTable fRjStats ;   // NSV rejection method statistics per channel
+
   // Tolerate this maximum percent deviation above the calculated maximum cross
   // section when sampling lepton kinematics for the SuSAv2-MEC model.
   double fSuSAMaxXSecDiffTolerance;
@@ -0,0 +1,290 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2025, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <sstream>
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "Physics/MuonEnergyLoss/TabulatedMuELossModel.h"
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
+
+using std::ostringstream;
+
+using namespace genie;
+using namespace genie::mueloss;
+using namespace genie::constants;
+
+//____________________________________________________________________________
+TabulatedMuELossModel::TabulatedMuELossModel() :
+MuELossI("genie::mueloss::TabulatedMuELossModel")
+{
+
+}
+//____________________________________________________________________________
+TabulatedMuELossModel::TabulatedMuELossModel(string config) :
+MuELossI("genie::mueloss::TabulatedMuELossModel", config)
+{
+
+}
+//____________________________________________________________________________
+TabulatedMuELossModel::~TabulatedMuELossModel()
+{
+
+}
+//____________________________________________________________________________
+MuELProcess_t TabulatedMuELossModel::Process(void) const
+{
+  return fProcess;
+}
+//____________________________________________________________________________
+double TabulatedMuELossModel::dE_dx(double E, MuELMaterial_t mt) const
+{
+// Interpolates the tabulated dE/dx (in GeV^-2).
+// Outside the tabulated energy range the underlying models are called.
+
+  if(mt == eMuUndefined) return 0;
+  if(E<=MuELProcess::Threshold(this->Process()) || E>=kMaxMuE) return 0;
+
+  if(E<fEMin || E>fEMax) return this->ExactdE_dx(E,mt);
+
+  const Table & table = this->GetTable(mt);
+
+  double f = 0;
+  int    i = this->Locate(E,f);
+
+  return this->Interpolate(table,i,f);
+}
+//____________________________________________________________________________
+double TabulatedMuELossModel::ExactdE_dx(double E, MuELMaterial_t mt) const
+{
+  double de_dx = 0;
+  vector<const MuELossI *>::const_iterator it = fModels.begin();
+  for( ; it != fModels.end(); ++it) {
+    de_dx += (*it)->dE_dx(E,mt);
+  }
+  return de_dx;
+}
+//____________________________________________________________________________
+double TabulatedMuELossModel::Range(double E, MuELMaterial_t mt) const
+{
+// CSDA range, R(E) = \int_{m_mu}^{E} dE' / (dE/dx)(E').
+// The integral is tabulated at the grid nodes using the trapezoidal rule in
+// log(E), i.e. integrating E/(dE/dx) in dlog(E). Below the lowest node dE/dx
+// is taken as constant.
+
+  if(mt == eMuUndefined) return 0;
+  if(E <= kMuonMass) return 0;
+
+  const Table & table = this->GetTable(mt);
+
+  if(E < fEMin) {
+    return (table.dEdx[0] > 0) ? (E-kMuonMass)/table.dEdx[0] : 0;
+  }
+
+  double f = 0;
+  int    i = this->Locate(E,f);
+
+  double Ei = this->NodeEnergy(i);
+  double yi = table.dEdx[i];
+  double y  = this->Interpolate(table,i,f);
+  double wi = (yi > 0) ? Ei/yi : 0;
+  double w  = (y  > 0) ? E /y  : 0;
+
+  return table.Range[i] + 0.5*f*fLogStep*(wi+w);
+}
+//____________________________________________________________________________
+double TabulatedMuELossModel::Energy(double range, MuELMaterial_t mt) const
+{
+// Inverts the CSDA range table: The grid interval is found by bisection,
+// the energy is interpolated linearly in log(E) and refined by a Newton step.
+
+  if(mt == eMuUndefined) return 0;
+  if(range <= 0) return kMuonMass;
+
+  const Table & table = this->GetTable(mt);
+
+  if(range < table.Range[0]) {
+    return kMuonMass + range*table.dEdx[0];
+  }
+
+  vector<double>::const_iterator it =
+     std::upper_bound(table.Range.begin(), table.Range.end(), range);
+  int i = (int) (it - table.Range.begin()) - 1;
+  i = TMath::Max(0, TMath::Min(i, fNKnots-2));
+
+  double dR = table.Range[i+1] - table.Range[i];
+  double f  = (dR > 0) ? (range - table.Range[i])/dR : 0;
+  double E  = TMath::Exp(fLogEMin + (i+f)*fLogStep);
+
+  double de_dx = this->Interpolate(table,i,f);
+  if(de_dx > 0) {
+    E += (range - this->Range(E,mt)) * de_dx;
+  }
+  return TMath::Max(E, kMuonMass);
+}
+//____________________________________________________________________________
+double TabulatedMuELossModel::ResidualEnergy(
+   double E, double thickness, MuELMaterial_t mt) const
+{
+  double range = this->Range(E,mt) - thickness;
+  if(range <= 0) return kMuonMass;
+
+  return this->Energy(range,mt);
+}
+//____________________________________________________________________________
+const TabulatedMuELossModel::Table &
+  TabulatedMuELossModel::GetTable(MuELMaterial_t mt) const
+{
+  map<MuELMaterial_t, Table>::const_iterator it = fTables.find(mt);
+  if(it != fTables.end()) return it->second;
+
+  Table & table = fTables[mt];
+  this->BuildTable(mt, table);
+  return table;
+}
+//____________________________________________________________________________
+void TabulatedMuELossModel::BuildTable(MuELMaterial_t mt, Table & table) const
+{
+  // Get the dE/dx nodes from the cache, computing them if they are not
+  // there (or were computed on a different grid)
+  Cache * cache = Cache::Instance();
+  string key = cache->CacheBranchKey(
+      this->Id().Key(), MuELMaterial::AsString(mt), "dE_dx");
+
+  CacheBranchFx * cb =
+      dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(!cb) {
+    cb = new CacheBranchFx("Muon dE/dx vs energy");
+    cache->AddCacheBranch(key, cb);
+  }
+
+  const map<double,double> & nodes = cb->Map();
+  bool cached = ((int)nodes.size() == fNKnots);
+  if(cached) {
+    double e0 = nodes.begin()->first;
+    double e1 = nodes.rbegin()->first;
+    cached = TMath::Abs(e0/fEMin - 1) < 1E-9 && TMath::Abs(e1/fEMax - 1) < 1E-9;
+  }
+
+  if(!cached) {
+    LOG("MuELoss", pINFO)
+      << "Tabulating muon dE/dx in " << MuELMaterial::AsString(mt)
+      << " (" << fNKnots << " nodes, E = " << fEMin << " - " << fEMax << " GeV)";
+    cb->Reset();
+    for(int i = 0; i < fNKnots; i++) {
+      double E = this->NodeEnergy(i);
+      cb->AddValues(E, this->ExactdE_dx(E,mt));
+    }
+  } else {
+    LOG("MuELoss", pINFO)
+      << "Loaded muon dE/dx table in " << MuELMaterial::AsString(mt)
+      << " from the cache";
+  }
+
+  table.dEdx   .resize(fNKnots);
+  table.LogdEdx.resize(fNKnots);
+  table.Range  .resize(fNKnots);
+
+  int i = 0;
+  map<double,double>::const_iterator it = nodes.begin();
+  for( ; it != nodes.end(); ++it, ++i) {
+    double de_dx = it->second;
+    table.dEdx   [i] = de_dx;
+    table.LogdEdx[i] = (de_dx > 0) ? TMath::Log(de_dx) : 0;
+  }
+
+  // Integrate the CSDA range at the nodes
+  double E0 = this->NodeEnergy(0);
+  table.Range[0] = (table.dEdx[0] > 0) ? (E0-kMuonMass)/table.dEdx[0] : 0;
+  double wprev = (table.dEdx[0] > 0) ? E0/table.dEdx[0] : 0;
+  for(i = 1; i < fNKnots; i++) {
+    double E = this->NodeEnergy(i);
+    double w = (table.dEdx[i] > 0) ? E/table.dEdx[i] : 0;
+    table.Range[i] = table.Range[i-1] + 0.5*fLogStep*(wprev+w);
+    wprev = w;
+  }
+}
+//____________________________________________________________________________
+double TabulatedMuELossModel::NodeEnergy(int i) const
+{
+  return TMath::Exp(fLogEMin + i*fLogStep);
+}
+//____________________________________________________________________________
+int TabulatedMuELossModel::Locate(double E, double & f) const
+{
+// Returns the index of the grid interval containing E and sets the fractional
+// position of log(E) within it. Energies beyond the last node are assigned
+// to the last interval (with f>1).
+
+  double u = (TMath::Log(E) - fLogEMin) / fLogStep;
+  int i = TMath::Max(0, TMath::Min((int)u, fNKnots-2));
+  f = u - i;
+  return i;
+}
+//____________________________________________________________________________
+double TabulatedMuELossModel::Interpolate(
+    const Table & table, int i, double f) const
+{
+  double y0 = table.dEdx[i];
+  double y1 = table.dEdx[i+1];
+
+  // log-log interpolation, unless a node is at / below the process threshold
+  if(y0 > 0 && y1 > 0) {
+    return TMath::Exp((1-f)*table.LogdEdx[i] + f*table.LogdEdx[i+1]);
+  }
+  return TMath::Max(0., (1-f)*y0 + f*y1);
+}
+//____________________________________________________________________________
+void TabulatedMuELossModel::Configure(const Registry & config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void TabulatedMuELossModel::Configure(string config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void TabulatedMuELossModel::LoadConfig(void)
+{
+  fModels.clear();
+  fTables.clear();
+
+  int nmodels = 0;
+  GetParam("NModels", nmodels);
+  assert(nmodels > 0);
+
+  for(int i = 0; i < nmodels; i++) {
+    ostringstream key;
+    key << "Model-" << i;
+    const MuELossI * model =
+        dynamic_cast<const MuELossI *> (this->SubAlg(key.str()));
+    assert(model);
+    fModels.push_back(model);
+  }
+  fProcess = (nmodels == 1) ? fModels[0]->Process() : eMupSum;
+
+  GetParamDef("Table-NKnots", fNKnots, 200);
+  GetParamDef("Table-EMin",   fEMin,   0.2);
+  GetParamDef("Table-EMax",   fEMax,   0.999*kMaxMuE);
+
+  assert(fNKnots > 1);
+  assert(fEMin > kMuonMass && fEMin < fEMax && fEMax < kMaxMuE);
+
+  fLogEMin = TMath::Log(fEMin);
+  fLogStep = (TMath::Log(fEMax) - fLogEMin) / (fNKnots-1);
+}
+//____________________________________________________________________________
@@ -0,0 +1,106 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::mueloss::TabulatedMuELossModel
+
+\brief    Tabulated muon energy loss model.
+          Concrete implementation of the MuELossI interface.
+
+          Sums the dE/dx of a configurable list of MuELossI models and, for
+          each material, tabulates it on a logarithmic energy grid the first
+          time the material is requested. Subsequent dE_dx() calls locate the
+          grid interval directly from log(E) and interpolate log(dE/dx)
+          linearly in log(E), instead of re-evaluating the (integral-based)
+          underlying models.
+
+          The tabulated nodes are stored in the GENIE cache, so they are
+          written to / read back from the cache file given to the apps via
+          --cache-file. The continuous-slowing-down-approximation (CSDA)
+          range, and its inverse, are computed from the same tables.
+
+          The exact (untabulated) sum is still available via ExactdE_dx()
+          for validation.
+
+\author   The GENIE Collaboration
+
+\created  October 18, 2026
+
+\cpright  Copyright (c) 2003-2025, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _TABULATED_MUELOSS_MODEL_H_
+#define _TABULATED_MUELOSS_MODEL_H_
+
+#include <map>
+#include <vector>
+
+#include "Physics/MuonEnergyLoss/MuELossI.h"
+
+using std::map;
+using std::vector;
+
+namespace genie   {
+namespace mueloss {
+
+class TabulatedMuELossModel : public MuELossI
+{
+public:
+  TabulatedMuELossModel();
+  TabulatedMuELossModel(string config);
+  virtual ~TabulatedMuELossModel();
+
+  //! implement the MuELossI interface
+  double        dE_dx   (double E, MuELMaterial_t material) const;
+  MuELProcess_t Process (void) const;
+
+  //! dE/dx summed over the configured models, without tabulation (in GeV^-2)
+  double ExactdE_dx (double E, MuELMaterial_t material) const;
+
+  //! CSDA range of a muon with energy E (in natural units of mass per area;
+  //! divide by units::g/units::cm2 to get it in gr/cm^2)
+  double Range (double E, MuELMaterial_t material) const;
+
+  //! Energy of a muon with the input CSDA range (inverse of Range())
+  double Energy (double range, MuELMaterial_t material) const;
+
+  //! Energy of a muon with energy E after traversing the input amount of
+  //! material (in natural units of mass per area). Returns the muon mass
+  //! if the muon stops in the material.
+  double ResidualEnergy (double E, double thickness, MuELMaterial_t material) const;
+
+  //! Overload the Algorithm::Configure() methods to load private data
+  //! members from configuration options
+  void Configure(const Registry & config);
+  void Configure(string config);
+
+private:
+
+  struct Table {
+    vector<double> dEdx;    ///< dE/dx at the grid nodes (GeV^-2)
+    vector<double> LogdEdx; ///< log(dE/dx) at the grid nodes (0 if dE/dx<=0)
+    vector<double> Range;   ///< CSDA range at the grid nodes
+  };
+
+  void          LoadConfig    (void);
+  const Table & GetTable      (MuELMaterial_t material) const;
+  void          BuildTable    (MuELMaterial_t material, Table & table) const;
+  double        NodeEnergy    (int i) const;
+  int           Locate        (double E, double & f) const;
+  double        Interpolate   (const Table & table, int i, double f) const;
+
+  vector<const MuELossI *> fModels;   ///< models whose dE/dx are summed
+  MuELProcess_t            fProcess;  ///< process for the summed models
+  int                      fNKnots;   ///< number of energy grid nodes
+  double                   fEMin;     ///< lowest grid energy
+  double                   fEMax;     ///< highest grid energy
+  double                   fLogEMin;  ///< log(fEMin)
+  double                   fLogStep;  ///< log-energy grid step
+
+  mutable map<MuELMaterial_t, Table> fTables; ///< tables built so far
+};
+
+}      // mueloss namespace
+}      // genie   namespace
+#endif // _TABULATED_MUELOSS_MODEL_H_
@@ -15,6 +15,8 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+
 #include <TSystem.h>
 #include <TNtupleD.h>
 #include <TGraph2D.h>
@@ -37,6 +39,7 @@ NuclearModelI("genie::SpectralFunc")
 {
   fSfFe56 = 0;
   fSfC12  = 0;
+  fUseSamplingTable = true;
 }
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc(string config) :
@@ -44,6 +47,7 @@ NuclearModelI("genie::SpectralFunc", config)
 {
   fSfFe56 = 0;
   fSfC12  = 0;
+  fUseSamplingTable = true;
 }
 //____________________________________________________________________________
 SpectralFunc::~SpectralFunc()
@@ -54,14 +58,73 @@ SpectralFunc::~SpectralFunc()
 //____________________________________________________________________________
 bool SpectralFunc::GenerateNucleon(const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
-
-  if(!sf) {
-    fCurrRemovalEnergy = 0.;
-    fCurrMomentum.SetXYZ(0.,0.,0.);
-    return false;
+  fCurrRemovalEnergy = 0.;
+  fCurrMomentum.SetXYZ(0.,0.,0.);
+
+  double kc = 0, wc = 0;
+  bool generated = false;
+  if(fUseSamplingTable) {
+    const SamplingTable * table = this->SelectSamplingTable(target);
+    if(!table) return false;
+    generated = this->GenerateFromTable(*table, kc, wc);
+  } else {
+    TGraph2D * sf = this->SelectSpectralFunction(target);
+    if(!sf) return false;
+    generated = this->GenerateFromRejection(sf, kc, wc);
   }
+  if(!generated) return false;
+
+  LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc;
+  LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  // generate momentum components
+  double costheta = -1. + 2. * rnd->RndGen().Rndm();
+  double sintheta = TMath::Sqrt(1.-costheta*costheta);
+  double fi       = 2 * kPi * rnd->RndGen().Rndm();
+  double cosfi    = TMath::Cos(fi);
+  double sinfi    = TMath::Sin(fi);
+
+  double kx = kc*sintheta*cosfi;
+  double ky = kc*sintheta*sinfi;
+  double kz = kc*costheta;
+
+  // set generated values
+  fCurrRemovalEnergy = wc;
+  fCurrMomentum.SetXYZ(kx,ky,kz);
+
+  return true;
+}
+//____________________________________________________________________________
+bool SpectralFunc::GenerateFromTable(
+                   const SamplingTable & table, double & k, double & w) const
+{
+// Draw a k bin from the marginal cdf and a w bin from the cdf conditional on
+// that k bin, then a point uniformly within the selected cell
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double rk = table.kcdf.back() * rnd->RndGen().Rndm();
+  int ik = std::upper_bound(table.kcdf.begin()+1, table.kcdf.end(), rk)
+           - table.kcdf.begin() - 1;
+  ik = TMath::Min(ik, table.nk-1);
 
+  vector<double>::const_iterator wbeg = table.wcdf.begin() + ik*(table.nw+1);
+  vector<double>::const_iterator wend = wbeg + table.nw + 1;
+  double rw = *(wend-1) * rnd->RndGen().Rndm();
+  int iw = std::upper_bound(wbeg+1, wend, rw) - wbeg - 1;
+  iw = TMath::Min(iw, table.nw-1);
+
+  k = table.kmin + table.dk * (ik + rnd->RndGen().Rndm());
+  w = table.wmin + table.dw * (iw + rnd->RndGen().Rndm());
+
+  return true;
+}
+//____________________________________________________________________________
+bool SpectralFunc::GenerateFromRejection(
+                             TGraph2D * sf, double & k, double & w) const
+{
   double kmin    = sf->GetXmin(); // momentum range
   double kmax    = sf->GetXmax();
   double wmin    = sf->GetYmin(); // removal energy range
@@ -92,29 +155,13 @@ bool SpectralFunc::GenerateNucleon(const Target & target) const
     LOG("SpectralFunc", pINFO) << "Trying p = " << kc << ", w = " << wc;
 
     // accept/reject
-    double prob  = this->Prob(kc,wc, target);
+    double prob  = sf->Interpolate(kc,wc);
     double probg = probmax * rnd->RndGen().Rndm();
     bool accept = (probg < prob);
     if(!accept) continue;
 
-    LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
-    LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
-
-    // generate momentum components
-    double costheta = -1. + 2. * rnd->RndGen().Rndm();
-    double sintheta = TMath::Sqrt(1.-costheta*costheta);
-    double fi       = 2 * kPi * rnd->RndGen().Rndm();
-    double cosfi    = TMath::Cos(fi);
-    double sinfi    = TMath::Sin(fi);
-
-    double kx = kc*sintheta*cosfi;
-    double ky = kc*sintheta*sinfi;
-    double kz = kc*costheta;
-
-    // set generated values
-    fCurrRemovalEnergy = wc;
-    fCurrMomentum.SetXYZ(kx,ky,kz);
-
+    k = kc;
+    w = wc;
     return true;
   }
   return false;
@@ -171,6 +218,15 @@ void SpectralFunc::LoadConfig(void)
 
   fSfFe56->SetName("sf_fe56");
   fSfC12 ->SetName("sf_c12");
+
+  this->GetParamDef("SF-UseSamplingTable", fUseSamplingTable, true);
+  this->GetParamDef("SF-SamplingTableNK",  fSamplingTableNK,  200);
+  this->GetParamDef("SF-SamplingTableNW",  fSamplingTableNW,  200);
+
+  if(fUseSamplingTable) {
+    this->BuildSamplingTable(fSfFe56, fTableFe56);
+    this->BuildSamplingTable(fSfC12,  fTableC12);
+  }
 }
 //____________________________________________________________________________
 TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
@@ -193,6 +249,58 @@ TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
   return sfgraph;
 }
 //____________________________________________________________________________
+void SpectralFunc::BuildSamplingTable(
+                              TGraph2D * sf, SamplingTable & table) const
+{
+// Tabulate the spectral function at the centres of a regular (k,w) grid
+// spanning the input data range and build the k marginal cdf and, for each
+// k bin, the w cdf. Interpolation is only done here, at configuration time.
+
+  table.nk   = TMath::Max(1, fSamplingTableNK);
+  table.nw   = TMath::Max(1, fSamplingTableNW);
+  table.kmin = sf->GetXmin();
+  table.wmin = sf->GetYmin();
+  table.dk   = (sf->GetXmax() - table.kmin) / table.nk;
+  table.dw   = (sf->GetYmax() - table.wmin) / table.nw;
+
+  table.kcdf.assign(table.nk+1, 0.);
+  table.wcdf.assign(table.nk*(table.nw+1), 0.);
+
+  for(int ik = 0; ik < table.nk; ik++) {
+    double k = table.kmin + (ik+0.5) * table.dk;
+    double * wcdf = &table.wcdf[ik*(table.nw+1)];
+    for(int iw = 0; iw < table.nw; iw++) {
+      double w = table.wmin + (iw+0.5) * table.dw;
+      double prob = TMath::Max(0., sf->Interpolate(k,w));
+      wcdf[iw+1] = wcdf[iw] + prob;
+    }
+    table.kcdf[ik+1] = table.kcdf[ik] + wcdf[table.nw];
+  }
+
+  LOG("SpectralFunc", pDEBUG)
+    << "Built " << table.nk << " x " << table.nw
+    << " sampling table for " << sf->GetName();
+
+  if(table.kcdf.back() <= 0) {
+    LOG("SpectralFunc", pFATAL)
+      << "Spectral function " << sf->GetName() << " integrates to zero";
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+const SpectralFunc::SamplingTable *
+         SpectralFunc::SelectSamplingTable(const Target & t) const
+{
+  int pdgc = t.Pdg();
+
+  if (pdgc == kPdgTgtC12)  return &fTableC12;
+  if (pdgc == kPdgTgtFe56) return &fTableFe56;
+
+  LOG("SpectralFunc", pERROR)
+     << "** The spectral function for target " << pdgc << " isn't available";
+  return 0;
+}
+//____________________________________________________________________________
 TGraph2D * SpectralFunc::SelectSpectralFunction(const Target & t) const
 {
   TGraph2D * sf = 0;
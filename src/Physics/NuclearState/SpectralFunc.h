@@ -6,6 +6,13 @@
 \brief    A realistic spectral function - based nuclear model.
           Is a concrete implementation of the NuclearModelI interface.
 
+          By default, (k,w) pairs are drawn directly from a tabulated
+          cumulative distribution (the k marginal and the w distribution
+          conditional on each k bin), built on a regular grid once per
+          nucleus at configuration time. The original accept/reject sampler,
+          interpolating the spectral function at every trial, can be
+          restored with SF-UseSamplingTable = false.
+
 \author   Costas Andreopoulos <c.andreopoulos \at cern.ch>
           University of Liverpool
 
@@ -21,8 +28,12 @@
 #ifndef _SPECTRAL_FUNCTION_H_
 #define _SPECTRAL_FUNCTION_H_
 
+#include <vector>
+
 #include "Physics/NuclearState/NuclearModelI.h"
 
+using std::vector;
+
 class TNtupleD;
 class TGraph2D;
 
@@ -55,12 +66,31 @@ public:
   void       LoadConfig             (void);
 
 private:
-  
-  TGraph2D * Convert2Graph          (TNtupleD & data) const;
-  TGraph2D * SelectSpectralFunction (const Target & target) const; 
+
+  // (k,w) sampling table on a regular grid
+  struct SamplingTable {
+    int    nk, nw;         ///< number of k, w bins
+    double kmin, dk;       ///< k grid: lower edge, bin width
+    double wmin, dw;       ///< w grid: lower edge, bin width
+    vector<double> kcdf;   ///< k marginal cdf, nk+1 entries
+    vector<double> wcdf;   ///< w cdf conditional on k bin, nk x (nw+1) entries
+  };
+
+  TGraph2D *            Convert2Graph          (TNtupleD & data) const;
+  TGraph2D *            SelectSpectralFunction (const Target & target) const;
+  const SamplingTable * SelectSamplingTable    (const Target & target) const;
+  void                  BuildSamplingTable     (TGraph2D * sf, SamplingTable & table) const;
+  bool                  GenerateFromTable      (const SamplingTable & table, double & k, double & w) const;
+  bool                  GenerateFromRejection  (TGraph2D * sf, double & k, double & w) const;
 
   TGraph2D * fSfFe56;   ///< Benhar's Fe56 SF
   TGraph2D * fSfC12;    ///< Benhar's C12 SF
+
+  bool          fUseSamplingTable; ///< sample from tabulated cdf rather than by accept/reject?
+  int           fSamplingTableNK;  ///< number of k bins in the sampling tables
+  int           fSamplingTableNW;  ///< number of w bins in the sampling tables
+  SamplingTable fTableFe56;        ///< Fe56 sampling table
+  SamplingTable fTableC12;         ///< C12 sampling table
 };
 
 }      // genie namespace
@@ -11,6 +11,7 @@
 #include <sstream>
 #include <fstream>
 #include <cstdlib>
+#include <algorithm>
 
 #include <TSystem.h>
 #include <TMath.h>
@@ -86,11 +87,10 @@ double GRV98LO::Gluon(double x, double Q2) const
 //____________________________________________________________________________
 PDF_t GRV98LO::AllPDFs(double x, double Q2) const
 {
-  PDF_t pdf;
-
   if(!fInitialized) {
     LOG("GRV98LO", pWARN)
       << "GRV98LO algorithm was not initialized succesfully";
+    PDF_t pdf;
     pdf.uval = 0.;
     pdf.dval = 0.;
     pdf.usea = 0.;
@@ -103,6 +103,23 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
     return pdf;
   }
 
+  return this->Evaluate(x,Q2);
+}
+//____________________________________________________________________________
+void GRV98LO::AllPDFs(
+       int n, const double * x, const double * Q2, PDF_t * pdfs) const
+{
+  if(!fInitialized) {
+    PDFModelI::AllPDFs(n, x, Q2, pdfs);
+    return;
+  }
+  for(int i = 0; i < n; i++) {
+    pdfs[i] = this->Evaluate(x[i], Q2[i]);
+  }
+}
+//____________________________________________________________________________
+PDF_t GRV98LO::Evaluate(double x, double Q2) const
+{
   LOG("GRV98LO", pDEBUG)
     << "Inputs x = " << x << ", Q2 = " << Q2;
 
@@ -123,15 +140,39 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
   double x1p5  = x1*x1p4;
   double x1p7  = x1p3*x1p4;
 
-  double uv = fXUVF->Eval(logx,logQ2) * x1p3 * xv;
-  double dv = fXDVF->Eval(logx,logQ2) * x1p4 * xv;
-  double de = fXDEF->Eval(logx,logQ2) * x1p7 * xv;
-  double ud = fXUDF->Eval(logx,logQ2) * x1p7 * xs;
+  // locate the grid cell (once, for all partons) and the bilinear weights
+  int ix = std::upper_bound(fGridLogXbj, fGridLogXbj+kNXbj, logx ) - fGridLogXbj - 1;
+  int iq = std::upper_bound(fGridLogQ2,  fGridLogQ2 +kNQ2,  logQ2) - fGridLogQ2  - 1;
+  ix = std::max(0, std::min(ix, kNXbj-2));
+  iq = std::max(0, std::min(iq, kNQ2 -2));
+
+  double t = (logx  - fGridLogXbj[ix]) / (fGridLogXbj[ix+1] - fGridLogXbj[ix]);
+  double u = (logQ2 - fGridLogQ2 [iq]) / (fGridLogQ2 [iq+1] - fGridLogQ2 [iq]);
+  double w00 = (1-t)*(1-u);
+  double w10 =    t *(1-u);
+  double w01 = (1-t)*   u ;
+  double w11 =    t *   u ;
+
+  const double * k00 = &fKnots[((iq  )*kNXbj + ix  )*kNParton];
+  const double * k10 = k00 + kNParton;
+  const double * k01 = k00 + kNXbj*kNParton;
+  const double * k11 = k01 + kNParton;
+
+  double f[kNParton];
+  for(int ip = 0; ip < kNParton; ip++) {
+    f[ip] = w00*k00[ip] + w10*k10[ip] + w01*k01[ip] + w11*k11[ip];
+  }
+
+  double uv = f[0] * x1p3 * xv;
+  double dv = f[1] * x1p4 * xv;
+  double de = f[2] * x1p7 * xv;
+  double ud = f[3] * x1p7 * xs;
   double us = 0.5 * (ud - de);
   double ds = 0.5 * (ud + de);
-  double ss = fXSF->Eval(logx,logQ2)  * x1p7 * xs;
-  double gl = fXGF->Eval(logx,logQ2)  * x1p5 * xs;
+  double ss = f[4] * x1p7 * xs;
+  double gl = f[5] * x1p5 * xs;
 
+  PDF_t pdf;
   pdf.uval = uv;
   pdf.dval = dv;
   pdf.usea = us;
@@ -266,25 +307,14 @@ void GRV98LO::Initialize(void)
 
   grid_file.close();
 
-  // arrays for interpolation routines
+  // knots for the interpolation, interleaved by parton
   //
 
-  vector<double> gridLogQ2 (kNQ2);
-  vector<double> gridLogXbj(kNXbj);
-  vector<double> knotsXUVF(kNQ2*kNXbj);
-  vector<double> knotsXDVF(kNQ2*kNXbj);
-  vector<double> knotsXDEF(kNQ2*kNXbj);
-  vector<double> knotsXUDF(kNQ2*kNXbj);
-  vector<double> knotsXSF (kNQ2*kNXbj);
-  vector<double> knotsXGF (kNQ2*kNXbj);
+  fKnots.assign(kNQ2*kNXbj*kNParton, 0.);
 
   k=0;
   for(int i=0; i < kNQ2; i++) {
-    double logQ2 = std::log(fGridQ2[i]);
-    gridLogQ2[i] = logQ2;
     for(int j=0; j < kNXbj - 1; j++) {
-       double logx  = std::log(fGridXbj[j]);
-       gridLogXbj[j] = logx;
        double xb0v  = std::sqrt(fGridXbj[j]);
        double xb0s  = std::pow(fGridXbj[j], -0.2);
        double xb1   = 1 - fGridXbj[j];
@@ -292,32 +322,18 @@ void GRV98LO::Initialize(void)
        double xb1p4 = std::pow(xb1, 4.);
        double xb1p5 = std::pow(xb1, 5.);
        double xb1p7 = std::pow(xb1, 7.);
-       knotsXUVF[k] = fParton[0][i][j] / (xb1p3 * xb0v);
-       knotsXDVF[k] = fParton[1][i][j] / (xb1p4 * xb0v);
-       knotsXDEF[k] = fParton[2][i][j] / (xb1p7 * xb0v);
-       knotsXUDF[k] = fParton[3][i][j] / (xb1p7 * xb0s);
-       knotsXSF [k] = fParton[4][i][j] / (xb1p7 * xb0s);
-       knotsXGF [k] = fParton[5][i][j] / (xb1p5 * xb0s);
-       k++;
+       fKnots[k+0] = fParton[0][i][j] / (xb1p3 * xb0v);
+       fKnots[k+1] = fParton[1][i][j] / (xb1p4 * xb0v);
+       fKnots[k+2] = fParton[2][i][j] / (xb1p7 * xb0v);
+       fKnots[k+3] = fParton[3][i][j] / (xb1p7 * xb0s);
+       fKnots[k+4] = fParton[4][i][j] / (xb1p7 * xb0s);
+       fKnots[k+5] = fParton[5][i][j] / (xb1p5 * xb0s);
+       k += kNParton;
     }
-    double logxmax = TMath::Log(fGridXbj[kNXbj-1]);
-    gridLogXbj[kNXbj-1] = logxmax;
-    knotsXUVF[k] = 0;
-    knotsXDVF[k] = 0;
-    knotsXDEF[k] = 0;
-    knotsXUDF[k] = 0;
-    knotsXSF [k] = 0;
-    knotsXGF [k] = 0;
-    k++;
+    // knots at the last x grid point (x=1) are left at 0
+    k += kNParton;
   }
 
-  fXUVF = std::make_unique<Interpolator2D>(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUVF[0]);
-  fXDVF = std::make_unique<Interpolator2D>(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDVF[0]);
-  fXDEF = std::make_unique<Interpolator2D>(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDEF[0]);
-  fXUDF = std::make_unique<Interpolator2D>(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUDF[0]);
-  fXSF  = std::make_unique<Interpolator2D>(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXSF [0]);
-  fXGF  = std::make_unique<Interpolator2D>(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXGF [0]);
-
   fInitialized = true;
 }
 //____________________________________________________________________________
@@ -12,6 +12,11 @@
           The original code contains NLO (MSbar and DIS schemes) and LO pdf
           implementations. Only the LO pdfs are implemented here.
 
+          The parton grids are interpolated bilinearly in (log x, log Q^2).
+          All parton flavours are stored interleaved at each grid point, so
+          that a single cell search and set of interpolation weights serves
+          every flavour.
+
           Reference listed in original code:
           M. Glueck, E. Reya, A. Vogt,
           Eur. Phys. J. C5 (1998) 461-470; hep-ph/9806404
@@ -30,9 +35,10 @@
 #define _GRV98LO_H_
 
 #include "Physics/PartonDistributions/PDFModelI.h"
-#include "Framework/Numerical/Interpolator2D.h"
 
-#include <memory>
+#include <vector>
+
+using std::vector;
 
 namespace genie {
 
@@ -55,6 +61,7 @@ public:
   double Top         (double x, double Q2) const;
   double Gluon       (double x, double Q2) const;
   PDF_t  AllPDFs     (double x, double Q2) const;
+  void   AllPDFs     (int n, const double * x, const double * Q2, PDF_t * pdfs) const;
 
   // override the default "Configure" implementation
   // of the Algorithm interface
@@ -64,7 +71,8 @@ public:
 
 private:
 
-  void Initialize   (void);
+  void  Initialize   (void);
+  PDF_t Evaluate     (double x, double Q2) const;
 
   bool fInitialized;
 
@@ -84,14 +92,10 @@ private:
   double fGridLogXbj[kNXbj]; // log(Bjorken-x) values in grid
   double fParton    [kNParton][kNQ2][kNXbj-1]; // PARTON (NPART,NQ,NX-1) array in original code
   //
-  // arrays for the interpolation routine
+  // interpolation knots: xuvf, xdvf, xdef, xudf, xsf, xgf = f(logx,logQ2),
+  // interleaved as [iq][ix][parton]
   //
-  std::unique_ptr<Interpolator2D> fXUVF; // = f(logx,logQ2)
-  std::unique_ptr<Interpolator2D> fXDVF;
-  std::unique_ptr<Interpolator2D> fXDEF;
-  std::unique_ptr<Interpolator2D> fXUDF;
-  std::unique_ptr<Interpolator2D> fXSF;
-  std::unique_ptr<Interpolator2D> fXGF;
+  vector<double> fKnots;
 };
 
 }         // genie namespace
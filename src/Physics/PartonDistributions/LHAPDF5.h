@@ -33,6 +33,8 @@ public:
   LHAPDF5(string config);
   virtual ~LHAPDF5();
 
+  using PDFModelI::AllPDFs; // inherit versions not overridden here
+
   // Implement PDFModelI interface
 
   double UpValence   (double x, double Q2) const;
@@ -39,6 +39,8 @@ public:
   LHAPDF6(string config);
   virtual ~LHAPDF6();
 
+  using PDFModelI::AllPDFs; // inherit versions not overridden here
+
   // Implement the PDFModelI interface
 
   double UpValence   (double x, double Q2) const;
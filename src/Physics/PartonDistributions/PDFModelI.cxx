@@ -36,3 +36,11 @@ PDFModelI::~PDFModelI()
 
 }
 //____________________________________________________________________________
+void PDFModelI::AllPDFs(
+       int n, const double * x, const double * Q2, PDF_t * pdfs) const
+{
+  for(int i = 0; i < n; i++) {
+    pdfs[i] = this->AllPDFs(x[i], Q2[i]);
+  }
+}
+//____________________________________________________________________________
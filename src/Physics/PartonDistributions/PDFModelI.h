@@ -44,6 +44,11 @@ public:
   virtual double Gluon       (double x, double Q2) const = 0;
   virtual PDF_t  AllPDFs     (double x, double Q2) const = 0;
 
+  //-- evaluate all pdfs at n (x,Q2) points (eg for integrators).
+  //   the default implementation calls AllPDFs(x,Q2) at each point.
+
+  virtual void   AllPDFs     (int n, const double * x, const double * Q2, PDF_t * pdfs) const;
+
 protected:
 
   PDFModelI();
@@ -68,9 +68,6 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
     LOG("QELEvent", pDEBUG) << "Generating QE event kinematics...";
 
-    // Get the random number generators
-    RandomGen * rnd = RandomGen::Instance();
-
     // Access cross section algorithm for running thread
     RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
     const EventGeneratorI * evg = rtinfo->RunningThread();
@@ -100,8 +97,8 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
     // Store the hit nucleon radius before computing the maximum differential
     // cross section (important when using the local Fermi gas model)
     Target* tgt = interaction->InitState().TgtPtr();
-    double hitNucPos = nucleon->X4()->Vect().Mag();
-    tgt->SetHitNucPosition( hitNucPos );
+    fHitNucPos = nucleon->X4()->Vect().Mag();
+    tgt->SetHitNucPosition( fHitNucPos );
 
     //-- For the subsequent kinematic selection with the rejection method:
     //   Calculate the max differential cross section or retrieve it from the
@@ -130,160 +127,187 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
       }
     }
 
-    // In the accept/reject loop, each iteration samples a new value of
+    // In the accept/reject loop, each proposed point samples a new value of
     //   - the hit nucleon 3-momentum,
     //   - its binding energy (only actually used if fHitNucleonBindingMode == kUseNuclearModel)
     //   - the final lepton scattering angles in the neutrino-and-hit-nucleon COM frame
     //     (measured with respect to the velocity of the COM frame as seen in the lab frame)
-    unsigned int iter = 0;
-    bool accept = false;
-    while (1) {
-
-        iter++;
-        LOG("QELEvent", pINFO) << "Attempt #: " << iter;
-        if(iter > kRjMaxIterations) {
-            LOG("QELEvent", pWARN)
-                << "Couldn't select a valid (pNi, Eb, cos_theta_0, phi_0) tuple after "
-                << iter << " iterations";
-            evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-            genie::exceptions::EVGThreadException exception;
-            exception.SetReason("Couldn't select kinematics");
-            exception.SwitchOnFastForward();
-            throw exception;
-        }
-
-        // If the target is a composite nucleus, then sample an initial nucleon
-        // 3-momentum and removal energy from the nuclear model.
-        if ( tgt->IsNucleus() ) {
-          fNuclModel->GenerateNucleon(*tgt, hitNucPos);
-        }
-        else {
-          // Otherwise, just set the nucleon to be at rest in the lab frame and
-          // unbound. Use the nuclear model to make these assignments. The call
-          // to BindHitNucleon() will apply them correctly below.
-          fNuclModel->SetMomentum3( TVector3(0., 0., 0.) );
-          fNuclModel->SetRemovalEnergy( 0. );
-        }
-
-        // Put the hit nucleon off-shell (if needed) so that we can get the correct
-        // value of cos_theta0_max
-        genie::utils::BindHitNucleon(*interaction, *fNuclModel,
-          fEb, fHitNucleonBindingMode);
+    // Points are proposed in batches of fRjBatchSize and passed to the common
+    // accept/reject step
+    double xsec = -1;
+    bool accept = this->SelectKinematics(evrec, xsec_max, xsec);
+    if(!accept) {
+        LOG("QELEvent", pWARN)
+            << "Couldn't select a valid (pNi, Eb, cos_theta_0, phi_0) tuple after "
+            << kRjMaxIterations << " iterations";
+        evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
+        genie::exceptions::EVGThreadException exception;
+        exception.SetReason("Couldn't select kinematics");
+        exception.SwitchOnFastForward();
+        throw exception;
+    }
 
-        double cos_theta0_max = std::min(1., CosTheta0Max(*interaction));
+    // The generated kinematics are accepted, finish-up module's job
+    double gQ2 = interaction->KinePtr()->Q2(false);
+    LOG("QELEvent", pINFO) << "*Selected* Q^2 = " << gQ2 << " GeV^2";
+
+    // reset bits
+    interaction->ResetBit(kISkipProcessChk);
+    interaction->ResetBit(kISkipKinematicChk);
+    interaction->ResetBit(kIAssumeFreeNucleon);
+
+    // get neutrino energy at struck nucleon rest frame and the
+    // struck nucleon mass (can be off the mass shell)
+    const InitialState & init_state = interaction->InitState();
+    double E  = init_state.ProbeE(kRfHitNucRest);
+    double M = init_state.Tgt().HitNucP4().M();
+    LOG("QELKinematics", pNOTICE) << "E = " << E << ", M = "<< M;
+
+    // The hadronic inv. mass is equal to the recoil nucleon on-shell mass.
+    // For QEL/Charm events it is set to be equal to the on-shell mass of
+    // the generated charm baryon (Lamda_c+, Sigma_c+ or Sigma_c++)
+    // Similarly for strange baryons
+    //
+    const XclsTag & xcls = interaction->ExclTag();
+    int rpdgc = 0;
+    if (xcls.IsCharmEvent()) {
+        rpdgc = xcls.CharmHadronPdg();
+    } else if (xcls.IsStrangeEvent()) {
+        rpdgc = xcls.StrangeHadronPdg();
+    } else {
+        rpdgc = interaction->RecoilNucleonPdg();
+    }
+    assert(rpdgc);
+    double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+    LOG("QELEvent", pNOTICE) << "Selected: W = "<< gW;
+
+    // (W,Q2) -> (x,y)
+    double gx=0, gy=0;
+    kinematics::WQ2toXY(E,M,gW,gQ2,gx,gy);
+
+    // lock selected kinematics & clear running values
+    interaction->KinePtr()->SetQ2(gQ2, true);
+    interaction->KinePtr()->SetW (gW,  true);
+    interaction->KinePtr()->Setx (gx,  true);
+    interaction->KinePtr()->Sety (gy,  true);
+    interaction->KinePtr()->ClearRunningValues();
+
+    // set the cross section for the selected kinematics
+    evrec->SetDiffXSec(xsec, kPSQELEvGen);
+
+    TLorentzVector lepton(interaction->KinePtr()->FSLeptonP4());
+    TLorentzVector outNucleon(interaction->KinePtr()->HadSystP4());
+    TLorentzVector x4l(*(evrec->Probe())->X4());
+
+    // Add the final-state lepton to the event record
+    evrec->AddParticle(interaction->FSPrimLeptonPdg(), kIStStableFinalState,
+      evrec->ProbePosition(), -1, -1, -1, interaction->KinePtr()->FSLeptonP4(), x4l);
+
+    // Set its polarization
+    utils::SetPrimaryLeptonPolarization( evrec );
+
+    // Add the final-state nucleon to the event record
+    GHepStatus_t ist = (tgt->IsNucleus()) ? kIStHadronInTheNucleus : kIStStableFinalState;
+    evrec->AddParticle(interaction->RecoilNucleonPdg(), ist, evrec->HitNucleonPosition(),
+      -1, -1, -1, interaction->KinePtr()->HadSystP4(), x4l);
+
+    // Store struck nucleon momentum and binding energy
+    TLorentzVector p4ptr = interaction->InitStatePtr()->TgtPtr()->HitNucP4();
+    LOG("QELEvent",pNOTICE) << "pn: " << p4ptr.X() << ", "
+      << p4ptr.Y() << ", " << p4ptr.Z() << ", " << p4ptr.E();
+    nucleon->SetMomentum(p4ptr);
+    nucleon->SetRemovalEnergy(fEb);
+
+    // add a recoiled nucleus remnant
+    this->AddTargetNucleusRemnant(evrec);
 
-        // If the allowed range of cos(theta_0) is vanishing, skip doing the
-        // full differential cross section calculation (it will be zero)
-        if ( cos_theta0_max <= -1. ) continue;
+    LOG("QELEvent", pINFO) << "Done generating QE event kinematics!";
+}
+//___________________________________________________________________________
+bool QELEventGenerator::ProposeKinematics(
+                                    GHepRecord * evrec, double * point) const
+{
+// Samples the hit nucleon state and the lepton angles for a single point.
+// Returns false (no point to evaluate) if the allowed cos_theta_0 range is
+// vanishing
 
-        // Pick a direction
-        // NOTE: In the kPSQELEvGen phase space used by this generator,
-        // these angles are specified with respect to the velocity of the
-        // probe + hit nucleon COM frame as measured in the lab frame. That is,
-        // costheta = 1 means that the outgoing lepton's COM frame 3-momentum
-        // points parallel to the velocity of the COM frame.
-        double costheta = rnd->RndKine().Uniform(-1., cos_theta0_max); // cosine theta
-        double phi = rnd->RndKine().Uniform( 2.*kPi ); // phi: [0, 2pi]
+    RandomGen * rnd = RandomGen::Instance();
+    Interaction * interaction = evrec->Summary();
+    Target * tgt = interaction->InitState().TgtPtr();
 
-        // Set the "bind_nucleon" flag to false in this call to ComputeFullQELPXSec
-        // since we've already done that above
-        LOG("QELEvent", pDEBUG) << "cth0 = " << costheta << ", phi0 = " << phi;
-        double xsec = genie::utils::ComputeFullQELPXSec(interaction, fNuclModel,
-          fXSecModel, costheta, phi, fEb, fHitNucleonBindingMode, fMinAngleEM, false);
+    // If the target is a composite nucleus, then sample an initial nucleon
+    // 3-momentum and removal energy from the nuclear model.
+    if ( tgt->IsNucleus() ) {
+      fNuclModel->GenerateNucleon(*tgt, fHitNucPos);
+    }
+    else {
+      // Otherwise, just set the nucleon to be at rest in the lab frame and
+      // unbound. Use the nuclear model to make these assignments. The call
+      // to BindHitNucleon() will apply them correctly below.
+      fNuclModel->SetMomentum3( TVector3(0., 0., 0.) );
+      fNuclModel->SetRemovalEnergy( 0. );
+    }
 
-        // select/reject event
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
+    // Put the hit nucleon off-shell (if needed) so that we can get the correct
+    // value of cos_theta0_max
+    genie::utils::BindHitNucleon(*interaction, *fNuclModel,
+      fEb, fHitNucleonBindingMode);
+
+    double cos_theta0_max = std::min(1., CosTheta0Max(*interaction));
+
+    // If the allowed range of cos(theta_0) is vanishing, skip doing the
+    // full differential cross section calculation (it will be zero)
+    if ( cos_theta0_max <= -1. ) return false;
+
+    // Pick a direction
+    // NOTE: In the kPSQELEvGen phase space used by this generator,
+    // these angles are specified with respect to the velocity of the
+    // probe + hit nucleon COM frame as measured in the lab frame. That is,
+    // costheta = 1 means that the outgoing lepton's COM frame 3-momentum
+    // points parallel to the velocity of the COM frame.
+    double costheta = rnd->RndKine().Uniform(-1., cos_theta0_max); // cosine theta
+    double phi = rnd->RndKine().Uniform( 2.*kPi ); // phi: [0, 2pi]
+
+    LOG("QELEvent", pDEBUG) << "cth0 = " << costheta << ", phi0 = " << phi;
+
+    const TVector3 & p3 = fNuclModel->Momentum3();
+    point[0] = p3.X();
+    point[1] = p3.Y();
+    point[2] = p3.Z();
+    point[3] = fNuclModel->RemovalEnergy();
+    point[4] = costheta;
+    point[5] = phi;
+    return true;
+}
+//___________________________________________________________________________
+void QELEventGenerator::EvaluateKinematics(GHepRecord * evrec,
+               int npoints, const double * points, double * xsec) const
+{
+// Restores the hit nucleon state of each point and computes the full
+// differential cross section. The "bind_nucleon" flag is set in the call to
+// ComputeFullQELPXSec since the nucleon state of the point has to be bound
+// again (the interaction holds the last point evaluated)
 
-        double t = xsec_max * rnd->RndKine().Rndm();
+    Interaction * interaction = evrec->Summary();
 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-        LOG("QELEvent", pDEBUG)
-            << "xsec= " << xsec << ", Rnd= " << t;
-#endif
-        accept = (t < xsec);
-
-        // If the generated kinematics are accepted, finish-up module's job
-        if(accept) {
-            double gQ2 = interaction->KinePtr()->Q2(false);
-            LOG("QELEvent", pINFO) << "*Selected* Q^2 = " << gQ2 << " GeV^2";
-
-            // reset bits
-            interaction->ResetBit(kISkipProcessChk);
-            interaction->ResetBit(kISkipKinematicChk);
-            interaction->ResetBit(kIAssumeFreeNucleon);
-
-            // get neutrino energy at struck nucleon rest frame and the
-            // struck nucleon mass (can be off the mass shell)
-            const InitialState & init_state = interaction->InitState();
-            double E  = init_state.ProbeE(kRfHitNucRest);
-            double M = init_state.Tgt().HitNucP4().M();
-            LOG("QELKinematics", pNOTICE) << "E = " << E << ", M = "<< M;
-
-            // The hadronic inv. mass is equal to the recoil nucleon on-shell mass.
-            // For QEL/Charm events it is set to be equal to the on-shell mass of
-            // the generated charm baryon (Lamda_c+, Sigma_c+ or Sigma_c++)
-            // Similarly for strange baryons
-            //
-            const XclsTag & xcls = interaction->ExclTag();
-            int rpdgc = 0;
-            if (xcls.IsCharmEvent()) {
-                rpdgc = xcls.CharmHadronPdg();
-            } else if (xcls.IsStrangeEvent()) {
-                rpdgc = xcls.StrangeHadronPdg();
-            } else {
-                rpdgc = interaction->RecoilNucleonPdg();
-            }
-            assert(rpdgc);
-            double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
-            LOG("QELEvent", pNOTICE) << "Selected: W = "<< gW;
-
-            // (W,Q2) -> (x,y)
-            double gx=0, gy=0;
-            kinematics::WQ2toXY(E,M,gW,gQ2,gx,gy);
-
-            // lock selected kinematics & clear running values
-            interaction->KinePtr()->SetQ2(gQ2, true);
-            interaction->KinePtr()->SetW (gW,  true);
-            interaction->KinePtr()->Setx (gx,  true);
-            interaction->KinePtr()->Sety (gy,  true);
-            interaction->KinePtr()->ClearRunningValues();
-
-            // set the cross section for the selected kinematics
-            evrec->SetDiffXSec(xsec, kPSQELEvGen);
-
-            TLorentzVector lepton(interaction->KinePtr()->FSLeptonP4());
-            TLorentzVector outNucleon(interaction->KinePtr()->HadSystP4());
-            TLorentzVector x4l(*(evrec->Probe())->X4());
-
-            // Add the final-state lepton to the event record
-            evrec->AddParticle(interaction->FSPrimLeptonPdg(), kIStStableFinalState,
-              evrec->ProbePosition(), -1, -1, -1, interaction->KinePtr()->FSLeptonP4(), x4l);
-
-            // Set its polarization
-            utils::SetPrimaryLeptonPolarization( evrec );
-
-            // Add the final-state nucleon to the event record
-            GHepStatus_t ist = (tgt->IsNucleus()) ? kIStHadronInTheNucleus : kIStStableFinalState;
-            evrec->AddParticle(interaction->RecoilNucleonPdg(), ist, evrec->HitNucleonPosition(),
-              -1, -1, -1, interaction->KinePtr()->HadSystP4(), x4l);
-
-            // Store struck nucleon momentum and binding energy
-            TLorentzVector p4ptr = interaction->InitStatePtr()->TgtPtr()->HitNucP4();
-            LOG("QELEvent",pNOTICE) << "pn: " << p4ptr.X() << ", "
-              << p4ptr.Y() << ", " << p4ptr.Z() << ", " << p4ptr.E();
-            nucleon->SetMomentum(p4ptr);
-            nucleon->SetRemovalEnergy(fEb);
-
-            // add a recoiled nucleus remnant
-            this->AddTargetNucleusRemnant(evrec);
-
-            break; // done
-        } else { // accept throw
-            LOG("QELEvent", pDEBUG) << "Reject current throw...";
-        }
+    for(int ip = 0; ip < npoints; ip++) {
+      const double * point = points + ip*fRjPointSize;
+      fNuclModel->SetMomentum3( TVector3(point[0], point[1], point[2]) );
+      fNuclModel->SetRemovalEnergy( point[3] );
+      xsec[ip] = genie::utils::ComputeFullQELPXSec(interaction, fNuclModel,
+        fXSecModel, point[4], point[5], fEb, fHitNucleonBindingMode,
+        fMinAngleEM, true);
+    }
+}
+//___________________________________________________________________________
+void QELEventGenerator::ApplyKinematics(
+                              GHepRecord * evrec, const double * point) const
+{
+// The kinematics of a point are only fully set by the cross section
+// calculation, so re-evaluate it
 
-    } // iterations - while(1) loop
-    LOG("QELEvent", pINFO) << "Done generating QE event kinematics!";
+    double xsec = 0;
+    this->EvaluateKinematics(evrec, 1, point, &xsec);
 }
 //___________________________________________________________________________
 void QELEventGenerator::AddTargetNucleusRemnant(GHepRecord * evrec) const
@@ -404,6 +428,20 @@ void QELEventGenerator::LoadConfig(void)
     fHitNucleonBindingMode = genie::utils::StringToQELBindingMode( binding_mode );
 
     GetParamDef( "MaxXSecNucleonThrows", fMaxXSecNucleonThrows, 800 );
+
+    // Number of kinematical points proposed per accept/reject batch and
+    // period (in accepted events per channel) for printing the rejection
+    // method statistics
+    GetParamDef( "RejectionBatchSize", fRjBatchSize, 1 );
+    assert(fRjBatchSize>0);
+    GetParamDef( "RejectionStats-PrintPeriod", fRjStatsPrintPeriod, 0 );
+
+    // Proposed points are (px, py, pz, removal energy, cos_theta_0, phi_0)
+    // tuples evaluated through ComputeFullQELPXSec() rather than through
+    // kinematic variables (see EvaluateKinematics())
+    fRjPhaseSpace = kPSQELEvGen;
+    fRjKineVars.clear();
+    fRjPointSize = 6;
 }
 //____________________________________________________________________________
 double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
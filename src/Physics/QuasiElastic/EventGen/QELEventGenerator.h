@@ -49,12 +49,21 @@ private:
   void   LoadConfig     (void);
   double ComputeMaxXSec(const Interaction* in) const;
 
+  // implement the proposal and evaluation steps of the rejection method:
+  // points carry the hit nucleon state along with the lepton angles
+  bool ProposeKinematics  (GHepRecord * evrec, double * point) const;
+  void EvaluateKinematics (GHepRecord * evrec, int npoints,
+                           const double * points, double * xsec) const;
+  void ApplyKinematics    (GHepRecord * evrec, const double * point) const;
+
   void AddTargetNucleusRemnant (GHepRecord * evrec) const; ///< add a recoiled nucleus remnant
 
   const NuclearModelI *  fNuclModel;   ///< nuclear model
 
   mutable double fMinAngleEM;
 
+  mutable double fHitNucPos; ///< hit nucleon radius, current event
+
   /// Enum that indicates which approach should be used to handle the binding
   /// energy of the struck nucleon
   QELEvGen_BindingMode_t fHitNucleonBindingMode;
@@ -36,12 +36,18 @@ using namespace genie::constants;
 using namespace genie::utils::gsl;
 
 //____________________________________________________________________________
-NewQELXSec::NewQELXSec() : XSecIntegratorI("genie::NewQELXSec")
+NewQELXSec::NewQELXSec() : XSecIntegratorI("genie::NewQELXSec"),
+fNuclModelParam("IntegralNuclearModel"),
+fBindingModeParam("IntegralNucleonBindingMode"),
+fNuclInfluenceCutoffParam("IntegralNuclearInfluenceCutoffEnergy")
 {
 
 }
 //____________________________________________________________________________
-NewQELXSec::NewQELXSec(std::string config) : XSecIntegratorI("genie::NewQELXSec", config)
+NewQELXSec::NewQELXSec(std::string config) : XSecIntegratorI("genie::NewQELXSec", config),
+fNuclModelParam("IntegralNuclearModel"),
+fBindingModeParam("IntegralNucleonBindingMode"),
+fNuclInfluenceCutoffParam("IntegralNuclearInfluenceCutoffEnergy")
 {
 
 }
@@ -55,9 +61,7 @@ double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in)
   interaction->SetBit( kISkipProcessChk );
   //interaction->SetBit( kISkipKinematicChk );
 
-  const NuclearModelI* nucl_model = dynamic_cast<const NuclearModelI*>(
-    model->SubAlg("IntegralNuclearModel") );
-  assert( nucl_model );
+  const NuclearModelI* nucl_model = fNuclModelParam.Value( model );
 
   AlgFactory* algf = AlgFactory::Instance();
   const VertexGenerator* vtx_gen = dynamic_cast<const VertexGenerator*>(
@@ -69,8 +73,7 @@ double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in)
   QELEvGen_BindingMode_t bind_mode = kOnShell;
   Target* tgt = interaction->InitState().TgtPtr();
   if ( tgt->IsNucleus() ) {
-    std::string bind_mode_str = model->GetConfig()
-      .GetString( "IntegralNucleonBindingMode" );
+    const std::string & bind_mode_str = fBindingModeParam.Value( model );
     bind_mode = genie::utils::StringToQELBindingMode( bind_mode_str );
   }
 
@@ -115,8 +118,7 @@ double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in)
   // Also use this approach if we're over the "nuclear influence" cutoff
   // energy for the probe. Beyond the cutoff, the effects of Fermi motion
   // and the removal energy are assumed to be small enough to be neglected
-  double E_lab_cutoff = model->GetConfig()
-    .GetDouble("IntegralNuclearInfluenceCutoffEnergy");
+  double E_lab_cutoff = fNuclInfluenceCutoffParam.Value( model );
 
   double probeE = interaction->InitState().ProbeE( kRfLab );
   if ( !tgt->IsNucleus() || probeE > E_lab_cutoff ) {
@@ -139,8 +141,19 @@ double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in)
   // to allow for using the local Fermi gas model). The MC estimator for the
   // total cross section is simply the mean of ig.Integral() for all of the
   // sampled nucleons.
-  double xsec_sum = 0.;
-  for (int n = 0; n < fNumNucleonThrows; ++n) {
+  //
+  // The running mean and variance are accumulated using Welford's algorithm.
+  // If a target relative precision has been configured, the loop stops as soon
+  // as the standard error on the mean drops below it (after a minimum number of
+  // throws, so that the variance estimate itself is meaningful). Otherwise
+  // exactly fNumNucleonThrows nucleons are sampled, as before.
+  bool adaptive = ( fNucleonThrowsRelErr > 0. );
+
+  double xsec_mean = 0.;
+  double xsec_m2   = 0.;
+  double rel_err   = 0.;
+  int n = 0;
+  while ( n < fNumNucleonThrows ) {
 
     // Select a new position for the initial hit nucleon (needed for the local
     // Fermi gas model, but other than slowing things down a bit, it doesn't
@@ -158,14 +171,33 @@ double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in)
     // the final lepton angles.
     double xsec = ig.Integral(kine_min, kine_max);
 
-    xsec_sum += xsec;
+    ++n;
+    double delta = xsec - xsec_mean;
+    xsec_mean += delta / n;
+    xsec_m2   += delta * (xsec - xsec_mean);
+
+    if ( !adaptive || n < fMinNucleonThrows || xsec_mean <= 0. ) continue;
+
+    double std_err = TMath::Sqrt( xsec_m2 / (n - 1) / n );
+    rel_err = std_err / xsec_mean;
+    if ( rel_err < fNucleonThrowsRelErr ) break;
   }
 
   delete func;
 
-  // MC estimator of the total cross section is the mean of the xsec values
-  double xsec_mean = xsec_sum / fNumNucleonThrows;
+  if ( adaptive ) {
+    LOG("NewQELXSec", pINFO) << "Averaged over " << n
+      << " nucleon throws (max: " << fNumNucleonThrows << "), relative"
+      << " standard error = " << rel_err << " (target: "
+      << fNucleonThrowsRelErr << ")";
+    if ( rel_err >= fNucleonThrowsRelErr ) {
+      LOG("NewQELXSec", pWARN) << "Target relative precision for the MC"
+        << " integration over initial nucleons was not reached after "
+        << n << " throws";
+    }
+  }
 
+  // MC estimator of the total cross section is the mean of the xsec values
   return xsec_mean;
 }
 //____________________________________________________________________________
@@ -196,6 +228,13 @@ void NewQELXSec::LoadConfig(void)
 
   GetParamDef( "NumNucleonThrows", fNumNucleonThrows, 5000 );
 
+  // Optional adaptive stopping rule for the MC integration over initial
+  // nucleons. A non-positive target relative error disables it, in which case
+  // exactly NumNucleonThrows nucleons are always sampled.
+  GetParamDef( "NucleonThrowsRelErr", fNucleonThrowsRelErr, 0. );
+  GetParamDef( "MinNucleonThrows", fMinNucleonThrows, 100 );
+  if ( fMinNucleonThrows < 2 ) fMinNucleonThrows = 2;
+
   // TODO: This is a parameter that may also be specified in the XML
   // configuration for QELEventGenerator. Avoid duplication here to ensure
   // consistency.
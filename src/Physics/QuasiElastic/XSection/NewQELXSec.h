@@ -19,6 +19,7 @@
 #ifndef _NEW_QEL_XSEC_H_
 #define _NEW_QEL_XSEC_H_
 
+#include "Framework/Algorithm/AlgParam.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Physics/QuasiElastic/XSection/QELUtils.h"
 
@@ -88,6 +89,8 @@ private:
   unsigned int fGSLMaxEval;
   AlgId fVertexGenID;
   int fNumNucleonThrows;
+  double fNucleonThrowsRelErr;
+  int fMinNucleonThrows;
   double fMinAngleEM;
 
   // If false, the total cross section will be computed by integrating over
@@ -98,6 +101,12 @@ private:
   // of initial nucleons. This approach is needed to create total cross section
   // splines.
   bool fAverageOverNucleons;
+
+  // Configuration obtained from the cross section model, resolved once per
+  // (re)configuration of the model
+  AlgSubAlgParam<NuclearModelI> fNuclModelParam;
+  AlgParam<std::string>         fBindingModeParam;
+  AlgParam<double>              fNuclInfluenceCutoffParam;
 };
 
 
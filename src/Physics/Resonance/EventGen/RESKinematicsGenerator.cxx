@@ -59,9 +59,6 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
           << "Generating kinematics uniformly over the allowed phase space";
   }
 
-  //-- Get the random number generators
-  RandomGen * rnd = RandomGen::Instance();
-
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
@@ -99,133 +96,127 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   space the max xsec is irrelevant
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
 
-  //-- Try to select a valid W, Q2 pair using the rejection method
-  double dW   = W.max - W.min;
+  //-- Try to select a valid W, Q2 pair using the rejection method.
+  //   Candidate (W,Q2) pairs are proposed in batches of fRjBatchSize points
+  //   and passed to the common accept/reject step
+  fWLim = W;
+  if(!fGenerateUniformly) {
+     // neutrino scattering
+     // Selecting unweighted event kinematics using an importance sampling
+     // method. Q2 with be transformed to QD2 to take out the dipole form.
+     interaction->KinePtr()->SetW(W.min);
+     Range1D_t Q2 = kps.Q2Lim_W();
+     double Q2min  = -99.;
+     if (is_em)
+         Q2min  = Q2.min + kASmallNum;
+     else
+         Q2min  = 0 + kASmallNum;
+     double Q2max  = Q2.max - kASmallNum;
+
+     // In unweighted mode - use transform that takes out the dipole form
+     fQD2Min = utils::kinematics::Q2toQD2(Q2max);
+     fQD2Max = utils::kinematics::Q2toQD2(Q2min);
+  }
+
   double xsec = -1;
+  bool accept = this->SelectKinematics(evrec, xsec_max, xsec);
+  if(!accept) {
+     LOG("RESKinematics", pWARN)
+          << "*** Could not select a valid (W,Q^2) pair after "
+                                      << kRjMaxIterations << " iterations";
+     evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
+     genie::exceptions::EVGThreadException exception;
+     exception.SetReason("Couldn't select kinematics");
+     exception.SwitchOnFastForward();
+     throw exception;
+  }
 
-  unsigned int iter = 0;
-  bool accept = false;
-  while(1) {
-     iter++;
-     if(iter > kRjMaxIterations) {
-         LOG("RESKinematics", pWARN)
-              << "*** Could not select a valid (W,Q^2) pair after "
-                                                    << iter << " iterations";
-         evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-         genie::exceptions::EVGThreadException exception;
-         exception.SetReason("Couldn't select kinematics");
-         exception.SwitchOnFastForward();
-         throw exception;
-     }
-
-     double gW   = 0; // current hadronic invariant mass
-     double gQ2  = 0; // current momentum transfer
-     double gQD2 = 0; // tranformed Q2 to take out dipole form
-
-     if(fGenerateUniformly) 
-     {
-       //-- Generate a W uniformly in the kinematically allowed range.
-       //   For the generated W, compute the Q2 range and generate a value
-       //   uniformly over that range
-       gW  = W.min + dW  * rnd->RndKine().Rndm();
-       interaction->KinePtr()->SetW(gW);
-       Range1D_t Q2 = kps.Q2Lim_W();
-       if(Q2.max<=0. || Q2.min>=Q2.max) continue;
-       gQ2 = Q2.min + (Q2.max-Q2.min) * rnd->RndKine().Rndm();
-       interaction->SetBit(kISkipKinematicChk);
-     } 
-     else 
-     {
-        // neutrino scattering
-        // Selecting unweighted event kinematics using an importance sampling
-        // method. Q2 with be transformed to QD2 to take out the dipole form.
-        interaction->KinePtr()->SetW(W.min);
-        Range1D_t Q2 = kps.Q2Lim_W();
-        double Q2min  = -99.;
-        if (is_em) 
-            Q2min  = Q2.min + kASmallNum; 
-        else 
-            Q2min  = 0 + kASmallNum;
-        double Q2max  = Q2.max - kASmallNum;
-        
-        // In unweighted mode - use transform that takes out the dipole form
-        double QD2min = utils::kinematics::Q2toQD2(Q2max);
-        double QD2max = utils::kinematics::Q2toQD2(Q2min);
-        
-        gW  = W.min + dW  * rnd->RndKine().Rndm();
-        gQD2 = QD2min + (QD2max - QD2min) * rnd->RndKine().Rndm();
-         
-        // QD2 -> Q2
-        gQ2 = utils::kinematics::QD2toQ2(gQD2);
-     } // uniformly over phase space?
-
-     LOG("RESKinematics", pINFO) << "Trying: W = " << gW << ", Q2 = " << gQ2;
-
-     //-- Set kinematics for current trial
-     interaction->KinePtr()->SetW(gW);
-     interaction->KinePtr()->SetQ2(gQ2);
-
-     //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSWQD2fE);
-     //-- Decide whether to accept the current kinematics
-     if(!fGenerateUniformly) 
-     {
-       // unified neutrino / electron scattering
-       double t   = xsec_max * rnd->RndKine().Rndm();
-       this->AssertXSecLimits(interaction, xsec, xsec_max);
-       accept = (t < xsec);
-     } // charged lepton or neutrino scattering?
-     else 
-     {
-        accept = (xsec>0);
-     } // uniformly over phase space
-
-     //-- If the generated kinematics are accepted, finish-up module's job
-     if(accept) {
-        LOG("RESKinematics", pINFO)
-                            << "Selected: W = " << gW << ", Q2 = " << gQ2;
-        // reset 'trust' bits
-        interaction->ResetBit(kISkipProcessChk);
-        interaction->ResetBit(kISkipKinematicChk);
-
-        // compute x,y for selected W,Q2
-        // note: hit nucleon can be off the mass-shell
-        double gx=-1, gy=-1;
-        double M = init_state.Tgt().HitNucP4().M();
-        kinematics::WQ2toXY(E,M,gW,gQ2,gx,gy);
-
-        // set the cross section for the selected kinematics.
-        // we're converting here to the more familiar "W*Q2" space
-        // rather than the "W*Q2D" (precomputed dipole) space that's used above
-        // for generation efficiency in the accept-reject loop
-        double J = kinematics::Jacobian(interaction, kPSWQD2fE, kPSWQ2fE);
-        xsec *= J;
-        evrec->SetDiffXSec(xsec, kPSWQ2fE);
-
-        // for uniform kinematics, compute an event weight as
-        // wght = (phase space volume)*(differential xsec)/(event total xsec)
-        if(fGenerateUniformly) {
-          double vol     = kinematics::PhaseSpaceVolume(interaction,kPSWQ2fE);
-          double totxsec = evrec->XSec();
-          double wght    = (vol/totxsec)*xsec;
-          LOG("RESKinematics", pNOTICE)  << "Kinematics wght = "<< wght;
-
-          // apply computed weight to the current event weight
-          wght *= evrec->Weight();
-          LOG("RESKinematics", pNOTICE) << "Current event wght = " << wght;
-          evrec->SetWeight(wght);
-        }
+  //-- The generated kinematics are accepted, finish-up module's job
+  double gW  = interaction->KinePtr()->W();
+  double gQ2 = interaction->KinePtr()->Q2();
+
+  LOG("RESKinematics", pINFO) << "Selected: W = " << gW << ", Q2 = " << gQ2;
 
-        // lock selected kinematics & clear running values
-        interaction->KinePtr()->SetQ2(gQ2, true);
-        interaction->KinePtr()->SetW (gW,  true);
-        interaction->KinePtr()->Setx (gx,  true);
-        interaction->KinePtr()->Sety (gy,  true);
-        interaction->KinePtr()->ClearRunningValues();
+  // reset 'trust' bits
+  interaction->ResetBit(kISkipProcessChk);
+  interaction->ResetBit(kISkipKinematicChk);
 
-        return;
-     } // accept
-  } // iterations
+  // compute x,y for selected W,Q2
+  // note: hit nucleon can be off the mass-shell
+  double gx=-1, gy=-1;
+  double M = init_state.Tgt().HitNucP4().M();
+  kinematics::WQ2toXY(E,M,gW,gQ2,gx,gy);
+
+  // set the cross section for the selected kinematics.
+  // we're converting here to the more familiar "W*Q2" space
+  // rather than the "W*Q2D" (precomputed dipole) space that's used above
+  // for generation efficiency in the accept-reject loop
+  double J = kinematics::Jacobian(interaction, kPSWQD2fE, kPSWQ2fE);
+  xsec *= J;
+  evrec->SetDiffXSec(xsec, kPSWQ2fE);
+
+  // for uniform kinematics, compute an event weight as
+  // wght = (phase space volume)*(differential xsec)/(event total xsec)
+  if(fGenerateUniformly) {
+    double vol     = kinematics::PhaseSpaceVolume(interaction,kPSWQ2fE);
+    double totxsec = evrec->XSec();
+    double wght    = (vol/totxsec)*xsec;
+    LOG("RESKinematics", pNOTICE)  << "Kinematics wght = "<< wght;
+
+    // apply computed weight to the current event weight
+    wght *= evrec->Weight();
+    LOG("RESKinematics", pNOTICE) << "Current event wght = " << wght;
+    evrec->SetWeight(wght);
+  }
+
+  // lock selected kinematics & clear running values
+  interaction->KinePtr()->SetQ2(gQ2, true);
+  interaction->KinePtr()->SetW (gW,  true);
+  interaction->KinePtr()->Setx (gx,  true);
+  interaction->KinePtr()->Sety (gy,  true);
+  interaction->KinePtr()->ClearRunningValues();
+}
+//___________________________________________________________________________
+bool RESKinematicsGenerator::ProposeKinematics(
+                                    GHepRecord * evrec, double * point) const
+{
+// Proposes a (W,Q2) pair. Returns false (no point to evaluate) if there is
+// no available Q2 range for the W generated uniformly over phase space
+
+  RandomGen * rnd = RandomGen::Instance();
+  Interaction * interaction = evrec->Summary();
+
+  double dW   = fWLim.max - fWLim.min;
+  double gW   = 0; // current hadronic invariant mass
+  double gQ2  = 0; // current momentum transfer
+  double gQD2 = 0; // tranformed Q2 to take out dipole form
+
+  if(fGenerateUniformly)
+  {
+    //-- Generate a W uniformly in the kinematically allowed range.
+    //   For the generated W, compute the Q2 range and generate a value
+    //   uniformly over that range
+    gW  = fWLim.min + dW  * rnd->RndKine().Rndm();
+    interaction->KinePtr()->SetW(gW);
+    Range1D_t Q2 = interaction->PhaseSpace().Q2Lim_W();
+    if(Q2.max<=0. || Q2.min>=Q2.max) return false;
+    gQ2 = Q2.min + (Q2.max-Q2.min) * rnd->RndKine().Rndm();
+    interaction->SetBit(kISkipKinematicChk);
+  }
+  else
+  {
+    gW   = fWLim.min + dW  * rnd->RndKine().Rndm();
+    gQD2 = fQD2Min + (fQD2Max - fQD2Min) * rnd->RndKine().Rndm();
+
+    // QD2 -> Q2
+    gQ2 = utils::kinematics::QD2toQ2(gQD2);
+  } // uniformly over phase space?
+
+  LOG("RESKinematics", pINFO) << "Trying: W = " << gW << ", Q2 = " << gQ2;
+
+  point[0] = gW;
+  point[1] = gQ2;
+  return true;
 }
 //___________________________________________________________________________
 void RESKinematicsGenerator::Configure(const Registry & config)
@@ -261,6 +252,20 @@ void RESKinematicsGenerator::LoadConfig(void)
   // an event weight?
   this->GetParamDef("UniformOverPhaseSpace", fGenerateUniformly, false);
 
+  // Number of kinematical points proposed per accept/reject batch and
+  // period (in accepted events per channel) for printing the rejection
+  // method statistics
+  this->GetParamDef("RejectionBatchSize", fRjBatchSize, 1);
+  assert(fRjBatchSize>0);
+  this->GetParamDef("RejectionStats-PrintPeriod", fRjStatsPrintPeriod, 0);
+
+  // Proposed points are (W,Q2) pairs, evaluated in kPSWQD2fE
+  fRjPhaseSpace = kPSWQD2fE;
+  fRjKineVars.clear();
+  fRjKineVars.push_back(kKVW);
+  fRjKineVars.push_back(kKVQ2);
+  fRjPointSize = fRjKineVars.size();
+
   // Envelope employed when importance sampling is used
   // (initialize with dummy range)
   if(fEnvelope) delete fEnvelope;
@@ -42,11 +42,16 @@ public :
   void Configure(string config);
 
 private:
-  void   LoadConfig      (void);
-  double ComputeMaxXSec  (const Interaction * interaction) const;
+  void   LoadConfig        (void);
+  double ComputeMaxXSec    (const Interaction * interaction) const;
+  bool   ProposeKinematics (GHepRecord * evrec, double * point) const;
 
   mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
   double fWcut;            ///< Wcut parameter in DIS/RES join scheme
+
+  mutable Range1D_t fWLim;   ///< W range of the current event
+  mutable double    fQD2Min; ///< QD2 range of the current event (importance sampling)
+  mutable double    fQD2Max;
 };
 
 }      // genie namespace
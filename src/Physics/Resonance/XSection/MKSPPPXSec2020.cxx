@@ -43,6 +43,7 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 
 #include <algorithm>
+#include <map>
 
 
 using namespace genie;
@@ -216,7 +217,6 @@ double MKSPPPXSec2020::XSec(const Interaction * interaction, KinePhaseSpace_t kp
   double u_minus_M2        = m_pi2 - 2*(q_0*p_10 + abs_mom_q*abs_mom_k*CosTheta);
   double t_minus_mpi2      = -(Q2 + 2*qk);
   double mpi2_minus_k2     = Q2 + m_pi2;
-  double Q                 = TMath::Sqrt(Q2);
 
   // Helicity amplitudes for bkg
   HelicityBkgAmp<std::complex<double>> Hbkg;
@@ -811,134 +811,54 @@ double MKSPPPXSec2020::XSec(const Interaction * interaction, KinePhaseSpace_t kp
 
   /*   Resonace contribution   */
   HelicityAmpVminusARes<std::complex<double>>  Hres;
-  //f_BW_A is same as f_BW_V in the latest version, so rename f_BW_V = f_BW_A -> f_BW
-  std::complex<double>  kappa_f_BW;
 
+  // The hadronic part of the resonance amplitudes only depends on (W, Q2)
+  // and on the helicity amplitude model
+  const RSHelicityAmplModelI * hamplmod = 0;
+  int imodel = 0;
+  if (is_CC)
+  {
+    hamplmod = fHAmplModelCC;
+    imodel   = 0;
+  }
+  else if(is_NC)
+  {
+    if (is_p)
+    {
+      hamplmod = fHAmplModelNCp;
+      imodel   = 1;
+    }
+    else
+    {
+      hamplmod = fHAmplModelNCn;
+      imodel   = 2;
+    }
+  }
+  const std::vector<ResAmpl> & res_ampl = this->ResAmplitudes(imodel, hamplmod, W, Q2, M, m_pi);
+
+  unsigned int ires = 0;
   for (auto res : fResList)
   {
+    const ResAmpl & ampl = res_ampl[ires++];
 
     if (utils::res::Isospin(res) == 1 && SppChannel::FinStateIsospin(spp_channel) == 3)  // skip resonances with I=1/2 if isospin of final state is 3/2
       continue;
 
-    int    NR         = utils::res::ResonanceIndex    (res);
-    int    LR         = utils::res::OrbitalAngularMom (res);
     int    JR         = (utils::res::AngularMom       (res) + 1)/2;
-    double MR         = utils::res::Mass              (res);
-    double WR         = utils::res::Width             (res);
     double Cjsgn_plus = utils::res::Cjsgn_plus        (res);
     double Dsgn       = utils::res::Dsgn              (res);
-    double BR         = SppChannel::BranchingRatio    (res);
-
-
-    double d = W_plus2 + Q2;
-    double sq2omg = TMath::Sqrt(2/fOmega);
-    double nomg = NR*fOmega;
-
-    //Graczyk and Sobczyk vector form-factors
-    double CV_factor = 1/(1 + Q2/fMv2/4);
-    // Eq. 29 of ref. 6
-    double CV3 =  fCv3*CV_factor/(1 + Q2/fMv2)/(1 + Q2/fMv2);
-    // Eq. 30 of ref. 6
-    double CV4 = -1. * fCv4 / fCv3 * CV3;
-    // Eq. 31 of ref. 6
-    double CV5 =  fCv51*CV_factor/(1 + Q2/fMv2/fCv52)/(1 + Q2/fMv2/fCv52);
-
-    // Eq. 38 of ref. 6
-    double GV3 =  0.5*k1_Sqrt3*(CV4*(W2 - M2 - Q2)/2/M2 + CV5*(W2 - M2 + Q2)/2/M2 + CV3*W_plus/M);
-    // Eq. 39 of ref. 6
-    double GV1 = -0.5*k1_Sqrt3*(CV4*(W2 - M2 - Q2)/2/M2 + CV5*(W2 - M2 + Q2)/2/M2 - CV3*(W_plus*M + Q2)/W/M);
-    // Eq. 36 of ref. 6, which is implied to use for EM-production
-    double GV  =  0.5*TMath::Sqrt(1 + Q2/W_plus2)/TMath::Power(1 + Q2/4/M2, 0.5*NR)*TMath::Sqrt(3*GV3*GV3 + GV1*GV1);
-    // Eq. 37 of ref. 6, which is implied to use for neutrino-production
-    // double GV  =  0.5*TMath::Sqrt(1 + Q2/W_plus2)/TMath::Power(1 + Q2/4/M2, NR)*TMath::Sqrt(3*GV3*GV3 + GV1*GV1);
-
-
-    //Graczyk and Sobczyk axial form-symmetry_factor
-    // Eq. 52 of ref. 6
-    double CA5 = fCA50/(1 + Q2/fMa2)/(1 + Q2/fMa2);
-
-    // The form is the same like in Eq. 54 of ref. 6, but differ from it by index, which in ref. 6 is equal to NR.
-    double GA = 0.5*kSqrt3*TMath::Sqrt(1 + Q2/W_plus2)*(1 - (W2 - Q2 -M2)/8/M2)*CA5/TMath::Power(1+ Q2/4/M2, 0.5*NR);
-
-    double qMR_0            = (MR*MR - M2 + m_pi2)/(2*MR);
-    double abs_mom_qMR      = TMath::Sqrt( qMR_0*qMR_0 - m_pi2);
-    double Gamma            = WR*TMath::Power((abs_mom_q/abs_mom_qMR), 2*LR + 1);
-
-    // denominator of Breit-Wigner function
-    std::complex<double> denom(W - MR, Gamma/2);
-    // Breit-Wigner amplitude multiplied by kappa*sqrt(BR) to avoid singularity at abs_mom_q=0, where BR = chi_E (see eq. 25 and 27 of ref. 1)
-    //   double kappa            = kPi*W*TMath::Sqrt(2/JR/abs_mom_q)/M;
-    //   f_BW                    = TMath::Sqrt(BR*Gamma/2/kPi)/denom;
-    kappa_f_BW = W*TMath::Sqrt(kPi*BR*WR/JR/abs_mom_qMR)*TMath::Power((abs_mom_q/abs_mom_qMR), LR)/denom/M;
-
-    fFKR.Lamda  = sq2omg*abs_mom_k;
-    fFKR.Tv     = GV/3/W/sq2omg;
-    fFKR.Ta     = 2./3/sq2omg*abs_mom_k*GA/d;
-    fFKR.Rv     = kSqrt2*abs_mom_k*W_plus*GV/d;
-    fFKR.Ra     = kSqrt2/6*(W_plus + 2*nomg*W/d)*GA/W;
-    fFKR.R      = fFKR.Rv;
-    fFKR.T      = fFKR.Tv;
-    fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-    fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-    fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-    fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
-
-    double a_aux = 1 + ((W2 + Q2 + M2)/(Mt2*W));
-    // if Q2=Q=sqrt(Q2)=0 then the singularity appears in k_sqrtQ2
-    // which is eliminated when in Hres at BosonPolarization=PLUS0 or BosonPolarization=MINUS0
-    // when k_sqrtQ2 is multiplied by C, B and S. Therefore in this case we put Q equal to 1.
-    // In our opinion it is simplier to eliminate singularity in such way, because it allows to
-    // keep intact original formulas from paper.
-    if (Q == 0) Q = 1;
-
-    double C_plus = Q/C_S_plus*((eps_zero_R*abs_mom_k - eps_z_R*k_0)*(1./3 + k_0/a_aux/M) +
-                   (Wt2/3 - Q2/a_aux/M + nomg/a_aux/M/3)*(eps_z_R + (eps_zero_R*k_0 - eps_z_R*abs_mom_k)*abs_mom_k/mpi2_minus_k2))*GA/Wt2/abs_mom_k;
-    double C_minus = Q/C_S_minus*((eps_zero_L*abs_mom_k - eps_z_L*k_0)*(1./3 + k_0/a_aux/M) +
-                   (Wt2/3 - Q2/a_aux/M + nomg/a_aux/M/3)*(eps_z_L + (eps_zero_L*k_0 - eps_z_L*abs_mom_k)*abs_mom_k/mpi2_minus_k2))*GA/Wt2/abs_mom_k;
-
-    double B_plus =  Q/C_S_plus *(eps_zero_R + eps_z_R*abs_mom_k/a_aux/M +
-                    (eps_zero_R*k_0 - eps_z_R*abs_mom_k)*(k_0 + abs_mom_k*abs_mom_k/M/a_aux)/mpi2_minus_k2)*GA/W/3/sq2omg/abs_mom_k;
-    double B_minus = Q/C_S_minus*(eps_zero_L + eps_z_L*abs_mom_k/a_aux/M +
-                    (eps_zero_L*k_0 - eps_z_L*abs_mom_k)*(k_0 + abs_mom_k*abs_mom_k/M/a_aux)/mpi2_minus_k2)*GA/W/3/sq2omg/abs_mom_k;
-
-    double S_plus  = Q/C_S_plus *(eps_z_R*k_0 - eps_zero_R*abs_mom_k)*(1 + Q2/M2 - 3*W/M)*GV/abs_mom_k_L2/6;
-    double S_minus = Q/C_S_minus*(eps_z_L*k_0 - eps_zero_L*abs_mom_k)*(1 + Q2/M2 - 3*W/M)*GV/abs_mom_k_L2/6;
-    double k_sqrtQ2 = abs_mom_k/Q;
-
-    const RSHelicityAmplModelI * hamplmod = 0;
-
-    if (is_CC)
-      hamplmod = fHAmplModelCC;
-    else if(is_NC)
-    {
-      if (is_p)
-        hamplmod = fHAmplModelNCp;
-      else
-        hamplmod = fHAmplModelNCn;
-    }
 
-    fFKR.S = S_minus;
-    fFKR.B = B_minus;
-    fFKR.C = C_minus;
-    const RSHelicityAmpl & hampl = hamplmod->Compute(res, fFKR);
-    double fp3 = hampl.AmpPlus3();
-    double fp1 = hampl.AmpPlus1();
-    double fm3 = hampl.AmpMinus3();
-    double fm1 = hampl.AmpMinus1();
-    double fm0m = 0, fm0p = 0, fp0m = 0, fp0p = 0;
+    // Scalar amplitudes for the actual boson polarization vectors, see ComputeResAmpl()
+    std::complex<double> fm0m = 0, fm0p = 0, fp0m = 0, fp0p = 0;
     if (is_CC || (is_NC && is_nu) )
     {
-      fm0m = hampl.Amp0Minus();
-      fm0p = hampl.Amp0Plus();
+      fm0m = (eps_zero_L*ampl.a[kA0MinusE0] + eps_z_L*ampl.a[kA0MinusEz])/C_S_minus;
+      fm0p = (eps_zero_L*ampl.a[kA0PlusE0]  + eps_z_L*ampl.a[kA0PlusEz] )/C_S_minus;
     }
     if (is_CC || (is_NC && is_nubar) )
     {
-      fFKR.S = S_plus;
-      fFKR.B = B_plus;
-      fFKR.C = C_plus;
-      const RSHelicityAmpl & hampl_plus = hamplmod->Compute(res, fFKR);
-      fp0m = hampl_plus.Amp0Minus();
-      fp0p = hampl_plus.Amp0Plus();
+      fp0m = (eps_zero_R*ampl.a[kA0MinusE0] + eps_z_R*ampl.a[kA0MinusEz])/C_S_plus;
+      fp0p = (eps_zero_R*ampl.a[kA0PlusE0]  + eps_z_R*ampl.a[kA0PlusEz] )/C_S_plus;
     }
 
     double JRtSqrt2 = kSqrt2*JR;
@@ -956,17 +876,17 @@ double MKSPPPXSec2020::XSec(const Interaction * interaction, KinePhaseSpace_t kp
     // The sign of the following amplitude is opposite to one from original code, because of it will be change
     // when it will be multiplied by Wigner functions d^j_{\lambda\mu}
     Hres(res,                      BosonPolarization::LEFT, NucleonPolarization::PLUS,  NucleonPolarization::PLUS) =
-        JRtSqrt2*Dsgn*Cjsgn_plus*kappa_f_BW*fp3*std::complex<double>
+        JRtSqrt2*Dsgn*Cjsgn_plus*ampl.a[kA3Plus]*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::LEFT, NucleonPolarization::PLUS,  NucleonPolarization::PLUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::LEFT, NucleonPolarization::PLUS,  NucleonPolarization::PLUS)));
 
     Hres(res,                      BosonPolarization::LEFT, NucleonPolarization::MINUS,  NucleonPolarization::PLUS) =
-       -JRtSqrt2*Dsgn*Cjsgn_plus*kappa_f_BW*fp3*std::complex<double>
+       -JRtSqrt2*Dsgn*Cjsgn_plus*ampl.a[kA3Plus]*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::LEFT, NucleonPolarization::MINUS,  NucleonPolarization::PLUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::LEFT, NucleonPolarization::MINUS,  NucleonPolarization::PLUS)));
 
     Hres(res,                      BosonPolarization::LEFT, NucleonPolarization::PLUS,  NucleonPolarization::MINUS) =
-        JRtSqrt2*Dsgn*Cjsgn_plus*kappa_f_BW*fp1*std::complex<double>
+        JRtSqrt2*Dsgn*Cjsgn_plus*ampl.a[kA1Plus]*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::LEFT, NucleonPolarization::PLUS,  NucleonPolarization::MINUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::LEFT, NucleonPolarization::PLUS,  NucleonPolarization::MINUS)));
 
@@ -974,77 +894,77 @@ double MKSPPPXSec2020::XSec(const Interaction * interaction, KinePhaseSpace_t kp
     // The sign of the following amplitude is opposite to one from original code, because of it will be change
     // when it will be multiplied by Wigner functions d^j_{\lambda\mu}
     Hres(res,                      BosonPolarization::LEFT, NucleonPolarization::MINUS,  NucleonPolarization::MINUS) =
-       -JRtSqrt2*Dsgn*Cjsgn_plus*kappa_f_BW*fp1*std::complex<double>
+       -JRtSqrt2*Dsgn*Cjsgn_plus*ampl.a[kA1Plus]*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::LEFT, NucleonPolarization::MINUS,  NucleonPolarization::MINUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::LEFT, NucleonPolarization::MINUS,  NucleonPolarization::MINUS)));
 
 
 
     Hres(res,                      BosonPolarization::RIGHT, NucleonPolarization::PLUS,  NucleonPolarization::PLUS) =
-       -JRtSqrt2*Dsgn*Cjsgn_plus*kappa_f_BW*fm1*std::complex<double>
+       -JRtSqrt2*Dsgn*Cjsgn_plus*ampl.a[kA1Minus]*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::RIGHT, NucleonPolarization::PLUS,  NucleonPolarization::PLUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::RIGHT, NucleonPolarization::PLUS,  NucleonPolarization::PLUS)));
 
     Hres(res,                      BosonPolarization::RIGHT, NucleonPolarization::MINUS,  NucleonPolarization::PLUS) =
-        JRtSqrt2*Dsgn*Cjsgn_plus*kappa_f_BW*fm1*std::complex<double>
+        JRtSqrt2*Dsgn*Cjsgn_plus*ampl.a[kA1Minus]*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::RIGHT, NucleonPolarization::MINUS,  NucleonPolarization::PLUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::RIGHT, NucleonPolarization::MINUS,  NucleonPolarization::PLUS)));
 
     Hres(res,                      BosonPolarization::RIGHT, NucleonPolarization::PLUS,  NucleonPolarization::MINUS) =
-       -JRtSqrt2*Dsgn*Cjsgn_plus*kappa_f_BW*fm3*std::complex<double>
+       -JRtSqrt2*Dsgn*Cjsgn_plus*ampl.a[kA3Minus]*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::RIGHT, NucleonPolarization::PLUS,  NucleonPolarization::MINUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::RIGHT, NucleonPolarization::PLUS,  NucleonPolarization::MINUS)));
 
     Hres(res,                      BosonPolarization::RIGHT, NucleonPolarization::MINUS,  NucleonPolarization::MINUS) =
-        JRtSqrt2*Dsgn*Cjsgn_plus*kappa_f_BW*fm3*std::complex<double>
+        JRtSqrt2*Dsgn*Cjsgn_plus*ampl.a[kA3Minus]*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::RIGHT, NucleonPolarization::MINUS,  NucleonPolarization::MINUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::RIGHT, NucleonPolarization::MINUS,  NucleonPolarization::MINUS)));
 
 
 
     Hres(res,                      BosonPolarization::MINUS0, NucleonPolarization::PLUS,  NucleonPolarization::PLUS) =
-       -k_sqrtQ2*JRtSqrt2*Dsgn*kappa_f_BW*fm0m*std::complex<double>
+       -JRtSqrt2*Dsgn*fm0m*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::MINUS0, NucleonPolarization::PLUS,  NucleonPolarization::PLUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::MINUS0, NucleonPolarization::PLUS,  NucleonPolarization::PLUS)));
 
     // The sign of the following amplitude is opposite to one from original code, because of it will be change
     // when it will be multiplied by Wigner functions d^j_{\lambda\mu}
     Hres(res,                      BosonPolarization::MINUS0, NucleonPolarization::MINUS,  NucleonPolarization::PLUS) =
-        k_sqrtQ2*JRtSqrt2*Dsgn*kappa_f_BW*fm0m*std::complex<double>
+        JRtSqrt2*Dsgn*fm0m*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::MINUS0, NucleonPolarization::MINUS,  NucleonPolarization::PLUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::MINUS0, NucleonPolarization::MINUS,  NucleonPolarization::PLUS)));
 
     Hres(res,                      BosonPolarization::MINUS0, NucleonPolarization::PLUS,  NucleonPolarization::MINUS) =
-        k_sqrtQ2*JRtSqrt2*Dsgn*kappa_f_BW*fm0p*std::complex<double>
+        JRtSqrt2*Dsgn*fm0p*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::MINUS0, NucleonPolarization::PLUS,  NucleonPolarization::MINUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::MINUS0, NucleonPolarization::PLUS,  NucleonPolarization::MINUS)));
 
     Hres(res,                      BosonPolarization::MINUS0, NucleonPolarization::MINUS,  NucleonPolarization::MINUS) =
-       -k_sqrtQ2*JRtSqrt2*Dsgn*kappa_f_BW*fm0p*std::complex<double>
+       -JRtSqrt2*Dsgn*fm0p*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::MINUS0, NucleonPolarization::MINUS,  NucleonPolarization::MINUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::MINUS0, NucleonPolarization::MINUS,  NucleonPolarization::MINUS)));
 
 
 
     Hres(res,                      BosonPolarization::PLUS0, NucleonPolarization::PLUS,  NucleonPolarization::PLUS) =
-       -k_sqrtQ2*JRtSqrt2*Dsgn*kappa_f_BW*fp0m*std::complex<double>
+       -JRtSqrt2*Dsgn*fp0m*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::PLUS0, NucleonPolarization::PLUS,  NucleonPolarization::PLUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::PLUS0, NucleonPolarization::PLUS,  NucleonPolarization::PLUS)));
 
     // The sign of the following amplitude is opposite to one from original code, because of it will be change
     // when it will be multiplied by Wigner functions d^j_{\lambda\mu}
     Hres(res,                      BosonPolarization::PLUS0, NucleonPolarization::MINUS,  NucleonPolarization::PLUS) =
-        k_sqrtQ2*JRtSqrt2*Dsgn*kappa_f_BW*fp0m*std::complex<double>
+        JRtSqrt2*Dsgn*fp0m*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::PLUS0, NucleonPolarization::MINUS,  NucleonPolarization::PLUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::PLUS0, NucleonPolarization::MINUS,  NucleonPolarization::PLUS)));
 
     Hres(res,                      BosonPolarization::PLUS0, NucleonPolarization::PLUS,  NucleonPolarization::MINUS) =
-        k_sqrtQ2*JRtSqrt2*Dsgn*kappa_f_BW*fp0p*std::complex<double>
+        JRtSqrt2*Dsgn*fp0p*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::PLUS0, NucleonPolarization::PLUS,  NucleonPolarization::MINUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::PLUS0, NucleonPolarization::PLUS,  NucleonPolarization::MINUS)));
 
     Hres(res,                      BosonPolarization::PLUS0, NucleonPolarization::MINUS,  NucleonPolarization::MINUS) =
-       -k_sqrtQ2*JRtSqrt2*Dsgn*kappa_f_BW*fp0p*std::complex<double>
+       -JRtSqrt2*Dsgn*fp0p*std::complex<double>
        (TMath::Cos(Phi*PhaseFactor(BosonPolarization::PLUS0, NucleonPolarization::MINUS,  NucleonPolarization::MINUS)),
         TMath::Sin(Phi*PhaseFactor(BosonPolarization::PLUS0, NucleonPolarization::MINUS,  NucleonPolarization::MINUS)));
   } //end resonances loop
@@ -1371,6 +1291,185 @@ bool MKSPPPXSec2020::ValidKinematics(const Interaction * interaction) const
 
 }
 //____________________________________________________________________________
+const std::vector<MKSPPPXSec2020::ResAmpl> & MKSPPPXSec2020::ResAmplitudes(
+     int imodel, const RSHelicityAmplModelI * hamplmod,
+     double W, double Q2, double M, double m_pi) const
+{
+  fResAmpl.resize(fResList.NResonances());
+
+  if (!fUseResAmplTable)
+  {
+    unsigned int ires = 0;
+    for (auto res : fResList)
+      this->ComputeResAmpl(res, hamplmod, W, Q2, M, m_pi, fResAmpl[ires++]);
+    return fResAmpl;
+  }
+
+  // bilinear interpolation between the (lazily computed) grid nodes
+  double tw = W/fResAmplTableDW;
+  double tq = TMath::Max(0., Q2)/fResAmplTableDQ2;
+  long   iw = (long) TMath::Floor(tw);
+  long   iq = (long) TMath::Floor(tq);
+  double fw = tw - iw;
+  double fq = tq - iq;
+
+  // keep the table bounded: start over once it is full (before any of the
+  // nodes used below is looked up, so that none is invalidated)
+  if (fResAmplTable.size() + 4 > (size_t) fResAmplTableMaxNodes) fResAmplTable.clear();
+
+  const std::vector<ResAmpl> * node[4] = {
+    &this->ResAmplNode(imodel, hamplmod, iw,   iq,   M, m_pi),
+    &this->ResAmplNode(imodel, hamplmod, iw+1, iq,   M, m_pi),
+    &this->ResAmplNode(imodel, hamplmod, iw,   iq+1, M, m_pi),
+    &this->ResAmplNode(imodel, hamplmod, iw+1, iq+1, M, m_pi)
+  };
+  double weight[4] = { (1-fw)*(1-fq), fw*(1-fq), (1-fw)*fq, fw*fq };
+
+  for (unsigned int ires = 0; ires < fResAmpl.size(); ires++)
+  {
+    for (int i = 0; i < kNResAmpl; i++)
+    {
+      fResAmpl[ires].a[i] = weight[0]*(*node[0])[ires].a[i] + weight[1]*(*node[1])[ires].a[i] +
+                            weight[2]*(*node[2])[ires].a[i] + weight[3]*(*node[3])[ires].a[i];
+    }
+  }
+  return fResAmpl;
+}
+//____________________________________________________________________________
+const std::vector<MKSPPPXSec2020::ResAmpl> & MKSPPPXSec2020::ResAmplNode(
+     int imodel, const RSHelicityAmplModelI * hamplmod,
+     long iw, long iq, double M, double m_pi) const
+{
+  long key = (imodel*100000L + iw)*1000000L + iq;
+  std::map<long, std::vector<ResAmpl> >::const_iterator it = fResAmplTable.find(key);
+  if (it != fResAmplTable.end()) return it->second;
+
+  std::vector<ResAmpl> & node = fResAmplTable[key];
+  node.resize(fResList.NResonances());
+  double W  = iw*fResAmplTableDW;
+  double Q2 = iq*fResAmplTableDQ2;
+  unsigned int ires = 0;
+  for (auto res : fResList)
+    this->ComputeResAmpl(res, hamplmod, W, Q2, M, m_pi, node[ires++]);
+  return node;
+}
+//____________________________________________________________________________
+void MKSPPPXSec2020::ComputeResAmpl(
+     Resonance_t res, const RSHelicityAmplModelI * hamplmod,
+     double W, double Q2, double M, double m_pi, ResAmpl & ampl) const
+{
+  double m_pi2 = m_pi*m_pi;
+  double M2    = M*M;
+  double W2    = W*W;
+  double Wt2   = W*2;
+
+  double q_0               = (W2 - M2 + m_pi2)/Wt2;
+  double abs_mom_q         = TMath::Sqrt(TMath::Max(0., q_0*q_0 - m_pi2));
+  double k_0               = (W2 - M2 - Q2)/Wt2;
+  double abs_mom_k         = TMath::Sqrt(k_0*k_0 + Q2);
+  double abs_mom_k_L       = W*abs_mom_k/M;
+  double abs_mom_k_L2      = abs_mom_k_L*abs_mom_k_L;
+  double W_plus            = W + M;
+  double W_plus2           = W_plus*W_plus;
+  double mpi2_minus_k2     = Q2 + m_pi2;
+
+  int    NR         = utils::res::ResonanceIndex    (res);
+  int    LR         = utils::res::OrbitalAngularMom (res);
+  int    JR         = (utils::res::AngularMom       (res) + 1)/2;
+  double MR         = utils::res::Mass              (res);
+  double WR         = utils::res::Width             (res);
+  double BR         = SppChannel::BranchingRatio    (res);
+
+  double d = W_plus2 + Q2;
+  double sq2omg = TMath::Sqrt(2/fOmega);
+  double nomg = NR*fOmega;
+
+  //Graczyk and Sobczyk vector form-factors
+  double CV_factor = 1/(1 + Q2/fMv2/4);
+  // Eq. 29 of ref. 6
+  double CV3 =  fCv3*CV_factor/(1 + Q2/fMv2)/(1 + Q2/fMv2);
+  // Eq. 30 of ref. 6
+  double CV4 = -1. * fCv4 / fCv3 * CV3;
+  // Eq. 31 of ref. 6
+  double CV5 =  fCv51*CV_factor/(1 + Q2/fMv2/fCv52)/(1 + Q2/fMv2/fCv52);
+
+  // Eq. 38 of ref. 6
+  double GV3 =  0.5*k1_Sqrt3*(CV4*(W2 - M2 - Q2)/2/M2 + CV5*(W2 - M2 + Q2)/2/M2 + CV3*W_plus/M);
+  // Eq. 39 of ref. 6
+  double GV1 = -0.5*k1_Sqrt3*(CV4*(W2 - M2 - Q2)/2/M2 + CV5*(W2 - M2 + Q2)/2/M2 - CV3*(W_plus*M + Q2)/W/M);
+  // Eq. 36 of ref. 6, which is implied to use for EM-production
+  double GV  =  0.5*TMath::Sqrt(1 + Q2/W_plus2)/TMath::Power(1 + Q2/4/M2, 0.5*NR)*TMath::Sqrt(3*GV3*GV3 + GV1*GV1);
+  // Eq. 37 of ref. 6, which is implied to use for neutrino-production
+  // double GV  =  0.5*TMath::Sqrt(1 + Q2/W_plus2)/TMath::Power(1 + Q2/4/M2, NR)*TMath::Sqrt(3*GV3*GV3 + GV1*GV1);
+
+
+  //Graczyk and Sobczyk axial form-symmetry_factor
+  // Eq. 52 of ref. 6
+  double CA5 = fCA50/(1 + Q2/fMa2)/(1 + Q2/fMa2);
+
+  // The form is the same like in Eq. 54 of ref. 6, but differ from it by index, which in ref. 6 is equal to NR.
+  double GA = 0.5*kSqrt3*TMath::Sqrt(1 + Q2/W_plus2)*(1 - (W2 - Q2 -M2)/8/M2)*CA5/TMath::Power(1+ Q2/4/M2, 0.5*NR);
+
+  double qMR_0            = (MR*MR - M2 + m_pi2)/(2*MR);
+  double abs_mom_qMR      = TMath::Sqrt( qMR_0*qMR_0 - m_pi2);
+  double Gamma            = WR*TMath::Power((abs_mom_q/abs_mom_qMR), 2*LR + 1);
+
+  // denominator of Breit-Wigner function
+  std::complex<double> denom(W - MR, Gamma/2);
+  // Breit-Wigner amplitude multiplied by kappa*sqrt(BR) to avoid singularity at abs_mom_q=0, where BR = chi_E (see eq. 25 and 27 of ref. 1)
+  //   double kappa            = kPi*W*TMath::Sqrt(2/JR/abs_mom_q)/M;
+  //   f_BW                    = TMath::Sqrt(BR*Gamma/2/kPi)/denom;
+  std::complex<double> kappa_f_BW = W*TMath::Sqrt(kPi*BR*WR/JR/abs_mom_qMR)*TMath::Power((abs_mom_q/abs_mom_qMR), LR)/denom/M;
+
+  fFKR.Lamda  = sq2omg*abs_mom_k;
+  fFKR.Tv     = GV/3/W/sq2omg;
+  fFKR.Ta     = 2./3/sq2omg*abs_mom_k*GA/d;
+  fFKR.Rv     = kSqrt2*abs_mom_k*W_plus*GV/d;
+  fFKR.Ra     = kSqrt2/6*(W_plus + 2*nomg*W/d)*GA/W;
+  fFKR.R      = fFKR.Rv;
+  fFKR.T      = fFKR.Tv;
+  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
+  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
+  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
+  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
+
+  double a_aux = 1 + ((W2 + Q2 + M2)/(2*M*W));
+
+  // C, B and S are linear in the components (eps_zero, eps_z) of the boson
+  // polarization vector (divided by C_S), and so are the scalar helicity
+  // amplitudes. Evaluate them for the unit vectors (1,0) and (0,1); XSec()
+  // combines them with the actual (eps_zero, eps_z)/C_S. The factor Q of C,
+  // B and S is cancelled against k_sqrtQ2 = abs_mom_k/Q, which removes the
+  // singularity at Q2=0.
+  for (int ib = 0; ib < 2; ib++)
+  {
+    double eps_zero = (ib == 0) ? 1 : 0;
+    double eps_z    = (ib == 0) ? 0 : 1;
+
+    fFKR.C = ((eps_zero*abs_mom_k - eps_z*k_0)*(1./3 + k_0/a_aux/M) +
+             (Wt2/3 - Q2/a_aux/M + nomg/a_aux/M/3)*(eps_z + (eps_zero*k_0 - eps_z*abs_mom_k)*abs_mom_k/mpi2_minus_k2))*GA/Wt2/abs_mom_k;
+    fFKR.B = (eps_zero + eps_z*abs_mom_k/a_aux/M +
+             (eps_zero*k_0 - eps_z*abs_mom_k)*(k_0 + abs_mom_k*abs_mom_k/M/a_aux)/mpi2_minus_k2)*GA/W/3/sq2omg/abs_mom_k;
+    fFKR.S = (eps_z*k_0 - eps_zero*abs_mom_k)*(1 + Q2/M2 - 3*W/M)*GV/abs_mom_k_L2/6;
+
+    const RSHelicityAmpl & hampl = hamplmod->Compute(res, fFKR);
+    if (ib == 0)
+    {
+      ampl.a[kA3Plus]    = kappa_f_BW*hampl.AmpPlus3();
+      ampl.a[kA1Plus]    = kappa_f_BW*hampl.AmpPlus1();
+      ampl.a[kA3Minus]   = kappa_f_BW*hampl.AmpMinus3();
+      ampl.a[kA1Minus]   = kappa_f_BW*hampl.AmpMinus1();
+      ampl.a[kA0MinusE0] = abs_mom_k*kappa_f_BW*hampl.Amp0Minus();
+      ampl.a[kA0PlusE0]  = abs_mom_k*kappa_f_BW*hampl.Amp0Plus();
+    }
+    else
+    {
+      ampl.a[kA0MinusEz] = abs_mom_k*kappa_f_BW*hampl.Amp0Minus();
+      ampl.a[kA0PlusEz]  = abs_mom_k*kappa_f_BW*hampl.Amp0Plus();
+    }
+  }
+}
+//____________________________________________________________________________
 void MKSPPPXSec2020::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -1460,6 +1559,14 @@ void MKSPPPXSec2020::LoadConfig(void)
   
   this->GetParamDef("UseAuthorCode", fUseAuthorCode, false );
 
+  // Tabulation of the hadronic part of the resonance amplitudes
+  this->GetParamDef("MK-ResAmplTable",     fUseResAmplTable,  false );
+  this->GetParamDef("MK-ResAmplTable-dW",  fResAmplTableDW,   0.005 );
+  this->GetParamDef("MK-ResAmplTable-dQ2", fResAmplTableDQ2,  0.02  );
+  this->GetParamDef("MK-ResAmplTable-MaxNodes", fResAmplTableMaxNodes, 200000 );
+  assert(fResAmplTableMaxNodes >= 4);
+  fResAmplTable.clear();
+
   // Load the differential cross section integrator
   fXSecIntegrator = dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
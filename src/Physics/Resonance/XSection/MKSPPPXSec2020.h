@@ -74,6 +74,7 @@ for the following channels:
 #ifndef _MK_SPP_PXSEC2020_H_
 #define _MK_SPP_PXSEC2020_H_
 
+#include <map>
 #include <vector>
 #include <complex>
 #include <functional>
@@ -364,6 +365,26 @@ namespace genie {
       int Lambda (BosonPolarization l) const;
       int PhaseFactor(BosonPolarization lk, NucleonPolarization l1, NucleonPolarization l2) const;
       
+      // Hadronic part of the resonance helicity amplitudes. It depends on
+      // (W, Q2) only: the scalar amplitudes are linear in the boson polarization
+      // vector (eps_zero, eps_z)/C_S and are stored for the unit vectors
+      enum ResAmplIndex {
+        kA3Plus, kA1Plus, kA3Minus, kA1Minus,   ///< transverse, times kappa*f_BW
+        kA0MinusE0, kA0PlusE0,                  ///< scalar, times |k|*kappa*f_BW, for eps = (1,0)
+        kA0MinusEz, kA0PlusEz,                  ///< scalar, times |k|*kappa*f_BW, for eps = (0,1)
+        kNResAmpl
+      };
+      struct ResAmpl {
+        std::complex<double> a[kNResAmpl];
+      };
+
+      void ComputeResAmpl (Resonance_t res, const RSHelicityAmplModelI * hamplmod,
+                           double W, double Q2, double M, double m_pi, ResAmpl & ampl) const;
+      const std::vector<ResAmpl> & ResAmplitudes (int imodel, const RSHelicityAmplModelI * hamplmod,
+                           double W, double Q2, double M, double m_pi) const;
+      const std::vector<ResAmpl> & ResAmplNode (int imodel, const RSHelicityAmplModelI * hamplmod,
+                           long iw, long iq, double M, double m_pi) const;
+
       void LoadConfig (void);
       mutable FKR fFKR;
       const RSHelicityAmplModelI * fHAmplModelCC;
@@ -417,6 +438,13 @@ namespace genie {
       const XSecIntegratorI * fXSecIntegrator;
       
       BaryonResList  fResList;
+
+      bool   fUseResAmplTable;                   ///< Interpolate the resonance amplitudes in a (W,Q2) table?
+      double fResAmplTableDW;                    ///< W step of the resonance amplitude table
+      double fResAmplTableDQ2;                   ///< Q2 step of the resonance amplitude table
+      int    fResAmplTableMaxNodes;              ///< max number of nodes kept in the resonance amplitude table
+      mutable std::vector<ResAmpl> fResAmpl;     ///< resonance amplitudes at the current (W,Q2)
+      mutable std::map<long, std::vector<ResAmpl> > fResAmplTable; ///< lazily filled table nodes, keyed by (model, W bin, Q2 bin)
                  
   };
   
@@ -3,14 +3,64 @@
 
 \program gevserv
 
-\brief   GENIE v+A event generation server 
+\brief   GENIE v+A event generation server
+
+         A pre-warmed GENIE process holding the cross section splines and one
+         GEVGDriver per initial state, serving events on demand to many
+         clients (eg detector simulation workers) over a local TCP socket.
+
+         Clients are multiplexed with a TMonitor: event generation itself is
+         done sequentially in the server process (GENIE is not thread-safe)
+         but no client can block the others while idle. Binary event requests
+         (EVTBIN) received in the same polling cycle are grouped by initial
+         state and served back-to-back by the corresponding GEVGDriver.
 
          Syntax :
-           gevserv [-p port]
+           gevserv [-p port] [--nu-list pdg_codes] [--tgt-list pdg_codes]
+                   [--cross-sections xml_file] [--seed seed]
+                   [--tune tune] [--event-generator-list list]
+                   [--message-thresholds xml_file]
 
          Options :
            [] denotes an optional argument
            -p port number (default: 9090)
+           --nu-list
+              Comma-separated list of neutrino PDG codes. If set together with
+              --tgt-list, the event generation drivers are configured at start-
+              up, before accepting any clients (the CONFIG command is then
+              optional).
+           --tgt-list
+              Comma-separated list of target PDG codes.
+           --cross-sections
+              Input cross section splines XML file (default: $GSPLOAD).
+           --seed
+              Random number seed.
+
+         Commands (string messages, one per TMessage):
+
+           RUB GENIE LAMP
+              handshake, replied with "YOU HAVE 3 WISHES!"
+           CONFIG: [load-splines] neutrino-list=<pdgs> target-list=<pdgs>
+              creates drivers for all (neutrino, target) pairs not already
+              available, replied with "CONFIG COMPLETED"
+           XSEC: ipdgnu ipdgtgt
+              total xsec for all enabled channels, as text (see client_test.C)
+           EVTVTX: irun ievt ipdgnunoosc vtx_x vtx_y vtx_z ipdgnu ipdgtgt px py pz
+              generates one event, replied with a text record (see client_test.C)
+           EVTBIN: irun ievt ipdgnunoosc vtx_x vtx_y vtx_z ipdgnu ipdgtgt px py pz
+              as EVTVTX, but replied with a single kMESS_ANY TMessage holding
+              the compact binary event record described in SendBinaryEvent().
+              Clients may pipeline many EVTBIN requests; replies for different
+              initial states may come back in a different order than the
+              requests were sent and are matched through (irun, ievt).
+           SHUTDOWN
+              stops the server, replied with "SHUTTING DOWN". The EVTBIN
+              requests queued so far are still served; requests already sent
+              by the clients but not read yet are rejected (EVTBIN requests
+              with a binary failure record, other commands with "SHUTTING
+              DOWN") before the server exits.
+           BYE
+              closes the connection of the calling client only
 
 \author  Costas Andreopoulos <c.andreopoulos \at cern.ch>
  University of Liverpool
@@ -19,61 +69,92 @@
 
 \cpright Copyright (c) 2003-2025, The GENIE Collaboration
          For the full text of the license visit http://copyright.genie-mc.org
-         
+
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <vector>
+#include <map>
 
 #include <TSystem.h>
 #include <TServerSocket.h>
 #include <TSocket.h>
+#include <TMonitor.h>
 #include <TMessage.h>
+#include <TList.h>
 #include <TBits.h>
 #include <TMath.h>
-
-#include "Conventions/Units.h"
-#include "EVGCore/EventRecord.h"
-#include "EVGDrivers/GEVGDriver.h"
-#include "EVGDrivers/GEVGPool.h"
-#include "EVGDrivers/GMCJMonitor.h"
-#include "GHEP/GHepFlags.h"
-#include "GHEP/GHepParticle.h"
-#include "GHEP/GHepRecord.h"
-#include "Interaction/Interaction.h"
-#include "Messenger/Messenger.h"
-#include "Numerical/Spline.h"
-#include "PDG/PDGCodeList.h"
-#include "Utils/XSecSplineList.h"
-#include "Utils/StringUtils.h"
-#include "Utils/CmdLnArgParser.h"
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/GEVGPool.h"
+#include "Framework/GHEP/GHepFlags.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
 
 using std::string;
 using std::vector;
+using std::map;
 using std::ostringstream;
 
 using namespace genie;
 using namespace genie::utils;
 
+// ** Event request
+//
+struct EvRequest {
+  TSocket * sock;
+  int       irun;
+  int       ievt;
+  int       ipdgnunoosc;
+  double    vtxx, vtxy, vtxz;
+  int       ipdgnu;
+  int       ipdgtgt;
+  double    px, py, pz;
+};
+
 // ** Prototypes
 //
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
+void Initialize         (void);
 void RunInitChecks      (void);
 void HandleMesg         (string mesg);
 void Handshake          (void);
 void Configure          (string mesg);
+void ConfigureDrivers   (const PDGCodeList & neutrinos, const PDGCodeList & targets);
 void CalcTotalXSec      (string mesg);
 void GenerateEvent      (string mesg);
+bool ParseEvRequest     (string mesg, string cmd, EvRequest & req);
+void GenerateBinEvents  (vector<EvRequest> & batch);
+void SendBinaryEvent    (const EvRequest & req, const EventRecord * event);
+void SendBinaryFailure  (const EvRequest & req);
+void CloseClient        (TSocket * sock);
 void Shutdown           (void);
+void RejectPendingMesgs (TSocket * serv_sock);
 
 // ** Consts & Defaults
 //
 const int    kDefPortNum           = 9090;  // default port number
+const long   kSelectTimeout        = 1000;  // TMonitor polling timeout (msec)
+const long   kDrainTimeout         = 100;   // polling timeout at shutdown (msec)
+const int    kBinEventVersion      = 1;     // binary event record layout version
 const string kHandshakeCmdRecv     = "RUB GENIE LAMP";
 const string kHandshakeMesgSent    = "YOU HAVE 3 WISHES!";
 const string kConfigCmdRecv        = "CONFIG";
@@ -85,9 +166,11 @@ const string kXSecCmdRecv          = "XSEC";
 const string kXSecCmdSent          = "XSECSPL";
 const string kXSecOkMesgSent       = "XSEC SENT";
 const string kEvgenCmdRecv         = "EVTVTX";
+const string kEvgenBinCmdRecv      = "EVTBIN";
 const string kEvgenHdrCmdSent      = "EVTREC";
 const string kEvgenStdhepCmdSent   = "STDHEP";
 const string kEvgenOkMesgSent      = "EVENT GENERATED";
+const string kByeCmdRecv           = "BYE";
 const string kShutdownCmdRecv      = "SHUTDOWN";
 const string kShutdownOkMesgSent   = "SHUTTING DOWN";
 const string kErrNoConf            = "*** NOT CONFIGURED! ***";
@@ -97,14 +180,20 @@ const string kErr                  = "FAILED";
 
 // ** User-specified options:
 //
-int gOptPortNum;   // port number
+int         gOptPortNum;          // port number
+PDGCodeList gOptNeutrinos(false); // neutrinos to configure at start-up
+PDGCodeList gOptTargets(false);   // targets to configure at start-up
+string      gOptInpXSecFile = ""; // input cross section splines
+long int    gOptRanSeed = -1;     // random number seed
 
 // ** Globals
 //
-TSocket * gSock       = 0;      // tcp/ip socket
+TSocket * gSock       = 0;      // socket of the client being served
+TMonitor * gMonitor  = 0;      // multiplexes the server & client sockets
 bool      gShutDown   = false;  // 'shutting down?' flag
 bool      gConfigured = false;  // 'am I configured?' flag
 GEVGPool  gGPool;               // list of GENIE event generation drivers used in job
+map<string, vector<EvRequest> > gBinRequests; // pending EVTBIN requests per init state
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -115,67 +204,136 @@ int main(int argc, char ** argv)
   // Run some checks
   RunInitChecks();
 
+  // Load tune, splines, random number seed etc
+  Initialize();
+
+  // Pre-warm the event generation drivers, if requested
+  if(gOptNeutrinos.size() > 0 && gOptTargets.size() > 0) {
+    ConfigureDrivers(gOptNeutrinos, gOptTargets);
+    gConfigured = true;
+  }
+
   // Open a server socket
   TServerSocket * serv_sock = new TServerSocket(gOptPortNum, kTRUE);
+  if(!serv_sock->IsValid()) {
+    LOG("gevserv", pFATAL) << "Could not open server socket on port: " << gOptPortNum;
+    exit(1);
+  }
+  gMonitor = new TMonitor;
+  gMonitor->Add(serv_sock);
 
-  // Accept a connection
-  gSock = serv_sock->Accept();
-
-  if(!gSock) exit(1);
   LOG("gevserv", pNOTICE) << "Listening on port: " << gOptPortNum;
-  
-  // Set no TCP/IP NODELAY
-  int delay_ok = gSock->SetOption(kNoDelay,1);
-  LOG("gevserv", pNOTICE) << "TCP_NODELAY > " << delay_ok;
 
-  // Start listening for messages & take the corresponding actions
+  // Start listening for connections & messages and take the corresponding
+  // actions. Every polling cycle: accept new clients, handle all messages
+  // received and then serve the queued binary event requests, grouped by
+  // initial state.
 
   while(1) {
 
     if(gShutDown) break;
 
-    TMessage * mesg = 0;
+    TList ready;
+    gMonitor->Select(&ready, 0, kSelectTimeout);
+
+    TIter next(&ready);
+    TSocket * sock = 0;
+    while( (sock = (TSocket *) next()) ) {
+
+      // new client?
+      if(sock == serv_sock) {
+        TSocket * client = serv_sock->Accept();
+        if(!client || client == (TSocket *) -1) continue;
+        int delay_ok = client->SetOption(kNoDelay,1);
+        LOG("gevserv", pNOTICE)
+          << "Accepted connection from: " << client->GetInetAddress().GetHostName()
+          << " (TCP_NODELAY > " << delay_ok << ")";
+        gMonitor->Add(client);
+        continue;
+      }
 
-    gSock->Recv(mesg);
+      TMessage * mesg = 0;
+      int nrecv = sock->Recv(mesg);
+      if(nrecv <= 0) {
+        CloseClient(sock);
+        continue;
+      }
+      if(!mesg) continue;
+      if(mesg->What() != kMESS_STRING) { delete mesg; continue; }
 
-    if(!mesg) continue;
-    if(mesg->What() != kMESS_STRING) continue;
+      char mesg_content[2048];
+      mesg->ReadString(mesg_content, 2048);
+      delete mesg;
 
-    char mesg_content[2048];
-    mesg->ReadString(mesg_content, 2048);
+      LOG("gevserv", pINFO) << "Processing mesg > " << mesg_content;
 
-    LOG("gevserv", pNOTICE) << "Processing mesg > " << mesg_content;
+      gSock = sock;
+      string mesg_str(mesg_content);
+      if(mesg_str.find(kByeCmdRecv) == 0) {
+        CloseClient(sock);
+      } else {
+        HandleMesg(mesg_str);
+      }
+      gSock = 0;
+
+      if(gShutDown) break;
+    }
 
-    HandleMesg(mesg_content);
+    // Serve the binary event requests accumulated in this cycle
+    map<string, vector<EvRequest> >::iterator batch_iter = gBinRequests.begin();
+    for( ; batch_iter != gBinRequests.end(); ++batch_iter) {
+      GenerateBinEvents(batch_iter->second);
+    }
+    gBinRequests.clear();
 
   } // while(1)
 
+  // Answer what the clients sent before seeing the shutdown reply
+  RejectPendingMesgs(serv_sock);
+
+  gMonitor->RemoveAll();
+  delete gMonitor;
+  serv_sock->Close();
+  delete serv_sock;
+
   return 0;
 }
 //____________________________________________________________________________
 void HandleMesg(string mesg)
 {
-  if(mesg.find(kHandshakeCmdRecv.c_str()) != string::npos) 
-  { 
+  if(mesg.find(kHandshakeCmdRecv.c_str()) != string::npos)
+  {
     Handshake();
-  } 
+  }
   else
-  if (mesg.find(kConfigCmdRecv.c_str()) != string::npos) 
+  if (mesg.find(kConfigCmdRecv.c_str()) != string::npos)
   {
     Configure(mesg);
-  } 
+  }
   else
-  if (mesg.find(kXSecCmdRecv.c_str()) != string::npos) 
+  if (mesg.find(kXSecCmdRecv.c_str()) != string::npos)
   {
     CalcTotalXSec(mesg);
   }
   else
-  if (mesg.find(kEvgenCmdRecv.c_str()) != string::npos) 
+  if (mesg.find(kEvgenBinCmdRecv.c_str()) != string::npos)
+  {
+    // queue; served at the end of the polling cycle, grouped by init state
+    EvRequest req;
+    if(!ParseEvRequest(mesg, kEvgenBinCmdRecv, req)) {
+      gSock->Send(kErr.c_str());
+      return;
+    }
+    InitialState init_state(req.ipdgtgt, req.ipdgnu);
+    gBinRequests[init_state.AsString()].push_back(req);
+  }
+  else
+  if (mesg.find(kEvgenCmdRecv.c_str()) != string::npos)
   {
     GenerateEvent(mesg);
-  } 
+  }
   else
-  if (mesg.find(kShutdownCmdRecv.c_str()) != string::npos) 
+  if (mesg.find(kShutdownCmdRecv.c_str()) != string::npos)
   {
     Shutdown();
   }
@@ -185,9 +343,9 @@ void Handshake(void)
 {
 // Reply to client messages checking whether the event server is active
 //
-  LOG("gevserv", pNOTICE) 
+  LOG("gevserv", pNOTICE)
          << "GENIE was pinged by a client (lamp was rubbed)! Responding...";
-  
+
   gSock->Send(kHandshakeMesgSent.c_str());
 
   LOG("gevserv", pINFO) << "...done!";
@@ -196,9 +354,9 @@ void Handshake(void)
 void Configure(string mesg)
 {
 // Configure the GENIE event server
-// ** Load splines 
-//    - if the "load-splines" command is contained in the mesg 
-//    - the splines are loaded from the the XML file specified in $GSPLOAD (server-side) 
+// ** Load splines
+//    - if the "load-splines" command is contained in the mesg
+//    - the splines are loaded from the the XML file specified in $GSPLOAD (server-side)
 //    the "load-splines" mesg is sent
 // ** Specify the neutrino list
 //    - adding a "neutrino-list=<comma separated list of pdg codes>" in the mesg
@@ -206,30 +364,34 @@ void Configure(string mesg)
 //    - adding a "target-list=<comma separated list of pdg codes>" in the mesg
 //
 // Note:
-// - All nedded cross section splines for the specified neutrino/target lists must 
+// - All nedded cross section splines for the specified neutrino/target lists must
 //   be available in the specified XML file. If not GENIE will attempt building the
 //   the missing ones which may increase start-up overheads.
+// - Drivers already created (at start-up or by a previous CONFIG request from any
+//   client) are reused.
 // - You can further control GENIE (suppress modes, set messenger verbosity, ...)
-//   by setting all the std GENIE env vars at the server side. 
+//   by setting all the std GENIE env vars at the server side.
 //   See the GENIE web site.
 
   LOG("gevserv", pNOTICE)  << "Configuring GENIE event server";
 
-  mesg = str::FilterString(kConfigCmdRecv, mesg); 
-  mesg = str::FilterString(":", mesg); 
-  mesg = str::TrimSpaces(mesg);             
+  mesg = str::FilterString(kConfigCmdRecv, mesg);
+  mesg = str::FilterString(":", mesg);
+  mesg = str::TrimSpaces(mesg);
 
   LOG("gevserv", pNOTICE) << "Configure options: " << mesg;
 
-  // Autoload splines from the XML file pointed at the $GSPLOAD env. var.
-  // (if set at the server side)
+  // Load splines from the XML file given at start-up or pointed at by the
+  // $GSPLOAD env. var. (if set at the server side and not already loaded)
   //
   if(mesg.find(kConfigCmdLdSpl) != string::npos) {
      XSecSplineList * xspl = XSecSplineList::Instance();
-     xspl->AutoLoad();
+     if(xspl->IsEmpty() && gOptInpXSecFile.size() > 0) {
+       utils::app_init::XSecTable(gOptInpXSecFile, false);
+     }
 
      mesg.erase(mesg.find(kConfigCmdLdSpl),12);
-     mesg = str::TrimSpaces(mesg);             
+     mesg = str::TrimSpaces(mesg);
   }
 
   // Extract neutrino and target lists from the input mesg
@@ -243,11 +405,15 @@ void Configure(string mesg)
 
   for( ; conf_opt_iter != conf_opt_v.end(); ++conf_opt_iter) {
     string conf_opt = *conf_opt_iter;
-    LOG("gevserv", pNOTICE) 
+    if(conf_opt.size() == 0) continue;
+    LOG("gevserv", pNOTICE)
           << "Processing config option: " << conf_opt;
 
     vector<string> sv = str::Split(conf_opt, "=");
-    assert(sv.size()==2);
+    if(sv.size() != 2) {
+      LOG("gevserv", pERROR) << "Ignoring malformed config option: " << conf_opt;
+      continue;
+    }
     string list_name     = sv[0];
     string particle_list = sv[1];
 
@@ -258,23 +424,33 @@ void Configure(string mesg)
       string particle_code_str = *particle_iter;
       int particle_code = atoi(particle_code_str.c_str());
 
-      if(list_name.find(kConfigCmdNeuList) != string::npos) 
+      if(list_name.find(kConfigCmdNeuList) != string::npos)
       {
          neutrinos.push_back(particle_code);
-      } else 
-      if(list_name.find(kConfigCmdTgtList) != string::npos) 
+      } else
+      if(list_name.find(kConfigCmdTgtList) != string::npos)
       {
 	 targets.push_back(particle_code);
       }
     }
   }
 
-  LOG("gevserv", pNOTICE) 
+  ConfigureDrivers(neutrinos, targets);
+
+  gConfigured = true;
+
+  gSock->Send(kConfigOkMesgSent.c_str());
+
+  LOG("gevserv", pINFO) << "...done!";
+}
+//____________________________________________________________________________
+void ConfigureDrivers(const PDGCodeList & neutrinos, const PDGCodeList & targets)
+{
+  LOG("gevserv", pNOTICE)
         << "Specified neutrino list: " << neutrinos;
-  LOG("gevserv", pNOTICE) 
+  LOG("gevserv", pNOTICE)
         << "Specified target list: "   << targets;
 
-
   // Loop over the specified neutrinos and targets and for each
   // possible pair create / configure a GENIE event generation driver.
   //
@@ -289,11 +465,19 @@ void Configure(string mesg)
 
      InitialState init_state(target_code, neutrino_code);
 
+     if(gGPool.FindDriver(init_state)) {
+       LOG("gevserv", pNOTICE)
+         << "Reusing GEVGDriver for init-state: " << init_state.AsString();
+       continue;
+     }
+
      LOG("gevserv", pNOTICE)
        << "\n\n ---- Creating a GEVGDriver object configured for init-state: "
        << init_state.AsString() << " ----\n\n";
 
      GEVGDriver * evgdriver = new GEVGDriver;
+     evgdriver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+     evgdriver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
      evgdriver->Configure(init_state);
      evgdriver->UseSplines(); // will also check if all splines needed are loaded
 
@@ -304,21 +488,15 @@ void Configure(string mesg)
 
   LOG("gevserv", pNOTICE)
        << "All necessary GEVGDriver object were pushed into GEVGPool\n";
-
-  gConfigured = true;
-
-  gSock->Send(kConfigOkMesgSent.c_str());
-
-  LOG("gevserv", pINFO) << "...done!";
 }
 //____________________________________________________________________________
 void CalcTotalXSec(string mesg)
 {
-  LOG("gevserv", pNOTICE) 
+  LOG("gevserv", pNOTICE)
        << "Sending total xsec for enabled channels  - Input info : " << mesg;
 
   if(!gConfigured) {
-      LOG("gevserv", pERROR) 
+      LOG("gevserv", pERROR)
              << "Event server is not configured - Can not generate event";
       gSock->Send(kErrNoConf.c_str());
       gSock->Send(kErr.c_str());
@@ -327,12 +505,16 @@ void CalcTotalXSec(string mesg)
 
   // Extract info from the input mesg
 
-  mesg = str::FilterString(kXSecCmdRecv, mesg); 
-  mesg = str::FilterString(":", mesg); 
-  mesg = str::TrimSpaces(mesg);             
+  mesg = str::FilterString(kXSecCmdRecv, mesg);
+  mesg = str::FilterString(":", mesg);
+  mesg = str::TrimSpaces(mesg);
 
-  vector<string> sv = str::Split(mesg," "); 
-  assert(sv.size()==2);
+  vector<string> sv = str::Split(mesg," ");
+  if(sv.size() != 2) {
+      LOG("gevserv", pERROR) << "Malformed request: " << mesg;
+      gSock->Send(kErr.c_str());
+      return;
+  }
 
   int ipdgnu  = atoi(sv[0].c_str());  // neutrino code
   int ipdgtgt = atoi(sv[1].c_str());  // target code
@@ -350,14 +532,16 @@ void CalcTotalXSec(string mesg)
   }
 
   // Ask the event generation driver to sum up the splines for all enabled
-  // channels
+  // channels (only once; the sum is kept by the driver for later requests)
 
    LOG("gevserv", pNOTICE)
-       << "Requesting total cross section for init state: " 
+       << "Requesting total cross section for init state: "
        << init_state.AsString();
 
-  evg_driver->CreateXSecSumSpline (
-     1000 /*nknots*/, 0.001 /*Emin*/, 300 /*Emax*/, true /*in-log*/);
+  if(!evg_driver->XSecSumSpline()) {
+    evg_driver->CreateXSecSumSpline (
+       1000 /*nknots*/, 0.001 /*Emin*/, 300 /*Emax*/, true /*in-log*/);
+  }
 
   const Spline * total_xsec_spl = evg_driver->XSecSumSpline();
   assert(total_xsec_spl);
@@ -376,7 +560,7 @@ void CalcTotalXSec(string mesg)
   for(int ip=0; ip<np; ip++) {
      double E  = Emin + ip*dE;
      double xs = TMath::Max(0., total_xsec_spl->Evaluate(E) / (1E-38*units::cm2));
-     
+
      ostringstream xsec_spl_knot;
      xsec_spl_knot << ip << " " << E << " " << Form("%15.8e",xs);
      gSock->Send(xsec_spl_knot.str().c_str());
@@ -387,12 +571,44 @@ void CalcTotalXSec(string mesg)
   LOG("gevserv", pINFO) << "...done!";
 }
 //____________________________________________________________________________
+bool ParseEvRequest(string mesg, string cmd, EvRequest & req)
+{
+  mesg = str::FilterString(cmd, mesg);
+  mesg = str::FilterString(":", mesg);
+  mesg = str::TrimSpaces(mesg);
+
+  vector<string> sv = str::Split(mesg," ");
+  vector<string> fields;
+  for(unsigned int i=0; i<sv.size(); i++) {
+    if(sv[i].size() > 0) fields.push_back(sv[i]);
+  }
+  if(fields.size() != 11) {
+    LOG("gevserv", pERROR) << "Malformed event request: " << mesg;
+    return false;
+  }
+
+  req.sock        = gSock;
+  req.irun        = atoi(fields[0].c_str());  // just pass through
+  req.ievt        = atoi(fields[1].c_str());  // ...
+  req.ipdgnunoosc = atoi(fields[2].c_str());  // ...
+  req.vtxx        = atof(fields[3].c_str());  // ...
+  req.vtxy        = atof(fields[4].c_str());  // ...
+  req.vtxz        = atof(fields[5].c_str());  // ...
+  req.ipdgnu      = atoi(fields[6].c_str());  // neutrino code
+  req.ipdgtgt     = atoi(fields[7].c_str());  // target code
+  req.px          = atof(fields[8].c_str());  // neutrino px
+  req.py          = atof(fields[9].c_str());  // neutrino py
+  req.pz          = atof(fields[10].c_str()); // neutrino pz
+
+  return true;
+}
+//____________________________________________________________________________
 void GenerateEvent(string mesg)
 {
   LOG("gevserv", pNOTICE) << "Generating event - Input info : " << mesg;
 
   if(!gConfigured) {
-      LOG("gevserv", pERROR) 
+      LOG("gevserv", pERROR)
              << "Event server is not configured - Can not generate event";
       gSock->Send(kErrNoConf.c_str());
       gSock->Send(kErr.c_str());
@@ -401,31 +617,18 @@ void GenerateEvent(string mesg)
 
   // Extract info from the input mesg
 
-  mesg = str::FilterString(kEvgenCmdRecv, mesg); 
-  mesg = str::FilterString(":", mesg); 
-  mesg = str::TrimSpaces(mesg);             
-
-  vector<string> sv = str::Split(mesg," "); 
-
-  assert(sv.size()==11);
-  int    irun        = atoi(sv[0].c_str());  // just pass through
-  int    ievt        = atoi(sv[1].c_str());  // ...
-  int    ipdgnunoosc = atoi(sv[2].c_str());  // ...
-  double vtxx        = atof(sv[3].c_str());  // ...
-  double vtxy        = atof(sv[4].c_str());  // ...
-  double vtxz        = atof(sv[5].c_str());  // ...
-  int    ipdgnu      = atoi(sv[6].c_str());  // neutrino code
-  int    ipdgtgt     = atoi(sv[7].c_str());  // target code
-  double px          = atof(sv[8].c_str());  // neutrino px
-  double py          = atof(sv[9].c_str());  // neutrino py
-  double pz          = atof(sv[10].c_str()); // neutrino pz
-  double E           = TMath::Sqrt(px*px + py*py + pz*pz);
-
-  TLorentzVector p4(px,py,pz,E); 
-     
+  EvRequest req;
+  if(!ParseEvRequest(mesg, kEvgenCmdRecv, req)) {
+      gSock->Send(kErr.c_str());
+      return;
+  }
+  double E = TMath::Sqrt(req.px*req.px + req.py*req.py + req.pz*req.pz);
+
+  TLorentzVector p4(req.px,req.py,req.pz,E);
+
   // Find the appropriate event generation driver for the given initial state
 
-  InitialState init_state(ipdgtgt, ipdgnu);
+  InitialState init_state(req.ipdgtgt, req.ipdgnu);
   GEVGDriver * evg_driver = gGPool.FindDriver(init_state);
   if(!evg_driver) {
      LOG("gevserv", pERROR)
@@ -442,10 +645,11 @@ void GenerateEvent(string mesg)
   // Check/print the generated event
   bool failed = (event==0) || event->IsUnphysical();
   if(failed) {
-      LOG("gevserv", pWARN) 
+      LOG("gevserv", pWARN)
               << "Failed to generate the requested event";
       gSock->Send(kErrNoEvent.c_str());
       gSock->Send(kErr.c_str());
+      if(event) delete event;
       return;
   }
   LOG("gevserv", pINFO) << "Generated event: " << *event;
@@ -492,36 +696,36 @@ void GenerateEvent(string mesg)
 
   ostringstream hdr1, hdr2, hdr3, hdr4, stdhep_hdr;
 
-  hdr1 
+  hdr1
     << kEvgenHdrCmdSent << ": "
-    << irun             << " " 
-    << ievt             << " " 
-    << ipdgnunoosc      << " "
-    << vtxx             << " " 
-    << vtxy             << " " 
-    << vtxz;
-  hdr2 
-    << ipdgnu  << " " 
-    << ipdgtgt << " " 
-    << px      << " " 
-    << py      << " " 
-    << pz;
-  hdr3 
-    << int_type << " " 
-    << iaction  << " " 
-    << nucleon  << " " 
+    << req.irun         << " "
+    << req.ievt         << " "
+    << req.ipdgnunoosc  << " "
+    << req.vtxx         << " "
+    << req.vtxy         << " "
+    << req.vtxz;
+  hdr2
+    << req.ipdgnu  << " "
+    << req.ipdgtgt << " "
+    << req.px      << " "
+    << req.py      << " "
+    << req.pz;
+  hdr3
+    << int_type << " "
+    << iaction  << " "
+    << nucleon  << " "
     << hitquark << " "
-    << xbj_sel  << " " 
-    << y_sel    << " "  
-    << W2_sel   << " " 
+    << xbj_sel  << " "
+    << y_sel    << " "
+    << W2_sel   << " "
     << q2_sel;
-  hdr4 
-    << tot_xsec  << " " 
-    << diff_xsec << " " 
+  hdr4
+    << tot_xsec  << " "
+    << diff_xsec << " "
     << ihadmode;
 
-  stdhep_hdr 
-    << kEvgenStdhepCmdSent << ": " 
+  stdhep_hdr
+    << kEvgenStdhepCmdSent << ": "
     << event->GetEntriesFast();
 
   gSock->Send(hdr1.str().c_str());
@@ -537,11 +741,11 @@ void GenerateEvent(string mesg)
 
       ostringstream stdhep_entry;
 
-      stdhep_entry 
+      stdhep_entry
   	 << i << " " << p->Status() << " " << p->Pdg() << " "
          << p->FirstMother()   << " " << p->LastMother()   << " "
          << p->FirstDaughter() << " " << p->LastDaughter() << " "
-         << p->Px() << " " << p->Py() << " " << p->Pz() << " " << p->E() << " " 
+         << p->Px() << " " << p->Py() << " " << p->Pz() << " " << p->E() << " "
          << p->Mass() << " "
          << p->Vx() << " " << p->Vy() << " " << p->Vz() << " " << p->Vt();
 
@@ -558,6 +762,180 @@ void GenerateEvent(string mesg)
   LOG("gevserv", pINFO) << "...done!";
 }
 //____________________________________________________________________________
+void GenerateBinEvents(vector<EvRequest> & batch)
+{
+// Serves a batch of EVTBIN requests, all for the same initial state, with a
+// single driver lookup.
+
+  if(batch.size() == 0) return;
+
+  InitialState init_state(batch[0].ipdgtgt, batch[0].ipdgnu);
+
+  LOG("gevserv", pNOTICE)
+    << "Generating " << batch.size() << " events for init state: "
+    << init_state.AsString();
+
+  GEVGDriver * evg_driver = (gConfigured) ? gGPool.FindDriver(init_state) : 0;
+  if(!evg_driver) {
+     LOG("gevserv", pERROR)
+       << "No GEVGDriver object for init state: " << init_state.AsString();
+  }
+
+  vector<EvRequest>::const_iterator req_iter = batch.begin();
+  for( ; req_iter != batch.end(); ++req_iter) {
+    const EvRequest & req = *req_iter;
+
+    // (requests from clients that disconnected were dropped by CloseClient())
+    if(!evg_driver) {
+      SendBinaryFailure(req);
+      continue;
+    }
+
+    double E = TMath::Sqrt(req.px*req.px + req.py*req.py + req.pz*req.pz);
+    TLorentzVector p4(req.px,req.py,req.pz,E);
+
+    EventRecord * event = evg_driver->GenerateEvent(p4);
+
+    bool failed = (event==0) || event->IsUnphysical();
+    if(failed) {
+      LOG("gevserv", pWARN)
+        << "Failed to generate the requested event (run: " << req.irun
+        << ", event: " << req.ievt << ")";
+      SendBinaryFailure(req);
+    } else {
+      LOG("gevserv", pINFO) << "Generated event: " << *event;
+      SendBinaryEvent(req, event);
+    }
+    if(event) delete event;
+  }
+}
+//____________________________________________________________________________
+void SendBinaryEvent(const EvRequest & req, const EventRecord * event)
+{
+// Sends the generated event as a single kMESS_ANY message:
+//
+//   int    version (=kBinEventVersion)
+//   int    status  (1 = ok, 0 = failed; nothing else follows if failed)
+//   int    irun, ievt, ipdgnunoosc
+//   double vtx_x, vtx_y, vtx_z
+//   int    ipdgnu, ipdgtgt
+//   double px_nu, py_nu, pz_nu
+//   int    int_type, iaction, nucleon, struck-quark
+//   double xbj, y, W2, Q2 (selected kinematics), total-xsec, diff-xsec
+//   int    nparticles
+//   nparticles x {
+//      int   ist, ipdg, jmo1, jmo2, jda1, jda2
+//      double px, py, pz, E, mass
+//      float  vx, vy, vz, time  (fm, ns - single precision is plenty here)
+//   }
+//
+// Int_t/Double_t/Float_t are streamed by ROOT in network byte order.
+
+  const Interaction * interaction = event->Summary();
+  const ProcessInfo &  proc_info  = interaction->ProcInfo();
+  const Kinematics &   kine       = interaction->Kine();
+
+  int int_type  = -1;
+  if      (proc_info.IsQuasiElastic())      int_type = 1;
+  else if (proc_info.IsResonant())          int_type = 2;
+  else if (proc_info.IsDeepInelastic())     int_type = 3;
+  else if (proc_info.IsCoherent())          int_type = 4;
+  else if (proc_info.IsInverseMuDecay())    int_type = 5;
+  else if (proc_info.IsNuElectronElastic()) int_type = 6;
+
+  int iaction   = -1;
+  if      (proc_info.IsWeakNC()) iaction = 0;
+  else if (proc_info.IsWeakCC()) iaction = 1;
+  else                           iaction = 2; // cc+nc interference
+
+  int nucleon = -1;
+  GHepParticle * hitnucl = event->HitNucleon();
+  if(hitnucl) {
+    nucleon = hitnucl->Pdg();
+  }
+  int hitquark  = interaction->InitState().Tgt().HitQrkPdg();
+
+  bool get_selected = true;
+
+  TMessage out(kMESS_ANY);
+  out.WriteInt    (kBinEventVersion);
+  out.WriteInt    (1);
+  out.WriteInt    (req.irun);
+  out.WriteInt    (req.ievt);
+  out.WriteInt    (req.ipdgnunoosc);
+  out.WriteDouble (req.vtxx);
+  out.WriteDouble (req.vtxy);
+  out.WriteDouble (req.vtxz);
+  out.WriteInt    (req.ipdgnu);
+  out.WriteInt    (req.ipdgtgt);
+  out.WriteDouble (req.px);
+  out.WriteDouble (req.py);
+  out.WriteDouble (req.pz);
+  out.WriteInt    (int_type);
+  out.WriteInt    (iaction);
+  out.WriteInt    (nucleon);
+  out.WriteInt    (hitquark);
+  out.WriteDouble (kine.x (get_selected));
+  out.WriteDouble (kine.y (get_selected));
+  out.WriteDouble (TMath::Power(kine.W(get_selected), 2.));
+  out.WriteDouble (-1 * kine.Q2(get_selected));
+  out.WriteDouble (event->XSec());
+  out.WriteDouble (event->DiffXSec());
+  out.WriteInt    (event->GetEntriesFast());
+
+  TIter event_iter(event);
+  GHepParticle * p = 0;
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    out.WriteInt    (p->Status());
+    out.WriteInt    (p->Pdg());
+    out.WriteInt    (p->FirstMother());
+    out.WriteInt    (p->LastMother());
+    out.WriteInt    (p->FirstDaughter());
+    out.WriteInt    (p->LastDaughter());
+    out.WriteDouble (p->Px());
+    out.WriteDouble (p->Py());
+    out.WriteDouble (p->Pz());
+    out.WriteDouble (p->E());
+    out.WriteDouble (p->Mass());
+    out.WriteFloat  (p->Vx());
+    out.WriteFloat  (p->Vy());
+    out.WriteFloat  (p->Vz());
+    out.WriteFloat  (p->Vt());
+  }
+
+  req.sock->Send(out);
+}
+//____________________________________________________________________________
+void SendBinaryFailure(const EvRequest & req)
+{
+  TMessage out(kMESS_ANY);
+  out.WriteInt (kBinEventVersion);
+  out.WriteInt (0);
+  out.WriteInt (req.irun);
+  out.WriteInt (req.ievt);
+  req.sock->Send(out);
+}
+//____________________________________________________________________________
+void CloseClient(TSocket * sock)
+{
+  LOG("gevserv", pNOTICE) << "Closing client connection";
+
+  // drop any queued requests from this client
+  map<string, vector<EvRequest> >::iterator batch_iter = gBinRequests.begin();
+  for( ; batch_iter != gBinRequests.end(); ++batch_iter) {
+    vector<EvRequest> & batch = batch_iter->second;
+    vector<EvRequest> kept;
+    for(unsigned int i=0; i<batch.size(); i++) {
+      if(batch[i].sock != sock) kept.push_back(batch[i]);
+    }
+    batch.swap(kept);
+  }
+
+  gMonitor->Remove(sock);
+  sock->Close();
+  delete sock;
+}
+//____________________________________________________________________________
 void Shutdown(void)
 {
   LOG("gevserv", pNOTICE) << "Shutting GENIE event server down ...";
@@ -569,18 +947,87 @@ void Shutdown(void)
   LOG("gevserv", pINFO) << "...done!";
 }
 //____________________________________________________________________________
+void RejectPendingMesgs(TSocket * serv_sock)
+{
+// Called at shutdown, after the queued EVTBIN requests were served: reads the
+// messages the clients have already sent (eg pipelined EVTBIN requests) and
+// rejects them, so that no client is left waiting for a reply.
+
+  gMonitor->Remove(serv_sock);
+
+  while(1) {
+    TList ready;
+    gMonitor->Select(&ready, 0, kDrainTimeout);
+    if(ready.GetSize() == 0) break;
+
+    TIter next(&ready);
+    TSocket * sock = 0;
+    while( (sock = (TSocket *) next()) ) {
+      TMessage * mesg = 0;
+      int nrecv = sock->Recv(mesg);
+      if(nrecv <= 0) {
+        CloseClient(sock);
+        continue;
+      }
+      if(!mesg) continue;
+      if(mesg->What() != kMESS_STRING) { delete mesg; continue; }
+
+      char mesg_content[2048];
+      mesg->ReadString(mesg_content, 2048);
+      delete mesg;
+
+      LOG("gevserv", pNOTICE) << "Rejecting mesg > " << mesg_content;
+
+      gSock = sock;
+      string mesg_str(mesg_content);
+      EvRequest req;
+      if(mesg_str.find(kByeCmdRecv) == 0) {
+        CloseClient(sock);
+      } else
+      if(mesg_str.find(kEvgenBinCmdRecv) != string::npos &&
+         ParseEvRequest(mesg_str, kEvgenBinCmdRecv, req)) {
+        SendBinaryFailure(req);
+      } else {
+        sock->Send(kShutdownOkMesgSent.c_str());
+      }
+      gSock = 0;
+    }
+  }
+}
+//____________________________________________________________________________
+void Initialize(void)
+{
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevserv", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  if(gOptInpXSecFile.size() > 0) {
+    utils::app_init::XSecTable(gOptInpXSecFile, false);
+  }
+
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+}
+//____________________________________________________________________________
 void RunInitChecks(void)
 {
+  if(gOptInpXSecFile.size() > 0) return;
+
   if(gSystem->Getenv("GSPLOAD")) {
     string splines_filename = gSystem->Getenv("GSPLOAD");
     bool is_accessible = ! (gSystem->AccessPathName( splines_filename.c_str() ));
     if (!is_accessible) {
-       LOG("gevserv", pWARN) 
-          << "*** The file (" << splines_filename 
+       LOG("gevserv", pWARN)
+          << "*** The file (" << splines_filename
           << ") specified in $GSPLOAD doesn't seem to be available!";
-       LOG("gevserv", pWARN) 
+       LOG("gevserv", pWARN)
           << "*** Expect a significant start-up overhead!";
-    }     
+    } else {
+       gOptInpXSecFile = splines_filename;
+    }
   } else {
      LOG("gevserv", pWARN) << "*** $GSPLOAD was not set!";
      LOG("gevserv", pWARN) << "*** Expect a significant start-up overhead!";
@@ -591,8 +1038,17 @@ void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gevserv", pNOTICE) << "Parsing command line arguments";
 
+  // Common run options (tune, event generator list, messenger thresholds, ...)
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
   CmdLnArgParser parser(argc,argv);
 
+  // help?
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+
   // port number:
   if( parser.OptionExists('p') ) {
     LOG("gevserv", pINFO) << "Reading port number";
@@ -602,13 +1058,39 @@ void GetCommandLineArgs(int argc, char ** argv)
 	<< "Unspecified port number - Using default (" << kDefPortNum << ")";
     gOptPortNum = kDefPortNum;
   }
+
+  // initial states to configure at start-up:
+  if( parser.OptionExists("nu-list") ) {
+    vector<string> codes = str::Split(parser.ArgAsString("nu-list"), ",");
+    for(unsigned int i=0; i<codes.size(); i++) {
+      gOptNeutrinos.push_back(atoi(codes[i].c_str()));
+    }
+  }
+  if( parser.OptionExists("tgt-list") ) {
+    vector<string> codes = str::Split(parser.ArgAsString("tgt-list"), ",");
+    for(unsigned int i=0; i<codes.size(); i++) {
+      gOptTargets.push_back(atoi(codes[i].c_str()));
+    }
+  }
+
+  // cross section splines:
+  if( parser.OptionExists("cross-sections") ) {
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  }
+
+  // random number seed:
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
 }
 //____________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevserv", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << "   gevserv [-p port] \n";
+    << "   gevserv [-p port] [--nu-list pdg_codes] [--tgt-list pdg_codes] \n"
+    << "           [--cross-sections xml_file] [--seed seed] \n"
+    << "           [--tune tune] [--event-generator-list list] \n"
+    << "           [--message-thresholds xml_file] \n";
 }
 //____________________________________________________________________________
-
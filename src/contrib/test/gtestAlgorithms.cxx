@@ -19,6 +19,7 @@
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgParam.h"
 #include "Physics/QuasiElastic/XSection/QELFormFactorsModelI.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Physics/QuasiElastic/XSection/ELFormFactorsModelI.h"
@@ -28,11 +29,13 @@ using namespace genie;
 
 void testReconfigInCommonPool   (void);
 void testReconfigInOwnedModules (void);
+void testParamHandles           (void);
 
 int main(int /*argc*/, char ** /*argv*/)
 {
   testReconfigInCommonPool();
   testReconfigInOwnedModules();
+  testParamHandles();
 
   return 0;
 }
@@ -143,3 +146,38 @@ void testReconfigInOwnedModules (void)
   LOG("test", pINFO) << *xsecalg;
 }
 //____________________________________________________________________________
+void testParamHandles(void)
+{
+// Test that typed parameter handles pick up a reconfiguration of the
+// algorithm they are accessed with
+
+  AlgFactory * algf = AlgFactory::Instance();
+
+  AlgId id("genie::QELPXSec","CC-Default");
+  Algorithm * alg = algf->AdoptAlgorithm(id);
+  alg->AdoptSubstructure();
+
+  AlgParam<double>       angle  ("CabbiboAngle");
+  AlgParam<double>       nodef  ("NoSuchParameter", -1.);
+  AlgSubAlgParam<QELFormFactorsModelI> ffmodel("FormFactorsAlg");
+
+  LOG("test", pINFO) << "CabbiboAngle    = " << angle.Value(alg);
+  LOG("test", pINFO) << "NoSuchParameter = " << nodef.Value(alg);
+  LOG("test", pINFO) << "FormFactorsAlg  = " << ffmodel.Value(alg)->Id().Key();
+
+  unsigned long generation = alg->ConfigGeneration();
+
+  LOG("test", pINFO) << "Reconfiguring algorithm";
+  Registry r(alg->GetConfig());
+  r.Set("CabbiboAngle", 0.23);
+  alg->Configure(r);
+
+  LOG("test", pINFO) << "Configuration generation changed: "
+                     << (alg->ConfigGeneration() != generation ? "yes" : "NO");
+  LOG("test", pINFO) << "CabbiboAngle    = " << angle.Value(alg)
+                     << (angle.Value(alg) == 0.23 ? "" : "  ** NOT UPDATED **");
+  LOG("test", pINFO) << "FormFactorsAlg  = " << ffmodel.Value(alg)->Id().Key();
+
+  delete alg;
+}
+//____________________________________________________________________________
@@ -0,0 +1,604 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestBenchmarks
+
+\brief   Benchmarks for the most frequently executed parts of GENIE.
+
+         Micro-benchmarks time the following calls on fixed, pre-generated
+         inputs (so that random number generation is not timed):
+         - Spline::Evaluate
+         - BLI2DUnifGrid::Evaluate, BLI2DNonUnifGrid::Evaluate
+         - Interaction::AsString
+         - Registry look-ups
+         - PDGLibrary::Find
+         - XSecAlgorithmI::XSec for representative QEL, RES and DIS models
+         - utils::intranuke2018::MeanFreePath
+         Macro-benchmarks time GEVGDriver::GenerateEvent at fixed initial
+         states. They need pre-computed cross-section splines and are only
+         run if a cross-section file is given.
+
+         Each benchmark is run once to warm up and then repeated a number of
+         times. The minimum and the median wall time per call are reported.
+         The results are written in a JSON file so that they can be compared
+         across releases.
+
+\syntax  gtestBenchmarks
+            [-o output_json_file]
+            [-n scale]
+            [-r repetitions]
+            [--filter name_substring]
+            [--seed random_number_seed]
+            [--cross-sections xml_file]
+            [--event-generator-list list]
+            --tune genie_tune
+
+         [] denotes an optional argument
+         -o  Output JSON file [default: gtestBenchmarks.json]
+         -n  Multiplies the number of calls of each benchmark [default: 1]
+         -r  Number of timed repetitions of each benchmark [default: 5]
+         --filter
+             Run only the benchmarks whose name contains the given string
+         --seed
+             Random number seed [default: 1234]
+         --cross-sections
+             Cross-section splines, needed for the event generation
+             benchmarks
+         --event-generator-list
+             Event generator list used by the event generation benchmarks
+         --tune
+             GENIE tune
+
+\author  The GENIE Collaboration
+
+\created October 18, 2026
+
+\cpright Copyright (c) 2003-2025, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <TSystem.h>
+#include <TDatime.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventGenProfiler.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/BLI2D.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/BaryonResonance.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Registry/Registry.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Physics/HadronTransport/INukeUtils2018.h"
+
+using std::string;
+using std::vector;
+using std::ostringstream;
+
+using namespace genie;
+using namespace genie::constants;
+
+// benchmark results
+struct BenchResult {
+  string   Name;       ///< benchmark name
+  long     NCalls;     ///< number of calls per repetition
+  int      NReps;      ///< number of timed repetitions
+  double   WallMin;    ///< minimum wall time per repetition (s)
+  double   WallMedian; ///< median wall time per repetition (s)
+  double   CpuTotal;   ///< total cpu time over all repetitions (s)
+  double   Checksum;   ///< sum of the benchmarked function outputs
+};
+
+// a benchmarked function: makes n calls and returns the sum of their outputs
+typedef double (*BenchFunc_t) (long n);
+
+void   GetCommandLineArgs (int argc, char ** argv);
+void   PrintSyntax        (void);
+void   Initialize         (void);
+bool   Selected           (string name);
+void   RunBenchmark       (string name, BenchFunc_t func, long ncalls);
+void   WriteResults       (void);
+string JSONString         (const string & s);
+
+// benchmarks
+void   SetupInputs              (void);
+void   SetupXSecAlgorithms      (void);
+double BenchSplineEvaluate      (long n);
+double BenchBLI2DUnifGrid       (long n);
+double BenchBLI2DNonUnifGrid    (long n);
+double BenchInteractionAsString (long n);
+double BenchRegistryGet         (long n);
+double BenchPDGLibraryFind      (long n);
+double BenchXSecQELCC           (long n);
+double BenchXSecRESCC           (long n);
+double BenchXSecDISCC           (long n);
+double BenchMeanFreePath        (long n);
+double BenchGenerateEvent       (long n);
+
+// command-line options
+string gOptOutFilename = "gtestBenchmarks.json";
+double gOptScale       = 1.;
+int    gOptNReps       = 5;
+string gOptFilter      = "";
+long   gOptRanSeed     = 1234;
+string gOptInpXSecFile = "";
+
+vector<BenchResult> gResults;
+
+// pre-generated benchmark inputs
+const int kNInputs = 1000;
+
+vector<double>        gX;            // points in [0,1)
+vector<double>        gY;            // points in [0,1)
+vector<int>           gPdgCodes;     // particle codes
+vector<Interaction *> gInteractions; // interactions of different types
+
+Spline *           gSpline         = 0;
+BLI2DUnifGrid *    gUnifGrid       = 0;
+BLI2DNonUnifGrid * gNonUnifGrid    = 0;
+Registry *         gRegistry       = 0;
+vector<string>     gRegistryKeys;
+
+const XSecAlgorithmI * gXSecQEL = 0;
+const XSecAlgorithmI * gXSecRES = 0;
+const XSecAlgorithmI * gXSecDIS = 0;
+Interaction *          gIntQEL  = 0;
+Interaction *          gIntRES  = 0;
+Interaction *          gIntDIS  = 0;
+
+GEVGDriver *    gEvgDriver = 0;
+TLorentzVector  gNuP4;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc, argv);
+  Initialize();
+  SetupInputs();
+  SetupXSecAlgorithms();
+
+  long n = (long) (gOptScale * 1E5);
+
+  RunBenchmark ( "Spline::Evaluate",             BenchSplineEvaluate,      10*n    );
+  RunBenchmark ( "BLI2DUnifGrid::Evaluate",      BenchBLI2DUnifGrid,       10*n    );
+  RunBenchmark ( "BLI2DNonUnifGrid::Evaluate",   BenchBLI2DNonUnifGrid,    10*n    );
+  RunBenchmark ( "Interaction::AsString",        BenchInteractionAsString, n       );
+  RunBenchmark ( "Registry::Get",                BenchRegistryGet,         10*n    );
+  RunBenchmark ( "PDGLibrary::Find",             BenchPDGLibraryFind,      10*n    );
+  RunBenchmark ( "XSec/LwlynSmithQELCCPXSec",    BenchXSecQELCC,           n       );
+  RunBenchmark ( "XSec/ReinSehgalRESPXSec",      BenchXSecRESCC,           n/10    );
+  RunBenchmark ( "XSec/QPMDISPXSec",             BenchXSecDISCC,           n/10    );
+  RunBenchmark ( "intranuke2018::MeanFreePath",  BenchMeanFreePath,        n       );
+
+  // event generation at fixed initial states
+  if(gOptInpXSecFile.size() == 0) {
+    LOG("gtestBenchmarks", pWARN)
+      << "No cross-section file was given - Skipping event generation benchmarks";
+  }
+  else {
+    const int    nu       = kPdgNuMu;
+    const int    tgt      = 1000060120;
+    const double energy[] = { 1., 10. };
+    for(int ie = 0; ie < 2; ie++) {
+      ostringstream name;
+      name << "GEVGDriver::GenerateEvent/numu_C12_" << energy[ie] << "GeV";
+      if(!Selected(name.str())) continue;
+
+      InitialState init_state(tgt, nu);
+      gEvgDriver = new GEVGDriver;
+      gEvgDriver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      gEvgDriver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+      gEvgDriver->Configure(init_state);
+      gEvgDriver->UseSplines();
+      gNuP4.SetPxPyPzE(0., 0., energy[ie], energy[ie]);
+
+      // restart the random number sequence for each initial state
+      utils::app_init::RandGen(gOptRanSeed);
+
+      RunBenchmark(name.str(), BenchGenerateEvent, TMath::Max(1L, n/1000));
+
+      delete gEvgDriver;
+      gEvgDriver = 0;
+    }
+  }
+
+  WriteResults();
+
+  LOG("gtestBenchmarks", pNOTICE) << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+void Initialize(void)
+{
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::XSecTable(gOptInpXSecFile, false);
+}
+//____________________________________________________________________________
+bool Selected(string name)
+{
+  if(gOptFilter.size() == 0) return true;
+  return (name.find(gOptFilter) != string::npos);
+}
+//____________________________________________________________________________
+void RunBenchmark(string name, BenchFunc_t func, long ncalls)
+{
+  if(!Selected(name)) return;
+
+  ncalls = TMath::Max(1L, ncalls);
+
+  LOG("gtestBenchmarks", pNOTICE)
+    << "Running: " << name << " (" << ncalls << " calls x " << gOptNReps << ")";
+
+  // warm up (fills caches, loads data, configures algorithms)
+  double checksum = func(TMath::Max(1L, ncalls/10));
+
+  vector<double> wall(gOptNReps, 0.);
+  double cpu0 = EventGenProfiler::CpuTime();
+  for(int irep = 0; irep < gOptNReps; irep++) {
+    double t0 = EventGenProfiler::WallTime();
+    checksum += func(ncalls);
+    wall[irep] = EventGenProfiler::WallTime() - t0;
+  }
+  double cpu = EventGenProfiler::CpuTime() - cpu0;
+
+  std::sort(wall.begin(), wall.end());
+
+  BenchResult result;
+  result.Name       = name;
+  result.NCalls     = ncalls;
+  result.NReps      = gOptNReps;
+  result.WallMin    = wall.front();
+  result.WallMedian = wall[gOptNReps/2];
+  result.CpuTotal   = cpu;
+  result.Checksum   = checksum;
+  gResults.push_back(result);
+
+  LOG("gtestBenchmarks", pNOTICE)
+    << name << ": " << 1E9 * result.WallMin / ncalls << " ns/call (min), "
+    << 1E9 * result.WallMedian / ncalls << " ns/call (median)";
+}
+//____________________________________________________________________________
+void WriteResults(void)
+{
+  std::ofstream out(gOptOutFilename.c_str());
+  if(!out) {
+    LOG("gtestBenchmarks", pERROR)
+      << "Could not open output file: " << gOptOutFilename;
+    return;
+  }
+
+  TDatime now;
+  TuneId * tune = RunOpt::Instance()->Tune();
+
+  out << "{\n"
+      << "  \"date\": "     << JSONString(now.AsSQLString())         << ",\n"
+      << "  \"host\": "     << JSONString(gSystem->HostName())       << ",\n"
+      << "  \"tune\": "     << JSONString(tune ? tune->Name() : "")  << ",\n"
+      << "  \"seed\": "     << gOptRanSeed                          << ",\n"
+      << "  \"benchmarks\": [";
+
+  vector<BenchResult>::const_iterator it = gResults.begin();
+  for( ; it != gResults.end(); ++it) {
+    out << ((it == gResults.begin()) ? "\n" : ",\n")
+        << "    { \"name\": "            << JSONString(it->Name)
+        << ", \"calls\": "               << it->NCalls
+        << ", \"repetitions\": "         << it->NReps
+        << ", \"wall_time_min\": "       << it->WallMin
+        << ", \"wall_time_median\": "    << it->WallMedian
+        << ", \"cpu_time\": "            << it->CpuTotal
+        << ", \"ns_per_call_min\": "     << 1E9 * it->WallMin    / it->NCalls
+        << ", \"ns_per_call_median\": "  << 1E9 * it->WallMedian / it->NCalls
+        << ", \"checksum\": "            << it->Checksum
+        << " }";
+  }
+  out << "\n  ]\n}\n";
+
+  LOG("gtestBenchmarks", pNOTICE) << "Results written in: " << gOptOutFilename;
+}
+//____________________________________________________________________________
+string JSONString(const string & s)
+{
+  string out = "\"";
+  for(string::const_iterator c = s.begin(); c != s.end(); ++c) {
+    if      (*c == '"' ) out += "\\\"";
+    else if (*c == '\\') out += "\\\\";
+    else if (*c == '\n') out += "\\n";
+    else                 out += *c;
+  }
+  out += "\"";
+  return out;
+}
+//____________________________________________________________________________
+void SetupInputs(void)
+{
+  RandomGen * rnd = RandomGen::Instance();
+
+  for(int i = 0; i < kNInputs; i++) {
+    gX.push_back(rnd->RndGen().Uniform());
+    gY.push_back(rnd->RndGen().Uniform());
+  }
+
+  // spline on a log-spaced grid, as used for cross-section splines
+  const int nknots = 200;
+  double x[nknots], y[nknots];
+  for(int i = 0; i < nknots; i++) {
+    x[i] = TMath::Power(10., -2. + 4.*i/(nknots-1));
+    y[i] = TMath::Log(1. + x[i]) * TMath::Exp(-0.1*x[i]);
+  }
+  gSpline = new Spline(nknots, x, y);
+
+  // bilinear interpolation grids
+  const int nx = 100;
+  const int ny = 100;
+  gUnifGrid    = new BLI2DUnifGrid    (nx, 0., 1., ny, 0., 1.);
+  gNonUnifGrid = new BLI2DNonUnifGrid (nx, 0., 1., ny, 0., 1.);
+  for(int ix = 0; ix < nx; ix++) {
+    double gx = (double) ix / (nx-1);
+    for(int iy = 0; iy < ny; iy++) {
+      double gy = (double) iy / (ny-1);
+      double gz = TMath::Sin(3*gx) * TMath::Cos(2*gy);
+      gUnifGrid    -> AddPoint(gx, gy, gz);
+      gNonUnifGrid -> AddPoint(gx, gy, gz);
+    }
+  }
+
+  // registry with a size typical of an algorithm configuration
+  gRegistry = new Registry("benchmark", false);
+  for(int i = 0; i < 100; i++) {
+    ostringstream key;
+    key << "Benchmark-Param-" << i;
+    gRegistry->Set(key.str(), (double) i);
+    gRegistryKeys.push_back(key.str());
+  }
+
+  // particle codes
+  const int pdgc[] = {
+    kPdgProton, kPdgNeutron, kPdgPiP, kPdgPiM, kPdgPi0, kPdgKP, kPdgKM,
+    kPdgK0, kPdgLambda, kPdgMuon, kPdgElectron, kPdgNuMu, kPdgGamma,
+    kPdgP33m1232_DeltaPP, 1000060120, 1000080160, 1000260560
+  };
+  const int npdgc = sizeof(pdgc)/sizeof(int);
+  for(int i = 0; i < kNInputs; i++) {
+    gPdgCodes.push_back(pdgc[i % npdgc]);
+  }
+
+  // interactions
+  const int tgt = 1000060120;
+  gInteractions.push_back(Interaction::QELCC (tgt, kPdgNeutron, kPdgNuMu, 1.));
+  gInteractions.push_back(Interaction::RESCC (tgt, kPdgProton,  kPdgNuMu, 1.));
+  gInteractions.push_back(Interaction::DISCC (tgt, kPdgNeutron, kPdgNuMu, 10.));
+  gInteractions.push_back(Interaction::DISNC (tgt, kPdgProton,  kPdgAntiNuMu, 10.));
+  gInteractions[1]->ExclTagPtr()->SetResonance(kP33_1232);
+}
+//____________________________________________________________________________
+void SetupXSecAlgorithms(void)
+{
+  AlgFactory * algf = AlgFactory::Instance();
+
+  gXSecQEL = dynamic_cast<const XSecAlgorithmI *> (
+     algf->GetAlgorithm("genie::LwlynSmithQELCCPXSec", "Default"));
+  gXSecRES = dynamic_cast<const XSecAlgorithmI *> (
+     algf->GetAlgorithm("genie::ReinSehgalRESPXSec", "Default"));
+  gXSecDIS = dynamic_cast<const XSecAlgorithmI *> (
+     algf->GetAlgorithm("genie::QPMDISPXSec", "Default"));
+
+  // free nucleon targets
+  gIntQEL = Interaction::QELCC (kPdgTgtFreeN, kPdgNeutron, kPdgNuMu, 1.);
+  gIntRES = Interaction::RESCC (kPdgTgtFreeP, kPdgProton,  kPdgNuMu, 2.);
+  gIntDIS = Interaction::DISCC (kPdgTgtFreeN, kPdgNeutron, kPdgNuMu, 10.);
+  gIntRES->ExclTagPtr()->SetResonance(kP33_1232);
+}
+//____________________________________________________________________________
+double BenchSplineEvaluate(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    double x = TMath::Power(10., -2. + 4.*gX[i % kNInputs]);
+    sum += gSpline->Evaluate(x);
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchBLI2DUnifGrid(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    sum += gUnifGrid->Evaluate(gX[i % kNInputs], gY[i % kNInputs]);
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchBLI2DNonUnifGrid(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    sum += gNonUnifGrid->Evaluate(gX[i % kNInputs], gY[i % kNInputs]);
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchInteractionAsString(long n)
+{
+  double sum = 0;
+  int ni = gInteractions.size();
+  for(long i = 0; i < n; i++) {
+    sum += gInteractions[i % ni]->AsString().size();
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchRegistryGet(long n)
+{
+  double sum = 0;
+  int nk = gRegistryKeys.size();
+  for(long i = 0; i < n; i++) {
+    RgDbl value = 0;
+    gRegistry->Get(gRegistryKeys[(i * 37) % nk], value);
+    sum += value;
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchPDGLibraryFind(long n)
+{
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    TParticlePDG * p = pdglib->Find(gPdgCodes[i % kNInputs]);
+    if(p) sum += p->Mass();
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchXSecQELCC(long n)
+{
+  if(!gXSecQEL) return 0;
+
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    double Q2 = 0.01 + 1.2 * gX[i % kNInputs];
+    gIntQEL->KinePtr()->SetQ2(Q2);
+    sum += gXSecQEL->XSec(gIntQEL, kPSQ2fE);
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchXSecRESCC(long n)
+{
+  if(!gXSecRES) return 0;
+
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    double W  = 1.1 + 0.3 * gX[i % kNInputs];
+    double Q2 = 0.05 + 1.0 * gY[i % kNInputs];
+    gIntRES->KinePtr()->SetW (W);
+    gIntRES->KinePtr()->SetQ2(Q2);
+    sum += gXSecRES->XSec(gIntRES, kPSWQ2fE);
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchXSecDISCC(long n)
+{
+  if(!gXSecDIS) return 0;
+
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    double x = 0.01 + 0.9 * gX[i % kNInputs];
+    double y = 0.05 + 0.9 * gY[i % kNInputs];
+    gIntDIS->KinePtr()->Setx(x);
+    gIntDIS->KinePtr()->Sety(y);
+    sum += gXSecDIS->XSec(gIntDIS, kPSxyfE);
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchMeanFreePath(long n)
+{
+  const double A = 12;
+  const double Z = 6;
+  const int pdgc[] = { kPdgPiP, kPdgPi0, kPdgProton, kPdgNeutron };
+
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    int    ip   = pdgc[i % 4];
+    double mass = PDGLibrary::Instance()->Find(ip)->Mass();
+    double KE   = 0.05 + 0.95 * gX[i % kNInputs];  // GeV
+    double r    = 4.0 * gY[i % kNInputs];          // fm
+    double E    = KE + mass;
+    double p    = TMath::Sqrt(E*E - mass*mass);
+    TLorentzVector x4(0., 0., r, 0.);
+    TLorentzVector p4(0., 0., p, E);
+    sum += utils::intranuke2018::MeanFreePath(ip, x4, p4, A, Z);
+  }
+  return sum;
+}
+//____________________________________________________________________________
+double BenchGenerateEvent(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    EventRecord * event = gEvgDriver->GenerateEvent(gNuP4);
+    if(!event) continue;
+    sum += event->GetEntries();
+    delete event;
+  }
+  return sum;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gtestBenchmarks", pNOTICE) << "*** Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('o') ) {
+    gOptOutFilename = parser.ArgAsString('o');
+  }
+  if( parser.OptionExists('n') ) {
+    gOptScale = parser.ArgAsDouble('n');
+    if(gOptScale <= 0) {
+      LOG("gtestBenchmarks", pFATAL) << "Invalid scale: " << gOptScale;
+      PrintSyntax();
+      exit(1);
+    }
+  }
+  if( parser.OptionExists('r') ) {
+    gOptNReps = TMath::Max(1, parser.ArgAsInt('r'));
+  }
+  if( parser.OptionExists("filter") ) {
+    gOptFilter = parser.ArgAsString("filter");
+  }
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+  if( parser.OptionExists("cross-sections") ) {
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  }
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gtestBenchmarks", pFATAL) << " No TuneId in RunOption";
+    PrintSyntax();
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gtestBenchmarks", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gtestBenchmarks [-o output.json] [-n scale] [-r repetitions]\n"
+    << "                   [--filter name] [--seed seed]\n"
+    << "                   [--cross-sections xsec.xml]\n"
+    << "                   [--event-generator-list list]\n"
+    << "                   --tune genie_tune\n";
+}
+//____________________________________________________________________________
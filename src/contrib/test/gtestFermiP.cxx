@@ -19,6 +19,8 @@
 
 #include <TFile.h>
 #include <TNtuple.h>
+#include <TH1D.h>
+#include <TString.h>
 #include <TMath.h>
 #include <TVector3.h>
 
@@ -34,7 +36,7 @@ using namespace genie;
 int main(int /*argc*/, char ** /*argv*/)
 {
   const unsigned int kNTargets = 2;
-  const unsigned int kNModels  = 4;
+  const unsigned int kNModels  = 5;
   const unsigned int kNEvents  = 3000;
 
   //-- Get nuclear models
@@ -48,12 +50,15 @@ int main(int /*argc*/, char ** /*argv*/)
               algf->GetAlgorithm("genie::BenharSpectralFunc1D","Default"));
   const NuclearModelI * benhsf2d = 
        dynamic_cast<const NuclearModelI *> (
-                 algf->GetAlgorithm("genie::BenharSpectralFunc","Default"));
+                 algf->GetAlgorithm("genie::SpectralFunc","Default"));
+  const NuclearModelI * benhsf2drj = 
+       dynamic_cast<const NuclearModelI *> (
+                 algf->GetAlgorithm("genie::SpectralFunc","RejectionSampling"));
   const NuclearModelI * effsf = 
        dynamic_cast<const NuclearModelI *> (
                  algf->GetAlgorithm("genie::EffectiveSF","Default"));
 
-  const NuclearModelI * nuclmodel[kNModels] = { bodritch, benhsf1d, benhsf2d, effsf };
+  const NuclearModelI * nuclmodel[kNModels] = { bodritch, benhsf1d, benhsf2d, effsf, benhsf2drj };
 
   //-- Create nuclear targets
   Target * nucltgt[kNTargets];
@@ -86,6 +91,22 @@ int main(int /*argc*/, char ** /*argv*/)
      }//immodels
   }//itargets
 
+  //-- Compare the tabulated and accept/reject spectral function samplers
+  for(unsigned int it = 0; it < kNTargets; it++) {
+     TH1D hp_tab("hp_tab","",50,0.,1.);
+     TH1D hp_rej("hp_rej","",50,0.,1.);
+     TH1D hw_tab("hw_tab","",50,0.,0.5);
+     TH1D hw_rej("hw_rej","",50,0.,0.5);
+     nuclnt->Project("hp_tab","p",Form("target==%d&&model==2",it));
+     nuclnt->Project("hp_rej","p",Form("target==%d&&model==4",it));
+     nuclnt->Project("hw_tab","w",Form("target==%d&&model==2",it));
+     nuclnt->Project("hw_rej","w",Form("target==%d&&model==4",it));
+     LOG("test", pNOTICE)
+        << "SpectralFunc samplers, target " << *nucltgt[it]
+        << ": KS prob(p) = " << hp_tab.KolmogorovTest(&hp_rej)
+        << ", KS prob(w) = " << hw_tab.KolmogorovTest(&hw_rej);
+  }
+
   //-- Save ntuple
   TFile f("./fermip.root","recreate");
   nuclnt->Write();
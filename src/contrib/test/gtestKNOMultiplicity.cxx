@@ -0,0 +1,226 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestKNOMultiplicity
+
+\brief   Regression test for the tabulated hadronic multiplicity sampling of
+         the AGKYLowW2019 KNO hadronizer.
+
+         For a set of initial states and W values, the program compares the
+         stack tables used at event generation time (MultiplicityProb / CDF
+         arrays) with a reference multiplicity probability histogram, built
+         independently here the way the hadronizer used to build it (KNO
+         scaling with the Levy function, normalization and NeuGEN Rijk
+         factors applied on TH1D bins), from the parameters found in the
+         hadronizer configuration. It then generates multiplicities with both
+         TH1::GetRandom() on the reference histogram and
+         AGKYLowW2019::GenerateMultiplicity() starting from the same gRandom
+         state. The two samples must agree event by event.
+
+         Syntax :
+           gtestKNOMultiplicity [-n nevents]
+
+         Options :
+           [] Denotes an optional argument
+           -n  number of multiplicities to generate per (init state, W) point
+
+\author  The GENIE Collaboration
+
+\created October 18, 2026
+
+\cpright Copyright (c) 2003-2025, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include <TH1D.h>
+#include <TMath.h>
+#include <TRandom.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/Controls.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Registry/Registry.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/Hadronization/AGKYLowW2019.h"
+
+using namespace genie;
+using namespace genie::constants;
+using namespace genie::controls;
+
+TH1D * RefMultiplicityProb (const Registry & conf, const Interaction * in);
+
+int main(int argc, char ** argv)
+{
+  int nev = 100000;
+  CmdLnArgParser parser(argc,argv);
+  if( parser.OptionExists('n') ) {
+    nev = parser.ArgAsInt('n');
+  }
+
+  AlgFactory * algf = AlgFactory::Instance();
+  const AGKYLowW2019 * kno =
+       dynamic_cast<const AGKYLowW2019 *> (algf->GetAlgorithm(
+                             "genie::AGKYLowW2019","Default"));
+  if(!kno) {
+    LOG("test", pFATAL) << "Couldn't instantiate the KNO hadronizer";
+    exit(1);
+  }
+
+  const int kNInitStates = 6;
+  Interaction * in[kNInitStates];
+  in[0] = Interaction::DISCC(kPdgTgtFreeP, kPdgProton,  kPdgNuMu,     5.);
+  in[1] = Interaction::DISCC(kPdgTgtFreeN, kPdgNeutron, kPdgNuMu,     5.);
+  in[2] = Interaction::DISCC(kPdgTgtFreeP, kPdgProton,  kPdgAntiNuMu, 5.);
+  in[3] = Interaction::DISCC(kPdgTgtFreeN, kPdgNeutron, kPdgAntiNuMu, 5.);
+  in[4] = Interaction::DISNC(kPdgTgtFreeP, kPdgProton,  kPdgNuMu,     5.);
+  in[5] = Interaction::DISNC(kPdgTgtFreeN, kPdgNeutron, kPdgAntiNuMu, 5.);
+
+  const char * opt = "+LowMultSuppr+Renormalize";
+
+  int nfailed = 0;
+
+  for(int is = 0; is < kNInitStates; is++) {
+    for(double W = 1.2; W < 4.; W += 0.05) {
+
+      in[is]->KinePtr()->SetW(W);
+
+      TH1D * mprob = RefMultiplicityProb(kno->GetConfig(), in[is]);
+      double prob[kMaxKNOMultiplicity];
+      double cdf [kMaxKNOMultiplicity];
+      int nmult  = kno->MultiplicityProb(in[is], opt, prob);
+      int nmultc = kno->MultiplicityCDF (in[is], opt, cdf);
+
+      if(!mprob) {
+        if(nmult>0 || nmultc>0) {
+          LOG("test", pERROR)
+            << "Null histogram but non-empty table @ W = " << W;
+          nfailed++;
+        }
+        continue;
+      }
+
+      // compare the probabilities
+      bool same = (nmult == mprob->GetNbinsX() && nmult == nmultc);
+      for(int i = 0; same && i < nmult; i++) {
+        same = TMath::Abs(prob[i] - mprob->GetBinContent(i+1)) < 1E-12;
+      }
+      if(!same) {
+        LOG("test", pERROR)
+          << "Multiplicity probabilities differ for: "
+          << in[is]->AsString() << " @ W = " << W;
+        nfailed++;
+        delete mprob;
+        continue;
+      }
+
+      // compare the generated multiplicities, event by event
+      UInt_t seed = 1000*is + TMath::Nint(100*W);
+      int ndiff = 0;
+      gRandom->SetSeed(seed);
+      int * mhist = new int[nev];
+      for(int iev = 0; iev < nev; iev++) {
+        mhist[iev] = TMath::Nint( mprob->GetRandom() );
+      }
+      gRandom->SetSeed(seed);
+      for(int iev = 0; iev < nev; iev++) {
+        int mtab = kno->GenerateMultiplicity(cdf, nmultc);
+        if(mtab != mhist[iev]) ndiff++;
+      }
+      delete [] mhist;
+      delete mprob;
+
+      LOG("test", pINFO)
+        << in[is]->AsString() << " @ W = " << W
+        << ": " << ndiff << "/" << nev << " different multiplicities";
+
+      if(ndiff>0) {
+        LOG("test", pERROR)
+          << "Generated multiplicities differ for: "
+          << in[is]->AsString() << " @ W = " << W;
+        nfailed++;
+      }
+    }
+  }
+
+  for(int is = 0; is < kNInitStates; is++) delete in[is];
+
+  if(nfailed>0) {
+    LOG("test", pFATAL) << nfailed << " tests failed!";
+    return 1;
+  }
+  LOG("test", pNOTICE) << "All tests passed";
+  return 0;
+}
+//____________________________________________________________________________
+TH1D * RefMultiplicityProb(const Registry & conf, const Interaction * in)
+{
+// Reference multiplicity probability histogram, computed as in the original
+// (histogram based) AGKYLowW2019 implementation for the "+LowMultSuppr+
+// Renormalize" option. The NeuGEN maximum multiplicity limit is not applied.
+
+  int  nu_pdg  = in->InitState().ProbePdg();
+  bool is_p    = pdg::IsProton(in->InitState().Tgt().HitNucPdg());
+  bool is_nu   = pdg::IsNeutrino(nu_pdg);
+  bool is_CC   = in->ProcInfo().IsWeakCC();
+
+  string sfx = string(is_nu ? "v" : "vb") + (is_p ? "p" : "n");
+
+  double W = in->Kine().W();
+  if(W < kNucleonMass+kPionMass) return 0;
+
+  // average hadronic multiplicity
+  double a = conf.GetDouble("KNO-Alpha-" + sfx);
+  double b = conf.GetDouble("KNO-Beta-"  + sfx);
+  double c = conf.GetDouble("KNO-LevyC-" + sfx);
+  double avn = 1.5 * (a + b * 2*TMath::Log(W));
+
+  // maximum multiplicity
+  double maxmult = TMath::Floor(1 + (W-kNeutronMass)/kPionMass);
+  if(maxmult>18) maxmult=18;
+  if(maxmult<2) return 0;
+
+  int nbins = TMath::Nint(maxmult-1);
+  TH1D * mult_prob = new TH1D("ref_mult_prob",
+       "hadronic multiplicity distribution", nbins, 1.5, maxmult+0.5);
+  mult_prob->SetDirectory(0);
+
+  if(maxmult>2) {
+    for(int i = 1; i <= nbins; i++) {
+       double n    = mult_prob->GetBinCenter(i);
+       double x    = c*n/avn+1;
+       double avnP = 2*TMath::Exp(-c)*TMath::Power(c,x)/TMath::Gamma(x);
+       mult_prob->Fill(n, avnP/avn);
+    }
+  } else {
+    mult_prob->Fill(2,1.);
+  }
+
+  double integral = mult_prob->Integral("width");
+  if(integral<=0) return mult_prob;
+  mult_prob->Scale(1.0/integral);
+
+  // NeuGEN Rijk factors
+  if(W < conf.GetDouble("Wcut")) {
+    string rsfx = sfx + (is_CC ? "-CC" : "-NC");
+    double R2 = conf.GetDouble("DIS-HMultWgt-" + rsfx + "-m2");
+    double R3 = conf.GetDouble("DIS-HMultWgt-" + rsfx + "-m3");
+    for(int i = 1; i <= nbins; i++) {
+      int n = TMath::Nint( mult_prob->GetBinCenter(i) );
+      if      (n==2) mult_prob->SetBinContent(i, R2*mult_prob->GetBinContent(i));
+      else if (n==3) mult_prob->SetBinContent(i, R3*mult_prob->GetBinContent(i));
+    }
+    double norm = mult_prob->Integral("width");
+    if(norm>0) mult_prob->Scale(1.0/norm);
+  }
+
+  return mult_prob;
+}
+//____________________________________________________________________________
@@ -32,12 +32,14 @@
 
 #include <TFile.h>
 #include <TNtuple.h>
+#include <TMath.h>
 
 #include "Framework/AlgorithmAlgFactory.h"
 #include "Framework/Conventions/Units.h"
 #include "Physics/MuonEnergyLoss/MuELossI.h"
 #include "Physics/MuonEnergyLoss/MuELMaterial.h"
 #include "Physics/MuonEnergyLoss/MuELProcess.h"
+#include "Physics/MuonEnergyLoss/TabulatedMuELossModel.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
@@ -82,17 +84,22 @@ int main(int argc, char ** argv)
          dynamic_cast<const MuELossI *> (algf->GetAlgorithm(
                      "genie::mueloss::BezrukovBugaevModel","Default"));
 
+  const TabulatedMuELossModel * tabulated =
+         dynamic_cast<const TabulatedMuELossModel *> (algf->GetAlgorithm(
+                   "genie::mueloss::TabulatedMuELossModel","Default"));
+
   assert ( betheBloch         );
   assert ( petrukhinShestakov );
   assert ( kokoulinPetroukhin );
   assert ( bezroukovBugaev    );
+  assert ( tabulated          );
 
   double myunits_conversion = units::GeV/(units::g/units::cm2); 
   string myunits_name       = " GeV/(gr/cm^2)";
 
   // open a ROOT file and define the output ntuple.
   TFile froot("./genie-mueloss.root", "RECREATE");
-  TNtuple muntp("muntp","muon dE/dx", "material:E:ion:brem:pair:pnucl");
+  TNtuple muntp("muntp","muon dE/dx", "material:E:ion:brem:pair:pnucl:tab:range");
   
   //loop over materials
   vector<string>::iterator iter;
@@ -140,7 +147,21 @@ int main(int argc, char ** argv)
          << " : \n -dE/dx(E=" << E[i] << ") = " << pnucl << myunits_name
          << "\n\n";
 
-       muntp.Fill( (int)mt,E[i],ion,brem,pair,pnucl);
+       // tabulated sum of the above, and CSDA range
+       double tab   = tabulated->dE_dx(E[i],mt) / myunits_conversion;
+       double exact = tabulated->ExactdE_dx(E[i],mt) / myunits_conversion;
+       double range = tabulated->Range(E[i],mt) / (units::g/units::cm2);
+       double rdiff = (exact > 0) ? TMath::Abs(tab/exact - 1) : 0;
+
+       LOG("test", pINFO)
+         << "Model: " << tabulated->Id().Key()
+         << " : \n -dE/dx(E=" << E[i] << ") = " << tab << myunits_name
+         << " (exact: " << exact << myunits_name
+         << ", rel. diff: " << rdiff << ")"
+         << "\n CSDA range = " << range << " gr/cm^2"
+         << "\n\n";
+
+       muntp.Fill( (int)mt,E[i],ion,brem,pair,pnucl,tab,range);
     }//e
   }//m
 